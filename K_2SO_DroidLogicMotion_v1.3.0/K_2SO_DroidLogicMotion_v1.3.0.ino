@@ -53,7 +53,7 @@ CONTROL INTERFACES:
 IR REMOTE LAYOUT:
 ================================================================================
 
-MOVEMENT:        UP/DOWN/LEFT/RIGHT (direct eye positioning), OK (center)
+MOVEMENT:        UP/DOWN/LEFT/RIGHT (hold to jog eyes, accelerates), OK (center)
 PERSONALITY:     1=Scanning(Ice Blue), 2=Alert(Red), 3=Idle(Amber)
 AUDIO:           4=Random Scan, 5=Random Alert, 6=Random Voice
 VISUAL:          *=Color Forward, #=Color Backward, 0=Eyes On/Off
@@ -191,7 +191,7 @@ USE OF THIS CODE CONSTITUTES ACCEPTANCE OF THESE TERMS.
 //========================================
 #include <Arduino.h>
 #include <WiFi.h>
-#include <WebServer.h>
+#include <ESPAsyncWebServer.h>
 #include <ESPmDNS.h>
 #include <ESP32Servo.h>
 #include <Adafruit_NeoPixel.h>
@@ -212,10 +212,18 @@ USE OF THIS CODE CONSTITUTES ACCEPTANCE OF THESE TERMS.
 //========================================
 #include "config.h"       // Base configuration and structures
 #include "Mp3Notify.h"    // MP3 Notification class (needs DFMiniMp3.h)
+#include "audiolink.h"    // DFPlayer link supervisor
 #include "statusled.h"    // Status LED control system
 #include "detailleds.h"   // Detail LED control system (WS2812)
 #include "animations.h"   // LED animations
 #include "sequences.h"    // Sequence recording and playback
+#include "ircombos.h"     // IR button combos
+#include "serialcli.h"    // Serial command line engine
+#include "puppetlink.h"   // Binary PC puppeteering frames
+#include "weblink.h"      // WebSocket control/push channel
+#include "webcontrol.h"   // Async HTTP -> main loop control queue
+#include "webevents.h"    // Server-Sent Events on /events
+#include "metrics.h"      // OpenMetrics registry (/metrics), metered NeoPixels
 #include "webpage.h"      // Web interface
 #include "handlers.h"     // Command handlers
 #include "globals.h"      // Global variables (LAST!)
@@ -231,13 +239,13 @@ const char* standard17Buttons[17] = {
 //========================================
 // HARDWARE OBJECT DEFINITIONS
 //========================================
-Adafruit_NeoPixel leftEye(NUM_EYE_PIXELS, LEFT_EYE_PIN, NEO_GRB + NEO_KHZ800);
-Adafruit_NeoPixel rightEye(NUM_EYE_PIXELS, RIGHT_EYE_PIN, NEO_GRB + NEO_KHZ800);
-Adafruit_NeoPixel statusLED(STATUS_LED_COUNT, STATUS_LED_PIN, NEO_GRB + NEO_KHZ800);
+MeteredNeoPixel leftEye(NUM_EYE_PIXELS, LEFT_EYE_PIN, NEO_GRB + NEO_KHZ800, METRIC_EYE_SHOWS);
+MeteredNeoPixel rightEye(NUM_EYE_PIXELS, RIGHT_EYE_PIN, NEO_GRB + NEO_KHZ800, METRIC_EYE_SHOWS);
+MeteredNeoPixel statusLED(STATUS_LED_COUNT, STATUS_LED_PIN, NEO_GRB + NEO_KHZ800, METRIC_STATUS_SHOWS);
 // Note: detailLEDs NeoPixel object is defined in detailleds.cpp
 HardwareSerial dfSerial(2);
 DFMiniMp3<HardwareSerial, Mp3Notify> mp3(dfSerial);
-WebServer server(80);
+AsyncWebServer server(80);
 Servo eyePanServo;
 Servo eyeTiltServo;
 Servo headPanServo;
@@ -311,6 +319,7 @@ void setup() {
   }
   delay(100);  // Short delay for stability
   uptimeStart = millis();
+  initializeCLI();
 
   Serial.println(F("\n========================================="));
   Serial.println(F("   K-2SO Professional Controller v1.3.0"));
@@ -328,6 +337,7 @@ void setup() {
 
   // Initialize sequence manager (LittleFS)
   sequenceManager.begin();
+  initializeIRCombos();
 
   initializeWiFi();
   setupWebServer();
@@ -351,24 +361,21 @@ void setup() {
 // MAIN LOOP
 //========================================
 void loop() {
-  static unsigned long lastCommandCheck = 0;
   unsigned long currentMillis = millis();
+  unsigned long loopStart = micros();
 
-  // Handle web server requests in both WiFi and AP mode
-  if (WiFi.status() == WL_CONNECTED || WiFi.getMode() == WIFI_AP || WiFi.getMode() == WIFI_AP_STA) {
-    server.handleClient();
-  }
+  // Web requests and WebSocket commands queued by the network task
+  processWebCommands();
+  updateWebLink();          // WebSocket state pushes
+  updateWebEvents();        // Event stream batches
 
-  if (currentMillis - lastCommandCheck > 50) {
-    if (Serial.available()) {
-      String command = Serial.readStringUntil('\n');
-      command.trim();
-      if (command.length() > 0) {
-        processCommand(command);
-      }
-    }
-    lastCommandCheck = currentMillis;
+  // Monitor and demo modes end on any keypress and read Serial themselves
+  if (operatingMode != MODE_MONITOR && operatingMode != MODE_DEMO) {
+    pollSerialCommands();
   }
+  updatePuppetLink();       // Apply latest PC pose, release on silence
+
+  handleSensors();  // Drain queued IR events in every mode
 
   switch (operatingMode) {
     case MODE_NORMAL:      handleNormalOperation(); break;
@@ -384,12 +391,16 @@ void loop() {
   handlePixelAnimations();
   updateSystemStats();
   updateSystemStatus();     // Update status LED system
+  updateAudioLink();        // DFPlayer keepalive and backoff re-probe
   updateStatusLED();        // Handle status LED animations
   sequenceManager.updatePlayback();  // Update sequence playback
+  sequenceManager.updateCacheWarm(); // Load newly mapped sequences into PSRAM
 
   if (!bootSequenceComplete) {
     handleBootSequence(currentMillis);
   }
+
+  metricObserve(METRIC_LOOP_TIME, micros() - loopStart);
 }
 
 //========================================
@@ -426,7 +437,7 @@ void initializeHardware() {
   while (attempts < maxAttempts && fileCount == 0) {
     mp3.loop();
     delay(150);  // Reduced from 300ms to 150ms
-    fileCount = mp3.getTotalTrackCount();
+    fileCount = audioGetTotalTrackCount();
     attempts++;
     if (fileCount == 0 && attempts < maxAttempts) {
       Serial.printf("- DFPlayer attempt %d/%d\n", attempts, maxAttempts);
@@ -435,14 +446,21 @@ void initializeHardware() {
 
   if (fileCount > 0) {
     isAudioReady = true;
-    mp3.setVolume(config.savedVolume);
+    audioSetVolume(config.savedVolume);
     Serial.printf("- DFPlayer: OK (%d files found)\n", fileCount);
+  } else if (audioLastQueryAnswered()) {
+    Serial.println(F("- DFPlayer: OK, but no tracks on SD card"));
+    statusLEDError(); // NEW: Show error on status LED
   } else {
-    Serial.println(F("- DFPlayer: Not ready or no SD card"));
-    Serial.println(F("  Note: Audio will retry during boot sequence"));
+    Serial.println(F("- DFPlayer: Not responding"));
+    Serial.println(F("  Note: Audio link will be re-probed in the background"));
     statusLEDError(); // NEW: Show error on status LED
   }
 
+  // Link supervisor keeps retrying in the background with backoff.
+  // An empty card is a working link; the keepalive notices tracks later.
+  initializeAudioLink(fileCount > 0 || audioLastQueryAnswered());
+
   initializeIR();
 }
 
@@ -660,7 +678,7 @@ void handleTriggerWakeup() {
   // Wake up message
   isAwake = true;
 
-  server.send(200, F("text/plain"), F("K2SO activated - Scanning mode"));
+  webRequest.send(200, F("text/plain"), F("K2SO activated - Scanning mode"));
   Serial.println(F("[VOICE] K2SO activated"));
 }
 
@@ -682,7 +700,7 @@ void handleTriggerStandby() {
   uint32_t dimBlue = Adafruit_NeoPixel::Color(30, 70, 120);
   setEyeColor(dimBlue, dimBlue);
 
-  server.send(200, F("text/plain"), F("K2SO standby mode"));
+  webRequest.send(200, F("text/plain"), F("K2SO standby mode"));
   Serial.println(F("[VOICE] Standby mode active"));
 }
 
@@ -710,7 +728,7 @@ void handleTriggerSleep() {
   statusLED.setPixelColor(0, 0, 0, 0);
   statusLED.show();
 
-  server.send(200, F("text/plain"), F("K2SO sleep mode"));
+  webRequest.send(200, F("text/plain"), F("K2SO sleep mode"));
   Serial.println(F("[VOICE] Sleep mode - all systems off"));
 }
 
@@ -723,7 +741,7 @@ void handleTriggerDemo() {
   // Start demo mode
   enterDemoMode();
 
-  server.send(200, F("text/plain"), F("K2SO demo started"));
+  webRequest.send(200, F("text/plain"), F("K2SO demo started"));
   Serial.println(F("[VOICE] Demo mode started"));
 }
 
@@ -735,10 +753,10 @@ void handleTriggerSpeak() {
 
   if (isAudioReady) {
     playRandomSound(4); // Voice lines folder
-    server.send(200, F("text/plain"), F("K2SO speaking"));
+    webRequest.send(200, F("text/plain"), F("K2SO speaking"));
     Serial.println(F("[VOICE] Playing random voice line"));
   } else {
-    server.send(503, F("text/plain"), F("Audio system not ready"));
+    webRequest.send(503, F("text/plain"), F("Audio system not ready"));
     Serial.println(F("[VOICE] Audio not available"));
   }
 }
@@ -763,7 +781,7 @@ void handleTriggerAlert() {
     playRandomSound(2); // Alert sounds folder
   }
 
-  server.send(200, F("text/plain"), F("K2SO alert mode activated"));
+  webRequest.send(200, F("text/plain"), F("K2SO alert mode activated"));
   Serial.println(F("[VOICE] Alert mode active"));
 }
 
@@ -776,7 +794,7 @@ void handleTriggerScanner() {
   // Start scanner animation
   startScannerMode();
 
-  server.send(200, F("text/plain"), F("K2SO scanner animation"));
+  webRequest.send(200, F("text/plain"), F("K2SO scanner animation"));
   Serial.println(F("[VOICE] Scanner animation active"));
 }
 
@@ -798,7 +816,7 @@ void handleTriggerAlarm() {
     playRandomSound(2); // Alert sounds
   }
 
-  server.send(200, F("text/plain"), F("K2SO alarm activated"));
+  webRequest.send(200, F("text/plain"), F("K2SO alarm activated"));
   Serial.println(F("[VOICE] Alarm mode active"));
 }
 
@@ -811,7 +829,7 @@ void handleTriggerCenter() {
   // Center all servos
   centerAllServos();
 
-  server.send(200, F("text/plain"), F("K2SO servos centered"));
+  webRequest.send(200, F("text/plain"), F("K2SO servos centered"));
   Serial.println(F("[VOICE] All servos centered"));
 }
 
@@ -837,7 +855,7 @@ void handleTriggerPatrol() {
     playRandomSound(1);
   }
 
-  server.send(200, F("text/plain"), F("K2SO patrol mode"));
+  webRequest.send(200, F("text/plain"), F("K2SO patrol mode"));
   Serial.println(F("[VOICE] Patrol mode - active scanning"));
 }
 
@@ -847,69 +865,94 @@ void setupWebServer() {
     return;
   }
 
-  server.on("/", handleRoot);
-  server.on("/status", handleWebStatus);
-  server.on("/setServos", handleSetServos);
-  server.on("/red", handleRed);
-  server.on("/green", handleGreen);
-  server.on("/blue", handleBlue);
-  server.on("/white", handleWhite);
-  server.on("/off", handleOff);
-  server.on("/brightness", handleBrightness);
-  server.on("/volume", handleVolume);
-  server.on("/flicker", handleFlicker);
-  server.on("/pulse", handlePulse);
-  server.on("/playSound", handlePlaySound);
-  server.on("/mode", handleWebMode);
+  // Routes survive server.end()/begin(), so a WiFi reconnect only restarts
+  // the listener
+  static bool routesRegistered = false;
+  if (routesRegistered) {
+    server.begin();
+    Serial.println(F("Web server restarted"));
+    return;
+  }
+  initializeWebControl();
+
+  // Everything except the static UI files runs on the main loop via the
+  // control queue (webcontrol.h)
+  registerWebAssetRoutes();  // "/", style.css, app.js
+  onWeb("/ws/info", handleWebLinkInfo);
+  onWeb("/status", handleWebStatus);
+  onWeb("/metrics", handleMetrics);
+  onWeb("/setServos", handleSetServos);
+  onWeb("/red", handleRed);
+  onWeb("/green", handleGreen);
+  onWeb("/blue", handleBlue);
+  onWeb("/white", handleWhite);
+  onWeb("/off", handleOff);
+  onWeb("/brightness", handleBrightness);
+  onWeb("/volume", handleVolume);
+  onWeb("/flicker", handleFlicker);
+  onWeb("/pulse", handlePulse);
+  onWeb("/playSound", handlePlaySound);
+  onWeb("/audio/health", handleAudioHealth);
+  onWeb("/mode", handleWebMode);
+  onWeb("/batch", HTTP_POST, handleBatch);
+  onWeb("/state", handleState);
+  onWeb("/state/save", handleStateSave);
+  onWeb("/state/recall", handleStateRecall);
+  onWeb("/state/slots", handleStateSlots);
+  onWeb("/state/list", handleStateList);
+  onWeb("/state/delete", handleStateDelete);
 
   // Detail LED web handlers
-  server.on("/detailCount", handleDetailCount);
-  server.on("/detailBrightness", handleDetailBrightnessWeb);
-  server.on("/detailPattern", handleDetailPatternWeb);
-  server.on("/detailEnabled", handleDetailEnabledWeb);
+  onWeb("/detailCount", handleDetailCount);
+  onWeb("/detailBrightness", handleDetailBrightnessWeb);
+  onWeb("/detailPattern", handleDetailPatternWeb);
+  onWeb("/detailEnabled", handleDetailEnabledWeb);
 
   // Sequence web handlers
-  server.on("/seq/list", handleSeqList);
-  server.on("/seq/play", handleSeqPlay);
-  server.on("/seq/stop", handleSeqStop);
-  server.on("/seq/pause", handleSeqPause);
-  server.on("/seq/resume", handleSeqResume);
-  server.on("/seq/loop", handleSeqLoop);
-  server.on("/seq/delete", handleSeqDelete);
-  server.on("/seq/verify", handleSeqVerify);
-  server.on("/seq/verify-all", handleSeqVerifyAll);
-  server.on("/seq/stats", handleSeqStats);
-  server.on("/seq/duplicate", handleSeqDuplicate);
-  server.on("/seq/export", handleSeqExport);
-  server.on("/seq/import", HTTP_POST, handleSeqImport);
-  server.on("/seq/playlist/add", handleSeqPlaylistAdd);
-  server.on("/seq/playlist/remove", handleSeqPlaylistRemove);
-  server.on("/seq/playlist/move", handleSeqPlaylistMove);
-  server.on("/seq/playlist/save", handleSeqPlaylistSave);
-  server.on("/seq/playlist/load", handleSeqPlaylistLoad);
-  server.on("/seq/playlist/list", handleSeqPlaylistList);
-  server.on("/seq/playlist/clear", handleSeqPlaylistClear);
-  server.on("/seq/playlist/play", handleSeqPlaylistPlay);
-  server.on("/seq/playlist/loop", handleSeqPlaylistLoop);
-  server.on("/seq/playlist/get", handleSeqPlaylistGet);
-  server.on("/seq/map/list", handleSeqMapList);
-  server.on("/seq/map/set", handleSeqMapSet);
-  server.on("/seq/map/clear", handleSeqMapClear);
+  onWeb("/seq/list", handleSeqList);
+  onWeb("/seq/play", handleSeqPlay);
+  onWeb("/seq/stop", handleSeqStop);
+  onWeb("/seq/pause", handleSeqPause);
+  onWeb("/seq/resume", handleSeqResume);
+  onWeb("/seq/loop", handleSeqLoop);
+  onWeb("/seq/delete", handleSeqDelete);
+  onWeb("/seq/verify", handleSeqVerify);
+  onWeb("/seq/verify-all", handleSeqVerifyAll);
+  onWeb("/seq/stats", handleSeqStats);
+  onWeb("/seq/duplicate", handleSeqDuplicate);
+  onWeb("/seq/export", handleSeqExport);
+  onWebStream("/seq/import", createSequenceImportSink, handleSeqImport);
+  onWeb("/seq/playlist/add", handleSeqPlaylistAdd);
+  onWeb("/seq/playlist/remove", handleSeqPlaylistRemove);
+  onWeb("/seq/playlist/move", handleSeqPlaylistMove);
+  onWeb("/seq/playlist/save", handleSeqPlaylistSave);
+  onWeb("/seq/playlist/load", handleSeqPlaylistLoad);
+  onWeb("/seq/playlist/list", handleSeqPlaylistList);
+  onWeb("/seq/playlist/clear", handleSeqPlaylistClear);
+  onWeb("/seq/playlist/play", handleSeqPlaylistPlay);
+  onWeb("/seq/playlist/loop", handleSeqPlaylistLoop);
+  onWeb("/seq/playlist/get", handleSeqPlaylistGet);
+  onWeb("/seq/map/list", handleSeqMapList);
+  onWeb("/seq/map/set", handleSeqMapSet);
+  onWeb("/seq/map/clear", handleSeqMapClear);
 
   // Voice Assistant Trigger Endpoints (Google Home, Alexa via IFTTT)
-  server.on("/trigger/wakeup", handleTriggerWakeup);
-  server.on("/trigger/standby", handleTriggerStandby);
-  server.on("/trigger/sleep", handleTriggerSleep);
-  server.on("/trigger/demo", handleTriggerDemo);
-  server.on("/trigger/speak", handleTriggerSpeak);
-  server.on("/trigger/alert", handleTriggerAlert);
-  server.on("/trigger/scanner", handleTriggerScanner);
-  server.on("/trigger/alarm", handleTriggerAlarm);
-  server.on("/trigger/center", handleTriggerCenter);
-  server.on("/trigger/patrol", handleTriggerPatrol);
-
-  server.onNotFound(handleNotFound);
+  onWeb("/trigger/wakeup", handleTriggerWakeup);
+  onWeb("/trigger/standby", handleTriggerStandby);
+  onWeb("/trigger/sleep", handleTriggerSleep);
+  onWeb("/trigger/demo", handleTriggerDemo);
+  onWeb("/trigger/speak", handleTriggerSpeak);
+  onWeb("/trigger/alert", handleTriggerAlert);
+  onWeb("/trigger/scanner", handleTriggerScanner);
+  onWeb("/trigger/alarm", handleTriggerAlarm);
+  onWeb("/trigger/center", handleTriggerCenter);
+  onWeb("/trigger/patrol", handleTriggerPatrol);
+
+  onWebNotFound(handleNotFound);
+  initializeWebLink();       // WebSocket handler on /ws
+  initializeWebEvents();     // Event stream on /events
   server.begin();
+  routesRegistered = true;
   Serial.println(F("Web server started"));
   Serial.println(F("Voice triggers: /trigger/[wakeup|standby|sleep|demo|speak|alert|scanner|alarm|center|patrol]"));
 }
@@ -6,15 +6,20 @@
 
 #include "Mp3Notify.h"
 #include "globals.h"   // Include for access to global objects like 'mp3'
+#include "audiolink.h" // Link supervisor error accounting
+#include "webevents.h" // Audio finished -> event stream
 
 void Mp3Notify::OnError(DFMiniMp3<HardwareSerial, Mp3Notify>& mp3, uint16_t errorCode) {
     Serial.print("DFPlayer Error: ");
     Serial.println(errorCode);
-    isAudioReady = false;
+
+    // Supervisor attributes the error and decides whether the link is down
+    audioLinkReportError(errorCode);
 }
 
 void Mp3Notify::OnPlayFinished(DFMiniMp3<HardwareSerial, Mp3Notify>& mp3, DfMp3_PlaySources source, uint16_t track) {
     Serial.printf("Track %d finished from source %d\n", track, (int)source);
+    postWebEvent(WEB_EVENT_AUDIO, "{\"state\":\"finished\",\"track\":%u}", track);
 
     if (isAudioReady && isAwake) {
         // Schedule next random sound with configured pause time
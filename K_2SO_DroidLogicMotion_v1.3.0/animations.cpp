@@ -10,6 +10,7 @@
 #include "animations.h"   // DANN custom
 #include "config.h"
 #include "globals.h"      // For activeEyeLEDCount and other globals
+#include "metrics.h"      // For MeteredNeoPixel (leftEye/rightEye)
 
 //========================================
 // GLOBAL ANIMATION STATE
@@ -158,8 +159,14 @@ void setEyeBrightness(uint8_t brightness) {
   rightEye.show();
 }
 
+// Both changes go out with a single show()
 void setEyeColorAndBrightness(uint32_t leftColor, uint32_t rightColor, uint8_t brightness) {
-  setEyeBrightness(brightness);
+  currentBrightness = brightness;
+  animState.baseBrightness = brightness;
+  leftEye.setBrightness(brightness);
+  rightEye.setBrightness(brightness);
+
+  leftEyeCurrentColor = ~leftColor;  // Force the redraw, brightness changed
   setEyeColor(leftColor, rightColor);
 }
 
@@ -76,9 +76,9 @@ struct AnimationState {
 //========================================
 
 // Hardware references (defined in main file - forward declared here)
-class Adafruit_NeoPixel;
-extern Adafruit_NeoPixel leftEye;
-extern Adafruit_NeoPixel rightEye;
+class MeteredNeoPixel;
+extern MeteredNeoPixel leftEye;
+extern MeteredNeoPixel rightEye;
 
 // External variables (defined in main file)
 extern PixelMode currentPixelMode;
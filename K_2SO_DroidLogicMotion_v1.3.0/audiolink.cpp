@@ -0,0 +1,387 @@
+/*
+================================================================================
+// K-2SO Controller DFPlayer Link Supervisor Implementation
+// Times every DFPlayer command, attributes errors/timeouts to the command in
+// flight and re-probes a lost link with exponential backoff
+================================================================================
+*/
+
+#include <Arduino.h>
+#include <DFMiniMp3.h>
+#include "audiolink.h"
+#include "config.h"
+#include "statusled.h"    // For statusLEDAudioActivity on recovery
+#include "webevents.h"    // For postWebEvent
+#include "metrics.h"      // For the round trip histogram
+#include "sequences.h"    // Probes are deferred during sequence playback
+#include "globals.h"
+
+AudioLinkState audioLink;
+static bool queryLinkError = false;  // Link error reported during the last query
+
+//========================================
+// INTERNAL HELPERS
+//========================================
+
+static const char* const audioCommandNames[AUDIO_CMD_COUNT] = {
+  "probe", "folderCount", "play", "volume", "stop"
+};
+
+// Errors that say nothing about the link itself: missing/invalid file and
+// transient device states (busy, sleeping, advertising). Only reply timeouts,
+// packet and checksum errors mean the player stopped talking to us.
+static bool isContentError(uint16_t errorCode) {
+  return errorCode == DfMp3_Error_FileIndexOut ||
+         errorCode == DfMp3_Error_FileMismatch ||
+         errorCode == DfMp3_Error_Busy ||
+         errorCode == DfMp3_Error_Sleeping ||
+         errorCode == DfMp3_Error_Advertise;
+}
+
+// Only queries wait for the player's reply; play/volume/stop return once sent
+static bool commandAwaitsReply(AudioLinkCommand cmd) {
+  return cmd == AUDIO_CMD_PROBE || cmd == AUDIO_CMD_FOLDER_COUNT;
+}
+
+static void beginAudioCommand(AudioLinkCommand cmd, unsigned long& startMicros) {
+  audioLink.commandActive = true;
+  audioLink.activeCommand = cmd;
+  audioLink.commands[cmd].calls++;
+  audioLink.lastCommandTime = millis();
+  queryLinkError = false;
+  startMicros = micros();
+}
+
+static void endAudioCommand(AudioLinkCommand cmd, unsigned long startMicros) {
+  uint32_t elapsed = (uint32_t)(micros() - startMicros);
+  if (commandAwaitsReply(cmd)) {
+    metricObserve(METRIC_DFPLAYER_RTT, elapsed);
+  }
+  AudioCommandStats& stats = audioLink.commands[cmd];
+  stats.lastLatencyUs = elapsed;
+  stats.totalLatencyUs += elapsed;
+  if (elapsed > stats.maxLatencyUs) {
+    stats.maxLatencyUs = elapsed;
+  }
+  audioLink.commandActive = false;
+}
+
+static void markLinkDown(const char* reason) {
+  if (audioLink.linkDown) {
+    return;
+  }
+
+  audioLink.linkDown = true;
+  audioLink.downSince = millis();
+  audioLink.retryDelay = AUDIO_LINK_RETRY_BASE_MS;
+  audioLink.nextProbeTime = audioLink.downSince + audioLink.retryDelay;
+  audioLink.probeAttempts = 0;
+  audioLink.linkDrops++;
+
+  Serial.printf("⚠️ DFPlayer link lost (%s) - re-probing in %lu ms\n",
+                reason, audioLink.retryDelay);
+}
+
+static void markLinkUp() {
+  if (!audioLink.linkDown) {
+    return;
+  }
+
+  unsigned long downtime = millis() - audioLink.downSince;
+  audioLink.totalDowntimeMs += downtime;
+  audioLink.linkDown = false;
+  audioLink.probingParked = false;
+  audioLink.recoveries++;
+
+  Serial.printf("✓ DFPlayer link recovered after %u probe(s), %lu ms offline\n",
+                audioLink.probeAttempts, downtime);
+}
+
+// Probe the DFPlayer with a track count query. Returns true if the player
+// answered at all - an empty or missing card still means a working link.
+// Note: a dead link blocks for the library reply timeout, hence the backoff
+// and the deferral while a sequence is driving the servos.
+static bool probeAudioLink(uint16_t& trackCount) {
+  mp3.loop();  // Drain pending notifications before the query
+  trackCount = audioGetTotalTrackCount();
+  return audioLastQueryAnswered();
+}
+
+// Card found by a probe - bring audio back at the saved volume
+static void restoreAudioReady(uint16_t trackCount) {
+  if (isAudioReady || trackCount == 0) {
+    return;
+  }
+  isAudioReady = true;
+  audioSetVolume(config.savedVolume);
+  statusLEDAudioActivity();
+}
+
+//========================================
+// SUPERVISOR LIFECYCLE
+//========================================
+
+// Runs after the boot probes: their command stats and errors are kept
+// (audioLink starts zeroed as a global), only the link state is seeded
+void initializeAudioLink(bool linkUp) {
+  audioLink.commandActive = false;
+  audioLink.linkDown = false;
+  audioLink.probingParked = false;
+  audioLink.probeAttempts = 0;
+  audioLink.retryDelay = AUDIO_LINK_RETRY_BASE_MS;
+  audioLink.nextProbeTime = 0;
+  audioLink.lastKeepalive = millis();
+  audioLink.everUp = linkUp;
+
+  if (!linkUp) {
+    markLinkDown("not detected at startup");
+  }
+}
+
+void resetAudioLinkStats() {
+  memset(audioLink.commands, 0, sizeof(audioLink.commands));
+  audioLink.asyncErrors = 0;
+  audioLink.lastErrorCode = 0;
+  audioLink.lastErrorTime = 0;
+  audioLink.linkDrops = 0;
+  audioLink.recoveries = 0;
+  audioLink.totalDowntimeMs = 0;
+
+  // A reset is also the manual way to retry a player that was never found
+  if (audioLink.probingParked) {
+    audioLink.probingParked = false;
+    audioLink.probeAttempts = 0;
+    audioLink.retryDelay = AUDIO_LINK_RETRY_BASE_MS;
+    audioLink.nextProbeTime = millis();
+  }
+}
+
+bool audioLastQueryAnswered() {
+  return !queryLinkError;
+}
+
+void audioLinkReportError(uint16_t errorCode) {
+  audioLink.lastErrorCode = errorCode;
+  audioLink.lastErrorTime = millis();
+
+  if (audioLink.commandActive) {
+    AudioCommandStats& stats = audioLink.commands[audioLink.activeCommand];
+    if (errorCode == DfMp3_Error_RxTimeout) {
+      stats.timeouts++;
+    } else {
+      stats.errors++;
+    }
+  } else {
+    audioLink.asyncErrors++;
+  }
+
+  if (isContentError(errorCode)) {
+    return;  // Bad file request or busy player - link is fine
+  }
+
+  if (audioLink.commandActive) {
+    queryLinkError = true;
+  }
+  isAudioReady = false;
+  isWaitingForNextTrack = false;
+  markLinkDown(errorCode == DfMp3_Error_RxTimeout ? "reply timeout" : "device error");
+}
+
+void updateAudioLink() {
+  unsigned long now = millis();
+
+  // A notification that found tracks (card inserted/online) proves the link.
+  // A removed card only clears isAudioReady - the player itself is still there.
+  if (isAudioReady && audioLink.linkDown) {
+    markLinkUp();
+  }
+
+  // Every probe blocks for the reply (or the library timeout on a dead link),
+  // so never run one while a sequence is playing or recording servo motion
+  if (sequenceManager.isPlaying() || sequenceManager.isRecording()) {
+    return;
+  }
+
+  if (audioLink.linkDown) {
+    if (audioLink.probingParked || (long)(now - audioLink.nextProbeTime) < 0) {
+      return;
+    }
+
+    audioLink.probeAttempts++;
+    uint16_t trackCount = 0;
+    if (probeAudioLink(trackCount)) {
+      audioLink.everUp = true;
+      markLinkUp();
+      restoreAudioReady(trackCount);
+      if (trackCount == 0) {
+        Serial.println(F("⚠️ DFPlayer answered but reports no tracks - check the SD card"));
+      }
+      return;
+    }
+
+    // No DFPlayer fitted: stop paying for probe timeouts once the backoff has run out
+    if (!audioLink.everUp && audioLink.probeAttempts >= AUDIO_LINK_COLD_PROBES) {
+      audioLink.probingParked = true;
+      Serial.printf("⚠️ DFPlayer not found after %u probes - probing paused ('sound health reset' retries)\n",
+                    audioLink.probeAttempts);
+      return;
+    }
+
+    // Still dead - double the delay up to the ceiling
+    audioLink.retryDelay = min(audioLink.retryDelay * 2, (unsigned long)AUDIO_LINK_RETRY_MAX_MS);
+    audioLink.nextProbeTime = millis() + audioLink.retryDelay;
+    Serial.printf("DFPlayer probe %u failed - next attempt in %lu ms\n",
+                  audioLink.probeAttempts, audioLink.retryDelay);
+    return;
+  }
+
+  // Link is up: periodic keepalive so a silently dead player is noticed
+  // before the next sound is requested. Skipped while commands are flowing.
+  if (now - audioLink.lastKeepalive >= AUDIO_LINK_KEEPALIVE_MS &&
+      now - audioLink.lastCommandTime >= AUDIO_LINK_KEEPALIVE_QUIET_MS) {
+    audioLink.lastKeepalive = now;
+    uint16_t trackCount = 0;
+    if (!probeAudioLink(trackCount)) {
+      isAudioReady = false;
+      isWaitingForNextTrack = false;
+      markLinkDown("keepalive failed");
+      return;
+    }
+    restoreAudioReady(trackCount);  // Card swapped in without a notification
+  }
+}
+
+//========================================
+// SUPERVISED DFPLAYER COMMANDS
+//========================================
+
+uint16_t audioGetTotalTrackCount() {
+  unsigned long start;
+  beginAudioCommand(AUDIO_CMD_PROBE, start);
+  uint16_t count = mp3.getTotalTrackCount();
+  endAudioCommand(AUDIO_CMD_PROBE, start);
+  return count;
+}
+
+uint16_t audioGetFolderTrackCount(uint8_t folder) {
+  unsigned long start;
+  beginAudioCommand(AUDIO_CMD_FOLDER_COUNT, start);
+  uint16_t count = mp3.getFolderTrackCount(folder);
+  endAudioCommand(AUDIO_CMD_FOLDER_COUNT, start);
+  return count;
+}
+
+void audioPlayFolderTrack(uint8_t folder, uint8_t track) {
+  unsigned long start;
+  beginAudioCommand(AUDIO_CMD_PLAY, start);
+  mp3.playFolderTrack(folder, track);
+  endAudioCommand(AUDIO_CMD_PLAY, start);
+  postWebEvent(WEB_EVENT_AUDIO, "{\"state\":\"playing\",\"folder\":%u,\"track\":%u}", folder, track);
+}
+
+void audioSetVolume(uint8_t volume) {
+  unsigned long start;
+  beginAudioCommand(AUDIO_CMD_VOLUME, start);
+  mp3.setVolume(volume);
+  endAudioCommand(AUDIO_CMD_VOLUME, start);
+}
+
+void audioStop() {
+  unsigned long start;
+  beginAudioCommand(AUDIO_CMD_STOP, start);
+  mp3.stop();
+  endAudioCommand(AUDIO_CMD_STOP, start);
+}
+
+//========================================
+// REPORTING
+//========================================
+
+const char* getAudioLinkCommandName(AudioLinkCommand cmd) {
+  if (cmd >= AUDIO_CMD_COUNT) {
+    return "unknown";
+  }
+  return audioCommandNames[cmd];
+}
+
+void printAudioLinkStats() {
+  unsigned long now = millis();
+
+  Serial.println(F("\n=== DFPLAYER LINK HEALTH ==="));
+  Serial.printf("Link: %s\n", audioLink.linkDown ? "DOWN" : "UP");
+  if (audioLink.linkDown) {
+    Serial.printf("Offline for: %lu ms\n", now - audioLink.downSince);
+    if (audioLink.probingParked) {
+      Serial.printf("Probe attempts: %u (paused - 'sound health reset' retries)\n",
+                    audioLink.probeAttempts);
+    } else {
+      Serial.printf("Probe attempts: %u (next in %ld ms)\n",
+                    audioLink.probeAttempts, (long)(audioLink.nextProbeTime - now));
+    }
+  }
+  Serial.printf("Link drops: %lu, recoveries: %lu, total downtime: %lu ms\n",
+                (unsigned long)audioLink.linkDrops,
+                (unsigned long)audioLink.recoveries,
+                audioLink.totalDowntimeMs);
+  if (audioLink.lastErrorTime > 0) {
+    Serial.printf("Last error: code %u, %lu ms ago\n",
+                  audioLink.lastErrorCode, now - audioLink.lastErrorTime);
+  }
+  Serial.printf("Async errors: %lu\n", (unsigned long)audioLink.asyncErrors);
+
+  Serial.println(F("\nCommand       Calls  Errors  Timeouts  Last(us)  Avg(us)  Max(us)  Time"));
+  Serial.println(F("-------------------------------------------------------------------------"));
+  for (int i = 0; i < AUDIO_CMD_COUNT; i++) {
+    const AudioCommandStats& stats = audioLink.commands[i];
+    unsigned long avg = stats.calls > 0 ? (unsigned long)(stats.totalLatencyUs / stats.calls) : 0;
+    Serial.printf("%-12s %6lu %7lu %9lu %9lu %8lu %8lu  %s\n",
+                  audioCommandNames[i],
+                  (unsigned long)stats.calls,
+                  (unsigned long)stats.errors,
+                  (unsigned long)stats.timeouts,
+                  (unsigned long)stats.lastLatencyUs,
+                  avg,
+                  (unsigned long)stats.maxLatencyUs,
+                  commandAwaitsReply((AudioLinkCommand)i) ? "rtt" : "send");
+  }
+  Serial.println(F("rtt = round trip to the player's reply, send = fire-and-forget write time"));
+}
+
+String getAudioLinkStatsJson() {
+  unsigned long now = millis();
+
+  String json = "\"linkUp\":";
+  json += audioLink.linkDown ? "false" : "true";
+  json += ",\"audioReady\":";
+  json += isAudioReady ? "true" : "false";
+  json += ",\"downForMs\":" + String(audioLink.linkDown ? now - audioLink.downSince : 0UL);
+  json += ",\"probeAttempts\":" + String(audioLink.probeAttempts);
+  json += ",\"retryDelayMs\":" + String(audioLink.retryDelay);
+  json += ",\"probingPaused\":";
+  json += audioLink.probingParked ? "true" : "false";
+  json += ",\"linkDrops\":" + String((unsigned long)audioLink.linkDrops);
+  json += ",\"recoveries\":" + String((unsigned long)audioLink.recoveries);
+  json += ",\"totalDowntimeMs\":" + String(audioLink.totalDowntimeMs);
+  json += ",\"asyncErrors\":" + String((unsigned long)audioLink.asyncErrors);
+  json += ",\"lastErrorCode\":" + String(audioLink.lastErrorCode);
+  json += ",\"commands\":{";
+  for (int i = 0; i < AUDIO_CMD_COUNT; i++) {
+    const AudioCommandStats& stats = audioLink.commands[i];
+    unsigned long avg = stats.calls > 0 ? (unsigned long)(stats.totalLatencyUs / stats.calls) : 0;
+    if (i > 0) json += ",";
+    json += "\"";
+    json += audioCommandNames[i];
+    json += "\":{\"calls\":" + String((unsigned long)stats.calls);
+    json += ",\"errors\":" + String((unsigned long)stats.errors);
+    json += ",\"timeouts\":" + String((unsigned long)stats.timeouts);
+    json += ",\"timing\":\"";
+    json += commandAwaitsReply((AudioLinkCommand)i) ? "rtt" : "send";
+    json += "\"";
+    json += ",\"lastUs\":" + String((unsigned long)stats.lastLatencyUs);
+    json += ",\"avgUs\":" + String(avg);
+    json += ",\"maxUs\":" + String((unsigned long)stats.maxLatencyUs);
+    json += "}";
+  }
+  json += "}";
+  return json;
+}
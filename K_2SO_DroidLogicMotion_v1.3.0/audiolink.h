@@ -0,0 +1,103 @@
+/*
+================================================================================
+// K-2SO Controller DFPlayer Link Supervisor Header
+// Wraps DFPlayer commands with latency/error accounting and re-probes a dead
+// link with exponential backoff so audio recovers without a reboot
+================================================================================
+*/
+
+#ifndef K2SO_AUDIOLINK_H
+#define K2SO_AUDIOLINK_H
+
+#include <Arduino.h>
+
+//========================================
+// LINK SUPERVISOR CONFIGURATION
+//========================================
+
+#define AUDIO_LINK_RETRY_BASE_MS     1000    // First re-probe after link loss
+#define AUDIO_LINK_RETRY_MAX_MS      60000   // Backoff ceiling between probes
+#define AUDIO_LINK_KEEPALIVE_MS      60000   // Probe interval while link is up
+#define AUDIO_LINK_KEEPALIVE_QUIET_MS 10000  // Skip keepalive if a command ran recently
+#define AUDIO_LINK_COLD_PROBES       6       // Give up on a player never seen since boot
+
+//========================================
+// DATA STRUCTURES
+//========================================
+
+// DFPlayer command classes tracked by the supervisor
+enum AudioLinkCommand {
+  AUDIO_CMD_PROBE,          // getTotalTrackCount (init, keepalive, re-probe)
+  AUDIO_CMD_FOLDER_COUNT,   // getFolderTrackCount
+  AUDIO_CMD_PLAY,           // playFolderTrack
+  AUDIO_CMD_VOLUME,         // setVolume
+  AUDIO_CMD_STOP,           // stop
+  AUDIO_CMD_COUNT
+};
+
+// Per-command counters
+struct AudioCommandStats {
+  uint32_t calls;                   // Commands issued
+  uint32_t errors;                  // Error notifications during the command
+  uint32_t timeouts;                // Reply timeouts during the command
+  uint32_t lastLatencyUs;           // Round trip (queries) or send time (commands)
+  uint32_t maxLatencyUs;            // Worst time seen
+  uint64_t totalLatencyUs;          // Sum for average calculation
+};
+
+// Supervisor state
+struct AudioLinkState {
+  AudioCommandStats commands[AUDIO_CMD_COUNT];
+
+  // Error attribution
+  bool commandActive;               // A wrapped command is in flight
+  AudioLinkCommand activeCommand;   // Command that owns incoming errors
+  uint32_t asyncErrors;             // Errors reported outside a command (mp3.loop)
+  uint16_t lastErrorCode;           // Most recent DFPlayer error code
+  unsigned long lastErrorTime;      // millis() of most recent error
+  unsigned long lastCommandTime;    // millis() of most recent wrapped command
+
+  // Recovery state
+  bool linkDown;                    // Supervisor considers the link dead
+  bool everUp;                      // Player has answered since boot
+  bool probingParked;               // Cold player gave up, re-armed by a stats reset
+  unsigned long downSince;          // millis() when the link was lost
+  unsigned long nextProbeTime;      // millis() of next scheduled probe
+  unsigned long retryDelay;         // Current backoff delay
+  uint16_t probeAttempts;           // Probes since the link was lost
+  uint32_t linkDrops;               // Times the link was lost
+  uint32_t recoveries;              // Times the link was restored
+  unsigned long totalDowntimeMs;    // Accumulated downtime of closed outages
+  unsigned long lastKeepalive;      // millis() of last keepalive probe
+};
+
+//========================================
+// EXTERNAL REFERENCES
+//========================================
+
+extern AudioLinkState audioLink;
+
+//========================================
+// FUNCTION DECLARATIONS
+//========================================
+
+// Supervisor lifecycle
+void initializeAudioLink(bool linkUp);                 // Seed state after DFPlayer init
+void updateAudioLink();                                // Keepalive and backoff re-probe (call in loop)
+void resetAudioLinkStats();                            // Clear counters, keep link state
+void audioLinkReportError(uint16_t errorCode);         // Called from Mp3Notify::OnError
+bool audioLastQueryAnswered();                         // Last query got a reply (even 0 tracks)
+
+// Supervised DFPlayer commands (use these instead of calling mp3 directly)
+uint16_t audioGetTotalTrackCount();                    // Timed total track query
+uint16_t audioGetFolderTrackCount(uint8_t folder);     // Timed folder track query
+void audioPlayFolderTrack(uint8_t folder, uint8_t track); // Fire-and-forget play command
+void audioSetVolume(uint8_t volume);                   // Fire-and-forget volume command
+void audioStop();                                      // Fire-and-forget stop command
+
+// Reporting
+void printAudioLinkStats();                            // Print stats to Serial
+String getAudioLinkStatsJson();                        // Stats as JSON fields (no braces)
+const char* getAudioLinkCommandName(AudioLinkCommand cmd);
+
+#endif // K2SO_AUDIOLINK_H
@@ -80,6 +80,18 @@
 #define AUTO_SLEEP_TIME     3600000  // Auto-sleep after 60 minutes of inactivity
 #define DEFAULT_BRIGHTNESS  150     // Default LED brightness (0-255)
 
+// IR dispatch table (open addressing - power of two, at least 2x the 21 buttons)
+#define IR_DISPATCH_TABLE_BITS  6
+#define IR_DISPATCH_TABLE_SIZE  (1 << IR_DISPATCH_TABLE_BITS)
+
+// IR hold-to-repeat (NEC repeat frames arrive every ~108 ms while held)
+#define IR_REPEAT_WINDOW_MS     200     // Same full code within this window = repeat
+#define IR_JOG_RELEASE_MS       180     // No frame for this long = button released
+
+// IR capture ring (power of two; one slot stays empty)
+#define IR_EVENT_QUEUE_SIZE     32
+#define IR_CAPTURE_POLL_MS      2       // Capture task decode poll interval
+
 //========================================
 // STATUS LED CONFIGURATION (NEW)
 //========================================
@@ -176,6 +188,14 @@ struct __attribute__((packed)) IRButton {
   char sequenceName[32];  // Name of sequence to trigger (empty = standard action)
 };
 
+// Decoded IR frame queued by the capture task
+struct IREvent {
+  uint32_t code;            // Raw decoded data
+  uint32_t captureMicros;   // micros() when the decoder produced the frame
+  uint8_t protocol;         // IRremote decode_type_t
+  bool isRepeat;            // NEC repeat frame
+};
+
 // Servo state tracking
 struct ServoState {
   Servo* servoObject;
@@ -393,11 +413,17 @@ enum Command {
   CMD_SERVO, CMD_LED, CMD_SOUND, CMD_TIMING,
   CMD_PROFILE, CMD_MONITOR, CMD_TEST, CMD_DEMO,
   CMD_BACKUP, CMD_RESTORE, CMD_EXIT,
-  CMD_IR_ON, CMD_IR_OFF, CMD_MODE,
+  CMD_IR_ON, CMD_IR_OFF, CMD_IR_STATS, CMD_MODE,
   CMD_DETAIL,  // Detail LED control command
   CMD_WIFI,    // WiFi configuration command
   CMD_AP,      // Access Point configuration command
-  CMD_SEQ      // Sequence recording and playback command
+  CMD_SEQ,     // Sequence recording and playback command
+  CMD_COMBO,   // IR button combo command
+  CMD_PUPPET,  // PC puppet link status
+  CMD_WS,      // WebSocket link status
+  CMD_WEB,     // Web control queue status
+  CMD_EVENTS,  // Server-Sent Events stream status
+  CMD_STATE    // State snapshots and scenes
 };
 
 #endif // K2SO_CONFIG_H
@@ -12,7 +12,7 @@
 //========================================
 
 // Define the NeoPixel strip object (max 8 LEDs)
-Adafruit_NeoPixel detailLEDs = Adafruit_NeoPixel(MAX_DETAIL_LEDS, DETAIL_LED_PIN, NEO_GRB + NEO_KHZ800);
+MeteredNeoPixel detailLEDs(MAX_DETAIL_LEDS, DETAIL_LED_PIN, NEO_GRB + NEO_KHZ800, METRIC_DETAIL_SHOWS);
 
 //========================================
 // STATE VARIABLES
@@ -12,6 +12,7 @@
 #include <Arduino.h>
 #include <Adafruit_NeoPixel.h>
 #include "config.h"
+#include "metrics.h"    // For MeteredNeoPixel
 #include "globals.h"    // For DetailPattern enum definition
 
 //========================================
@@ -89,7 +90,7 @@ struct DetailModeColors {
 //========================================
 
 // Hardware object (defined in main file)
-extern Adafruit_NeoPixel detailLEDs;
+extern MeteredNeoPixel detailLEDs;
 
 // State variables (defined in detailleds.cpp)
 extern DetailLEDState detailState;
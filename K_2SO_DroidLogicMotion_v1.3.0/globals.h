@@ -29,8 +29,8 @@ enum DetailPattern {
 //========================================
 
 // Hardware classes - forward declared
-class Adafruit_NeoPixel;
-class WebServer;
+class MeteredNeoPixel;
+class AsyncWebServer;
 class Servo;
 class HardwareSerial;
 
@@ -39,13 +39,13 @@ class HardwareSerial;
 //========================================
 
 // NeoPixel objects
-extern Adafruit_NeoPixel leftEye;
-extern Adafruit_NeoPixel rightEye;
-extern Adafruit_NeoPixel statusLED;  // Status LED
-extern Adafruit_NeoPixel detailLEDs; // Detail LED strip (WS2812)
+extern MeteredNeoPixel leftEye;
+extern MeteredNeoPixel rightEye;
+extern MeteredNeoPixel statusLED;    // Status LED
+extern MeteredNeoPixel detailLEDs;   // Detail LED strip (WS2812)
 
 // Web server
-extern WebServer server;
+extern AsyncWebServer server;
 
 // Servo objects  
 extern Servo eyePanServo;
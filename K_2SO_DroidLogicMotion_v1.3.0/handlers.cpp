@@ -8,11 +8,13 @@
 // System libraries FIRST
 #include <Arduino.h>
 #include <WiFi.h>
-#include <WebServer.h>
+#include <ESPAsyncWebServer.h>
 #include <ESPmDNS.h>
 #include <Adafruit_NeoPixel.h>
 #include <ESP32Servo.h>
 #include <EEPROM.h>
+#include <ArduinoJson.h>
+#include <atomic>
 
 // IR Library with correct defines
 #define DISABLE_IR_SEND
@@ -29,8 +31,18 @@
 #include "detailleds.h"   // Detail LED functions (WS2812)
 #include "sequences.h"    // Sequence recording and playback
 #include "webpage.h"
+#include "webassets.h"     // Pre-built gzipped web UI (generated from webui/)
 #include "globals.h"
 #include "Mp3Notify.h"    
+#include "audiolink.h"    // Supervised DFPlayer commands
+#include "ircombos.h"     // IR combo matcher
+#include "serialcli.h"    // Line assembler, tokenizer, command tables
+#include "puppetlink.h"   // Binary puppeteering frames on the same port
+#include "weblink.h"      // WebSocket control/push channel
+#include "webcontrol.h"   // Web request queue (webRequest)
+#include "webevents.h"    // Server-Sent Events (postWebEvent)
+#include "metrics.h"      // For sendMetrics, fsOpen, MeteredNeoPixel
+#include "scenes.h"       // State snapshots and stored scenes
 
 // Forward declaration to access mp3 object from main .ino
 extern DFMiniMp3<HardwareSerial, Mp3Notify> mp3;
@@ -43,27 +55,27 @@ const int COLOR_COUNT = 6;
 //========================================
 // Returns true if parsing succeeded, false otherwise
 // value is only modified on success
-bool safeParseInt(const String& str, int& value, int minVal = INT_MIN, int maxVal = INT_MAX) {
-  if (str.length() == 0) {
+bool safeParseInt(const char* str, int& value, int minVal = INT_MIN, int maxVal = INT_MAX) {
+  if (str == nullptr || str[0] == '\0') {
     return false;
   }
 
   // Check if string contains only valid integer characters
   int startIdx = 0;
-  if (str.charAt(0) == '-' || str.charAt(0) == '+') {
+  if (str[0] == '-' || str[0] == '+') {
     startIdx = 1;
-    if (str.length() == 1) {
+    if (str[1] == '\0') {
       return false;  // Just a sign with no digits
     }
   }
 
-  for (int i = startIdx; i < (int)str.length(); i++) {
-    if (!isDigit(str.charAt(i))) {
+  for (int i = startIdx; str[i] != '\0'; i++) {
+    if (!isDigit(str[i])) {
       return false;  // Non-digit character found
     }
   }
 
-  long parsed = str.toInt();
+  long parsed = atol(str);
 
   // Check for overflow
   if (parsed < minVal || parsed > maxVal) {
@@ -74,6 +86,10 @@ bool safeParseInt(const String& str, int& value, int minVal = INT_MIN, int maxVa
   return true;
 }
 
+bool safeParseInt(const String& str, int& value, int minVal = INT_MIN, int maxVal = INT_MAX) {
+  return safeParseInt(str.c_str(), value, minVal, maxVal);
+}
+
 //========================================
 // JSON STRING ESCAPE HELPER
 //========================================
@@ -93,15 +109,24 @@ String escapeJsonString(const char* input) {
   return output;
 }
 
-static bool waitForSerialWithTimeout(unsigned long timeoutMs) {
-  unsigned long start = millis();
-  while (!Serial.available()) {
-    if (millis() - start > timeoutMs) {
-      return false;
-    }
-    delay(10);
+// Pending serial question (confirmations, learn/restore wizards). Answers are
+// delivered by pollSerialCommands(), so the loop keeps running meanwhile.
+static CLIPrompt serialPrompt;
+
+// Shared shape of the YES confirmations: true only for the exact word,
+// otherwise reports why nothing happened
+static bool promptConfirmed(CLIPromptEvent event, const char* input, const char* expected,
+                            const __FlashStringHelper* cancelMessage) {
+  if (event == CLI_PROMPT_TIMEOUT) {
+    Serial.print(F("\n⏱️ Timeout - "));
+    Serial.println(cancelMessage);
+    return false;
   }
-  return true;
+  if (strcmp(input, expected) == 0) {
+    return true;
+  }
+  Serial.println(cancelMessage);
+  return false;
 }
 
 static uint32_t calculateChecksumForConfig(const ConfigData& cfg) {
@@ -257,16 +282,160 @@ static String buildApiJson(bool ok, const String& message, const String& extraJs
 }
 
 static void sendApiResponse(int statusCode, bool ok, const String& message, const String& extraJson = "") {
-  server.send(statusCode, "application/json", buildApiJson(ok, message, extraJson));
+  webRequest.send(statusCode, "application/json", buildApiJson(ok, message, extraJson));
 }
 
 //========================================
 // IR SYSTEM MANAGEMENT FUNCTIONS
 //========================================
 
+//----------------------------------------
+// IR capture task and event ring
+//----------------------------------------
+// A small task on core 0 polls the decoder and pushes timestamped frames
+// into a single-producer/single-consumer ring. The main loop drains it in
+// every operating mode, so codes survive long web requests, EEPROM saves
+// and demo/test runs. The receiver mutex only guards begin()/end() against
+// a concurrent decode(); the ring itself is lock-free.
+
+static IREvent irEventRing[IR_EVENT_QUEUE_SIZE];
+static std::atomic<uint8_t> irEventHead(0);        // Written by capture task
+static std::atomic<uint8_t> irEventTail(0);        // Written by main loop
+static std::atomic<uint32_t> irEventOverflows(0);  // Frames dropped on a full ring
+static SemaphoreHandle_t irReceiverMutex = nullptr;
+static TaskHandle_t irCaptureTaskHandle = nullptr;
+static volatile bool irCaptureRunning = false;
+
+// Input-to-action latency (main loop only)
+struct IRInputStats {
+  uint32_t presses;
+  uint32_t repeats;
+  uint8_t maxDepth;
+  uint32_t lastQueueUs;       // Capture -> dequeue
+  uint32_t maxQueueUs;
+  uint64_t totalQueueUs;
+  uint32_t lastActionUs;      // Capture -> action dispatched
+  uint32_t maxActionUs;
+  uint64_t totalActionUs;
+};
+
+static IRInputStats irStats = {};
+static uint8_t currentIRProtocol = 0;              // Protocol of the frame being dispatched
+static uint32_t monitorLastIRCode = 0;        // Last press shown by monitor mode
+
+static bool pushIREvent(const IREvent& event) {
+  uint8_t head = irEventHead.load(std::memory_order_relaxed);
+  uint8_t next = (head + 1) & (IR_EVENT_QUEUE_SIZE - 1);
+  if (next == irEventTail.load(std::memory_order_acquire)) {
+    irEventOverflows.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  irEventRing[head] = event;
+  irEventHead.store(next, std::memory_order_release);
+  return true;
+}
+
+bool popIREvent(IREvent& event) {
+  uint8_t tail = irEventTail.load(std::memory_order_relaxed);
+  uint8_t head = irEventHead.load(std::memory_order_acquire);
+  if (tail == head) {
+    return false;
+  }
+
+  uint8_t depth = (head - tail) & (IR_EVENT_QUEUE_SIZE - 1);
+  if (depth > irStats.maxDepth) {
+    irStats.maxDepth = depth;
+  }
+
+  event = irEventRing[tail];
+  irEventTail.store((tail + 1) & (IR_EVENT_QUEUE_SIZE - 1), std::memory_order_release);
+  return true;
+}
+
+static void irCaptureTask(void* parameter) {
+  for (;;) {
+    if (irCaptureRunning && xSemaphoreTake(irReceiverMutex, 0) == pdTRUE) {
+      if (IrReceiver.decode()) {
+        IREvent event;
+        event.captureMicros = micros();
+        event.code = IrReceiver.decodedIRData.decodedRawData;
+        event.protocol = (uint8_t)IrReceiver.decodedIRData.protocol;
+        // IRremote 4.x flags NEC repeat frames; legacy decoders report 0xFFFFFFFF
+        event.isRepeat = (IrReceiver.decodedIRData.flags & IRDATA_FLAGS_IS_REPEAT) ||
+                         event.code == 0xFFFFFFFF;
+        IrReceiver.resume();
+        if (event.isRepeat || event.code != 0) {
+          pushIREvent(event);
+        }
+      }
+      xSemaphoreGive(irReceiverMutex);
+    }
+    vTaskDelay(pdMS_TO_TICKS(IR_CAPTURE_POLL_MS));
+  }
+}
+
+static void irReceiverBegin() {
+  xSemaphoreTake(irReceiverMutex, portMAX_DELAY);
+  IrReceiver.begin(IR_RECEIVER_PIN, false);
+  irCaptureRunning = true;
+  xSemaphoreGive(irReceiverMutex);
+}
+
+static void irReceiverEnd() {
+  xSemaphoreTake(irReceiverMutex, portMAX_DELAY);
+  irCaptureRunning = false;
+  IrReceiver.end();
+  xSemaphoreGive(irReceiverMutex);
+}
+
+static void recordIRLatency(const IREvent& event, uint32_t dequeueMicros) {
+  uint32_t queueUs = dequeueMicros - event.captureMicros;
+  uint32_t actionUs = micros() - event.captureMicros;
+
+  irStats.lastQueueUs = queueUs;
+  irStats.totalQueueUs += queueUs;
+  if (queueUs > irStats.maxQueueUs) irStats.maxQueueUs = queueUs;
+
+  irStats.lastActionUs = actionUs;
+  irStats.totalActionUs += actionUs;
+  if (actionUs > irStats.maxActionUs) irStats.maxActionUs = actionUs;
+}
+
+void printIRInputStats() {
+  uint8_t depth = (irEventHead.load() - irEventTail.load()) & (IR_EVENT_QUEUE_SIZE - 1);
+
+  Serial.println(F("\n=== IR INPUT STATS ==="));
+  Serial.printf("Receiver: %s, capture task: %s\n",
+                config.irEnabled ? "Enabled" : "Disabled",
+                irCaptureTaskHandle != nullptr ? "Running" : "Not started");
+  Serial.printf("Presses: %lu, repeats: %lu\n",
+                (unsigned long)irStats.presses, (unsigned long)irStats.repeats);
+  Serial.printf("Queue: %u/%d now, %u max, %lu dropped\n",
+                depth, IR_EVENT_QUEUE_SIZE - 1, irStats.maxDepth,
+                (unsigned long)irEventOverflows.load());
+  if (irStats.presses > 0) {
+    Serial.printf("Capture -> dequeue: last %lu us, avg %lu us, max %lu us\n",
+                  (unsigned long)irStats.lastQueueUs,
+                  (unsigned long)(irStats.totalQueueUs / irStats.presses),
+                  (unsigned long)irStats.maxQueueUs);
+    Serial.printf("Capture -> action:  last %lu us, avg %lu us, max %lu us\n",
+                  (unsigned long)irStats.lastActionUs,
+                  (unsigned long)(irStats.totalActionUs / irStats.presses),
+                  (unsigned long)irStats.maxActionUs);
+  }
+}
+
 void initializeIR() {
+  if (irReceiverMutex == nullptr) {
+    irReceiverMutex = xSemaphoreCreateMutex();
+  }
+  if (irCaptureTaskHandle == nullptr) {
+    xTaskCreatePinnedToCore(irCaptureTask, "irCapture", 3072, nullptr, 2,
+                            &irCaptureTaskHandle, 0);
+  }
+
   if (config.irEnabled) {
-    IrReceiver.begin(IR_RECEIVER_PIN, false);
+    irReceiverBegin();
     Serial.println("- IR Receiver: OK");
   } else {
     Serial.println("- IR Receiver: Disabled");
@@ -274,28 +443,37 @@ void initializeIR() {
 }
 
 void stopIR() {
-  IrReceiver.end();
+  irReceiverEnd();
 }
 
 void setIREnabled(bool enabled) {
   if (enabled && !config.irEnabled) {
-    IrReceiver.begin(IR_RECEIVER_PIN, false);
+    irReceiverBegin();
     config.irEnabled = true;
     Serial.println("IR enabled.");
   } else if (!enabled && config.irEnabled) {
-    IrReceiver.end();
+    irReceiverEnd();
     config.irEnabled = false;
     Serial.println("IR disabled.");
   }
 }
 
+bool readIRFrame(uint32_t& code, bool& isRepeat) {
+  IREvent event;
+  if (!popIREvent(event)) {
+    return false;
+  }
+  code = event.code;
+  isRepeat = event.isRepeat;
+  return true;
+}
+
 bool checkForIRCommand(uint32_t& code) {
-  if (!config.irEnabled) return false;
-  
-  if (IrReceiver.decode()) {
-    code = IrReceiver.decodedIRData.decodedRawData;
-    IrReceiver.resume();
-    return (code != 0xFFFFFFFF && code != 0);
+  bool isRepeat;
+  while (readIRFrame(code, isRepeat)) {
+    if (!isRepeat) {
+      return true;
+    }
   }
   return false;
 }
@@ -311,18 +489,46 @@ bool checkWebAuth() {
     return true;
   }
 
-  // Check if authentication is valid
-  if (!server.authenticate(WEB_AUTH_USER, WEB_AUTH_PASS)) {
-    server.requestAuthentication();
+  // Credentials were checked by the network task when the request was queued
+  if (!webRequest.authenticated()) {
+    webRequest.requestAuthentication();
     return false;
   }
   return true;
 }
 
-void handleRoot() {
-  if (!checkWebAuth()) return;
-  Serial.println("Web request: Root page");
-  server.send(200, "text/html", getIndexPage());
+// UI files are minified and gzipped at build time (webassets.h) and sent
+// straight from flash. index.html is revalidated on every load (empty 304
+// when unchanged); style.css / app.js are referenced by hashed URL and may
+// be cached for good. Assets touch no droid state, so they are answered
+// right in the network task instead of going through the control queue.
+static void sendWebAsset(AsyncWebServerRequest* request, const WebAsset& asset) {
+  if (strlen(WEB_AUTH_USER) > 0 && !request->authenticate(WEB_AUTH_USER, WEB_AUTH_PASS)) {
+    AsyncWebServerResponse* response = request->beginResponse(401, "text/plain", "Authentication required");
+    response->addHeader("WWW-Authenticate", "Basic realm=\"Login Required\"");
+    request->send(response);
+    return;
+  }
+
+  AsyncWebServerResponse* response;
+  if (request->hasHeader("If-None-Match") && request->header("If-None-Match") == asset.etag) {
+    response = request->beginResponse(304);
+  } else {
+    response = request->beginResponse(200, asset.contentType, asset.data, asset.length);
+    response->addHeader("Content-Encoding", "gzip");
+  }
+  response->addHeader("ETag", asset.etag);
+  response->addHeader("Cache-Control", asset.immutable ? "public, max-age=31536000, immutable" : "no-cache");
+  request->send(response);
+}
+
+void registerWebAssetRoutes() {
+  for (size_t i = 0; i < WEBUI_ASSET_COUNT; i++) {  // [0] is index.html at "/"
+    const WebAsset* asset = &WEBUI_ASSETS[i];
+    server.on(asset->path, HTTP_GET, [asset](AsyncWebServerRequest* request) {
+      sendWebAsset(request, *asset);
+    });
+  }
 }
 
 void handleWebStatus() {
@@ -338,73 +544,154 @@ void handleWebStatus() {
   status += "  \"ir_commands\": " + String(irCommandCount) + ",\n";
   status += "  \"servo_movements\": " + String(servoMovements) + "\n";
   status += "}";
-  server.send(200, "application/json", status);
+  webRequest.send(200, "application/json", status);
+}
+
+// OpenMetrics text for a Prometheus-style collector (see metrics.h)
+void handleMetrics() {
+  if (!checkWebAuth()) return;
+  sendMetrics();
 }
 
 void handleSetServos() {
   if (!checkWebAuth()) return;
-  Serial.println("Web request: Set servos");
 
-  if (server.hasArg("eyePan") && server.hasArg("eyeTilt") &&
-      server.hasArg("headPan") && server.hasArg("headTilt")) {
+  if (webRequest.hasArg("eyePan") && webRequest.hasArg("eyeTilt") &&
+      webRequest.hasArg("headPan") && webRequest.hasArg("headTilt")) {
 
     int eyePanPos, eyeTiltPos, headPanPos, headTiltPos;
 
     // Safe parsing with validation
-    if (!safeParseInt(server.arg("eyePan"), eyePanPos, 0, 180) ||
-        !safeParseInt(server.arg("eyeTilt"), eyeTiltPos, 0, 180) ||
-        !safeParseInt(server.arg("headPan"), headPanPos, 0, 180) ||
-        !safeParseInt(server.arg("headTilt"), headTiltPos, 0, 180)) {
-      server.send(400, "text/plain", "Invalid servo position values (must be 0-180)");
+    if (!safeParseInt(webRequest.arg("eyePan"), eyePanPos, 0, 180) ||
+        !safeParseInt(webRequest.arg("eyeTilt"), eyeTiltPos, 0, 180) ||
+        !safeParseInt(webRequest.arg("headPan"), headPanPos, 0, 180) ||
+        !safeParseInt(webRequest.arg("headTilt"), headTiltPos, 0, 180)) {
+      webRequest.send(400, "text/plain", "Invalid servo position values (must be 0-180)");
       return;
     }
 
-    // Validate positions within configured limits
-    eyePanPos = constrain(eyePanPos, config.eyePanMin, config.eyePanMax);
-    eyeTiltPos = constrain(eyeTiltPos, config.eyeTiltMin, config.eyeTiltMax);
-    headPanPos = constrain(headPanPos, config.headPanMin, config.headPanMax);
-    headTiltPos = constrain(headTiltPos, config.headTiltMin, config.headTiltMax);
-    
-    // Set servo targets
-    eyePan.targetPosition = eyePanPos;
-    eyeTilt.targetPosition = eyeTiltPos;
-    headPan.targetPosition = headPanPos;
-    headTilt.targetPosition = headTiltPos;
-    
-    // Move servos immediately for web interface responsiveness
-    eyePanServo.write(eyePanPos);
-    eyeTiltServo.write(eyeTiltPos);
-    headPanServo.write(headPanPos);
-    headTiltServo.write(headTiltPos);
-    
-    // Update current positions and mark movement complete
-    eyePan.currentPosition = eyePanPos;
-    eyeTilt.currentPosition = eyeTiltPos;
-    headPan.currentPosition = headPanPos;
-    headTilt.currentPosition = headTiltPos;
-
-    // Mark servos as not moving since we wrote directly
-    eyePan.isMoving = false;
-    eyeTilt.isMoving = false;
-    headPan.isMoving = false;
-    headTilt.isMoving = false;
-
-    // Wake up if sleeping and mark activity
-    if (!isAwake) {
-      isAwake = true;
-      currentMode = MODE_ALERT;
-      setServoParameters();
-    }
-    lastActivityTime = millis();
-    servoMovements++;
-    
-    statusLEDServoActivity(); // NEW: Flash blue for servo activity
-    
-    Serial.printf("Servos set: EP:%d ET:%d HP:%d HT:%d\n", eyePanPos, eyeTiltPos, headPanPos, headTiltPos);
-    server.send(200, "text/plain", "OK");
+    // Applied at the next servo tick; no per-request log line, this is
+    // called at gamepad rate
+    setRemoteServoTargets(eyePanPos, eyeTiltPos, headPanPos, headTiltPos);
+    webRequest.send(200, "text/plain", "OK");
   } else {
-    server.send(400, "text/plain", "Missing parameters");
+    webRequest.send(400, "text/plain", "Missing parameters");
+  }
+}
+
+//----------------------------------------
+// Remote servo targets (latest wins)
+//----------------------------------------
+// Web, WebSocket, serial and puppet link positions land in one pending slot
+// per axis and are written at the next servo update tick. A target replaced
+// before that tick is dropped and counted, so input faster than the loop can
+// never build a backlog. The WebSocket fills the slots straight from the network task,
+// hence the spinlock.
+
+struct RemoteServoTargets {
+  int position[4];            // eyePan, eyeTilt, headPan, headTilt
+  uint8_t pendingMask;        // Bit per axis
+  unsigned long pendingSince; // Oldest unapplied target
+};
+
+struct RemoteServoStats {
+  uint32_t requests;
+  uint32_t applied;           // Servo ticks that wrote remote targets
+  uint32_t superseded;        // Axis targets replaced before being applied
+  uint32_t lastLatencyMs;     // Request -> write
+  uint32_t maxLatencyMs;
+};
+
+static RemoteServoTargets remoteTargets = {};
+static RemoteServoStats remoteServoStats = {};
+static portMUX_TYPE remoteTargetLock = portMUX_INITIALIZER_UNLOCKED;
+
+void setRemoteServoTargets(int eyePanPos, int eyeTiltPos, int headPanPos, int headTiltPos) {
+  unsigned long now = millis();
+
+  portENTER_CRITICAL(&remoteTargetLock);
+  for (uint8_t axis = 0; axis < 4; axis++) {
+    if (remoteTargets.pendingMask & (1 << axis)) {
+      remoteServoStats.superseded++;
+    }
+  }
+  if (remoteTargets.pendingMask == 0) {
+    remoteTargets.pendingSince = now;
   }
+  remoteTargets.position[0] = eyePanPos;
+  remoteTargets.position[1] = eyeTiltPos;
+  remoteTargets.position[2] = headPanPos;
+  remoteTargets.position[3] = headTiltPos;
+  remoteTargets.pendingMask = 0x0F;
+  remoteServoStats.requests++;
+  portEXIT_CRITICAL(&remoteTargetLock);
+}
+
+// Servo update tick: direct write of the newest targets, clamped to the
+// calibrated range, no stepping
+static void applyRemoteServoTargets() {
+  RemoteServoTargets targets;
+  portENTER_CRITICAL(&remoteTargetLock);
+  targets = remoteTargets;
+  remoteTargets.pendingMask = 0;
+  portEXIT_CRITICAL(&remoteTargetLock);
+
+  if (targets.pendingMask == 0) {
+    return;
+  }
+
+  ServoState* axes[4] = { &eyePan, &eyeTilt, &headPan, &headTilt };
+  for (uint8_t axis = 0; axis < 4; axis++) {
+    if (!(targets.pendingMask & (1 << axis))) {
+      continue;
+    }
+    ServoState& servo = *axes[axis];
+    int position = constrain(targets.position[axis], servo.minRange, servo.maxRange);
+    servo.targetPosition = position;
+    servo.isMoving = false;
+    if (servo.currentPosition != position) {
+      servo.currentPosition = position;
+      servo.servoObject->write(position);
+    }
+  }
+
+  // Wake up if sleeping and mark activity
+  if (!isAwake) {
+    isAwake = true;
+    currentMode = MODE_ALERT;
+    setServoParameters();
+  }
+  lastActivityTime = millis();
+  servoMovements++;
+  statusLEDServoActivity(); // NEW: Flash blue for servo activity
+
+  uint32_t latency = millis() - targets.pendingSince;
+  remoteServoStats.applied++;
+  remoteServoStats.lastLatencyMs = latency;
+  if (latency > remoteServoStats.maxLatencyMs) {
+    remoteServoStats.maxLatencyMs = latency;
+  }
+}
+
+void printRemoteServoStats() {
+  portENTER_CRITICAL(&remoteTargetLock);
+  RemoteServoStats snapshot = remoteServoStats;
+  portEXIT_CRITICAL(&remoteTargetLock);
+
+  Serial.println(F("\n=== REMOTE SERVO TARGETS ==="));
+  Serial.printf("Requests: %lu, applied: %lu, superseded axis targets: %lu\n",
+                (unsigned long)snapshot.requests, (unsigned long)snapshot.applied,
+                (unsigned long)snapshot.superseded);
+  Serial.printf("Request -> write: last %lu ms, max %lu ms\n",
+                (unsigned long)snapshot.lastLatencyMs, (unsigned long)snapshot.maxLatencyMs);
+}
+
+// Connection details for the WebSocket link (browsers do not reliably send
+// Basic auth on the upgrade request, so a token is handed out behind it)
+void handleWebLinkInfo() {
+  if (!checkWebAuth()) return;
+  String extra = "\"path\":\"" WEBLINK_PATH "\",\"token\":\"" + String(getWebLinkToken()) + "\"";
+  sendApiResponse(200, true, "WebSocket link", extra);
 }
 
 void handleRed() {
@@ -414,7 +701,7 @@ void handleRed() {
   setEyeColor(red, red);
   currentPixelMode = SOLID_COLOR;
   lastActivityTime = millis();
-  server.send(200, "text/plain", "OK");
+  webRequest.send(200, "text/plain", "OK");
 }
 
 void handleGreen() {
@@ -424,7 +711,7 @@ void handleGreen() {
   setEyeColor(green, green);
   currentPixelMode = SOLID_COLOR;
   lastActivityTime = millis();
-  server.send(200, "text/plain", "OK");
+  webRequest.send(200, "text/plain", "OK");
 }
 
 void handleBlue() {
@@ -434,7 +721,7 @@ void handleBlue() {
   setEyeColor(blue, blue);
   currentPixelMode = SOLID_COLOR;
   lastActivityTime = millis();
-  server.send(200, "text/plain", "OK");
+  webRequest.send(200, "text/plain", "OK");
 }
 
 void handleWhite() {
@@ -444,7 +731,7 @@ void handleWhite() {
   setEyeColor(white, white);
   currentPixelMode = SOLID_COLOR;
   lastActivityTime = millis();
-  server.send(200, "text/plain", "OK");
+  webRequest.send(200, "text/plain", "OK");
 }
 
 void handleOff() {
@@ -453,22 +740,22 @@ void handleOff() {
   uint32_t off = Adafruit_NeoPixel::Color(0, 0, 0);
   setEyeColor(off, off);
   currentPixelMode = SOLID_COLOR;
-  server.send(200, "text/plain", "OK");
+  webRequest.send(200, "text/plain", "OK");
 }
 
 void handleBrightness() {
   if (!checkWebAuth()) return;
-  if (server.hasArg("value")) {
+  if (webRequest.hasArg("value")) {
     int brightness;
-    if (!safeParseInt(server.arg("value"), brightness, 0, 255)) {
-      server.send(400, "text/plain", "Invalid brightness value (must be 0-255)");
+    if (!safeParseInt(webRequest.arg("value"), brightness, 0, 255)) {
+      webRequest.send(400, "text/plain", "Invalid brightness value (must be 0-255)");
       return;
     }
     setEyeBrightness(brightness);
     Serial.printf("Web request: Brightness set to %d\n", brightness);
-    server.send(200, "text/plain", "OK");
+    webRequest.send(200, "text/plain", "OK");
   } else {
-    server.send(400, "text/plain", "Missing value parameter");
+    webRequest.send(400, "text/plain", "Missing value parameter");
   }
 }
 
@@ -477,7 +764,7 @@ void handleFlicker() {
   Serial.println("Web request: Flicker mode");
   startFlickerMode();
   lastActivityTime = millis();
-  server.send(200, "text/plain", "OK");
+  webRequest.send(200, "text/plain", "OK");
 }
 
 void handlePulse() {
@@ -485,76 +772,506 @@ void handlePulse() {
   Serial.println("Web request: Pulse mode");
   startPulseMode();
   lastActivityTime = millis();
-  server.send(200, "text/plain", "OK");
+  webRequest.send(200, "text/plain", "OK");
 }
 
 void handleVolume() {
   if (!checkWebAuth()) return;
-  if (server.hasArg("value")) {
+  if (webRequest.hasArg("value")) {
     int volume;
-    if (!safeParseInt(server.arg("value"), volume, 0, 30)) {
-      server.send(400, "text/plain", "Invalid volume value (must be 0-30)");
+    if (!safeParseInt(webRequest.arg("value"), volume, 0, 30)) {
+      webRequest.send(400, "text/plain", "Invalid volume value (must be 0-30)");
       return;
     }
     setVolume(volume);
     Serial.printf("Web request: Volume set to %d\n", volume);
-    server.send(200, "text/plain", "OK");
+    webRequest.send(200, "text/plain", "OK");
   } else {
-    server.send(400, "text/plain", "Missing value parameter");
+    webRequest.send(400, "text/plain", "Missing value parameter");
   }
 }
 
 void handlePlaySound() {
   if (!checkWebAuth()) return;
-  if (server.hasArg("file")) {
+  if (webRequest.hasArg("file")) {
     int fileNum;
-    if (!safeParseInt(server.arg("file"), fileNum, 1, 255)) {
-      server.send(400, "text/plain", "Invalid file number (must be 1-255)");
+    if (!safeParseInt(webRequest.arg("file"), fileNum, 1, 255)) {
+      webRequest.send(400, "text/plain", "Invalid file number (must be 1-255)");
       return;
     }
     playSound(fileNum);
     statusLEDAudioActivity(); // NEW: Flash green for audio activity
     Serial.printf("Web request: Playing sound %d\n", fileNum);
-    server.send(200, "text/plain", "OK");
+    webRequest.send(200, "text/plain", "OK");
   } else {
-    server.send(400, "text/plain", "Missing file parameter");
+    webRequest.send(400, "text/plain", "Missing file parameter");
   }
 }
 
+void handleAudioHealth() {
+  if (!checkWebAuth()) return;
+
+  if (webRequest.hasArg("reset") && webRequest.arg("reset") == "1") {
+    resetAudioLinkStats();
+  }
+
+  sendApiResponse(200, true,
+                  audioLink.linkDown ? "DFPlayer link is down." : "DFPlayer link is up.",
+                  getAudioLinkStatsJson());
+}
+
+bool parseModeName(String name, PersonalityMode& mode) {
+  name.toLowerCase();
+  if (name == "scanning") {
+    mode = MODE_SCANNING;
+  } else if (name == "alert") {
+    mode = MODE_ALERT;
+  } else if (name == "idle") {
+    mode = MODE_IDLE;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+static void applyWebMode(PersonalityMode mode) {
+  currentMode = mode;
+  switch (mode) {
+    case MODE_SCANNING: statusLEDScanningMode(); break;  // Update status LED
+    case MODE_ALERT:    statusLEDAlertMode();    break;
+    case MODE_IDLE:     statusLEDIdleMode();     break;
+  }
+
+  setServoParameters();
+  updateDetailColorForMode(currentMode); // NEW: Update detail LEDs for mode
+  config.savedMode = currentMode;
+
+  if (!isAwake) {
+    isAwake = true;
+  }
+  lastActivityTime = millis();
+}
+
 void handleWebMode() {
   if (!checkWebAuth()) return;
-  if (server.hasArg("mode")) {
-    String mode = server.arg("mode");
-    mode.toLowerCase();
-    
-    if (mode == "scanning") {
-      currentMode = MODE_SCANNING;
-      statusLEDScanningMode(); // Update status LED
-    } else if (mode == "alert") {
-      currentMode = MODE_ALERT;
-      statusLEDAlertMode(); // Update status LED
-    } else if (mode == "idle") {
-      currentMode = MODE_IDLE;
-      statusLEDIdleMode(); // Update status LED
-    } else {
-      server.send(400, "text/plain", "Invalid mode");
+  if (webRequest.hasArg("mode")) {
+    PersonalityMode mode;
+    if (!parseModeName(webRequest.arg("mode"), mode)) {
+      webRequest.send(400, "text/plain", "Invalid mode");
       return;
     }
+    applyWebMode(mode);
 
-    setServoParameters();
-    updateDetailColorForMode(currentMode); // NEW: Update detail LEDs for mode
-    config.savedMode = currentMode;
-    
-    if (!isAwake) {
-      isAwake = true;
+    Serial.printf("Web request: Mode changed to %s\n", getModeName(currentMode).c_str());
+    webRequest.send(200, "text/plain", "OK");
+  } else {
+    webRequest.send(400, "text/plain", "Missing mode parameter");
+  }
+}
+
+//========================================
+// BATCH WEB HANDLER
+//========================================
+// POST /batch with a JSON array, e.g.
+//   [{"cmd":"mode","mode":"alert"},{"cmd":"red"},{"cmd":"brightness","value":200},
+//    {"cmd":"setServos","eyePan":90,"eyeTilt":90,"headPan":60,"headTilt":100},
+//    {"cmd":"playSound","file":3}]
+// Command names and fields are those of the single endpoints, plus
+// {"cmd":"color","r":..,"g":..,"b":..}. The whole batch is validated before
+// anything is applied, then runs in one control queue tick in array order.
+// Eye color, brightness and effect are merged into one LED update at the end.
+
+enum BatchCommandType : uint8_t {
+  BATCH_MODE,
+  BATCH_COLOR,
+  BATCH_BRIGHTNESS,
+  BATCH_FLICKER,
+  BATCH_PULSE,
+  BATCH_VOLUME,
+  BATCH_SOUND,
+  BATCH_SERVOS
+};
+
+struct BatchCommand {
+  BatchCommandType type;
+  int values[4];              // Mode / r,g,b / value / file / servo positions
+};
+
+static bool batchInt(JsonObjectConst item, const char* key, int minVal, int maxVal, int& value) {
+  JsonVariantConst field = item[key];
+  if (!field.is<int>()) {
+    return false;
+  }
+  value = field.as<int>();
+  return value >= minVal && value <= maxVal;
+}
+
+// Returns nullptr if the command is valid, otherwise the error message
+static const char* parseBatchCommand(JsonObjectConst item, BatchCommand& command) {
+  const char* name = item["cmd"] | "";
+  int* v = command.values;
+
+  if (strcmp(name, "mode") == 0) {
+    PersonalityMode mode;
+    if (!parseModeName(String(item["mode"] | ""), mode)) return "Invalid mode";
+    command.type = BATCH_MODE;
+    v[0] = mode;
+  } else if (strcmp(name, "red") == 0 || strcmp(name, "green") == 0 || strcmp(name, "blue") == 0 ||
+             strcmp(name, "white") == 0 || strcmp(name, "off") == 0) {
+    command.type = BATCH_COLOR;
+    v[0] = (strcmp(name, "red") == 0 || strcmp(name, "white") == 0) ? 255 : 0;
+    v[1] = (strcmp(name, "green") == 0 || strcmp(name, "white") == 0) ? 255 : 0;
+    v[2] = (strcmp(name, "blue") == 0 || strcmp(name, "white") == 0) ? 255 : 0;
+  } else if (strcmp(name, "color") == 0) {
+    if (!batchInt(item, "r", 0, 255, v[0]) || !batchInt(item, "g", 0, 255, v[1]) ||
+        !batchInt(item, "b", 0, 255, v[2])) {
+      return "r, g, b must be 0-255";
+    }
+    command.type = BATCH_COLOR;
+  } else if (strcmp(name, "brightness") == 0) {
+    if (!batchInt(item, "value", 0, 255, v[0])) return "value must be 0-255";
+    command.type = BATCH_BRIGHTNESS;
+  } else if (strcmp(name, "flicker") == 0) {
+    command.type = BATCH_FLICKER;
+  } else if (strcmp(name, "pulse") == 0) {
+    command.type = BATCH_PULSE;
+  } else if (strcmp(name, "volume") == 0) {
+    if (!batchInt(item, "value", 0, 30, v[0])) return "value must be 0-30";
+    command.type = BATCH_VOLUME;
+  } else if (strcmp(name, "playSound") == 0) {
+    if (!batchInt(item, "file", 1, 255, v[0])) return "file must be 1-255";
+    command.type = BATCH_SOUND;
+  } else if (strcmp(name, "setServos") == 0) {
+    if (!batchInt(item, "eyePan", 0, 180, v[0]) || !batchInt(item, "eyeTilt", 0, 180, v[1]) ||
+        !batchInt(item, "headPan", 0, 180, v[2]) || !batchInt(item, "headTilt", 0, 180, v[3])) {
+      return "eyePan, eyeTilt, headPan, headTilt must be 0-180";
+    }
+    command.type = BATCH_SERVOS;
+  } else {
+    return "Unknown command";
+  }
+  return nullptr;
+}
+
+void handleBatch() {
+  if (!checkWebAuth()) return;
+
+  DynamicJsonDocument doc(WEB_BATCH_JSON_SIZE);
+  DeserializationError error = deserializeJson(doc, webRequest.arg("plain"));
+  if (error || !doc.is<JsonArray>()) {
+    sendApiResponse(400, false, "Body must be a JSON array of commands");
+    return;
+  }
+  JsonArrayConst items = doc.as<JsonArrayConst>();
+  if (items.size() == 0 || items.size() > WEB_BATCH_MAX_COMMANDS) {
+    sendApiResponse(400, false, "Batch must hold 1-" + String(WEB_BATCH_MAX_COMMANDS) + " commands");
+    return;
+  }
+
+  // Validate everything first - a rejected batch changes nothing
+  BatchCommand commands[WEB_BATCH_MAX_COMMANDS];
+  const char* errors[WEB_BATCH_MAX_COMMANDS];
+  uint8_t count = 0;
+  uint8_t invalid = 0;
+  for (JsonVariantConst item : items) {
+    errors[count] = item.is<JsonObjectConst>() ? parseBatchCommand(item.as<JsonObjectConst>(), commands[count])
+                                               : "Command must be an object";
+    if (errors[count] != nullptr) {
+      invalid++;
+    }
+    count++;
+  }
+
+  String results = "\"results\":[";
+  for (uint8_t i = 0; i < count; i++) {
+    if (i > 0) results += ",";
+    results += "{\"cmd\":\"";
+    results += escapeJsonString(items[i]["cmd"] | "");
+    results += errors[i] == nullptr ? "\",\"ok\":true" : "\",\"ok\":false,\"error\":\"";
+    if (errors[i] != nullptr) {
+      results += errors[i];
+      results += "\"";
+    }
+    results += "}";
+  }
+  results += "],\"count\":" + String(count);
+
+  if (invalid > 0) {
+    sendApiResponse(400, false, "Batch rejected, nothing applied", results);
+    return;
+  }
+
+  // Apply in order; eye changes are collected for a single LED update
+  bool hasColor = false;
+  bool hasBrightness = false;
+  BatchCommandType eyeEffect = BATCH_COLOR;   // BATCH_COLOR = solid
+  uint32_t eyeColor = 0;
+  uint8_t eyeBrightness = 0;
+
+  for (uint8_t i = 0; i < count; i++) {
+    const int* v = commands[i].values;
+    switch (commands[i].type) {
+      case BATCH_MODE:
+        applyWebMode((PersonalityMode)v[0]);
+        break;
+      case BATCH_COLOR:
+        eyeColor = Adafruit_NeoPixel::Color(v[0], v[1], v[2]);
+        hasColor = true;
+        eyeEffect = BATCH_COLOR;
+        break;
+      case BATCH_BRIGHTNESS:
+        eyeBrightness = v[0];
+        hasBrightness = true;
+        break;
+      case BATCH_FLICKER:
+      case BATCH_PULSE:
+        eyeEffect = commands[i].type;
+        break;
+      case BATCH_VOLUME:
+        setVolume(v[0]);
+        break;
+      case BATCH_SOUND:
+        playSound(v[0]);
+        statusLEDAudioActivity();
+        break;
+      case BATCH_SERVOS:
+        setRemoteServoTargets(v[0], v[1], v[2], v[3]);
+        break;
+    }
+  }
+
+  if (eyeEffect != BATCH_COLOR) {
+    if (hasBrightness) setEyeBrightness(eyeBrightness);
+    uint32_t base = hasColor ? eyeColor : animState.baseColorLeft;
+    if (eyeEffect == BATCH_PULSE) {
+      startPulseMode(base);
+    } else {
+      startFlickerMode(base);
     }
     lastActivityTime = millis();
-    
-    Serial.printf("Web request: Mode changed to %s\n", getModeName(currentMode).c_str());
-    server.send(200, "text/plain", "OK");
+  } else if (hasColor) {
+    if (hasBrightness) {
+      setEyeColorAndBrightness(eyeColor, eyeColor, eyeBrightness);
+    } else {
+      setEyeColor(eyeColor, eyeColor);
+    }
+    currentPixelMode = SOLID_COLOR;
+    lastActivityTime = millis();
+  } else if (hasBrightness) {
+    setEyeBrightness(eyeBrightness);
+  }
+
+  Serial.printf("Web request: Batch of %u commands applied\n", count);
+  sendApiResponse(200, true, "Batch applied", results);
+}
+
+//========================================
+// STATE SNAPSHOT WEB HANDLERS
+//========================================
+// GET /state returns the snapshot as {"ok","message","state":{...}} (or the
+// binary record with ?format=bin); POST /state takes either form back,
+// including a GET response as is. Stored scenes are RAM slots (?slot=N) or
+// LittleFS files (?name=X).
+
+static void sendStateJson(const StateSnapshot& snapshot, const char* message) {
+  DynamicJsonDocument doc(STATE_JSON_SIZE);
+  doc["ok"] = true;
+  doc["message"] = message;
+  stateSnapshotToJson(snapshot, doc.createNestedObject("state"));
+  String json;
+  serializeJson(doc, json);
+  webRequest.send(200, "application/json", json);
+}
+
+static void sendStateRestored(const StateSnapshot& snapshot, const char* source) {
+  String errorMessage;
+  bool complete = applyStateSnapshot(snapshot, errorMessage);
+  Serial.printf("Web request: State restored from %s\n", source);
+  if (complete) {
+    sendApiResponse(200, true, "State restored.");
   } else {
-    server.send(400, "text/plain", "Missing mode parameter");
+    sendApiResponse(200, true, "State restored without playback: " + errorMessage);
+  }
+}
+
+// Reads ?slot=N or ?name=X; false (and the reply sent) if neither is usable
+static bool parseSceneTarget(int& slot, String& name) {
+  slot = -1;
+  name = "";
+  if (webRequest.hasArg("slot")) {
+    if (!safeParseInt(webRequest.arg("slot"), slot, 0, SCENE_RAM_SLOTS - 1)) {
+      sendApiResponse(400, false, "Invalid slot (0-" + String(SCENE_RAM_SLOTS - 1) + ").");
+      return false;
+    }
+  } else if (webRequest.hasArg("name")) {
+    name = webRequest.arg("name");
   }
+  return true;
+}
+
+void handleState() {
+  if (!checkWebAuth()) return;
+
+  if (strcmp(webRequest.methodName(), "POST") != 0) {
+    StateSnapshot snapshot;
+    captureStateSnapshot(snapshot);
+    if (webRequest.arg("format") == "bin") {
+      webRequest.send(200, "application/octet-stream", (const uint8_t*)&snapshot, sizeof(snapshot));
+    } else {
+      sendStateJson(snapshot, "Current state");
+    }
+    return;
+  }
+
+  size_t length;
+  const uint8_t* body = webRequest.body(length);
+  if (body == nullptr || length == 0) {
+    sendApiResponse(400, false, "Missing state body.");
+    return;
+  }
+
+  StateSnapshot snapshot;
+  String errorMessage;
+  bool valid;
+  if (body[0] == '{') {
+    DynamicJsonDocument doc(STATE_JSON_SIZE);
+    if (deserializeJson(doc, (const char*)body, length)) {
+      sendApiResponse(400, false, "Invalid JSON.");
+      return;
+    }
+    JsonObjectConst state = doc["state"];
+    if (state.isNull()) {
+      state = doc.as<JsonObjectConst>();  // Bare snapshot object
+    }
+    valid = stateSnapshotFromJson(state, snapshot, errorMessage);
+  } else {
+    valid = stateSnapshotFromBinary(body, length, snapshot, errorMessage);
+  }
+  if (!valid) {
+    sendApiResponse(400, false, errorMessage);
+    return;
+  }
+  sendStateRestored(snapshot, "request body");
+}
+
+void handleStateSave() {
+  if (!checkWebAuth()) return;
+
+  int slot;
+  String name;
+  if (!parseSceneTarget(slot, name)) return;
+
+  StateSnapshot snapshot;
+  captureStateSnapshot(snapshot);
+
+  if (name.length() > 0) {
+    String errorMessage;
+    if (!saveSceneFile(name.c_str(), snapshot, errorMessage)) {
+      sendApiResponse(400, false, errorMessage);
+      return;
+    }
+    Serial.printf("Web request: Scene '%s' saved\n", name.c_str());
+    sendApiResponse(200, true, "Scene saved.", "\"name\":\"" + escapeJsonString(name.c_str()) + "\"");
+    return;
+  }
+
+  if (slot < 0) {
+    slot = storeSceneSlot(snapshot);
+  } else {
+    storeSceneSlot((uint8_t)slot, snapshot);
+  }
+  sendApiResponse(200, true, "Scene stored in RAM.", "\"slot\":" + String(slot));
+}
+
+void handleStateRecall() {
+  if (!checkWebAuth()) return;
+
+  int slot;
+  String name;
+  if (!parseSceneTarget(slot, name)) return;
+
+  StateSnapshot snapshot;
+  if (name.length() > 0) {
+    String errorMessage;
+    if (!loadSceneFile(name.c_str(), snapshot, errorMessage)) {
+      sendApiResponse(errorMessage == "Scene not found" ? 404 : 400, false, errorMessage);
+      return;
+    }
+    sendStateRestored(snapshot, name.c_str());
+  } else if (slot >= 0) {
+    if (!getSceneSlot((uint8_t)slot, snapshot)) {
+      sendApiResponse(404, false, "Slot is empty.");
+      return;
+    }
+    sendStateRestored(snapshot, "RAM slot");
+  } else {
+    sendApiResponse(400, false, "Missing slot or name parameter.");
+  }
+}
+
+// RAM slots, copied when the request runs (the list is sent from the network task)
+class SceneSlotList : public JsonListSource {
+public:
+  SceneSlotList() : JsonListSource("Scene slots loaded.", "slots"), index(0) {
+    for (uint8_t slot = 0; slot < SCENE_RAM_SLOTS; slot++) {
+      StateSnapshot snapshot;
+      entries[slot].used = getSceneSlotAge(slot, entries[slot].ageMs) && getSceneSlot(slot, snapshot);
+      if (entries[slot].used) {
+        entries[slot].mode = (PersonalityMode)snapshot.personalityMode;
+        strlcpy(entries[slot].sequence, (snapshot.flags & STATE_FLAG_PLAYING) ? snapshot.sequence : "",
+                sizeof(entries[slot].sequence));
+      }
+    }
+  }
+
+protected:
+  bool nextItem(char* out, size_t size) override {
+    if (index >= SCENE_RAM_SLOTS) {
+      return false;
+    }
+    const SlotEntry& entry = entries[index];
+    if (!entry.used) {
+      snprintf(out, size, "{\"slot\":%u,\"used\":false}", index);
+    } else {
+      snprintf(out, size, "{\"slot\":%u,\"used\":true,\"ageMs\":%lu,\"mode\":\"%s\",\"sequence\":",
+               index, entry.ageMs, getModeName(entry.mode).c_str());
+      appendJsonString(out, size, entry.sequence);
+      strlcat(out, "}", size);
+    }
+    index++;
+    return true;
+  }
+
+private:
+  struct SlotEntry {
+    bool used;
+    unsigned long ageMs;
+    PersonalityMode mode;
+    char sequence[MAX_SEQUENCE_NAME_LENGTH];
+  };
+  SlotEntry entries[SCENE_RAM_SLOTS];
+  uint8_t index;
+};
+
+void handleStateSlots() {
+  if (!checkWebAuth()) return;
+  webRequest.sendChunked("application/json", new SceneSlotList());
+}
+
+void handleStateDelete() {
+  if (!checkWebAuth()) return;
+
+  if (!webRequest.hasArg("name")) {
+    sendApiResponse(400, false, "Missing name parameter.");
+    return;
+  }
+  String name = webRequest.arg("name");
+  String errorMessage;
+  if (!deleteSceneFile(name.c_str(), errorMessage)) {
+    sendApiResponse(errorMessage == "Scene not found" ? 404 : 400, false, errorMessage);
+    return;
+  }
+  sendApiResponse(200, true, "Scene deleted.");
 }
 
 //========================================
@@ -563,40 +1280,40 @@ void handleWebMode() {
 
 void handleDetailCount() {
   if (!checkWebAuth()) return;
-  if (server.hasArg("value")) {
+  if (webRequest.hasArg("value")) {
     int count;
-    if (!safeParseInt(server.arg("value"), count, 1, 8)) {
-      server.send(400, "text/plain", "Invalid count value (must be 1-8)");
+    if (!safeParseInt(webRequest.arg("value"), count, 1, 8)) {
+      webRequest.send(400, "text/plain", "Invalid count value (must be 1-8)");
       return;
     }
     setDetailCount(count);
     Serial.printf("Web request: Detail LED count set to %d\n", count);
-    server.send(200, "text/plain", "OK");
+    webRequest.send(200, "text/plain", "OK");
   } else {
-    server.send(400, "text/plain", "Missing value parameter");
+    webRequest.send(400, "text/plain", "Missing value parameter");
   }
 }
 
 void handleDetailBrightnessWeb() {
   if (!checkWebAuth()) return;
-  if (server.hasArg("value")) {
+  if (webRequest.hasArg("value")) {
     int brightness;
-    if (!safeParseInt(server.arg("value"), brightness, 0, 255)) {
-      server.send(400, "text/plain", "Invalid brightness value (must be 0-255)");
+    if (!safeParseInt(webRequest.arg("value"), brightness, 0, 255)) {
+      webRequest.send(400, "text/plain", "Invalid brightness value (must be 0-255)");
       return;
     }
     setDetailBrightness(brightness);
     Serial.printf("Web request: Detail LED brightness set to %d\n", brightness);
-    server.send(200, "text/plain", "OK");
+    webRequest.send(200, "text/plain", "OK");
   } else {
-    server.send(400, "text/plain", "Missing value parameter");
+    webRequest.send(400, "text/plain", "Missing value parameter");
   }
 }
 
 void handleDetailPatternWeb() {
   if (!checkWebAuth()) return;
-  if (server.hasArg("pattern")) {
-    String pattern = server.arg("pattern");
+  if (webRequest.hasArg("pattern")) {
+    String pattern = webRequest.arg("pattern");
     pattern.toLowerCase();
 
     if (pattern == "blink") {
@@ -610,114 +1327,185 @@ void handleDetailPatternWeb() {
     } else if (pattern == "random") {
       startDetailRandom();
     } else {
-      server.send(400, "text/plain", "Invalid pattern");
+      webRequest.send(400, "text/plain", "Invalid pattern");
       return;
     }
 
     Serial.printf("Web request: Detail LED pattern set to %s\n", pattern.c_str());
-    server.send(200, "text/plain", "OK");
+    webRequest.send(200, "text/plain", "OK");
   } else {
-    server.send(400, "text/plain", "Missing pattern parameter");
+    webRequest.send(400, "text/plain", "Missing pattern parameter");
   }
 }
 
 void handleDetailEnabledWeb() {
   if (!checkWebAuth()) return;
-  if (server.hasArg("state")) {
-    String state = server.arg("state");
+  if (webRequest.hasArg("state")) {
+    String state = webRequest.arg("state");
     state.toLowerCase();
 
     if (state == "off") {
       setDetailEnabled(false);
       Serial.println("Web request: Detail LEDs disabled");
-      server.send(200, "text/plain", "OK");
+      webRequest.send(200, "text/plain", "OK");
     } else if (state == "on") {
       setDetailEnabled(true);
       Serial.println("Web request: Detail LEDs enabled");
-      server.send(200, "text/plain", "OK");
+      webRequest.send(200, "text/plain", "OK");
     } else {
-      server.send(400, "text/plain", "Invalid state");
+      webRequest.send(400, "text/plain", "Invalid state");
     }
   } else {
-    server.send(400, "text/plain", "Missing state parameter");
+    webRequest.send(400, "text/plain", "Missing state parameter");
   }
 }
 
 void handleNotFound() {
   String message = "404 - Not Found\n\n";
-  message += "URI: " + server.uri() + "\n";
+  message += "URI: " + webRequest.uri() + "\n";
   message += "Method: ";
-  message += (server.method() == HTTP_GET) ? "GET" : "POST";
+  message += webRequest.methodName();
   message += "\n";
-  message += "Arguments: " + String(server.args()) + "\n";
+  message += "Arguments: " + String(webRequest.args()) + "\n";
   
-  for (uint8_t i = 0; i < server.args(); i++) {
-    message += " " + server.argName(i) + ": " + server.arg(i) + "\n";
+  for (uint8_t i = 0; i < webRequest.args(); i++) {
+    message += " " + webRequest.argName(i) + ": " + webRequest.arg(i) + "\n";
   }
   
-  server.send(404, "text/plain", message);
-  Serial.println("Web request: 404 - " + server.uri());
+  webRequest.send(404, "text/plain", message);
+  Serial.println("Web request: 404 - " + webRequest.uri());
 }
 
 //========================================
 // COMMAND PROCESSING - UPDATED WITH STATUS LED
 //========================================
 
-Command parseCommand(String cmd) {
-  cmd.toLowerCase();
-  
-  if (cmd == "help") return CMD_HELP;
-  if (cmd == "status") return CMD_STATUS;
-  if (cmd == "reset") return CMD_RESET;
-  if (cmd == "save") return CMD_SAVE;
-  if (cmd == "config") return CMD_CONFIG;
-  if (cmd == "learn") return CMD_LEARN;
-  if (cmd == "scan") return CMD_SCAN;
-  if (cmd == "show") return CMD_SHOW;
-  if (cmd == "clear") return CMD_CLEAR;
-  if (cmd == "default") return CMD_DEFAULT;
-  if (cmd == "servo") return CMD_SERVO;
-  if (cmd == "led") return CMD_LED;
-  if (cmd == "sound") return CMD_SOUND;
-  if (cmd == "timing") return CMD_TIMING;
-  if (cmd == "profile") return CMD_PROFILE;
-  if (cmd == "monitor") return CMD_MONITOR;
-  if (cmd == "test") return CMD_TEST;
-  if (cmd == "demo") return CMD_DEMO;
-  if (cmd == "backup") return CMD_BACKUP;
-  if (cmd == "restore") return CMD_RESTORE;
-  if (cmd == "exit" || cmd == "normal") return CMD_EXIT;
-  if (cmd == "ir on") return CMD_IR_ON;
-  if (cmd == "ir off") return CMD_IR_OFF;
-  if (cmd == "mode") return CMD_MODE;
-  if (cmd == "detail") return CMD_DETAIL;
-  if (cmd == "wifi") return CMD_WIFI;
-  if (cmd == "ap") return CMD_AP;
-  if (cmd == "seq") return CMD_SEQ;
+// Command tables - keep each one sorted by name, cliLookup() binary searches them
+static const CLITableEntry irSubCommands[] = {
+  {"off",     CMD_IR_OFF,   nullptr, 0},
+  {"on",      CMD_IR_ON,    nullptr, 0},
+  {"stats",   CMD_IR_STATS, nullptr, 0}
+};
+
+static const CLITableEntry cliCommands[] = {
+  {"ap",      CMD_AP,       nullptr, 0},
+  {"backup",  CMD_BACKUP,   nullptr, 0},
+  {"clear",   CMD_CLEAR,    nullptr, 0},
+  {"combo",   CMD_COMBO,    nullptr, 0},
+  {"config",  CMD_CONFIG,   nullptr, 0},
+  {"default", CMD_DEFAULT,  nullptr, 0},
+  {"demo",    CMD_DEMO,     nullptr, 0},
+  {"detail",  CMD_DETAIL,   nullptr, 0},
+  {"events",  CMD_EVENTS,   nullptr, 0},
+  {"exit",    CMD_EXIT,     nullptr, 0},
+  {"help",    CMD_HELP,     nullptr, 0},
+  {"ir",      CMD_UNKNOWN,  irSubCommands, CLI_TABLE_SIZE(irSubCommands)},
+  {"learn",   CMD_LEARN,    nullptr, 0},
+  {"led",     CMD_LED,      nullptr, 0},
+  {"mode",    CMD_MODE,     nullptr, 0},
+  {"monitor", CMD_MONITOR,  nullptr, 0},
+  {"normal",  CMD_EXIT,     nullptr, 0},
+  {"profile", CMD_PROFILE,  nullptr, 0},
+  {"puppet",  CMD_PUPPET,   nullptr, 0},
+  {"reset",   CMD_RESET,    nullptr, 0},
+  {"restore", CMD_RESTORE,  nullptr, 0},
+  {"save",    CMD_SAVE,     nullptr, 0},
+  {"scan",    CMD_SCAN,     nullptr, 0},
+  {"seq",     CMD_SEQ,      nullptr, 0},
+  {"servo",   CMD_SERVO,    nullptr, 0},
+  {"show",    CMD_SHOW,     nullptr, 0},
+  {"sound",   CMD_SOUND,    nullptr, 0},
+  {"state",   CMD_STATE,    nullptr, 0},
+  {"status",  CMD_STATUS,   nullptr, 0},
+  {"test",    CMD_TEST,     nullptr, 0},
+  {"timing",  CMD_TIMING,   nullptr, 0},
+  {"web",     CMD_WEB,      nullptr, 0},
+  {"wifi",    CMD_WIFI,     nullptr, 0},
+  {"ws",      CMD_WS,       nullptr, 0}
+};
+
+static CLILineAssembler serialLine;
+
+void initializeCLI() {
+  memset(&serialLine, 0, sizeof(serialLine));
+  memset(&serialPrompt, 0, sizeof(serialPrompt));
+  cliTableSorted(cliCommands, CLI_TABLE_SIZE(cliCommands));
+}
 
-  return CMD_UNKNOWN;
+void pollSerialCommands() {
+  // Binary puppet frames and text commands share the port; frame bytes are
+  // claimed by the puppet parser, everything else builds the command line
+  // or answers the pending prompt. Stop at the first complete line so bytes
+  // after it (e.g. pasted JSON for seq import) stay in the stream for
+  // whoever handles the command.
+  while (Serial.available() > 0) {
+    uint8_t c = (uint8_t)Serial.read();
+    if (puppetLinkFeed(c)) {
+      continue;
+    }
+    if (serialPrompt.raw && cliPromptActive(serialPrompt)) {
+      cliPromptFeedByte(serialPrompt, (char)c);
+      continue;
+    }
+    char* line = cliFeedChar(serialLine, (char)c);
+    if (line != nullptr) {
+      if (cliPromptActive(serialPrompt)) {
+        cliPromptFeedLine(serialPrompt, line);
+      } else {
+        processCommand(line);
+      }
+      return;
+    }
+  }
+
+  cliPromptPoll(serialPrompt);
 }
 
-void processCommand(String fullCommand) {
-  int spaceIndex = fullCommand.indexOf(' ');
-  String cmd = (spaceIndex > 0) ? fullCommand.substring(0, spaceIndex) : fullCommand;
-  String params = (spaceIndex > 0) ? fullCommand.substring(spaceIndex + 1) : "";
-  
-  String cmdLower = cmd;
-  cmdLower.toLowerCase();
-  if (cmdLower == "ir") {
-    String paramsLower = params;
-    paramsLower.toLowerCase();
-    if (paramsLower == "on") {
-      cmd = "ir on";
-      params = "";
-    } else if (paramsLower == "off") {
-      cmd = "ir off";
-      params = "";
+// Resolves the leading tokens to a command. consumed = tokens used by the
+// command name (2 for grouped commands such as "ir on").
+Command parseCommand(uint8_t argc, char* argv[], uint8_t& consumed) {
+  const CLITableEntry* table = cliCommands;
+  uint8_t count = CLI_TABLE_SIZE(cliCommands);
+  consumed = 0;
+
+  while (consumed < argc) {
+    int index = cliLookup(table, count, argv[consumed]);
+    if (index < 0) {
+      return CMD_UNKNOWN;
     }
+    consumed++;
+
+    const CLITableEntry& entry = table[index];
+    if (entry.subTable == nullptr) {
+      return (Command)entry.id;
+    }
+    table = entry.subTable;
+    count = entry.subCount;
   }
-  
-  Command command = parseCommand(cmd);
+
+  return CMD_UNKNOWN;
+}
+
+static bool confirmClearCommand(CLIPromptEvent event, const char* input, const char* arg) {
+  if (promptConfirmed(event, input, "YES", F("Operation cancelled."))) {
+    clearAllData();  // Asks a second time
+  }
+  return false;
+}
+
+void processCommand(char* line) {
+  char* argv[CLI_MAX_ARGS];
+  uint8_t argc = cliTokenize(line, argv, CLI_MAX_ARGS);
+  if (argc == 0) {
+    return;
+  }
+
+  uint8_t consumed;
+  Command command = parseCommand(argc, argv, consumed);
+
+  // Sub-handlers see their own sub-command as params[0]
+  uint8_t paramCount = argc - consumed;
+  char** params = argv + consumed;
   
   switch (command) {
     case CMD_HELP:
@@ -757,44 +1545,33 @@ void processCommand(String fullCommand) {
       showSavedCodes();
       break;
       
-    case CMD_CLEAR: {
+    case CMD_CLEAR:
       Serial.print("Clear all data? Type 'YES' to confirm (30s timeout): ");
-      if (!waitForSerialWithTimeout(30000)) {
-        Serial.println("Timeout - operation cancelled.");
-        break;
-      }
-      String confirmation = Serial.readStringUntil('\n');
-      confirmation.trim();
-      if (confirmation == "YES") {
-        clearAllData();
-      } else {
-        Serial.println("Operation cancelled.");
-      }
+      cliPromptBegin(serialPrompt, confirmClearCommand, nullptr, 30000);
       break;
-    }
           
     case CMD_DEFAULT:
       loadDefaultCodes();
       break;
       
     case CMD_SERVO:
-      handleServoCommand(params);
+      handleServoCommand(paramCount, params);
       break;
       
     case CMD_LED:
-      handleLEDCommand(params);
+      handleLEDCommand(paramCount, params);
       break;
       
     case CMD_SOUND:
-      handleSoundCommand(params);
+      handleSoundCommand(paramCount, params);
       break;
       
     case CMD_TIMING:
-      handleTimingCommand(params);
+      handleTimingCommand(paramCount, params);
       break;
       
     case CMD_PROFILE:
-      handleProfileCommand(params);
+      handleProfileCommand(paramCount, params);
       break;
       
     case CMD_MONITOR:
@@ -802,7 +1579,7 @@ void processCommand(String fullCommand) {
       break;
       
     case CMD_TEST:
-      runTestSequence(params);
+      runTestSequence(paramCount, params);
       break;
 
     case CMD_DEMO:
@@ -824,34 +1601,41 @@ void processCommand(String fullCommand) {
       break;
       
     case CMD_IR_ON:
+      if (!config.irEnabled) {
+        irReceiverBegin();
+      }
       config.irEnabled = true;
-      IrReceiver.begin(IR_RECEIVER_PIN, false);
       smartSaveToEEPROM();
       Serial.println("IR enabled.");
       break;
       
     case CMD_IR_OFF:
+      if (config.irEnabled) {
+        irReceiverEnd();
+      }
       config.irEnabled = false;
-      IrReceiver.end();
       smartSaveToEEPROM();
       Serial.println("IR disabled.");
       break;
+
+    case CMD_IR_STATS:
+      printIRInputStats();
+      break;
       
     case CMD_MODE:
-      if (params.length() == 0) {
+      if (paramCount == 0) {
         Serial.println("Current mode: " + getModeName(currentMode));
         Serial.println("Available modes: scanning, alert, idle");
       } else {
-        params.toLowerCase();
-        if (params == "scanning") {
+        if (cliIs(params[0], "scanning")) {
           currentMode = MODE_SCANNING;
           statusLEDScanningMode(); // Update status LED
           Serial.println("Mode set to SCANNING");
-        } else if (params == "alert") {
+        } else if (cliIs(params[0], "alert")) {
           currentMode = MODE_ALERT;
           statusLEDAlertMode(); // Update status LED
           Serial.println("Mode set to ALERT");
-        } else if (params == "idle") {
+        } else if (cliIs(params[0], "idle")) {
           currentMode = MODE_IDLE;
           statusLEDIdleMode(); // Update status LED
           Serial.println("Mode set to IDLE");
@@ -870,19 +1654,47 @@ void processCommand(String fullCommand) {
       break;
 
     case CMD_DETAIL:
-      handleDetailCommand(params);
+      handleDetailCommand(paramCount, params);
       break;
 
     case CMD_WIFI:
-      handleWiFiCommand(params);
+      handleWiFiCommand(paramCount, params);
       break;
 
     case CMD_AP:
-      handleAPCommand(params);
+      handleAPCommand(paramCount, params);
       break;
 
     case CMD_SEQ:
-      handleSequenceCommand(params);
+      handleSequenceCommand(paramCount, params);
+      break;
+
+    case CMD_COMBO:
+      handleComboCommand(paramCount, params);
+      break;
+
+    case CMD_PUPPET:
+      if (paramCount > 0 && cliIs(params[0], "release")) {
+        releasePuppet("serial command");
+      } else {
+        printPuppetLinkStats();
+      }
+      break;
+
+    case CMD_WS:
+      printWebLinkStats();
+      break;
+
+    case CMD_WEB:
+      printWebControlStats();
+      break;
+
+    case CMD_EVENTS:
+      printWebEventStats();
+      break;
+
+    case CMD_STATE:
+      handleStateCommand(paramCount, params);
       break;
 
     default:
@@ -907,7 +1719,7 @@ void playSound(int fileNumber) {
     return;
   }
   
-  mp3.playFolderTrack(4, fileNumber);
+  audioPlayFolderTrack(4, fileNumber);
   lastActivityTime = millis();
   statusLEDAudioActivity(); // NEW: Flash green for audio
   Serial.printf("Playing sound file %d\n", fileNumber);
@@ -920,10 +1732,10 @@ void playRandomSound(int folder) {
     return;
   }
   
-  int trackCount = mp3.getFolderTrackCount(folder);
+  int trackCount = audioGetFolderTrackCount(folder);
   if (trackCount > 0) {
     int track = random(1, trackCount + 1);
-    mp3.playFolderTrack(folder, track);
+    audioPlayFolderTrack(folder, track);
     lastActivityTime = millis();
     statusLEDAudioActivity(); // NEW: Flash green for audio
     Serial.printf("Playing random sound: folder %d, track %d\n", folder, track);
@@ -941,7 +1753,7 @@ void setVolume(uint8_t volume) {
   config.savedVolume = volume;
   currentVolume = volume;  // Keep sequence recording state in sync
   if (isAudioReady) {
-    mp3.setVolume(volume);
+    audioSetVolume(volume);
     Serial.printf("Volume set to %d\n", volume);
   } else {
     Serial.println("Audio system not ready, volume setting saved");
@@ -978,6 +1790,48 @@ void updateAudio() {
 // IR LEARNING AND SCANNING - UPDATED WITH STATUS LED
 //========================================
 
+// Second half of learning: prompt for each button in turn
+static void beginButtonLearning() {
+  invalidateIRDispatchTable();
+
+  Serial.println("\nPress each button when prompted.");
+  Serial.println("Type 'exit' to cancel learning.");
+  Serial.printf("\nPress button '%s'\n", config.buttons[0].name);
+  
+  waitingForIR = true;
+  learningTimeout = millis();
+}
+
+// Answer to "How many buttons?" - IR capture starts once it is known
+static bool learnButtonCountAnswered(CLIPromptEvent event, const char* input, const char* arg) {
+  if (event == CLI_PROMPT_TIMEOUT) {
+    Serial.println(F("\n⏱️ Timeout (30s) - using default 17 buttons."));
+    config.buttonCount = 17;
+  } else if (cliIs(input, "exit") || cliIs(input, "normal")) {
+    operatingMode = MODE_NORMAL;
+    autoUpdateStatusLED(); // NEW: Return to normal status
+    Serial.println("Learning cancelled.");
+    return false;
+  } else {
+    config.buttonCount = constrain(atoi(input), 1, 21);
+  }
+  Serial.printf("Learning %d buttons.\n", config.buttonCount);
+
+  for (int i = 0; i < config.buttonCount && i < 17; i++) {
+    strncpy(config.buttons[i].name, standard17Buttons[i], sizeof(config.buttons[i].name) - 1);
+    config.buttons[i].name[sizeof(config.buttons[i].name) - 1] = '\0';  // Ensure null termination
+    config.buttons[i].isConfigured = false;
+  }
+
+  for (int i = 17; i < config.buttonCount; i++) {
+    snprintf(config.buttons[i].name, sizeof(config.buttons[i].name), "BTN%d", i + 1);
+    config.buttons[i].isConfigured = false;
+  }
+
+  beginButtonLearning();
+  return false;
+}
+
 void enterLearningMode() {
   operatingMode = MODE_IR_LEARNING;
   currentButtonIndex = 0;
@@ -989,41 +1843,11 @@ void enterLearningMode() {
   
   if (config.buttonCount == 0) {
     Serial.print("How many buttons does your remote have? (1-21, 30s timeout): ");
-    String buttonInput;
-    unsigned long inputTimeout = millis();
-    while (Serial.available() == 0) {
-      delay(50);
-      if (millis() - inputTimeout > 30000) {
-        Serial.println(F("\n⏱️ Timeout (30s) - using default 17 buttons."));
-        config.buttonCount = 17;
-        break;
-      }
-    }
-    if (Serial.available()) {
-      buttonInput = Serial.readStringUntil('\n');
-      buttonInput.trim();
-      config.buttonCount = constrain(buttonInput.toInt(), 1, 21);
-    }
-    Serial.printf("Learning %d buttons.\n", config.buttonCount);
-
-    for (int i = 0; i < config.buttonCount && i < 17; i++) {
-      strncpy(config.buttons[i].name, standard17Buttons[i], sizeof(config.buttons[i].name) - 1);
-      config.buttons[i].name[sizeof(config.buttons[i].name) - 1] = '\0';  // Ensure null termination
-      config.buttons[i].isConfigured = false;
-    }
-
-    for (int i = 17; i < config.buttonCount; i++) {
-      snprintf(config.buttons[i].name, sizeof(config.buttons[i].name), "BTN%d", i + 1);
-      config.buttons[i].isConfigured = false;
-    }
+    cliPromptBegin(serialPrompt, learnButtonCountAnswered, nullptr, 30000);
+    return;
   }
   
-  Serial.println("\nPress each button when prompted.");
-  Serial.println("Type 'exit' to cancel learning.");
-  Serial.printf("\nPress button '%s'\n", config.buttons[0].name);
-  
-  waitingForIR = true;
-  learningTimeout = millis();
+  beginButtonLearning();
 }
 
 void handleLearningMode() {
@@ -1034,15 +1858,7 @@ void handleLearningMode() {
     return;
   }
   
-  if (Serial.available()) {
-    String cmd = Serial.readStringUntil('\n');
-    if (cmd.indexOf("exit") >= 0) {
-      operatingMode = MODE_NORMAL;
-      autoUpdateStatusLED(); // NEW: Return to normal status
-      Serial.println("Learning cancelled");
-      return;
-    }
-  }
+  // 'exit' arrives through the command line (CMD_EXIT)
   
   uint32_t code;
   if (waitingForIR && checkForIRCommand(code)) {
@@ -1050,6 +1866,7 @@ void handleLearningMode() {
     
     config.buttons[currentButtonIndex].code = code;
     config.buttons[currentButtonIndex].isConfigured = true;
+    invalidateIRDispatchTable();
     
     currentButtonIndex++;
     waitingForIR = false;
@@ -1071,243 +1888,483 @@ void handleLearningMode() {
   }
 }
 
-void handleScannerMode() {
-  if (Serial.available()) {
-    String cmd = Serial.readStringUntil('\n');
-    if (cmd.indexOf("exit") >= 0 || cmd.indexOf("normal") >= 0) {
-      operatingMode = MODE_NORMAL;
-      autoUpdateStatusLED(); // NEW: Return to normal status
-      Serial.println("Exiting scanner mode");
-      return;
-    }
+void handleScannerMode() {
+  // 'exit' / 'normal' arrive through the command line (CMD_EXIT)
+  IREvent event;
+  while (popIREvent(event)) {
+    if (event.isRepeat) continue;
+    statusLEDIRActivity(); // NEW: Flash white for IR activity
+    Serial.printf("Received: 0x%08X (Protocol: %s)\n", (unsigned int)event.code,
+                  (const char*)getProtocolString((decode_type_t)event.protocol));
+  }
+}
+
+//========================================
+// IR HOLD-TO-REPEAT JOGGING
+//========================================
+// Direction buttons start a jog toward the axis limit. While repeat frames
+// keep arriving the planner step grows along irJogCurve; once frames stop
+// for IR_JOG_RELEASE_MS the target snaps to the current position.
+
+struct IRJogStage {
+  unsigned long heldMs;       // Stage starts after the button is held this long
+  uint8_t stepSize;           // Degrees per planner step
+  unsigned long moveInterval; // Planner interval (ms)
+};
+
+static const IRJogStage irJogCurve[] = {
+  {0,    1, 40},   // ~25 deg/s  - fine positioning on a tap
+  {300,  1, 20},   // ~50 deg/s
+  {800,  2, 20},   // ~100 deg/s
+  {1500, 4, 20}    // ~200 deg/s - full sweep in under a second
+};
+
+struct IRJogState {
+  bool active;
+  int8_t panDir;              // -1 toward min, +1 toward max, 0 idle
+  int8_t tiltDir;
+  uint32_t code;              // Button that started the jog (0 = serial), only its repeats extend it
+  unsigned long startTime;    // Initial press
+  unsigned long lastFrame;    // Last press or repeat frame
+  uint8_t stage;              // Current index into irJogCurve
+};
+
+static IRJogState irJog = {false, 0, 0, 0, 0, 0, 0};
+static uint32_t irDispatchCode = 0;   // Code of the button whose action is running
+
+static void applyJogStage(ServoState& servo, int8_t dir, const IRJogStage& stage) {
+  if (dir == 0) return;
+  servo.stepSize = stage.stepSize;
+  servo.moveInterval = stage.moveInterval;
+  servo.targetPosition = dir > 0 ? servo.maxRange : servo.minRange;
+  servo.isMoving = true;
+}
+
+static void haltJogAxis(ServoState& servo, int8_t dir) {
+  if (dir == 0) return;
+  servo.targetPosition = servo.currentPosition;
+  servo.isMoving = false;
+}
+
+static void startIRJog(int8_t panDir, int8_t tiltDir) {
+  unsigned long now = millis();
+
+  // A different direction while jogging stops the old axis first
+  if (irJog.active) {
+    if (irJog.panDir != panDir) haltJogAxis(eyePan, irJog.panDir);
+    if (irJog.tiltDir != tiltDir) haltJogAxis(eyeTilt, irJog.tiltDir);
+  }
+
+  irJog.active = true;
+  irJog.panDir = panDir;
+  irJog.tiltDir = tiltDir;
+  irJog.code = irDispatchCode;
+  irJog.startTime = now;
+  irJog.lastFrame = now;
+  irJog.stage = 0;
+
+  applyJogStage(eyePan, panDir, irJogCurve[0]);
+  applyJogStage(eyeTilt, tiltDir, irJogCurve[0]);
+  statusLEDServoActivity(); // NEW: Flash blue for servo
+}
+
+static void stopIRJog() {
+  haltJogAxis(eyePan, irJog.panDir);
+  haltJogAxis(eyeTilt, irJog.tiltDir);
+  irJog.active = false;
+  irJog.panDir = 0;
+  irJog.tiltDir = 0;
+  setServoParameters();  // Restore personality step size and intervals
+}
+
+// Repeat frame (or debounced duplicate) of the button with this code
+static void handleIRRepeat(uint32_t code) {
+  if (!irJog.active) {
+    return;  // One-shot buttons ignore repeats
+  }
+  if (code != irJog.code) {
+    stopIRJog();  // Another button is held now
+    return;
+  }
+  irJog.lastFrame = millis();
+  lastActivityTime = irJog.lastFrame;
+}
+
+bool isIRJogActive() {
+  return irJog.active;
+}
+
+void updateIRJog(unsigned long currentMillis) {
+  if (!irJog.active) {
+    return;
+  }
+
+  if (currentMillis - irJog.lastFrame > IR_JOG_RELEASE_MS) {
+    stopIRJog();
+    return;
+  }
+
+  unsigned long held = currentMillis - irJog.startTime;
+  uint8_t stage = irJog.stage;
+  while (stage + 1 < sizeof(irJogCurve) / sizeof(irJogCurve[0]) &&
+         held >= irJogCurve[stage + 1].heldMs) {
+    stage++;
+  }
+
+  if (stage != irJog.stage) {
+    irJog.stage = stage;
+    applyJogStage(eyePan, irJog.panDir, irJogCurve[stage]);
+    applyJogStage(eyeTilt, irJog.tiltDir, irJogCurve[stage]);
+  }
+}
+
+//========================================
+// IR BUTTON ACTIONS
+//========================================
+// Built-in actions for the standard button names. Resolved once per
+// dispatch table rebuild, never on the input path.
+
+static void irActionUp() {
+  startIRJog(0, 1);
+}
+
+static void irActionDown() {
+  startIRJog(0, -1);
+}
+
+static void irActionLeft() {
+  startIRJog(1, 0);
+}
+
+static void irActionRight() {
+  startIRJog(-1, 0);
+}
+
+static void irActionOk() {
+  centerAllServos();
+  statusLEDServoActivity(); // NEW: Flash blue for servo
+}
+
+// Mode changes with status LED updates
+static void irActionScanningMode() {
+  currentMode = MODE_SCANNING;
+  setServoParameters();
+  statusLEDScanningMode(); // NEW: Update status LED
+  uint32_t iceBlue = Adafruit_NeoPixel::Color(80, 150, 255);
+  setEyeColor(iceBlue, iceBlue);
+  Serial.println("Scanning mode: Eyes set to ice blue");
+}
+
+static void irActionAlertMode() {
+  currentMode = MODE_ALERT;
+  setServoParameters();
+  statusLEDAlertMode(); // NEW: Update status LED
+  uint32_t alertRed = Adafruit_NeoPixel::Color(255, 0, 0);
+  setEyeColor(alertRed, alertRed);
+  Serial.println("Alert mode: Eyes set to red");
+}
+
+static void irActionIdleMode() {
+  currentMode = MODE_IDLE;
+  setServoParameters();
+  statusLEDIdleMode(); // NEW: Update status LED
+  uint32_t dimAmber = Adafruit_NeoPixel::Color(100, 60, 0);
+  setEyeColor(dimAmber, dimAmber);
+  Serial.println("Idle mode: Eyes set to dim amber");
+}
+
+// Audio commands with status LED flash
+static void irActionScanSound() {
+  if (isAudioReady) {
+    playRandomSound(1);
+    Serial.println("Playing random scanning sound");
+  }
+}
+
+static void irActionAlertSound() {
+  if (isAudioReady) {
+    playRandomSound(2);
+    Serial.println("Playing random alert sound");
   }
-  
-  uint32_t code;
-  if (checkForIRCommand(code)) {
-    statusLEDIRActivity(); // NEW: Flash white for IR activity
-    Serial.printf("Received: 0x%08X (Protocol: %s)\n", (unsigned int)code,
-                  IrReceiver.getProtocolString());
+}
+
+static void irActionVoiceSound() {
+  if (isAudioReady) {
+    playRandomSound(4);
+    Serial.println("Playing random voice line");
   }
 }
 
-void handleIRCommand(uint32_t code) {
-  statusLEDIRActivity(); // NEW: Flash white for IR command
-  
-  Serial.printf("IR: 0x%08X, Protocol: %s\n", (unsigned int)code, 
-                IrReceiver.getProtocolString());
+// Button 7: Start Demo Mode
+static void irActionDemo() {
+  enterDemoMode();
+  Serial.println("Starting comprehensive demo mode");
+}
 
-  for (int i = 0; i < config.buttonCount; i++) {
-    if (config.buttons[i].isConfigured && config.buttons[i].code == code) {
-      Serial.printf("Executing command for button: %s\n", config.buttons[i].name);
-
-      // Check if a sequence is mapped to this button
-      if (strlen(config.buttons[i].sequenceName) > 0) {
-        Serial.print(F("▶️ IR triggering sequence: "));
-        Serial.println(config.buttons[i].sequenceName);
-        sequenceManager.playSequence(config.buttons[i].sequenceName, false);
-        return;
-      }
+// Button 8: Toggle Detail LEDs
+static void irActionToggleDetail() {
+  setDetailEnabled(!detailState.enabled);
+  Serial.printf("Detail LEDs: %s\n", detailState.enabled ? "ON" : "OFF");
+}
 
-      // Otherwise execute standard button command
-      executeButtonCommand(config.buttons[i].name);
-      return;
-    }
+// Button 9: Cycle Eye Animation Modes
+static void irActionCycleAnimation() {
+  static int animationModeIndex = 0;
+  const PixelMode modes[] = {SOLID_COLOR, FLICKER, PULSE, SCANNER, HEARTBEAT, ALARM};
+  const char* modeNames[] = {"Solid", "Flicker", "Pulse", "Scanner", "Heartbeat", "Alarm"};
+  const int modeCount = 6;
+
+  animationModeIndex = (animationModeIndex + 1) % modeCount;
+
+  switch(modes[animationModeIndex]) {
+    case SOLID_COLOR:
+      setEyeColor(getK2SOBlue(), getK2SOBlue());
+      break;
+    case FLICKER:
+      startFlickerMode();
+      break;
+    case PULSE:
+      startPulseMode();
+      break;
+    case SCANNER:
+      startScannerMode();
+      break;
+    case HEARTBEAT:
+      startHeartbeatMode();
+      break;
+    case ALARM:
+      startAlarmMode();
+      break;
+    default:
+      break;
   }
 
-  Serial.println("Unknown IR code");
+  Serial.printf("Eye Animation: %s\n", modeNames[animationModeIndex]);
 }
 
-void executeButtonCommand(const char* buttonName) {
+// Color cycling commands
+static const uint32_t irCycleColors[COLOR_COUNT] = {
+  Adafruit_NeoPixel::Color(80, 150, 255),   // Ice blue
+  Adafruit_NeoPixel::Color(255, 0, 0),     // Red
+  Adafruit_NeoPixel::Color(0, 255, 0),     // Green
+  Adafruit_NeoPixel::Color(255, 255, 0),   // Yellow
+  Adafruit_NeoPixel::Color(255, 0, 255),   // Magenta
+  Adafruit_NeoPixel::Color(255, 255, 255)  // White
+};
+
+static void irActionColorForward() {
+  currentColorIndex = (currentColorIndex + 1) % COLOR_COUNT;
+  setEyeColor(irCycleColors[currentColorIndex], irCycleColors[currentColorIndex]);
+  Serial.printf("Color forward: %d\n", currentColorIndex);
+}
+
+static void irActionColorBackward() {
+  currentColorIndex = (currentColorIndex - 1 + COLOR_COUNT) % COLOR_COUNT;
+  setEyeColor(irCycleColors[currentColorIndex], irCycleColors[currentColorIndex]);
+  Serial.printf("Color backward: %d\n", currentColorIndex);
+}
+
+// Eyes on/off toggle
+static void irActionToggleEyes() {
+  if (leftEyeCurrentColor == 0 && rightEyeCurrentColor == 0) {
+    uint32_t white = Adafruit_NeoPixel::Color(255, 255, 255);
+    setEyeColor(white, white);
+    Serial.println("Eyes ON");
+  } else {
+    uint32_t off = Adafruit_NeoPixel::Color(0, 0, 0);
+    setEyeColor(off, off);
+    Serial.println("Eyes OFF");
+  }
+}
+
+typedef void (*IRButtonAction)();
+
+struct IRButtonActionEntry {
+  const char* name;
+  IRButtonAction action;
+};
+
+static const IRButtonActionEntry irButtonActions[] = {
+  {"UP",    irActionUp},
+  {"DOWN",  irActionDown},
+  {"LEFT",  irActionLeft},
+  {"RIGHT", irActionRight},
+  {"OK",    irActionOk},
+  {"1",     irActionScanningMode},
+  {"2",     irActionAlertMode},
+  {"3",     irActionIdleMode},
+  {"4",     irActionScanSound},
+  {"5",     irActionAlertSound},
+  {"6",     irActionVoiceSound},
+  {"7",     irActionDemo},
+  {"8",     irActionToggleDetail},
+  {"9",     irActionCycleAnimation},
+  {"*",     irActionColorForward},
+  {"#",     irActionColorBackward},
+  {"0",     irActionToggleEyes}
+};
+
+static IRButtonAction lookupButtonAction(const char* buttonName) {
+  for (size_t i = 0; i < sizeof(irButtonActions) / sizeof(irButtonActions[0]); i++) {
+    if (strcmp(buttonName, irButtonActions[i].name) == 0) {
+      return irButtonActions[i].action;
+    }
+  }
+  return nullptr;
+}
+
+static void runButtonAction(const char* buttonName, IRButtonAction action) {
   Serial.printf("Executing button command: %s\n", buttonName);
-  
+
   if (!isAwake) {
     isAwake = true;
   }
   lastActivityTime = millis();
 
-  // Servo movement commands
-  if (strcmp(buttonName, "UP") == 0) {
-    eyePan.targetPosition = config.eyePanCenter;
-    eyeTilt.targetPosition = config.eyeTiltMax;
-    eyePanServo.write(eyePan.targetPosition);
-    eyeTiltServo.write(eyeTilt.targetPosition);
-    statusLEDServoActivity(); // NEW: Flash blue for servo
-    return;
-  }
-  else if (strcmp(buttonName, "DOWN") == 0) {
-    eyePan.targetPosition = config.eyePanCenter;
-    eyeTilt.targetPosition = config.eyeTiltMin;
-    eyePanServo.write(eyePan.targetPosition);
-    eyeTiltServo.write(eyeTilt.targetPosition);
-    statusLEDServoActivity(); // NEW: Flash blue for servo
-    return;
-  } 
-  else if (strcmp(buttonName, "LEFT") == 0) {
-    eyePan.targetPosition = config.eyePanMax;
-    eyeTilt.targetPosition = config.eyeTiltCenter;
-    eyePanServo.write(eyePan.targetPosition);
-    eyeTiltServo.write(eyeTilt.targetPosition);
-    statusLEDServoActivity(); // NEW: Flash blue for servo
-    return;
-  } 
-  else if (strcmp(buttonName, "RIGHT") == 0) {
-    eyePan.targetPosition = config.eyePanMin;
-    eyeTilt.targetPosition = config.eyeTiltCenter;
-    eyePanServo.write(eyePan.targetPosition);
-    eyeTiltServo.write(eyeTilt.targetPosition);
-    statusLEDServoActivity(); // NEW: Flash blue for servo
-    return;
-  } 
-  else if (strcmp(buttonName, "OK") == 0) {
-    centerAllServos();
-    statusLEDServoActivity(); // NEW: Flash blue for servo
-    return;
-  } 
-  // Mode changes with status LED updates
-  else if (strcmp(buttonName, "1") == 0) {
-    currentMode = MODE_SCANNING;
-    setServoParameters();
-    statusLEDScanningMode(); // NEW: Update status LED
-    uint32_t iceBlue = Adafruit_NeoPixel::Color(80, 150, 255);
-    setEyeColor(iceBlue, iceBlue);
-    Serial.println("Scanning mode: Eyes set to ice blue");
-    return;
-  } 
-  else if (strcmp(buttonName, "2") == 0) {
-    currentMode = MODE_ALERT;
-    setServoParameters();
-    statusLEDAlertMode(); // NEW: Update status LED
-    uint32_t alertRed = Adafruit_NeoPixel::Color(255, 0, 0);
-    setEyeColor(alertRed, alertRed);
-    Serial.println("Alert mode: Eyes set to red");
+  if (action == nullptr) {
+    Serial.printf("Unknown button command: %s\n", buttonName);
     return;
   }
-  else if (strcmp(buttonName, "3") == 0) {
-    currentMode = MODE_IDLE;
-    setServoParameters();
-    statusLEDIdleMode(); // NEW: Update status LED
-    uint32_t dimAmber = Adafruit_NeoPixel::Color(100, 60, 0);
-    setEyeColor(dimAmber, dimAmber);
-    Serial.println("Idle mode: Eyes set to dim amber");
-    return;
-  } 
-  // Audio commands with status LED flash
-  else if (strcmp(buttonName, "4") == 0) {
-    if (isAudioReady) {
-      playRandomSound(1);
-      Serial.println("Playing random scanning sound");
+  action();
+}
+
+//========================================
+// IR DISPATCH TABLE
+//========================================
+// Open-addressing hash (linear probing) from IR code to a precompiled
+// action slot. Code 0 marks an empty slot - checkForIRCommand() never
+// returns it. Rebuilt lazily after config.buttons changes.
+
+struct IRDispatchSlot {
+  uint32_t code;              // IR code (0 = empty)
+  uint8_t buttonIndex;        // Index into config.buttons (for logging)
+  IRButtonAction action;      // Built-in action (nullptr if name is unknown)
+  const char* sequenceName;   // Mapped sequence in config.buttons, or nullptr
+};
+
+static IRDispatchSlot irDispatchTable[IR_DISPATCH_TABLE_SIZE];
+static bool irDispatchDirty = true;
+static uint32_t irMappingGeneration = 0;   // ETag of /seq/map/list
+
+static inline uint32_t irDispatchHash(uint32_t code) {
+  // Fibonacci hashing - NEC codes differ mostly in the upper bytes
+  return (code * 2654435761UL) >> (32 - IR_DISPATCH_TABLE_BITS);
+}
+
+void invalidateIRDispatchTable() {
+  irDispatchDirty = true;
+  irMappingGeneration++;
+  invalidateIRCombos();  // Combo keys resolve to button indexes too
+  sequenceManager.requestCacheWarm();  // Mapped sequences start from PSRAM, loaded from the loop
+}
+
+void rebuildIRDispatchTable() {
+  memset(irDispatchTable, 0, sizeof(irDispatchTable));
+
+  int buttonCount = constrain((int)config.buttonCount, 0, 21);
+  for (int i = 0; i < buttonCount; i++) {
+    const IRButton& button = config.buttons[i];
+    if (!button.isConfigured || button.code == 0) {
+      continue;
     }
-    return;
-  }
-  else if (strcmp(buttonName, "5") == 0) {
-    if (isAudioReady) {
-      playRandomSound(2);
-      Serial.println("Playing random alert sound");
+
+    uint32_t idx = irDispatchHash(button.code);
+    while (irDispatchTable[idx].code != 0 && irDispatchTable[idx].code != button.code) {
+      idx = (idx + 1) & (IR_DISPATCH_TABLE_SIZE - 1);
     }
-    return;
-  }
-  else if (strcmp(buttonName, "6") == 0) {
-    if (isAudioReady) {
-      playRandomSound(4);
-      Serial.println("Playing random voice line");
+    if (irDispatchTable[idx].code == button.code) {
+      continue;  // Duplicate code - first button wins, as with the old linear scan
     }
-    return;
-  }
-  // Button 7: Start Demo Mode
-  else if (strcmp(buttonName, "7") == 0) {
-    enterDemoMode();
-    Serial.println("Starting comprehensive demo mode");
-    return;
-  }
-  // Button 8: Toggle Detail LEDs
-  else if (strcmp(buttonName, "8") == 0) {
-    setDetailEnabled(!detailState.enabled);
-    Serial.printf("Detail LEDs: %s\n", detailState.enabled ? "ON" : "OFF");
-    return;
+
+    IRDispatchSlot& slot = irDispatchTable[idx];
+    slot.code = button.code;
+    slot.buttonIndex = i;
+    slot.action = lookupButtonAction(button.name);
+    slot.sequenceName = button.sequenceName[0] != '\0' ? button.sequenceName : nullptr;
   }
-  // Button 9: Cycle Eye Animation Modes
-  else if (strcmp(buttonName, "9") == 0) {
-    static int animationModeIndex = 0;
-    const PixelMode modes[] = {SOLID_COLOR, FLICKER, PULSE, SCANNER, HEARTBEAT, ALARM};
-    const char* modeNames[] = {"Solid", "Flicker", "Pulse", "Scanner", "Heartbeat", "Alarm"};
-    const int modeCount = 6;
 
-    animationModeIndex = (animationModeIndex + 1) % modeCount;
+  irDispatchDirty = false;
+}
 
-    switch(modes[animationModeIndex]) {
-      case SOLID_COLOR:
-        setEyeColor(getK2SOBlue(), getK2SOBlue());
-        break;
-      case FLICKER:
-        startFlickerMode();
-        break;
-      case PULSE:
-        startPulseMode();
-        break;
-      case SCANNER:
-        startScannerMode();
-        break;
-      case HEARTBEAT:
-        startHeartbeatMode();
-        break;
-      case ALARM:
-        startAlarmMode();
-        break;
-      default:
-        break;
-    }
+static const IRDispatchSlot* findIRDispatchSlot(uint32_t code) {
+  if (irDispatchDirty) {
+    rebuildIRDispatchTable();
+  }
 
-    Serial.printf("Eye Animation: %s\n", modeNames[animationModeIndex]);
-    return;
+  uint32_t idx = irDispatchHash(code);
+  for (int probe = 0; probe < IR_DISPATCH_TABLE_SIZE; probe++) {
+    const IRDispatchSlot& slot = irDispatchTable[idx];
+    if (slot.code == code) {
+      return &slot;
+    }
+    if (slot.code == 0) {
+      return nullptr;
+    }
+    idx = (idx + 1) & (IR_DISPATCH_TABLE_SIZE - 1);
   }
-  // Color cycling commands
-  else if (strcmp(buttonName, "*") == 0) {
-    uint32_t colors[COLOR_COUNT] = {
-      Adafruit_NeoPixel::Color(80, 150, 255),   // Ice blue
-      Adafruit_NeoPixel::Color(255, 0, 0),     // Red
-      Adafruit_NeoPixel::Color(0, 255, 0),     // Green
-      Adafruit_NeoPixel::Color(255, 255, 0),   // Yellow
-      Adafruit_NeoPixel::Color(255, 0, 255),   // Magenta
-      Adafruit_NeoPixel::Color(255, 255, 255)  // White
-    };
-    
-    currentColorIndex = (currentColorIndex + 1) % COLOR_COUNT;
-    setEyeColor(colors[currentColorIndex], colors[currentColorIndex]);
-    Serial.printf("Color forward: %d\n", currentColorIndex);
+  return nullptr;
+}
+
+static void dispatchIRSlot(const IRDispatchSlot& slot) {
+  const char* buttonName = config.buttons[slot.buttonIndex].name;
+  Serial.printf("Executing command for button: %s\n", buttonName);
+  postWebEvent(WEB_EVENT_IR, "{\"button\":\"%s\",\"code\":\"0x%08lX\"}",
+               buttonName, (unsigned long)slot.code);
+
+  // Check if a sequence is mapped to this button
+  if (slot.sequenceName != nullptr) {
+    Serial.print(F("▶️ IR triggering sequence: "));
+    Serial.println(slot.sequenceName);
+    sequenceManager.playSequence(slot.sequenceName, false);
     return;
   }
-  else if (strcmp(buttonName, "#") == 0) {
-    uint32_t colors[COLOR_COUNT] = {
-      Adafruit_NeoPixel::Color(80, 150, 255),   // Ice blue
-      Adafruit_NeoPixel::Color(255, 0, 0),     // Red
-      Adafruit_NeoPixel::Color(0, 255, 0),     // Green
-      Adafruit_NeoPixel::Color(255, 255, 0),   // Yellow
-      Adafruit_NeoPixel::Color(255, 0, 255),   // Magenta
-      Adafruit_NeoPixel::Color(255, 255, 255)  // White
-    };
-    
-    currentColorIndex = (currentColorIndex - 1 + COLOR_COUNT) % COLOR_COUNT;
-    setEyeColor(colors[currentColorIndex], colors[currentColorIndex]);
-    Serial.printf("Color backward: %d\n", currentColorIndex);
-    return;
+
+  // Otherwise execute standard button command
+  irDispatchCode = slot.code;
+  runButtonAction(buttonName, slot.action);
+  irDispatchCode = 0;
+}
+
+void dispatchIRButton(uint8_t buttonIndex) {
+  if (buttonIndex >= 21) return;
+  const IRDispatchSlot* slot = findIRDispatchSlot(config.buttons[buttonIndex].code);
+  if (slot != nullptr) {
+    dispatchIRSlot(*slot);
   }
-  // Eyes on/off toggle
-  else if (strcmp(buttonName, "0") == 0) {
-    if (leftEyeCurrentColor == 0 && rightEyeCurrentColor == 0) {
-      uint32_t white = Adafruit_NeoPixel::Color(255, 255, 255);
-      setEyeColor(white, white);
-      Serial.println("Eyes ON");
-    } else {
-      uint32_t off = Adafruit_NeoPixel::Color(0, 0, 0);
-      setEyeColor(off, off);
-      Serial.println("Eyes OFF");
-    }
+}
+
+void handleIRCommand(uint32_t code) {
+  statusLEDIRActivity(); // NEW: Flash white for IR command
+  
+  Serial.printf("IR: 0x%08X, Protocol: %s\n", (unsigned int)code, 
+                (const char*)getProtocolString((decode_type_t)currentIRProtocol));
+
+  const IRDispatchSlot* slot = findIRDispatchSlot(code);
+  if (slot == nullptr) {
+    Serial.println("Unknown IR code");
     return;
   }
-  else {
-    Serial.printf("Unknown button command: %s\n", buttonName);
+
+  // Presses that start a combo are held back by the matcher
+  if (feedIRCombo(slot->buttonIndex)) {
     return;
   }
+
+  dispatchIRSlot(*slot);
+}
+
+void executeButtonCommand(const char* buttonName) {
+  runButtonAction(buttonName, lookupButtonAction(buttonName));
+}
+
+bool isButtonCommandName(const char* buttonName) {
+  return lookupButtonAction(buttonName) != nullptr;
+}
+
+bool isIRJogButton(const char* buttonName) {
+  IRButtonAction action = lookupButtonAction(buttonName);
+  return action == irActionUp || action == irActionDown ||
+         action == irActionLeft || action == irActionRight;
 }
 
 //========================================
@@ -1339,9 +2396,9 @@ void centerAllServos() {
   statusLEDServoActivity(); // NEW: Flash blue for servo activity
 }
 
-void runTestSequence(String params) {
+void runTestSequence(uint8_t argc, char* argv[]) {
   Serial.println("\n=== HARDWARE TEST SEQUENCE ===");
-  if (params.length() > 0) {
+  if (argc > 0) {
     Serial.println("Test options: servo, led, audio, ir, all");
     Serial.println("Usage: test [option]");
   }
@@ -1365,51 +2422,43 @@ void runTestSequence(String params) {
 // SPECIALIZED COMMAND HANDLERS - CONTINUED
 //========================================
 
-void handleSoundCommand(String params) {
-  if (params.length() == 0) {
+void handleSoundCommand(uint8_t argc, char* argv[]) {
+  if (argc == 0) {
     Serial.println("Sound commands:");
     Serial.println(F("  sound volume [0-30]          - Set volume"));
     Serial.println(F("  sound play [file_number]     - Play specific file"));
     Serial.println(F("  sound folder [folder] [track] - Play from folder"));
     Serial.println(F("  sound stop                   - Stop playback"));
     Serial.println(F("  sound show                   - Show settings"));
+    Serial.println(F("  sound health [reset]         - DFPlayer link stats"));
     return;
   }
   
-  String args[3];
-  int argCount = 0;
-  int startIdx = 0;
-  
-  for (int i = 0; i <= params.length() && argCount < 3; i++) {
-    if (i == params.length() || params[i] == ' ') {
-      if (i > startIdx) {
-        args[argCount++] = params.substring(startIdx, i);
-      }
-      startIdx = i + 1;
-    }
-  }
-  
-  if (args[0] == "show") {
+  if (cliIs(argv[0], "show")) {
     Serial.println("\n=== SOUND SETTINGS ===");
     Serial.printf("Volume: %d\n", config.savedVolume);
     Serial.printf("Audio ready: %s\n", isAudioReady ? "Yes" : "No");
+    Serial.printf("Link: %s (%lu drops, %lu recoveries)\n",
+                  audioLink.linkDown ? "DOWN" : "UP",
+                  (unsigned long)audioLink.linkDrops,
+                  (unsigned long)audioLink.recoveries);
     Serial.printf("Pause range: %d-%d ms\n", config.soundPauseMin, config.soundPauseMax);
   }
-  else if (args[0] == "volume" && argCount >= 2) {
-    int volume = constrain(args[1].toInt(), 0, 30);
+  else if (cliIs(argv[0], "volume") && argc >= 2) {
+    int volume = constrain(atoi(argv[1]), 0, 30);
     setVolume(volume);
     Serial.printf("Volume set to: %d\n", volume);
   }
-  else if (args[0] == "play" && argCount >= 2) {
-    int fileNum = args[1].toInt();
+  else if (cliIs(argv[0], "play") && argc >= 2) {
+    int fileNum = atoi(argv[1]);
     playSound(fileNum);
     Serial.printf("Playing file: %d\n", fileNum);
   }
-  else if (args[0] == "folder" && argCount >= 3) {
-    int folder = args[1].toInt();
-    int track = args[2].toInt();
+  else if (cliIs(argv[0], "folder") && argc >= 3) {
+    int folder = atoi(argv[1]);
+    int track = atoi(argv[2]);
     if (isAudioReady) {
-      mp3.playFolderTrack(folder, track);
+      audioPlayFolderTrack(folder, track);
       statusLEDAudioActivity(); // NEW: Flash green for audio
       Serial.printf("Playing folder %d, track %d\n", folder, track);
     } else {
@@ -1417,16 +2466,24 @@ void handleSoundCommand(String params) {
       statusLEDError(); // NEW: Show error
     }
   }
-  else if (args[0] == "stop") {
+  else if (cliIs(argv[0], "stop")) {
     if (isAudioReady) {
-      mp3.stop();
+      audioStop();
       Serial.println("Playback stopped");
     }
   }
+  else if (cliIs(argv[0], "health")) {
+    if (argc >= 2 && cliIs(argv[1], "reset")) {
+      resetAudioLinkStats();
+      Serial.println("DFPlayer link stats reset");
+    } else {
+      printAudioLinkStats();
+    }
+  }
 }
 
-void handleServoCommand(String params) {
-  if (params.length() == 0) {
+void handleServoCommand(uint8_t argc, char* argv[]) {
+  if (argc == 0) {
     Serial.println("Servo commands:");
     Serial.println(F("  servo eye center [pan] [tilt]   - Set eye center positions"));
     Serial.println(F("  servo eye limits [minP] [maxP] [minT] [maxT] - Set eye limits"));
@@ -1434,32 +2491,34 @@ void handleServoCommand(String params) {
     Serial.println(F("  servo head limits [minP] [maxP] [minT] [maxT] - Set head limits"));
     Serial.println(F("  servo test [eye/head/all]      - Test servo movement"));
     Serial.println(F("  servo show                     - Show all servo settings"));
+    Serial.println(F("  servo set [ep] [et] [hp] [ht]  - Position all servos (latest wins)"));
+    Serial.println(F("  servo stats                    - Remote target requests and drops"));
     return;
   }
   
-  String args[6];
-  int argCount = 0;
-  int startIdx = 0;
-  
-  for (int i = 0; i <= params.length() && argCount < 6; i++) {
-    if (i == params.length() || params[i] == ' ') {
-      if (i > startIdx) {
-        args[argCount++] = params.substring(startIdx, i);
-      }
-      startIdx = i + 1;
+  if (cliIs(argv[0], "set")) {
+    int positions[4];
+    if (argc != 5 ||
+        !safeParseInt(argv[1], positions[0], 0, 180) || !safeParseInt(argv[2], positions[1], 0, 180) ||
+        !safeParseInt(argv[3], positions[2], 0, 180) || !safeParseInt(argv[4], positions[3], 0, 180)) {
+      Serial.println(F("Usage: servo set [eyePan] [eyeTilt] [headPan] [headTilt] (0-180)"));
+      return;
     }
+    setRemoteServoTargets(positions[0], positions[1], positions[2], positions[3]);
   }
-  
-  if (args[0] == "show") {
+  else if (cliIs(argv[0], "stats")) {
+    printRemoteServoStats();
+  }
+  else if (cliIs(argv[0], "show")) {
     Serial.println("\n=== SERVO SETTINGS ===");
     Serial.printf("Eye Pan: Center=%d, Range=%d-%d\n", config.eyePanCenter, config.eyePanMin, config.eyePanMax);
     Serial.printf("Eye Tilt: Center=%d, Range=%d-%d\n", config.eyeTiltCenter, config.eyeTiltMin, config.eyeTiltMax);
     Serial.printf("Head Pan: Center=%d, Range=%d-%d\n", config.headPanCenter, config.headPanMin, config.headPanMax);
     Serial.printf("Head Tilt: Center=%d, Range=%d-%d\n", config.headTiltCenter, config.headTiltMin, config.headTiltMax);
   }
-  else if (args[0] == "eye" && args[1] == "center" && argCount >= 4) {
-    config.eyePanCenter = constrain(args[2].toInt(), 0, 180);
-    config.eyeTiltCenter = constrain(args[3].toInt(), 0, 180);
+  else if (cliIs(argv[0], "eye") && cliIs(argv[1], "center") && argc >= 4) {
+    config.eyePanCenter = constrain(atoi(argv[2]), 0, 180);
+    config.eyeTiltCenter = constrain(atoi(argv[3]), 0, 180);
     eyePan.currentPosition = config.eyePanCenter;
     eyeTilt.currentPosition = config.eyeTiltCenter;
     eyePanServo.write(config.eyePanCenter);
@@ -1468,11 +2527,11 @@ void handleServoCommand(String params) {
     Serial.printf("Eye centers set: Pan=%d, Tilt=%d\n", config.eyePanCenter, config.eyeTiltCenter);
     smartSaveToEEPROM();
   }
-  else if (args[0] == "eye" && args[1] == "limits" && argCount >= 6) {
-    int panMin = constrain(args[2].toInt(), 0, 180);
-    int panMax = constrain(args[3].toInt(), 0, 180);
-    int tiltMin = constrain(args[4].toInt(), 0, 180);
-    int tiltMax = constrain(args[5].toInt(), 0, 180);
+  else if (cliIs(argv[0], "eye") && cliIs(argv[1], "limits") && argc >= 6) {
+    int panMin = constrain(atoi(argv[2]), 0, 180);
+    int panMax = constrain(atoi(argv[3]), 0, 180);
+    int tiltMin = constrain(atoi(argv[4]), 0, 180);
+    int tiltMax = constrain(atoi(argv[5]), 0, 180);
 
     // Ensure min < max
     if (panMin >= panMax || tiltMin >= tiltMax) {
@@ -1494,9 +2553,9 @@ void handleServoCommand(String params) {
                   config.eyePanMin, config.eyePanMax, config.eyeTiltMin, config.eyeTiltMax);
     smartSaveToEEPROM();
   }
-  else if (args[0] == "head" && args[1] == "center" && argCount >= 4) {
-    config.headPanCenter = constrain(args[2].toInt(), 0, 180);
-    config.headTiltCenter = constrain(args[3].toInt(), 0, 180);
+  else if (cliIs(argv[0], "head") && cliIs(argv[1], "center") && argc >= 4) {
+    config.headPanCenter = constrain(atoi(argv[2]), 0, 180);
+    config.headTiltCenter = constrain(atoi(argv[3]), 0, 180);
     headPan.currentPosition = config.headPanCenter;
     headTilt.currentPosition = config.headTiltCenter;
     headPanServo.write(config.headPanCenter);
@@ -1505,11 +2564,11 @@ void handleServoCommand(String params) {
     Serial.printf("Head centers set: Pan=%d, Tilt=%d\n", config.headPanCenter, config.headTiltCenter);
     smartSaveToEEPROM();
   }
-  else if (args[0] == "head" && args[1] == "limits" && argCount >= 6) {
-    int panMin = constrain(args[2].toInt(), 0, 180);
-    int panMax = constrain(args[3].toInt(), 0, 180);
-    int tiltMin = constrain(args[4].toInt(), 0, 180);
-    int tiltMax = constrain(args[5].toInt(), 0, 180);
+  else if (cliIs(argv[0], "head") && cliIs(argv[1], "limits") && argc >= 6) {
+    int panMin = constrain(atoi(argv[2]), 0, 180);
+    int panMax = constrain(atoi(argv[3]), 0, 180);
+    int tiltMin = constrain(atoi(argv[4]), 0, 180);
+    int tiltMax = constrain(atoi(argv[5]), 0, 180);
 
     // Ensure min < max
     if (panMin >= panMax || tiltMin >= tiltMax) {
@@ -1531,8 +2590,8 @@ void handleServoCommand(String params) {
                   config.headPanMin, config.headPanMax, config.headTiltMin, config.headTiltMax);
     smartSaveToEEPROM();
   }
-  else if (args[0] == "test") {
-    if (argCount < 2 || args[1] == "all") {
+  else if (cliIs(argv[0], "test")) {
+    if (argc < 2 || cliIs(argv[1], "all")) {
       Serial.println("Testing all servos...");
       centerAllServos();
       delay(1000);
@@ -1573,8 +2632,8 @@ void handleServoCommand(String params) {
   }
 }
 
-void handleLEDCommand(String params) {
-  if (params.length() == 0) {
+void handleLEDCommand(uint8_t argc, char* argv[]) {
+  if (argc == 0) {
     Serial.println("LED commands:");
     Serial.println(F("  led brightness [0-255]       - Set eye brightness"));
     Serial.println(F("  led color [r] [g] [b]        - Set eye color (0-255 each)"));
@@ -1592,20 +2651,7 @@ void handleLEDCommand(String params) {
     return;
   }
   
-  String args[4];
-  int argCount = 0;
-  int startIdx = 0;
-  
-  for (int i = 0; i <= params.length() && argCount < 4; i++) {
-    if (i == params.length() || params[i] == ' ') {
-      if (i > startIdx) {
-        args[argCount++] = params.substring(startIdx, i);
-      }
-      startIdx = i + 1;
-    }
-  }
-  
-  if (args[0] == "show") {
+  if (cliIs(argv[0], "show")) {
     Serial.println("\n=== LED SETTINGS ===");
     Serial.printf("Eye Hardware Version: %s\n", getEyeHardwareVersionName().c_str());
     Serial.printf("Active LEDs per Eye: %d\n", getActiveEyeLEDCount());
@@ -1618,84 +2664,83 @@ void handleLEDCommand(String params) {
                   config.statusLedBrightness);
     Serial.printf("Status LED State: %s\n", getStatusLEDStateName(getCurrentStatusLEDState()).c_str());
   }
-  else if (args[0] == "brightness" && argCount >= 2) {
-    int brightness = constrain(args[1].toInt(), 0, 255);
+  else if (cliIs(argv[0], "brightness") && argc >= 2) {
+    int brightness = constrain(atoi(argv[1]), 0, 255);
     setEyeBrightness(brightness);
     config.eyeBrightness = brightness;
     Serial.printf("Eye brightness set to: %d\n", brightness);
   }
-  else if (args[0] == "color" && argCount >= 4) {
-    int r = constrain(args[1].toInt(), 0, 255);
-    int g = constrain(args[2].toInt(), 0, 255);
-    int b = constrain(args[3].toInt(), 0, 255);
+  else if (cliIs(argv[0], "color") && argc >= 4) {
+    int r = constrain(atoi(argv[1]), 0, 255);
+    int g = constrain(atoi(argv[2]), 0, 255);
+    int b = constrain(atoi(argv[3]), 0, 255);
     
     uint32_t color = Adafruit_NeoPixel::Color(r, g, b);
     setEyeColor(color, color);
     Serial.printf("Eye color set to RGB(%d, %d, %d)\n", r, g, b);
   }
-  else if (args[0] == "mode" && argCount >= 2) {
-    String mode = args[1];
-    mode.toLowerCase();
+  else if (cliIs(argv[0], "mode") && argc >= 2) {
+    const char* mode = argv[1];
 
-    if (mode == "solid") {
+    if (cliIs(mode, "solid")) {
       currentPixelMode = SOLID_COLOR;
       stopAllAnimations();
       Serial.println("Mode set to solid color");
-    } else if (mode == "flicker") {
+    } else if (cliIs(mode, "flicker")) {
       startFlickerMode();
       Serial.println("Mode set to flicker");
-    } else if (mode == "pulse") {
+    } else if (cliIs(mode, "pulse")) {
       startPulseMode();
       Serial.println("Mode set to pulse");
-    } else if (mode == "scanner") {
+    } else if (cliIs(mode, "scanner")) {
       startScannerMode();
       Serial.println("Mode set to scanner");
-    } else if (mode == "iris") {
+    } else if (cliIs(mode, "iris")) {
       if (activeEyeLEDCount == 13) {
         startIrisMode();
         Serial.println("Mode set to iris (13-LED)");
       } else {
         Serial.println("Error: Iris mode requires 13-LED eyes. Use 'led eye 13led' first.");
       }
-    } else if (mode == "targeting") {
+    } else if (cliIs(mode, "targeting")) {
       if (activeEyeLEDCount == 13) {
         startTargetingMode();
         Serial.println("Mode set to targeting (13-LED)");
       } else {
         Serial.println("Error: Targeting mode requires 13-LED eyes. Use 'led eye 13led' first.");
       }
-    } else if (mode == "ring_scanner") {
+    } else if (cliIs(mode, "ring_scanner")) {
       if (activeEyeLEDCount == 13) {
         startRingScannerMode();
         Serial.println("Mode set to ring scanner (13-LED)");
       } else {
         Serial.println("Error: Ring scanner mode requires 13-LED eyes. Use 'led eye 13led' first.");
       }
-    } else if (mode == "spiral") {
+    } else if (cliIs(mode, "spiral")) {
       if (activeEyeLEDCount == 13) {
         startSpiralMode();
         Serial.println("Mode set to spiral (13-LED)");
       } else {
         Serial.println("Error: Spiral mode requires 13-LED eyes. Use 'led eye 13led' first.");
       }
-    } else if (mode == "focus") {
+    } else if (cliIs(mode, "focus")) {
       if (activeEyeLEDCount == 13) {
         startFocusMode();
         Serial.println("Mode set to focus (13-LED)");
       } else {
         Serial.println("Error: Focus mode requires 13-LED eyes. Use 'led eye 13led' first.");
       }
-    } else if (mode == "radar") {
+    } else if (cliIs(mode, "radar")) {
       if (activeEyeLEDCount == 13) {
         startRadarMode();
         Serial.println("Mode set to radar (13-LED)");
       } else {
         Serial.println("Error: Radar mode requires 13-LED eyes. Use 'led eye 13led' first.");
       }
-    } else if (mode == "heartbeat") {
+    } else if (cliIs(mode, "heartbeat")) {
       startHeartbeatMode();
       Serial.println("Mode set to heartbeat (synchronized)");
-    } else if (mode == "alarm") {
+    } else if (cliIs(mode, "alarm")) {
       startAlarmMode();
       Serial.println("Mode set to alarm (synchronized)");
     } else {
@@ -1704,41 +2749,40 @@ void handleLEDCommand(String params) {
       Serial.println("13-LED only: iris, targeting, ring_scanner, spiral, focus, radar");
     }
   }
-  else if (args[0] == "eye" && argCount >= 2) {
-    String eyeVersion = args[1];
-    eyeVersion.toLowerCase();
+  else if (cliIs(argv[0], "eye") && argc >= 2) {
+    const char* eyeVersion = argv[1];
 
-    if (eyeVersion == "7led") {
+    if (cliIs(eyeVersion, "7led")) {
       setEyeHardwareVersion(EYE_VERSION_7LED);
       smartSaveToEEPROM();  // Save to EEPROM so it persists after reboot
-    } else if (eyeVersion == "13led") {
+    } else if (cliIs(eyeVersion, "13led")) {
       setEyeHardwareVersion(EYE_VERSION_13LED);
       smartSaveToEEPROM();  // Save to EEPROM so it persists after reboot
     } else {
       Serial.println("Invalid eye version. Use: 7led or 13led");
     }
   }
-  else if (args[0] == "status" && argCount >= 2) {
-    if (args[1] == "on") {
+  else if (cliIs(argv[0], "status") && argc >= 2) {
+    if (cliIs(argv[1], "on")) {
       enableStatusLED(true);
       Serial.println("Status LED enabled");
-    } else if (args[1] == "off") {
+    } else if (cliIs(argv[1], "off")) {
       enableStatusLED(false);
       Serial.println("Status LED disabled");
-    } else if (args[1] == "brightness" && argCount >= 3) {
-      int brightness = constrain(args[2].toInt(), 0, 255);
+    } else if (cliIs(argv[1], "brightness") && argc >= 3) {
+      int brightness = constrain(atoi(argv[2]), 0, 255);
       setStatusLEDBrightness(brightness);
       Serial.printf("Status LED brightness set to: %d\n", brightness);
-    } else if (args[1] == "test") {
+    } else if (cliIs(argv[1], "test")) {
       statusLEDSystemTest();
     }
   }
-  else if (args[0] == "test") {
-    String target = (argCount >= 2) ? args[1] : "both";
+  else if (cliIs(argv[0], "test")) {
+    const char* target = (argc >= 2) ? argv[1] : "both";
     
     Serial.println("LED test sequence starting...");
     
-    if (target == "left" || target == "both") {
+    if (cliIs(target, "left") || cliIs(target, "both")) {
       Serial.println("Testing left eye...");
       uint32_t red = Adafruit_NeoPixel::Color(255, 0, 0);
       uint32_t green = Adafruit_NeoPixel::Color(0, 255, 0);
@@ -1752,7 +2796,7 @@ void handleLEDCommand(String params) {
       setLeftEyeColor(off); delay(300);
     }
 
-    if (target == "right" || target == "both") {
+    if (cliIs(target, "right") || cliIs(target, "both")) {
       Serial.println("Testing right eye...");
       uint32_t red = Adafruit_NeoPixel::Color(255, 0, 0);
       uint32_t green = Adafruit_NeoPixel::Color(0, 255, 0);
@@ -1774,8 +2818,8 @@ void handleLEDCommand(String params) {
 // DETAIL LED COMMAND HANDLER (NEW - WS2812)
 //========================================
 
-void handleDetailCommand(String params) {
-  if (params.length() == 0) {
+void handleDetailCommand(uint8_t argc, char* argv[]) {
+  if (argc == 0) {
     Serial.println("\n=== Detail LED Commands ===");
     Serial.println(F("  detail show                     - Show current settings"));
     Serial.println(F("  detail count [1-8]              - Set number of active LEDs (default: 5)"));
@@ -1791,73 +2835,58 @@ void handleDetailCommand(String params) {
     return;
   }
 
-  String args[4];
-  int argCount = 0;
-  int startIdx = 0;
-
-  for (int i = 0; i <= params.length() && argCount < 4; i++) {
-    if (i == params.length() || params[i] == ' ') {
-      if (i > startIdx) {
-        args[argCount++] = params.substring(startIdx, i);
-      }
-      startIdx = i + 1;
-    }
-  }
-
-  if (args[0] == "show") {
+  if (cliIs(argv[0], "show")) {
     printDetailLEDStatus();
   }
-  else if (args[0] == "count" && argCount >= 2) {
-    int count = args[1].toInt();
+  else if (cliIs(argv[0], "count") && argc >= 2) {
+    int count = atoi(argv[1]);
     setDetailCount(count);
   }
-  else if (args[0] == "brightness" && argCount >= 2) {
-    int brightness = constrain(args[1].toInt(), 0, 255);
+  else if (cliIs(argv[0], "brightness") && argc >= 2) {
+    int brightness = constrain(atoi(argv[1]), 0, 255);
     setDetailBrightness(brightness);
   }
-  else if (args[0] == "color" && argCount >= 4) {
-    int r = constrain(args[1].toInt(), 0, 255);
-    int g = constrain(args[2].toInt(), 0, 255);
-    int b = constrain(args[3].toInt(), 0, 255);
+  else if (cliIs(argv[0], "color") && argc >= 4) {
+    int r = constrain(atoi(argv[1]), 0, 255);
+    int g = constrain(atoi(argv[2]), 0, 255);
+    int b = constrain(atoi(argv[3]), 0, 255);
     setDetailColor(r, g, b);
   }
-  else if (args[0] == "pattern" && argCount >= 2) {
-    String pattern = args[1];
-    pattern.toLowerCase();
+  else if (cliIs(argv[0], "pattern") && argc >= 2) {
+    const char* pattern = argv[1];
 
-    if (pattern == "blink") {
+    if (cliIs(pattern, "blink")) {
       startDetailBlink();
-    } else if (pattern == "fade") {
+    } else if (cliIs(pattern, "fade")) {
       startDetailFade();
-    } else if (pattern == "chase") {
+    } else if (cliIs(pattern, "chase")) {
       startDetailChase();
-    } else if (pattern == "pulse") {
+    } else if (cliIs(pattern, "pulse")) {
       startDetailPulse();
-    } else if (pattern == "random") {
+    } else if (cliIs(pattern, "random")) {
       startDetailRandom();
     } else {
       Serial.println("Invalid pattern. Use: blink, fade, chase, pulse, or random");
     }
   }
-  else if (args[0] == "on") {
+  else if (cliIs(argv[0], "on")) {
     setDetailEnabled(true);
   }
-  else if (args[0] == "off") {
+  else if (cliIs(argv[0], "off")) {
     setDetailEnabled(false);
   }
-  else if (args[0] == "auto" && argCount >= 2) {
-    String autoMode = args[1];
-    autoMode.toLowerCase();
+  else if (cliIs(argv[0], "auto") && argc >= 2) {
+    const char* autoMode = argv[1];
 
-    if (autoMode == "on") {
+    if (cliIs(autoMode, "on")) {
       setDetailAutoColorMode(true);
-    } else if (autoMode == "off") {
+    } else if (cliIs(autoMode, "off")) {
       setDetailAutoColorMode(false);
     } else {
       Serial.println("Use: detail auto on/off");
     }
   }
-  else if (args[0] == "test") {
+  else if (cliIs(argv[0], "test")) {
     Serial.println("\n=== Detail LED Test Sequence ===");
     Serial.println("Running quick pattern tests (1s each)...");
 
@@ -1902,8 +2931,26 @@ void handleDetailCommand(String params) {
 // WIFI CONFIGURATION COMMAND HANDLER
 //========================================
 
-void handleWiFiCommand(String params) {
-  if (params.length() == 0) {
+static bool confirmWiFiReset(CLIPromptEvent event, const char* input, const char* arg) {
+  if (!promptConfirmed(event, input, "YES", F("Operation cancelled."))) {
+    return false;
+  }
+
+  memset(config.wifiSSID, 0, sizeof(config.wifiSSID));
+  memset(config.wifiPassword, 0, sizeof(config.wifiPassword));
+  config.wifiConfigured = false;
+
+  smartSaveToEEPROM();
+
+  Serial.println(F("WiFi configuration cleared."));
+  Serial.println(F("Disconnecting WiFi..."));
+  WiFi.disconnect();
+  statusLEDWiFiDisconnected();
+  return false;
+}
+
+void handleWiFiCommand(uint8_t argc, char* argv[]) {
+  if (argc == 0) {
     Serial.println(F("\n=== WiFi Configuration ==="));
     Serial.println(F("  wifi set <ssid> <password>       - Configure WiFi credentials"));
     Serial.println(F("  wifi set \"ssid\" \"password\"       - Use quotes for spaces"));
@@ -1915,48 +2962,9 @@ void handleWiFiCommand(String params) {
     return;
   }
 
-  // Smart parser that supports quoted strings with spaces
-  String args[3];
-  int argCount = 0;
-  int i = 0;
-
-  while (i < params.length() && argCount < 3) {
-    // Skip leading spaces
-    while (i < params.length() && params[i] == ' ') {
-      i++;
-    }
-
-    if (i >= params.length()) break;
-
-    // Check if this argument starts with a quote
-    if (params[i] == '"') {
-      i++; // Skip opening quote
-      int startIdx = i;
-      // Find closing quote
-      while (i < params.length() && params[i] != '"') {
-        i++;
-      }
-      args[argCount++] = params.substring(startIdx, i);
-      if (i < params.length()) i++; // Skip closing quote
-    } else {
-      // No quote, read until next space
-      int startIdx = i;
-      while (i < params.length() && params[i] != ' ') {
-        i++;
-      }
-      args[argCount++] = params.substring(startIdx, i);
-    }
-  }
-
-  if (argCount == 0) {
-    Serial.println(F("Invalid wifi command. Type 'wifi' for help."));
-    return;
-  }
-
-  String subCmd = args[0];
-  subCmd.toLowerCase();
+  const char* subCmd = argv[0];
 
-  if (subCmd == "show") {
+  if (cliIs(subCmd, "show")) {
     Serial.println(F("\n=== WiFi Configuration ==="));
     if (config.wifiConfigured && strlen(config.wifiSSID) > 0) {
       Serial.print(F("SSID: "));
@@ -1991,8 +2999,8 @@ void handleWiFiCommand(String params) {
     }
     Serial.println(F("===========================\n"));
   }
-  else if (subCmd == "set") {
-    if (argCount < 3) {
+  else if (cliIs(subCmd, "set")) {
+    if (argc < 3) {
       Serial.println(F("\n=== WiFi Set Command ==="));
       Serial.println(F("Usage: wifi set <ssid> <password>"));
       Serial.println(F("\nFor SSIDs or passwords with spaces, use quotes:"));
@@ -2003,24 +3011,24 @@ void handleWiFiCommand(String params) {
       return;
     }
 
-    String ssid = args[1];
-    String password = args[2];
+    const char* ssid = argv[1];
+    const char* password = argv[2];
 
     // Check length limits
-    if (ssid.length() >= sizeof(config.wifiSSID)) {
+    if (strlen(ssid) >= sizeof(config.wifiSSID)) {
       Serial.printf("Error: SSID too long (max %d characters)\n", sizeof(config.wifiSSID) - 1);
       return;
     }
-    if (password.length() >= sizeof(config.wifiPassword)) {
+    if (strlen(password) >= sizeof(config.wifiPassword)) {
       Serial.printf("Error: Password too long (max %d characters)\n", sizeof(config.wifiPassword) - 1);
       return;
     }
 
     // Save to config
-    strncpy(config.wifiSSID, ssid.c_str(), sizeof(config.wifiSSID) - 1);
+    strncpy(config.wifiSSID, ssid, sizeof(config.wifiSSID) - 1);
     config.wifiSSID[sizeof(config.wifiSSID) - 1] = '\0';
 
-    strncpy(config.wifiPassword, password.c_str(), sizeof(config.wifiPassword) - 1);
+    strncpy(config.wifiPassword, password, sizeof(config.wifiPassword) - 1);
     config.wifiPassword[sizeof(config.wifiPassword) - 1] = '\0';
 
     config.wifiConfigured = true;
@@ -2036,35 +3044,15 @@ void handleWiFiCommand(String params) {
     Serial.println(F("\nUse 'wifi reconnect' or restart to apply changes."));
     Serial.println(F("================================\n"));
   }
-  else if (subCmd == "reset") {
+  else if (cliIs(subCmd, "reset")) {
     Serial.print(F("Clear WiFi configuration? Type 'YES' to confirm (30s timeout): "));
-    if (!waitForSerialWithTimeout(30000)) {
-      Serial.println(F("Timeout - operation cancelled."));
-      return;
-    }
-    String confirmation = Serial.readStringUntil('\n');
-    confirmation.trim();
-
-    if (confirmation == "YES") {
-      memset(config.wifiSSID, 0, sizeof(config.wifiSSID));
-      memset(config.wifiPassword, 0, sizeof(config.wifiPassword));
-      config.wifiConfigured = false;
-
-      smartSaveToEEPROM();
-
-      Serial.println(F("WiFi configuration cleared."));
-      Serial.println(F("Disconnecting WiFi..."));
-      WiFi.disconnect();
-      statusLEDWiFiDisconnected();
-    } else {
-      Serial.println(F("Operation cancelled."));
-    }
+    cliPromptBegin(serialPrompt, confirmWiFiReset, nullptr, 30000);
   }
-  else if (subCmd == "reconnect") {
+  else if (cliIs(subCmd, "reconnect")) {
     Serial.println(F("Reconnecting to WiFi..."));
 
     // Stop web server first and allow pending requests to complete
-    server.stop();
+    server.end();
     Serial.println(F("Web server stopped"));
     delay(500);  // Allow any in-flight requests to complete
 
@@ -2084,22 +3072,183 @@ void handleWiFiCommand(String params) {
     extern void initializeWiFi();
     extern void setupWebServer();
 
-    initializeWiFi();
-    delay(100);  // Brief pause before starting web server
-    setupWebServer();
+    initializeWiFi();
+    delay(100);  // Brief pause before starting web server
+    setupWebServer();
+
+    Serial.println(F("WiFi reconnection complete"));
+  }
+  else {
+    Serial.println(F("Invalid wifi command. Type 'wifi' for help."));
+  }
+}
+
+//========================================
+// IR COMBO COMMAND HANDLER
+//========================================
+void handleComboCommand(uint8_t argc, char* argv[]) {
+  if (argc == 0) {
+    Serial.println(F("\n=== IR Combo Commands ==="));
+    Serial.println(F("  combo list                          - Show defined combos"));
+    Serial.println(F("  combo add <k1,k2,..> seq <name>     - Combo plays a sequence"));
+    Serial.println(F("  combo add <k1,k2,..> playlist <name> - Combo plays a saved playlist"));
+    Serial.println(F("  combo add <k1,k2,..> mode <mode>    - Combo changes mode (scanning/alert/idle)"));
+    Serial.println(F("  combo add <k1,k2,..> button <name>  - Combo runs a button action"));
+    Serial.println(F("  combo remove <number>               - Remove combo (see list)"));
+    Serial.println(F("  combo clear                         - Remove all combos"));
+    Serial.println(F("\nExample: combo add *,1,2 seq wave"));
+    Serial.println(F("Combos cannot start with a direction button (it would delay the jog)."));
+    return;
+  }
+
+  const char* subCmd = argv[0];
+  String errorMessage;
+
+  if (cliIs(subCmd, "list")) {
+    printIRCombos();
+  }
+  else if (cliIs(subCmd, "add") && argc >= 4) {
+    if (addIRCombo(argv[1], argv[2], argv[3], errorMessage)) {
+      Serial.printf("✓ Combo %d added\n", getIRComboCount());
+    } else {
+      Serial.print(F("❌ "));
+      Serial.println(errorMessage);
+    }
+  }
+  else if (cliIs(subCmd, "remove") && argc >= 2) {
+    int number;
+    if (!safeParseInt(argv[1], number, 1, IR_COMBO_MAX_COMBOS)) {
+      Serial.println(F("Invalid combo number."));
+      return;
+    }
+    if (removeIRCombo(number - 1, errorMessage)) {
+      Serial.printf("✓ Combo %d removed\n", number);
+    } else {
+      Serial.print(F("❌ "));
+      Serial.println(errorMessage);
+    }
+  }
+  else if (cliIs(subCmd, "clear")) {
+    if (clearIRCombos(errorMessage)) {
+      Serial.println(F("✓ All combos removed"));
+    } else {
+      Serial.print(F("❌ "));
+      Serial.println(errorMessage);
+    }
+  }
+  else {
+    Serial.println(F("Invalid combo command. Type 'combo' for help."));
+  }
+}
+
+//========================================
+// STATE SNAPSHOT COMMAND HANDLER
+//========================================
+// A number selects a RAM slot, anything else a scene file
+
+void handleStateCommand(uint8_t argc, char* argv[]) {
+  if (argc == 0) {
+    Serial.println(F("\n=== State Snapshot Commands ==="));
+    Serial.println(F("  state show              - Print the current state"));
+    Serial.println(F("  state save              - Store in the next RAM slot (ring)"));
+    Serial.println(F("  state save <slot|name>  - Store in RAM slot 0-7 or as a scene file"));
+    Serial.println(F("  state recall <slot|name> - Apply a stored scene"));
+    Serial.println(F("  state slots             - List RAM slots"));
+    Serial.println(F("  state list              - List scene files"));
+    Serial.println(F("  state delete <name>     - Delete a scene file"));
+    return;
+  }
 
-    Serial.println(F("WiFi reconnection complete"));
+  const char* subCmd = argv[0];
+  String errorMessage;
+  int slot = -1;
+  bool isSlot = (argc >= 2) && safeParseInt(argv[1], slot, 0, SCENE_RAM_SLOTS - 1);
+  StateSnapshot snapshot;
+
+  if (cliIs(subCmd, "show")) {
+    captureStateSnapshot(snapshot);
+    Serial.println(F("\n=== CURRENT STATE ==="));
+    printStateSnapshot(snapshot);
+  }
+  else if (cliIs(subCmd, "save")) {
+    captureStateSnapshot(snapshot);
+    if (argc < 2) {
+      Serial.printf("✓ State stored in slot %u\n", storeSceneSlot(snapshot));
+    } else if (isSlot) {
+      storeSceneSlot((uint8_t)slot, snapshot);
+      Serial.printf("✓ State stored in slot %d\n", slot);
+    } else if (saveSceneFile(argv[1], snapshot, errorMessage)) {
+      Serial.printf("✓ Scene '%s' saved\n", argv[1]);
+    } else {
+      Serial.print(F("❌ "));
+      Serial.println(errorMessage);
+    }
+  }
+  else if (cliIs(subCmd, "recall") && argc >= 2) {
+    bool loaded = isSlot ? getSceneSlot((uint8_t)slot, snapshot)
+                         : loadSceneFile(argv[1], snapshot, errorMessage);
+    if (!loaded) {
+      Serial.print(F("❌ "));
+      Serial.println(isSlot ? String("Slot is empty") : errorMessage);
+      return;
+    }
+    if (applyStateSnapshot(snapshot, errorMessage)) {
+      Serial.println(F("✓ State restored"));
+    } else {
+      Serial.print(F("⚠️ State restored without playback: "));
+      Serial.println(errorMessage);
+    }
+  }
+  else if (cliIs(subCmd, "slots")) {
+    printSceneSlots();
+  }
+  else if (cliIs(subCmd, "list")) {
+    Serial.println(F("\n=== SCENE FILES ==="));
+    File dir = fsOpen(SCENES_DIR);
+    uint16_t count = 0;
+    for (File entry = dir ? dir.openNextFile() : File(); entry; entry = dir.openNextFile()) {
+      if (!entry.isDirectory()) {
+        Serial.printf("  %s\n", entry.name());
+        count++;
+      }
+    }
+    Serial.printf("%u scene(s)\n", count);
+  }
+  else if (cliIs(subCmd, "delete") && argc >= 2) {
+    if (deleteSceneFile(argv[1], errorMessage)) {
+      Serial.printf("✓ Scene '%s' deleted\n", argv[1]);
+    } else {
+      Serial.print(F("❌ "));
+      Serial.println(errorMessage);
+    }
   }
   else {
-    Serial.println(F("Invalid wifi command. Type 'wifi' for help."));
+    Serial.println(F("Invalid state command. Type 'state' for help."));
   }
 }
 
 //========================================
 // ACCESS POINT (AP) CONFIGURATION COMMAND HANDLER
 //========================================
-void handleAPCommand(String params) {
-  if (params.length() == 0) {
+static bool confirmAPReset(CLIPromptEvent event, const char* input, const char* arg) {
+  if (!promptConfirmed(event, input, "YES", F("Operation cancelled."))) {
+    return false;
+  }
+
+  memset(config.apSSID, 0, sizeof(config.apSSID));
+  memset(config.apPassword, 0, sizeof(config.apPassword));
+  config.apConfigured = false;
+
+  smartSaveToEEPROM();
+
+  Serial.println(F("AP configuration reset to defaults."));
+  Serial.print(F("Default AP will be K2SO-XXXXXX with password: "));
+  Serial.println(DEFAULT_AP_PASSWORD);
+  return false;
+}
+
+void handleAPCommand(uint8_t argc, char* argv[]) {
+  if (argc == 0) {
     Serial.println(F("\n=== Access Point Configuration ==="));
     Serial.println(F("  ap set <ssid> <password>       - Configure AP credentials (password min 8 chars)"));
     Serial.println(F("  ap set \"ssid\" \"password\"       - Use quotes for spaces"));
@@ -2113,48 +3262,9 @@ void handleAPCommand(String params) {
     return;
   }
 
-  // Smart parser that supports quoted strings with spaces (same as WiFi command)
-  String args[3];
-  int argCount = 0;
-  int i = 0;
-
-  while (i < params.length() && argCount < 3) {
-    // Skip leading spaces
-    while (i < params.length() && params[i] == ' ') {
-      i++;
-    }
-
-    if (i >= params.length()) break;
-
-    // Check if this argument starts with a quote
-    if (params[i] == '"') {
-      i++; // Skip opening quote
-      int startIdx = i;
-      // Find closing quote
-      while (i < params.length() && params[i] != '"') {
-        i++;
-      }
-      args[argCount++] = params.substring(startIdx, i);
-      if (i < params.length()) i++; // Skip closing quote
-    } else {
-      // No quote, read until next space
-      int startIdx = i;
-      while (i < params.length() && params[i] != ' ') {
-        i++;
-      }
-      args[argCount++] = params.substring(startIdx, i);
-    }
-  }
-
-  if (argCount == 0) {
-    Serial.println(F("Invalid ap command. Type 'ap' for help."));
-    return;
-  }
-
-  String subCmd = args[0];
-  subCmd.toLowerCase();
+  const char* subCmd = argv[0];
 
-  if (subCmd == "show") {
+  if (cliIs(subCmd, "show")) {
     Serial.println(F("\n=== Access Point Configuration ==="));
     if (config.apConfigured && strlen(config.apSSID) > 0) {
       Serial.print(F("AP SSID: "));
@@ -2194,8 +3304,8 @@ void handleAPCommand(String params) {
     }
     Serial.println(F("===================================\n"));
   }
-  else if (subCmd == "set") {
-    if (argCount < 3) {
+  else if (cliIs(subCmd, "set")) {
+    if (argc < 3) {
       Serial.println(F("\n=== AP Set Command ==="));
       Serial.println(F("Usage: ap set <ssid> <password>"));
       Serial.println(F("\nFor SSIDs or passwords with spaces, use quotes:"));
@@ -2207,30 +3317,30 @@ void handleAPCommand(String params) {
       return;
     }
 
-    String ssid = args[1];
-    String password = args[2];
+    const char* ssid = argv[1];
+    const char* password = argv[2];
 
     // Validate password length (WPA2 requirement)
-    if (password.length() < 8) {
+    if (strlen(password) < 8) {
       Serial.println(F("Error: Password must be at least 8 characters for WPA2"));
       return;
     }
 
     // Check length limits
-    if (ssid.length() >= sizeof(config.apSSID)) {
+    if (strlen(ssid) >= sizeof(config.apSSID)) {
       Serial.printf("Error: SSID too long (max %d characters)\n", sizeof(config.apSSID) - 1);
       return;
     }
-    if (password.length() >= sizeof(config.apPassword)) {
+    if (strlen(password) >= sizeof(config.apPassword)) {
       Serial.printf("Error: Password too long (max %d characters)\n", sizeof(config.apPassword) - 1);
       return;
     }
 
     // Save to config
-    strncpy(config.apSSID, ssid.c_str(), sizeof(config.apSSID) - 1);
+    strncpy(config.apSSID, ssid, sizeof(config.apSSID) - 1);
     config.apSSID[sizeof(config.apSSID) - 1] = '\0';
 
-    strncpy(config.apPassword, password.c_str(), sizeof(config.apPassword) - 1);
+    strncpy(config.apPassword, password, sizeof(config.apPassword) - 1);
     config.apPassword[sizeof(config.apPassword) - 1] = '\0';
 
     config.apConfigured = true;
@@ -2247,41 +3357,22 @@ void handleAPCommand(String params) {
     Serial.println(F("Use 'ap start' to activate AP mode now."));
     Serial.println(F("===============================\n"));
   }
-  else if (subCmd == "reset") {
+  else if (cliIs(subCmd, "reset")) {
     Serial.print(F("Reset AP configuration to defaults? Type 'YES' to confirm (30s timeout): "));
-    if (!waitForSerialWithTimeout(30000)) {
-      Serial.println(F("Timeout - operation cancelled."));
-      return;
-    }
-    String confirmation = Serial.readStringUntil('\n');
-    confirmation.trim();
-
-    if (confirmation == "YES") {
-      memset(config.apSSID, 0, sizeof(config.apSSID));
-      memset(config.apPassword, 0, sizeof(config.apPassword));
-      config.apConfigured = false;
-
-      smartSaveToEEPROM();
-
-      Serial.println(F("AP configuration reset to defaults."));
-      Serial.print(F("Default AP will be K2SO-XXXXXX with password: "));
-      Serial.println(DEFAULT_AP_PASSWORD);
-    } else {
-      Serial.println(F("Operation cancelled."));
-    }
+    cliPromptBegin(serialPrompt, confirmAPReset, nullptr, 30000);
   }
-  else if (subCmd == "enable") {
+  else if (cliIs(subCmd, "enable")) {
     config.apEnabled = true;
     smartSaveToEEPROM();
     Serial.println(F("AP mode fallback enabled."));
     Serial.println(F("AP will start automatically if WiFi connection fails."));
   }
-  else if (subCmd == "disable") {
+  else if (cliIs(subCmd, "disable")) {
     config.apEnabled = false;
     smartSaveToEEPROM();
     Serial.println(F("AP mode fallback disabled."));
   }
-  else if (subCmd == "start") {
+  else if (cliIs(subCmd, "start")) {
     Serial.println(F("Starting Access Point mode..."));
 
     // Declare external function
@@ -2293,8 +3384,8 @@ void handleAPCommand(String params) {
   }
 }
 
-void handleTimingCommand(String params) {
-  if (params.length() == 0) {
+void handleTimingCommand(uint8_t argc, char* argv[]) {
+  if (argc == 0) {
     Serial.println("Timing commands:");
     Serial.println(F("  timing scan move [min] [max]  - Set scan eye movement timing"));
     Serial.println(F("  timing scan wait [min] [max]  - Set scan eye wait timing"));
@@ -2305,20 +3396,7 @@ void handleTimingCommand(String params) {
     return;
   }
   
-  String args[4];
-  int argCount = 0;
-  int startIdx = 0;
-  
-  for (int i = 0; i <= params.length() && argCount < 4; i++) {
-    if (i == params.length() || params[i] == ' ') {
-      if (i > startIdx) {
-        args[argCount++] = params.substring(startIdx, i);
-      }
-      startIdx = i + 1;
-    }
-  }
-  
-  if (args[0] == "show") {
+  if (cliIs(argv[0], "show")) {
     Serial.println("\n=== TIMING SETTINGS ===");
     Serial.printf("Scan Eye Move: %d-%d ms\n", config.scanEyeMoveMin, config.scanEyeMoveMax);
     Serial.printf("Scan Eye Wait: %d-%d ms\n", config.scanEyeWaitMin, config.scanEyeWaitMax);
@@ -2327,40 +3405,40 @@ void handleTimingCommand(String params) {
     Serial.printf("Sound Pause: %d-%d ms\n", config.soundPauseMin, config.soundPauseMax);
     Serial.printf("Boot Sequence Delay: %d ms\n", config.bootSequenceDelay);
   }
-  else if (args[0] == "scan" && args[1] == "move" && argCount >= 4) {
-    config.scanEyeMoveMin = constrain(args[2].toInt(), 1, 1000);
-    config.scanEyeMoveMax = constrain(args[3].toInt(), config.scanEyeMoveMin, 2000);
+  else if (cliIs(argv[0], "scan") && cliIs(argv[1], "move") && argc >= 4) {
+    config.scanEyeMoveMin = constrain(atoi(argv[2]), 1, 1000);
+    config.scanEyeMoveMax = constrain(atoi(argv[3]), config.scanEyeMoveMin, 2000);
     Serial.printf("Scan eye move timing: %d-%d ms\n", config.scanEyeMoveMin, config.scanEyeMoveMax);
     smartSaveToEEPROM();
   }
-  else if (args[0] == "scan" && args[1] == "wait" && argCount >= 4) {
-    config.scanEyeWaitMin = constrain(args[2].toInt(), 100, 30000);
-    config.scanEyeWaitMax = constrain(args[3].toInt(), config.scanEyeWaitMin, 60000);
+  else if (cliIs(argv[0], "scan") && cliIs(argv[1], "wait") && argc >= 4) {
+    config.scanEyeWaitMin = constrain(atoi(argv[2]), 100, 30000);
+    config.scanEyeWaitMax = constrain(atoi(argv[3]), config.scanEyeWaitMin, 60000);
     Serial.printf("Scan eye wait timing: %d-%d ms\n", config.scanEyeWaitMin, config.scanEyeWaitMax);
     smartSaveToEEPROM();
   }
-  else if (args[0] == "alert" && args[1] == "move" && argCount >= 4) {
-    config.alertEyeMoveMin = constrain(args[2].toInt(), 1, 500);
-    config.alertEyeMoveMax = constrain(args[3].toInt(), config.alertEyeMoveMin, 1000);
+  else if (cliIs(argv[0], "alert") && cliIs(argv[1], "move") && argc >= 4) {
+    config.alertEyeMoveMin = constrain(atoi(argv[2]), 1, 500);
+    config.alertEyeMoveMax = constrain(atoi(argv[3]), config.alertEyeMoveMin, 1000);
     Serial.printf("Alert eye move timing: %d-%d ms\n", config.alertEyeMoveMin, config.alertEyeMoveMax);
     smartSaveToEEPROM();
   }
-  else if (args[0] == "alert" && args[1] == "wait" && argCount >= 4) {
-    config.alertEyeWaitMin = constrain(args[2].toInt(), 50, 10000);
-    config.alertEyeWaitMax = constrain(args[3].toInt(), config.alertEyeWaitMin, 20000);
+  else if (cliIs(argv[0], "alert") && cliIs(argv[1], "wait") && argc >= 4) {
+    config.alertEyeWaitMin = constrain(atoi(argv[2]), 50, 10000);
+    config.alertEyeWaitMax = constrain(atoi(argv[3]), config.alertEyeWaitMin, 20000);
     Serial.printf("Alert eye wait timing: %d-%d ms\n", config.alertEyeWaitMin, config.alertEyeWaitMax);
     smartSaveToEEPROM();
   }
-  else if (args[0] == "sound" && argCount >= 3) {
-    config.soundPauseMin = constrain(args[1].toInt(), 1000, 120000);
-    config.soundPauseMax = constrain(args[2].toInt(), config.soundPauseMin, 300000);
+  else if (cliIs(argv[0], "sound") && argc >= 3) {
+    config.soundPauseMin = constrain(atoi(argv[1]), 1000, 120000);
+    config.soundPauseMax = constrain(atoi(argv[2]), config.soundPauseMin, 300000);
     Serial.printf("Sound pause timing: %d-%d ms\n", config.soundPauseMin, config.soundPauseMax);
     smartSaveToEEPROM();
   }
 }
 
-void handleProfileCommand(String params) {
-  if (params.length() == 0) {
+void handleProfileCommand(uint8_t argc, char* argv[]) {
+  if (argc == 0) {
     Serial.println("Profile commands:");
     Serial.println(F("  profile save [name]    - Save current settings as profile"));
     Serial.println(F("  profile load [0-4]     - Load saved profile"));
@@ -2370,20 +3448,7 @@ void handleProfileCommand(String params) {
     return;
   }
   
-  String args[2];
-  int argCount = 0;
-  int startIdx = 0;
-  
-  for (int i = 0; i <= params.length() && argCount < 2; i++) {
-    if (i == params.length() || params[i] == ' ') {
-      if (i > startIdx) {
-        args[argCount++] = params.substring(startIdx, i);
-      }
-      startIdx = i + 1;
-    }
-  }
-  
-  if (args[0] == "list") {
+  if (cliIs(argv[0], "list")) {
     Serial.println("\n=== SAVED PROFILES ===");
     for (int i = 0; i < 5; i++) {
       if (config.profiles[i].active) {
@@ -2394,7 +3459,7 @@ void handleProfileCommand(String params) {
     }
     Serial.printf("Current profile: %d\n", config.currentProfile);
   }
-  else if (args[0] == "save" && argCount >= 2) {
+  else if (cliIs(argv[0], "save") && argc >= 2) {
     int slot = -1;
     for (int i = 0; i < 5; i++) {
       if (!config.profiles[i].active) {
@@ -2413,7 +3478,7 @@ void handleProfileCommand(String params) {
 
     Profile& profile = config.profiles[slot];
     profile.active = true;
-    strncpy(profile.name, args[1].c_str(), 15);
+    strncpy(profile.name, argv[1], 15);
     profile.name[15] = '\0';
     
     profile.mode = currentMode;
@@ -2439,8 +3504,8 @@ void handleProfileCommand(String params) {
     
     Serial.printf("Profile saved as '%s' in slot %d\n", profile.name, slot);
   }
-  else if (args[0] == "load" && argCount >= 2) {
-    int slot = constrain(args[1].toInt(), 0, 4);
+  else if (cliIs(argv[0], "load") && argc >= 2) {
+    int slot = constrain(atoi(argv[1]), 0, 4);
     
     if (!config.profiles[slot].active) {
       Serial.printf("Profile slot %d is empty\n", slot);
@@ -2475,8 +3540,8 @@ void handleProfileCommand(String params) {
     
     Serial.printf("Profile '%s' loaded from slot %d\n", profile.name, slot);
   }
-  else if (args[0] == "delete" && argCount >= 2) {
-    int slot = constrain(args[1].toInt(), 0, 4);
+  else if (cliIs(argv[0], "delete") && argc >= 2) {
+    int slot = constrain(atoi(argv[1]), 0, 4);
     
     if (!config.profiles[slot].active) {
       Serial.printf("Profile slot %d is already empty\n", slot);
@@ -2519,6 +3584,8 @@ void showHelp() {
   Serial.println(F("  clear     - Clear all IR codes (requires confirmation)"));
   Serial.println(F("  default   - Load standard IR remote codes"));
   Serial.println(F("  ir on/off - Enable/disable IR receiver"));
+  Serial.println(F("  ir stats  - IR queue depth and input-to-action latency"));
+  Serial.println(F("  combo [options] - IR button combos (e.g. * 1 2)"));
   
   Serial.println("\nHARDWARE CONFIGURATION:");
   Serial.println(F("  servo [options]  - Configure servo settings"));
@@ -2532,14 +3599,19 @@ void showHelp() {
   Serial.println(F("  profile load [index] - Load saved profile (0-4)"));
   Serial.println(F("  profile list         - List all profiles"));
   Serial.println(F("  profile delete [idx] - Delete profile"));
+  Serial.println(F("  state [options]      - Snapshot/recall the whole droid state (scenes)"));
   
   Serial.println("\nNETWORK CONFIGURATION:");
   Serial.println(F("  wifi [options]  - Configure WiFi connection"));
   Serial.println(F("  ap [options]    - Configure Access Point mode"));
+  Serial.println(F("  web             - Web request queue depth, waits and rejects"));
+  Serial.println(F("  ws              - WebSocket link clients and counters"));
+  Serial.println(F("  events          - Event stream (/events) clients, batches, replays"));
 
   Serial.println("\nSEQUENCE RECORDING:");
   Serial.println(F("  seq [options]   - Record and play animation sequences"));
   Serial.println(F("                    Type 'seq' for detailed commands"));
+  Serial.println(F("  puppet [release] - PC puppet link stats (binary frames, see tools/)"));
 
   Serial.println("\nSYSTEM TOOLS:");
   Serial.println(F("  monitor   - Live system monitoring mode"));
@@ -2575,6 +3647,8 @@ void showStatus() {
   Serial.printf("Free RAM: %lu bytes\n", (unsigned long)ESP.getFreeHeap());
   Serial.printf("EEPROM Writes: %lu\n", (unsigned long)config.writeCount);
   Serial.printf("WiFi IP: %s\n", WiFi.localIP().toString().c_str());
+  Serial.printf("WebSocket clients: %u\n", getWebLinkClientCount());
+  Serial.printf("Event stream clients: %u\n", getWebEventClientCount());
   
   Serial.printf("Mode: %s\n", getModeName(currentMode).c_str());
   Serial.printf("Status: %s\n", isAwake ? "AWAKE" : "SLEEPING");
@@ -2599,6 +3673,10 @@ void showStatus() {
   Serial.printf("Status LED Brightness: %d/255\n", config.statusLedBrightness);
   
   Serial.printf("IR Commands: %lu\n", irCommandCount);
+  if (irStats.presses > 0) {
+    Serial.printf("IR Latency: last %lu us, max %lu us (capture -> action)\n",
+                  (unsigned long)irStats.lastActionUs, (unsigned long)irStats.maxActionUs);
+  }
   Serial.printf("Servo Movements: %lu\n", servoMovements);
   Serial.printf("Last Activity: %lu seconds ago\n", (millis() - lastActivityTime) / 1000);
   
@@ -2703,29 +3781,27 @@ void loadDefaultCodes() {
   Serial.println("You can now use a standard NEC remote or run 'learn' to program your own.");
 }
 
+static bool confirmClearAllData(CLIPromptEvent event, const char* input, const char* arg) {
+  if (!promptConfirmed(event, input, "YES", F("Operation cancelled. No data was cleared."))) {
+    return false;
+  }
+
+  for (int i = 0; i < EEPROM_SIZE; i++) {
+    EEPROM.write(i, 0xFF);
+  }
+  EEPROM.commit();
+  
+  Serial.println("All data cleared. System will restart...");
+  delay(2000);
+  ESP.restart();
+  return false;
+}
+
 void clearAllData() {
   Serial.println(F("WARNING:"));
   Serial.println("All servo calibration, IR codes, profiles, and settings will be lost.");
   Serial.print("Are you absolutely sure? Type 'YES' to confirm (30s timeout): ");
-  if (!waitForSerialWithTimeout(30000)) {
-    Serial.println(F("Timeout - operation cancelled."));
-    return;
-  }
-  String confirmation = Serial.readStringUntil('\n');
-  confirmation.trim();
-
-  if (confirmation == "YES") {
-    for (int i = 0; i < EEPROM_SIZE; i++) {
-      EEPROM.write(i, 0xFF);
-    }
-    EEPROM.commit();
-    
-    Serial.println("All data cleared. System will restart...");
-    delay(2000);
-    ESP.restart();
-  } else {
-    Serial.println("Operation cancelled. No data was cleared.");
-  }
+  cliPromptBegin(serialPrompt, confirmClearAllData, nullptr, 30000);
 }
 
 //========================================
@@ -2745,7 +3821,9 @@ void enterMonitorMode() {
 
 void handleMonitorMode() {
   if (Serial.available()) {
-    Serial.readString();
+    while (Serial.available()) {
+      Serial.read();  // Drop the keypress without waiting for the stream timeout
+    }
     monitorMode = false;
     operatingMode = MODE_NORMAL;
     autoUpdateStatusLED(); // NEW: Return to normal status
@@ -2763,10 +3841,10 @@ void handleMonitorMode() {
                   eyePan.currentPosition, eyeTilt.currentPosition,
                   headPan.currentPosition, headTilt.currentPosition);
     
-    if (IrReceiver.decode()) {
-      Serial.printf("0x%04X", (unsigned int)(IrReceiver.decodedIRData.decodedRawData & 0xFFFF));
-      IrReceiver.resume();
-      statusLEDIRActivity(); // NEW: Flash for IR activity in monitor
+    // IR events are drained by handleSensors(); show the last press of this interval
+    if (monitorLastIRCode != 0) {
+      Serial.printf("0x%04X", (unsigned int)(monitorLastIRCode & 0xFFFF));
+      monitorLastIRCode = 0;
     } else {
       Serial.print("  --  ");
     }
@@ -2885,7 +3963,7 @@ void handleTestMode() {
         headPanServo.write(headPan.targetPosition);
         headTiltServo.write(headTilt.targetPosition);
         if (isAudioReady) {
-          mp3.playFolderTrack(4, 1);
+          audioPlayFolderTrack(4, 1);
           statusLEDAudioActivity(); // NEW: Flash for audio activity
         }
         testStep++;
@@ -2951,19 +4029,23 @@ void enterDemoMode() {
   Serial.println("Press any key to exit demo...\n");
 }
 
+void stopDemoMode() {
+  Serial.println("\n=== Demo Mode Stopped ===");
+  operatingMode = MODE_NORMAL;
+  setEyeColor(getK2SOBlue(), getK2SOBlue());
+  // Restore detail LED defaults
+  setDetailColor(255, 0, 0);  // Red
+  startDetailRandom();
+  autoUpdateStatusLED();
+}
+
 void handleDemoMode() {
   unsigned long currentMillis = millis();
 
   // Exit demo if serial input detected
   if (Serial.available() > 0) {
     Serial.read();  // Clear buffer
-    Serial.println("\n=== Demo Mode Stopped ===");
-    operatingMode = MODE_NORMAL;
-    setEyeColor(getK2SOBlue(), getK2SOBlue());
-    // Restore detail LED defaults
-    setDetailColor(255, 0, 0);  // Red
-    startDetailRandom();
-    autoUpdateStatusLED();
+    stopDemoMode();
     return;
   }
 
@@ -3237,7 +4319,7 @@ void handleDemoMode() {
         Serial.println("\n▶ Demonstrating: AUDIO SYSTEM");
         if (isAudioReady) {
           Serial.println("Playing K-2SO voice line");
-          mp3.playFolderTrack(4, 1);
+          audioPlayFolderTrack(4, 1);
         } else {
           Serial.println("Audio system not available");
         }
@@ -3338,21 +4420,73 @@ void logSystemEvent(const char* event) {
 void handleNormalOperation() {
   unsigned long currentMillis = millis();
   
-  handleSensors();
   updateServos(currentMillis);
   updateAudio();
 }
 
 void handleSensors() {
-  uint32_t code;
-  if (checkForIRCommand(code)) {
-    handleIRCommand(code);
+  static uint32_t lastIRCode = 0;
+  static unsigned long lastIRFrameTime = 0;
+
+  // Learning and scanner modes consume raw codes themselves
+  if (operatingMode == MODE_IR_LEARNING || operatingMode == MODE_IR_SCANNER) {
+    return;
+  }
+
+  IREvent event;
+  while (popIREvent(event)) {
+    uint32_t dequeueMicros = micros();
+    unsigned long now = millis();
+    // Age of the frame in ms - debounce on capture time, not on when we got to it
+    unsigned long frameTime = now - (dequeueMicros - event.captureMicros) / 1000;
+    bool isRepeat = event.isRepeat;
+
+    // Remotes that resend the full code while held are debounced into repeats
+    if (!isRepeat && event.code == lastIRCode && frameTime - lastIRFrameTime < IR_REPEAT_WINDOW_MS) {
+      isRepeat = true;
+    }
+    lastIRFrameTime = frameTime;
+
+    if (isRepeat) {
+      irStats.repeats++;
+      // Legacy decoders send repeats without the code, they repeat the last press
+      handleIRRepeat(event.code == 0xFFFFFFFF || event.code == 0 ? lastIRCode : event.code);
+      continue;
+    }
+
+    // Monitor mode only displays codes
+    if (operatingMode == MODE_MONITOR) {
+      monitorLastIRCode = event.code;
+      statusLEDIRActivity(); // NEW: Flash for IR activity in monitor
+      continue;
+    }
+
+    // A press ends demo/test runs and is then handled like any other
+    if (operatingMode == MODE_DEMO) {
+      stopDemoMode();
+    } else if (operatingMode == MODE_TEST) {
+      Serial.println(F("Hardware test interrupted by IR input"));
+      operatingMode = MODE_NORMAL;
+      autoUpdateStatusLED();
+    }
+
+    lastIRCode = event.code;
+    currentIRProtocol = event.protocol;
+    handleIRCommand(event.code);
     irCommandCount++;
-    lastActivityTime = millis();
+    lastActivityTime = now;
+
+    irStats.presses++;
+    recordIRLatency(event, dequeueMicros);
   }
+
+  unsigned long currentMillis = millis();
+  updateIRJog(currentMillis);
+  updateIRCombos(currentMillis);
 }
 
 void updateServos(unsigned long currentMillis) {
+  applyRemoteServoTargets();
   updateServo(eyePan, currentMillis);
   updateServo(eyeTilt, currentMillis);
   updateServo(headPan, currentMillis);
@@ -3360,7 +4494,8 @@ void updateServos(unsigned long currentMillis) {
   
   static unsigned long nextMoveTime = 0;
   
-  if (isAwake && currentMode != MODE_IDLE) {
+  // Autonomous movement pauses while a PC or an IR jog drives the servos
+  if (isAwake && currentMode != MODE_IDLE && !isPuppetActive() && !isIRJogActive()) {
     if (currentMillis >= nextMoveTime) {
       int moveType = random(0, 4);
       
@@ -3973,17 +5108,17 @@ void handleBootSequence(unsigned long currentMillis) {
             delay(500);  // Wait for DFPlayer to be fully ready
 
             // Check if folder 03 has files
-            int folder03Count = mp3.getFolderTrackCount(3);
+            int folder03Count = audioGetFolderTrackCount(3);
             Serial.printf("  Folder 03 has %d files\n", folder03Count);
 
             if (folder03Count > 0) {
               // Ensure volume is set
-              mp3.setVolume(config.savedVolume);
+              audioSetVolume(config.savedVolume);
               delay(100);
 
               // Play the boot sound
               Serial.println("  Sending playFolderTrack(3, 1) command...");
-              mp3.playFolderTrack(3, 1);
+              audioPlayFolderTrack(3, 1);
               delay(200);  // Give time for command to be processed
 
               Serial.println("✓ Boot sound command sent (Folder 03/001.mp3)");
@@ -4147,6 +5282,7 @@ void saveConfiguration() {
 }
 
 void smartSaveToEEPROM() {
+  invalidateIRDispatchTable();  // Callers save after editing config.buttons
   if (memcmp(&config, &lastSavedConfig, sizeof(config) - sizeof(uint32_t)) != 0) {
     saveConfiguration();
     Serial.println("Configuration saved to EEPROM");
@@ -4156,6 +5292,8 @@ void smartSaveToEEPROM() {
 }
 
 void applyConfiguration() {
+  invalidateIRDispatchTable();
+
   eyePan.currentPosition = config.eyePanCenter;
   eyeTilt.currentPosition = config.eyeTiltCenter;
   headPan.currentPosition = config.headPanCenter;
@@ -4180,7 +5318,7 @@ void applyConfiguration() {
   setStatusLEDConfig(config.statusLedBrightness, config.statusLedEnabled);
   
   if (isAudioReady) {
-    mp3.setVolume(config.savedVolume);
+    audioSetVolume(config.savedVolume);
   }
   
   currentMode = (PersonalityMode)config.savedMode;
@@ -4210,62 +5348,76 @@ void backupToSerial() {
   Serial.printf("Total size: %d bytes\n", sizeof(config));
 }
 
-void restoreFromSerial() {
-  Serial.println("\n=== CONFIGURATION RESTORE ===");
-  Serial.println(F("WARNING:"));
-  Serial.print("Continue? Type 'YES' to proceed (30s timeout): ");
-  if (!waitForSerialWithTimeout(30000)) {
-    Serial.println(F("Timeout - operation cancelled."));
-    return;
+// Restore wizard: YES confirmation, then raw hex capture. The paste ends
+// when a full v2 image has arrived, when input pauses after at least a v1
+// image, or on the inactivity timeout.
+static const unsigned long RESTORE_DATA_TIMEOUT_MS = 60000;
+static const unsigned long RESTORE_QUIET_AFTER_DATA_MS = 250;
+static String restoreHexData;
+
+static void finishRestore();
+
+static bool collectRestoreData(CLIPromptEvent event, const char* input, const char* arg) {
+  const size_t currentHexLength = sizeof(ConfigData) * 2;
+  const size_t legacyHexLength = sizeof(ConfigDataV1) * 2;
+
+  switch (event) {
+    case CLI_PROMPT_BYTE: {
+      char c = input[0];
+      if (isxdigit(c)) {
+        restoreHexData += c;
+      } else if (!(c == ' ' || c == '\n' || c == '\r' || c == '\t')) {
+        Serial.printf("Error: Invalid character '%c' in restore data.\n", c);
+        restoreHexData = String();
+        return false;
+      }
+      if (restoreHexData.length() >= currentHexLength) {
+        finishRestore();
+        return false;
+      }
+      return true;
+    }
+
+    case CLI_PROMPT_QUIET:
+      if (restoreHexData.length() >= legacyHexLength) {
+        finishRestore();
+        return false;
+      }
+      return true;  // Keep waiting for the rest of the paste
+
+    default:
+      finishRestore();
+      return false;
   }
-  String confirm = Serial.readStringUntil('\n');
-  confirm.trim();
+}
 
-  if (confirm != "YES") {
-    Serial.println("Restore cancelled.");
-    return;
+static bool confirmRestore(CLIPromptEvent event, const char* input, const char* arg) {
+  if (!promptConfirmed(event, input, "YES", F("Restore cancelled."))) {
+    return false;
   }
 
   Serial.println("Paste your hex backup data and press Enter:");
   Serial.println("(You have 60 seconds to paste the data)");
 
-  const size_t currentHexLength = sizeof(ConfigData) * 2;
-  const size_t legacyHexLength = sizeof(ConfigDataV1) * 2;
-
-  // Non-blocking multi-line data collection with timeout
-  String hexData = "";
-  hexData.reserve(currentHexLength);
-  unsigned long dataTimeout = millis();
-  unsigned long lastInputAt = millis();
-  const unsigned long DATA_TIMEOUT_MS = 60000;
-  const unsigned long QUIET_AFTER_DATA_MS = 250;
-
-  while (millis() - dataTimeout < DATA_TIMEOUT_MS) {
-    if (Serial.available()) {
-      char c = Serial.read();
-      if (isxdigit(c)) {
-        hexData += c;
-        dataTimeout = millis();
-        lastInputAt = millis();
-      } else if (!(c == ' ' || c == '\n' || c == '\r' || c == '\t')) {
-        Serial.printf("Error: Invalid character '%c' in restore data.\n", c);
-        return;
-      }
-    }
+  restoreHexData = String();
+  restoreHexData.reserve(sizeof(ConfigData) * 2);
+  cliPromptBeginRaw(serialPrompt, collectRestoreData, RESTORE_DATA_TIMEOUT_MS, RESTORE_QUIET_AFTER_DATA_MS);
+  return true;
+}
 
-    if (hexData.length() >= currentHexLength) {
-      break;
-    }
+void restoreFromSerial() {
+  Serial.println("\n=== CONFIGURATION RESTORE ===");
+  Serial.println(F("WARNING:"));
+  Serial.print("Continue? Type 'YES' to proceed (30s timeout): ");
+  cliPromptBegin(serialPrompt, confirmRestore, nullptr, 30000);
+}
 
-    if (hexData.length() >= legacyHexLength &&
-        millis() - lastInputAt > QUIET_AFTER_DATA_MS) {
-      break;
-    }
+static void finishRestore() {
+  const size_t currentHexLength = sizeof(ConfigData) * 2;
+  const size_t legacyHexLength = sizeof(ConfigDataV1) * 2;
 
-    delay(1);
-  }
-
-  hexData.trim();
+  String hexData = restoreHexData;
+  restoreHexData = String();  // Release the capture buffer
 
   if (hexData.length() == 0) {
     Serial.println(F("⏱️ Timeout (60s) - no data received. Operation cancelled."));
@@ -4345,10 +5497,116 @@ void restoreFromSerial() {
 // SEQUENCE RECORDING/PLAYBACK FUNCTIONS
 //========================================
 
-void handleSequenceCommand(String params) {
-  params.trim();
+// seq sub-commands - tables sorted by name for cliLookup()
+enum SeqSubCommand : uint8_t {
+  SEQ_CANCEL, SEQ_DELETE, SEQ_DUPLICATE, SEQ_EXPORT, SEQ_FORMAT, SEQ_FRAME,
+  SEQ_IMPORT, SEQ_INFO, SEQ_LIST, SEQ_LOOP, SEQ_MAP, SEQ_NEW, SEQ_PLAY, SEQ_PLAYLIST,
+  SEQ_RENAME, SEQ_SAVE, SEQ_STATS, SEQ_STATUS, SEQ_STOP, SEQ_VERIFY
+};
+
+static const CLITableEntry seqSubCommands[] = {
+  {"cancel",    SEQ_CANCEL,    nullptr, 0},
+  {"delete",    SEQ_DELETE,    nullptr, 0},
+  {"duplicate", SEQ_DUPLICATE, nullptr, 0},
+  {"export",    SEQ_EXPORT,    nullptr, 0},
+  {"format",    SEQ_FORMAT,    nullptr, 0},
+  {"frame",     SEQ_FRAME,     nullptr, 0},
+  {"import",    SEQ_IMPORT,    nullptr, 0},
+  {"info",      SEQ_INFO,      nullptr, 0},
+  {"list",      SEQ_LIST,      nullptr, 0},
+  {"loop",      SEQ_LOOP,      nullptr, 0},
+  {"map",       SEQ_MAP,       nullptr, 0},
+  {"new",       SEQ_NEW,       nullptr, 0},
+  {"play",      SEQ_PLAY,      nullptr, 0},
+  {"playlist",  SEQ_PLAYLIST,  nullptr, 0},
+  {"rename",    SEQ_RENAME,    nullptr, 0},
+  {"save",      SEQ_SAVE,      nullptr, 0},
+  {"stats",     SEQ_STATS,     nullptr, 0},
+  {"status",    SEQ_STATUS,    nullptr, 0},
+  {"stop",      SEQ_STOP,      nullptr, 0},
+  {"verify",    SEQ_VERIFY,    nullptr, 0}
+};
+
+enum PlaylistSubCommand : uint8_t {
+  PLAYLIST_ADD, PLAYLIST_CLEAR, PLAYLIST_LIST, PLAYLIST_LOAD, PLAYLIST_LOOP,
+  PLAYLIST_MOVE, PLAYLIST_PLAY, PLAYLIST_REMOVE, PLAYLIST_SAVE
+};
+
+static const CLITableEntry playlistSubCommands[] = {
+  {"add",    PLAYLIST_ADD,    nullptr, 0},
+  {"clear",  PLAYLIST_CLEAR,  nullptr, 0},
+  {"list",   PLAYLIST_LIST,   nullptr, 0},
+  {"load",   PLAYLIST_LOAD,   nullptr, 0},
+  {"loop",   PLAYLIST_LOOP,   nullptr, 0},
+  {"move",   PLAYLIST_MOVE,   nullptr, 0},
+  {"play",   PLAYLIST_PLAY,   nullptr, 0},
+  {"remove", PLAYLIST_REMOVE, nullptr, 0},
+  {"save",   PLAYLIST_SAVE,   nullptr, 0}
+};
+
+static bool confirmSeqFormat(CLIPromptEvent event, const char* input, const char* arg) {
+  if (!promptConfirmed(event, input, "YES", F("Format cancelled."))) {
+    return false;
+  }
+  if (sequenceManager.formatStorage()) {
+    Serial.println(F("Sequence storage formatted."));
+  } else {
+    Serial.println(F("Failed to format sequence storage."));
+  }
+  return false;
+}
+
+// seq import: the paste is parsed while it arrives and ends when input
+// pauses after a complete JSON object, or on the inactivity timeout
+static const unsigned long SEQ_IMPORT_TIMEOUT_MS = 60000;
+static const unsigned long SEQ_IMPORT_QUIET_MS = 250;
+static SequenceImporter* serialImport = nullptr;
+
+static void finishSerialImport() {
+  String importedName;
+  String errorMessage;
+  if (!serialImport->hasData() && !serialImport->failed()) {
+    Serial.println(F("❌ No JSON received for import."));
+  } else if (!serialImport->finish(importedName, errorMessage)) {
+    Serial.print(F("❌ Import failed: "));
+    Serial.println(errorMessage);
+  } else {
+    Serial.print(F("✓ Imported sequence: "));
+    Serial.println(importedName);
+  }
+  delete serialImport;
+  serialImport = nullptr;
+}
+
+static bool collectSeqImport(CLIPromptEvent event, const char* input, const char* arg) {
+  switch (event) {
+    case CLI_PROMPT_BYTE:
+      serialImport->feed((const uint8_t*)input, 1);
+      return true;
+
+    case CLI_PROMPT_QUIET:
+      if (!serialImport->complete() && !serialImport->failed()) {
+        return true;  // Keep waiting for the rest of the paste
+      }
+      finishSerialImport();
+      return false;
+
+    default:
+      finishSerialImport();
+      return false;
+  }
+}
+
+// arg = sequence name, validated before the question was asked
+static bool confirmSeqDelete(CLIPromptEvent event, const char* input, const char* arg) {
+  if (promptConfirmed(event, input, "yes", F("❌ Delete cancelled"))) {
+    sequenceManager.deleteSequence(arg);
+  }
+  return false;
+}
 
-  if (params.length() == 0) {
+void handleSequenceCommand(uint8_t argc, char* argv[]) {
+  if (argc == 0) {
     Serial.println(F("\n┌─ Sequence Commands ────────────────────────────"));
     Serial.println(F("│ RECORDING:"));
     Serial.println(F("│  seq new <name>           - Start new recording"));
@@ -4390,38 +5648,40 @@ void handleSequenceCommand(String params) {
     return;
   }
 
-  int spaceIndex = params.indexOf(' ');
-  String subCmd = (spaceIndex > 0) ? params.substring(0, spaceIndex) : params;
-  String subParams = (spaceIndex > 0) ? params.substring(spaceIndex + 1) : "";
-  subCmd.toLowerCase();
-  subParams.trim();
+  int subIndex = cliLookup(seqSubCommands, CLI_TABLE_SIZE(seqSubCommands), argv[0]);
+  if (subIndex < 0) {
+    Serial.println(F("❌ Unknown seq command. Type 'seq' for help."));
+    return;
+  }
+  uint8_t subCmd = seqSubCommands[subIndex].id;
+  const char* subParams = argv[1];  // First argument, "" if none
 
   // ========== RECORDING COMMANDS ==========
 
-  if (subCmd == "new") {
-    if (subParams.length() == 0) {
+  if (subCmd == SEQ_NEW) {
+    if (argc < 2) {
       Serial.println(F("❌ Usage: seq new <name>"));
       return;
     }
-    if (!sequenceManager.isValidSequenceName(subParams.c_str())) {
+    if (!sequenceManager.isValidSequenceName(subParams)) {
       Serial.println(F("Invalid sequence name. Use only A-Z, a-z, 0-9, _ and - (1-31 chars)."));
       return;
     }
-    if (sequenceManager.startRecording(subParams.c_str())) {
+    if (sequenceManager.startRecording(subParams)) {
       Serial.println(F("✓ Recording started. Use 'seq frame <duration>' to add frames."));
     }
     return;
   }
 
-  if (subCmd == "frame") {
+  if (subCmd == SEQ_FRAME) {
     if (!sequenceManager.isRecording()) {
       Serial.println(F("❌ Not recording. Start with 'seq new <name>' first."));
       return;
     }
 
     uint16_t duration = 1000; // Default 1 second
-    if (subParams.length() > 0) {
-      duration = subParams.toInt();
+    if (argc >= 2) {
+      duration = atoi(subParams);
       if (duration < 1 || duration > 60000) {
         Serial.println(F("❌ Duration must be 1-60000 ms"));
         return;
@@ -4448,7 +5708,7 @@ void handleSequenceCommand(String params) {
     return;
   }
 
-  if (subCmd == "save") {
+  if (subCmd == SEQ_SAVE) {
     if (!sequenceManager.isRecording()) {
       Serial.println(F("❌ Not recording."));
       return;
@@ -4457,100 +5717,64 @@ void handleSequenceCommand(String params) {
     return;
   }
 
-  if (subCmd == "export") {
-    if (subParams.length() == 0) {
+  if (subCmd == SEQ_EXPORT) {
+    if (argc < 2) {
       Serial.println(F("❌ Usage: seq export <name>"));
       return;
     }
-    if (!sequenceManager.isValidSequenceName(subParams.c_str())) {
+    if (!sequenceManager.isValidSequenceName(subParams)) {
       Serial.println(F("Invalid sequence name. Use only A-Z, a-z, 0-9, _ and - (1-31 chars)."));
       return;
     }
 
-    String json;
+    SequenceExporter exporter;
     String errorMessage;
-    if (!sequenceManager.exportSequenceJson(subParams.c_str(), json, errorMessage)) {
+    if (!sequenceManager.exportSequenceJson(subParams, exporter, errorMessage)) {
       Serial.print(F("❌ Export failed: "));
       Serial.println(errorMessage);
       return;
     }
 
     Serial.println(F("=== SEQUENCE EXPORT START ==="));
-    Serial.println(json);
+    uint8_t buffer[128];
+    size_t length;
+    while ((length = exporter.read(buffer, sizeof(buffer))) > 0) {
+      Serial.write(buffer, length);
+    }
+    Serial.println();
     Serial.println(F("=== SEQUENCE EXPORT END ==="));
     return;
   }
 
-  if (subCmd == "import") {
-    if (subParams.length() > 0) {
+  if (subCmd == SEQ_IMPORT) {
+    if (argc >= 2) {
       Serial.println(F("❌ Usage: seq import"));
       return;
     }
 
-    Serial.println(F("Paste raw sequence JSON. Import starts automatically after a short quiet period."));
-    String importJson = "";
-    importJson.reserve(16384);
-    unsigned long inputTimeout = millis();
-    unsigned long lastInputAt = millis();
-    const unsigned long INPUT_TIMEOUT_MS = 60000;
-    const unsigned long QUIET_AFTER_DATA_MS = 250;
-
-    while (millis() - inputTimeout < INPUT_TIMEOUT_MS) {
-      if (Serial.available()) {
-        char c = Serial.read();
-        importJson += c;
-        inputTimeout = millis();
-        lastInputAt = millis();
-      }
-
-      if (importJson.length() > 0 && millis() - lastInputAt > QUIET_AFTER_DATA_MS) {
-        break;
-      }
-
-      delay(1);
-    }
-
-    importJson.trim();
-    if (importJson.length() == 0) {
-      Serial.println(F("❌ No JSON received for import."));
-      return;
-    }
-
-    String importedName;
     String errorMessage;
-    if (!sequenceManager.importSequenceJson(importJson, importedName, errorMessage)) {
+    serialImport = new SequenceImporter();
+    if (!serialImport->begin(errorMessage)) {
       Serial.print(F("❌ Import failed: "));
       Serial.println(errorMessage);
+      delete serialImport;
+      serialImport = nullptr;
       return;
     }
 
-    Serial.print(F("✓ Imported sequence: "));
-    Serial.println(importedName);
+    Serial.println(F("Paste raw sequence JSON. Import starts automatically after a short quiet period."));
+    cliPromptBeginRaw(serialPrompt, collectSeqImport, SEQ_IMPORT_TIMEOUT_MS, SEQ_IMPORT_QUIET_MS);
     return;
   }
 
-  if (subCmd == "format") {
+  if (subCmd == SEQ_FORMAT) {
     Serial.println(F("WARNING: seq format will erase all saved sequences."));
     Serial.print(F("Type 'YES' to confirm (30s timeout): "));
-    if (!waitForSerialWithTimeout(30000)) {
-      Serial.println(F("Timeout - format cancelled."));
-      return;
-    }
-    String confirm = Serial.readStringUntil('\n');
-    confirm.trim();
-    if (confirm != "YES") {
-      Serial.println(F("Format cancelled."));
-      return;
-    }
-    if (sequenceManager.formatStorage()) {
-      Serial.println(F("Sequence storage formatted."));
-    } else {
-      Serial.println(F("Failed to format sequence storage."));
-    }
+    cliPromptBegin(serialPrompt, confirmSeqFormat, nullptr, 30000);
     return;
   }
 
-  if (subCmd == "cancel") {
+  if (subCmd == SEQ_CANCEL) {
     if (sequenceManager.cancelRecording()) {
       Serial.println(F("✓ Recording cancelled"));
     } else {
@@ -4561,40 +5785,40 @@ void handleSequenceCommand(String params) {
 
   // ========== PLAYBACK COMMANDS ==========
 
-  if (subCmd == "play") {
-    if (subParams.length() == 0) {
+  if (subCmd == SEQ_PLAY) {
+    if (argc < 2) {
       Serial.println(F("❌ Usage: seq play <name>"));
       return;
     }
-    if (!sequenceManager.isValidSequenceName(subParams.c_str())) {
+    if (!sequenceManager.isValidSequenceName(subParams)) {
       Serial.println(F("Invalid sequence name. Use only A-Z, a-z, 0-9, _ and - (1-31 chars)."));
       return;
     }
-    sequenceManager.playSequence(subParams.c_str(), false);
+    sequenceManager.playSequence(subParams, false);
     return;
   }
 
-  if (subCmd == "loop") {
-    if (subParams.length() == 0) {
+  if (subCmd == SEQ_LOOP) {
+    if (argc < 2) {
       Serial.println(F("❌ Usage: seq loop <name>"));
       return;
     }
-    if (!sequenceManager.isValidSequenceName(subParams.c_str())) {
+    if (!sequenceManager.isValidSequenceName(subParams)) {
       Serial.println(F("Invalid sequence name. Use only A-Z, a-z, 0-9, _ and - (1-31 chars)."));
       return;
     }
-    sequenceManager.playSequence(subParams.c_str(), true);
+    sequenceManager.playSequence(subParams, true);
     return;
   }
 
-  if (subCmd == "stop") {
+  if (subCmd == SEQ_STOP) {
     sequenceManager.stopPlayback();
     return;
   }
 
   // ========== MANAGEMENT COMMANDS ==========
 
-  if (subCmd == "list") {
+  if (subCmd == SEQ_LIST) {
     char names[20][MAX_SEQUENCE_NAME_LENGTH];
     int count = sequenceManager.listSequences(names, 20);
 
@@ -4617,7 +5841,7 @@ void handleSequenceCommand(String params) {
     return;
   }
 
-  if (subCmd == "stats") {
+  if (subCmd == SEQ_STATS) {
     SequenceStorageStats stats;
     if (!sequenceManager.getStorageStats(stats)) {
       Serial.println(F("Failed to read sequence storage stats."));
@@ -4644,23 +5868,38 @@ void handleSequenceCommand(String params) {
     } else {
       Serial.println(F("n/a"));
     }
+    Serial.print(F("  PSRAM cache: "));
+    if (stats.cacheCapacityBytes > 0) {
+      Serial.print(stats.cachedSequences);
+      Serial.print(F(" sequences, "));
+      Serial.print((unsigned long)(stats.cacheBytes / 1024));
+      Serial.print(F(" / "));
+      Serial.print((unsigned long)(stats.cacheCapacityBytes / 1024));
+      Serial.print(F(" KB, "));
+      Serial.print(stats.cacheHits);
+      Serial.print(F(" hits, "));
+      Serial.print(stats.cacheMisses);
+      Serial.println(F(" misses"));
+    } else {
+      Serial.println(F("off (no PSRAM)"));
+    }
     return;
   }
 
-  if (subCmd == "info") {
-    if (subParams.length() == 0) {
+  if (subCmd == SEQ_INFO) {
+    if (argc < 2) {
       Serial.println(F("❌ Usage: seq info <name>"));
       return;
     }
-    if (!sequenceManager.isValidSequenceName(subParams.c_str())) {
+    if (!sequenceManager.isValidSequenceName(subParams)) {
       Serial.println(F("Invalid sequence name. Use only A-Z, a-z, 0-9, _ and - (1-31 chars)."));
       return;
     }
-    sequenceManager.printSequenceInfo(subParams.c_str());
+    sequenceManager.printSequenceInfo(subParams);
     return;
   }
 
-  if (subCmd == "verify" && subParams.equalsIgnoreCase("all")) {
+  if (subCmd == SEQ_VERIFY && cliIs(subParams, "all")) {
     uint16_t okCount = 0;
     uint16_t failCount = 0;
     String report;
@@ -4679,17 +5918,17 @@ void handleSequenceCommand(String params) {
     return;
   }
 
-  if (subCmd == "verify") {
-    if (subParams.length() == 0) {
+  if (subCmd == SEQ_VERIFY) {
+    if (argc < 2) {
       Serial.println(F("❌ Usage: seq verify <name>"));
       return;
     }
-    if (!sequenceManager.isValidSequenceName(subParams.c_str())) {
+    if (!sequenceManager.isValidSequenceName(subParams)) {
       Serial.println(F("Invalid sequence name. Use only A-Z, a-z, 0-9, _ and - (1-31 chars)."));
       return;
     }
 
-    if (subParams.equalsIgnoreCase("all")) {
+    if (cliIs(subParams, "all")) {
       uint16_t okCount = 0;
       uint16_t failCount = 0;
       String report;
@@ -4710,7 +5949,7 @@ void handleSequenceCommand(String params) {
 
     SequenceVerifyInfo verifyInfo;
     String errorMessage;
-    bool ok = sequenceManager.verifySequence(subParams.c_str(), verifyInfo, errorMessage);
+    bool ok = sequenceManager.verifySequence(subParams, verifyInfo, errorMessage);
 
     Serial.println(F("\nSequence Verify"));
     Serial.print(F("  Name: "));
@@ -4734,74 +5973,58 @@ void handleSequenceCommand(String params) {
     return;
   }
 
-  if (subCmd == "duplicate") {
-    int space = subParams.indexOf(' ');
-    if (space < 0) {
+  if (subCmd == SEQ_DUPLICATE) {
+    if (argc < 3) {
       Serial.println(F("Usage: seq duplicate <old_name> <new_name>"));
       return;
     }
 
-    String oldName = subParams.substring(0, space);
-    String newName = subParams.substring(space + 1);
-    oldName.trim();
-    newName.trim();
+    const char* oldName = argv[1];
+    const char* newName = argv[2];
 
-    if (!sequenceManager.isValidSequenceName(oldName.c_str()) ||
-        !sequenceManager.isValidSequenceName(newName.c_str())) {
+    if (!sequenceManager.isValidSequenceName(oldName) ||
+        !sequenceManager.isValidSequenceName(newName)) {
       Serial.println(F("Invalid sequence name. Use only A-Z, a-z, 0-9, _ and - (1-31 chars)."));
       return;
     }
 
-    if (!sequenceManager.duplicateSequence(oldName.c_str(), newName.c_str())) {
+    if (!sequenceManager.duplicateSequence(oldName, newName)) {
       Serial.println(F("Sequence duplicate failed."));
     }
     return;
   }
 
-  if (subCmd == "delete") {
-    if (subParams.length() == 0) {
+  if (subCmd == SEQ_DELETE) {
+    if (argc < 2) {
       Serial.println(F("❌ Usage: seq delete <name>"));
       return;
     }
     Serial.print(F("⚠️ Delete sequence \""));
-    if (!sequenceManager.isValidSequenceName(subParams.c_str())) {
+    if (!sequenceManager.isValidSequenceName(subParams)) {
       Serial.println(F("Invalid sequence name. Use only A-Z, a-z, 0-9, _ and - (1-31 chars)."));
       return;
     }
     Serial.print(subParams);
     Serial.println(F("\"? Type 'yes' to confirm:"));
-    if (!waitForSerialWithTimeout(30000)) {
-      Serial.println(F("Timeout - delete cancelled"));
-      return;
-    }
-    String confirm = Serial.readStringUntil('\n');
-    confirm.trim();
-    if (confirm != "yes") {
-      Serial.println(F("❌ Delete cancelled"));
-      return;
-    }
-    sequenceManager.deleteSequence(subParams.c_str());
+    cliPromptBegin(serialPrompt, confirmSeqDelete, subParams, 30000);
     return;
   }
 
-  if (subCmd == "rename") {
-    int space = subParams.indexOf(' ');
-    if (space < 0) {
+  if (subCmd == SEQ_RENAME) {
+    if (argc < 3) {
       Serial.println(F("❌ Usage: seq rename <old_name> <new_name>"));
       return;
     }
-    String oldName = subParams.substring(0, space);
-    String newName = subParams.substring(space + 1);
-    oldName.trim();
-    newName.trim();
+    const char* oldName = argv[1];
+    const char* newName = argv[2];
 
-    if (!sequenceManager.isValidSequenceName(oldName.c_str()) ||
-        !sequenceManager.isValidSequenceName(newName.c_str())) {
+    if (!sequenceManager.isValidSequenceName(oldName) ||
+        !sequenceManager.isValidSequenceName(newName)) {
       Serial.println(F("Invalid sequence name. Use only A-Z, a-z, 0-9, _ and - (1-31 chars)."));
       return;
     }
 
-    if (sequenceManager.renameSequence(oldName.c_str(), newName.c_str())) {
+    if (sequenceManager.renameSequence(oldName, newName)) {
       Serial.print(F("✓ Renamed '"));
       Serial.print(oldName);
       Serial.print(F("' to '"));
@@ -4815,34 +6038,32 @@ void handleSequenceCommand(String params) {
 
   // ========== PLAYLIST COMMANDS (CHAINING) ==========
 
-  if (subCmd == "playlist") {
-    if (subParams.length() == 0) {
+  if (subCmd == SEQ_PLAYLIST) {
+    if (argc < 2) {
       // Show current playlist
       sequenceManager.playlistPrint();
       return;
     }
 
     // Parse playlist subcommand
-    int space = subParams.indexOf(' ');
-    String plCmd = (space > 0) ? subParams.substring(0, space) : subParams;
-    String plParams = (space > 0) ? subParams.substring(space + 1) : "";
-    plCmd.toLowerCase();
-    plParams.trim();
-
-    if (plCmd == "add") {
-      if (plParams.length() == 0) {
+    int plIndex = cliLookup(playlistSubCommands, CLI_TABLE_SIZE(playlistSubCommands), argv[1]);
+    int plCmd = (plIndex >= 0) ? playlistSubCommands[plIndex].id : -1;
+    const char* plParams = argv[2];
+
+    if (plCmd == PLAYLIST_ADD) {
+      if (argc < 3) {
         Serial.println(F("❌ Usage: seq playlist add <sequence_name>"));
         return;
       }
-      if (!sequenceManager.isValidSequenceName(plParams.c_str())) {
+      if (!sequenceManager.isValidSequenceName(plParams)) {
         Serial.println(F("Invalid sequence name. Use only A-Z, a-z, 0-9, _ and - (1-31 chars)."));
         return;
       }
-      sequenceManager.playlistAdd(plParams.c_str());
+      sequenceManager.playlistAdd(plParams);
       return;
     }
 
-    if (plCmd == "list") {
+    if (plCmd == PLAYLIST_LIST) {
       char playlistNames[20][MAX_SEQUENCE_NAME_LENGTH];
       int playlistCount = sequenceManager.listPlaylists(playlistNames, 20);
       if (playlistCount == 0) {
@@ -4860,7 +6081,7 @@ void handleSequenceCommand(String params) {
       return;
     }
 
-    if (plCmd == "remove") {
+    if (plCmd == PLAYLIST_REMOVE) {
       int index = 0;
       if (!safeParseInt(plParams, index, 1, MAX_PLAYLIST_ITEMS)) {
         Serial.println(F("❌ Usage: seq playlist remove <item_number>"));
@@ -4870,17 +6091,9 @@ void handleSequenceCommand(String params) {
       return;
     }
 
-    if (plCmd == "move") {
-      int moveSpace = plParams.indexOf(' ');
-      if (moveSpace < 0) {
-        Serial.println(F("❌ Usage: seq playlist move <from> <to>"));
-        return;
-      }
-
-      String fromArg = plParams.substring(0, moveSpace);
-      String toArg = plParams.substring(moveSpace + 1);
-      fromArg.trim();
-      toArg.trim();
+    if (plCmd == PLAYLIST_MOVE) {
+      const char* fromArg = argv[2];
+      const char* toArg = argv[3];
 
       int fromIndex = 0;
       int toIndex = 0;
@@ -4894,47 +6107,47 @@ void handleSequenceCommand(String params) {
       return;
     }
 
-    if (plCmd == "save") {
-      if (plParams.length() == 0) {
+    if (plCmd == PLAYLIST_SAVE) {
+      if (argc < 3) {
         Serial.println(F("Usage: seq playlist save <name>"));
         return;
       }
-      if (!sequenceManager.isValidSequenceName(plParams.c_str())) {
+      if (!sequenceManager.isValidSequenceName(plParams)) {
         Serial.println(F("Invalid playlist name. Use only A-Z, a-z, 0-9, _ and - (1-31 chars)."));
         return;
       }
-      if (!sequenceManager.playlistSave(plParams.c_str())) {
+      if (!sequenceManager.playlistSave(plParams)) {
         Serial.println(F("Playlist save failed."));
       }
       return;
     }
 
-    if (plCmd == "load") {
-      if (plParams.length() == 0) {
+    if (plCmd == PLAYLIST_LOAD) {
+      if (argc < 3) {
         Serial.println(F("Usage: seq playlist load <name>"));
         return;
       }
-      if (!sequenceManager.isValidSequenceName(plParams.c_str())) {
+      if (!sequenceManager.isValidSequenceName(plParams)) {
         Serial.println(F("Invalid playlist name. Use only A-Z, a-z, 0-9, _ and - (1-31 chars)."));
         return;
       }
-      if (!sequenceManager.playlistLoad(plParams.c_str())) {
+      if (!sequenceManager.playlistLoad(plParams)) {
         Serial.println(F("Playlist load failed."));
       }
       return;
     }
 
-    if (plCmd == "clear") {
+    if (plCmd == PLAYLIST_CLEAR) {
       sequenceManager.playlistClear();
       return;
     }
 
-    if (plCmd == "play") {
+    if (plCmd == PLAYLIST_PLAY) {
       sequenceManager.playlistStart(false);
       return;
     }
 
-    if (plCmd == "loop") {
+    if (plCmd == PLAYLIST_LOOP) {
       sequenceManager.playlistStart(true);
       return;
     }
@@ -4955,8 +6168,8 @@ void handleSequenceCommand(String params) {
 
   // ========== IR MAPPING COMMANDS ==========
 
-  if (subCmd == "map") {
-    if (subParams.length() == 0) {
+  if (subCmd == SEQ_MAP) {
+    if (argc < 2) {
       // Show all IR mappings
       Serial.println(F("\n┌─ IR Button Mappings ───────────────────────────"));
       bool hasMappings = false;
@@ -4977,22 +6190,19 @@ void handleSequenceCommand(String params) {
     }
 
     // Parse: map <button_name> <sequence_name>
-    int space = subParams.indexOf(' ');
-    if (space < 0) {
+    if (argc < 3) {
       Serial.println(F("❌ Usage: seq map <button_name> <sequence_name>"));
       Serial.println(F("   Or: seq map <button_name> clear"));
       return;
     }
 
-    String buttonName = subParams.substring(0, space);
-    String seqName = subParams.substring(space + 1);
-    buttonName.trim();
-    seqName.trim();
+    const char* buttonName = argv[1];
+    const char* seqName = argv[2];
 
     // Find button
     int buttonIndex = -1;
     for (int i = 0; i < config.buttonCount; i++) {
-      if (config.buttons[i].isConfigured && strcmp(config.buttons[i].name, buttonName.c_str()) == 0) {
+      if (config.buttons[i].isConfigured && strcmp(config.buttons[i].name, buttonName) == 0) {
         buttonIndex = i;
         break;
       }
@@ -5006,7 +6216,7 @@ void handleSequenceCommand(String params) {
     }
 
     // Clear mapping
-    if (seqName.equalsIgnoreCase("clear")) {
+    if (cliIs(seqName, "clear")) {
       config.buttons[buttonIndex].sequenceName[0] = '\0';
       smartSaveToEEPROM();
       Serial.print(F("✓ Cleared mapping for button: "));
@@ -5014,20 +6224,20 @@ void handleSequenceCommand(String params) {
       return;
     }
 
-    if (!sequenceManager.isValidSequenceName(seqName.c_str())) {
+    if (!sequenceManager.isValidSequenceName(seqName)) {
       Serial.println(F("Invalid sequence name. Use only A-Z, a-z, 0-9, _ and - (1-31 chars)."));
       return;
     }
 
     // Check if sequence exists
-    if (!sequenceManager.sequenceExists(seqName.c_str())) {
+    if (!sequenceManager.sequenceExists(seqName)) {
       Serial.print(F("❌ Sequence not found: "));
       Serial.println(seqName);
       return;
     }
 
     // Set mapping
-    strncpy(config.buttons[buttonIndex].sequenceName, seqName.c_str(), 31);
+    strncpy(config.buttons[buttonIndex].sequenceName, seqName, 31);
     config.buttons[buttonIndex].sequenceName[31] = '\0';
     smartSaveToEEPROM();
 
@@ -5041,7 +6251,7 @@ void handleSequenceCommand(String params) {
 
   // ========== STATUS COMMAND ==========
 
-  if (subCmd == "status") {
+  if (subCmd == SEQ_STATUS) {
     Serial.println(F("\n┌─ Sequence System Status ───────────────────────"));
     Serial.print(F("│ Storage: "));
     Serial.println(sequenceManager.isStorageAvailable() ? F("LittleFS OK") : F("Not available"));
@@ -5076,38 +6286,165 @@ void handleSequenceCommand(String params) {
 // SEQUENCE WEB HANDLERS
 //========================================
 
-void handleSeqList() {
-  if (!checkWebAuth()) return;
+//----------------------------------------
+// Streamed list responses
+//----------------------------------------
+// Built one entry at a time while the response is sent (network task), so
+// neither the number of files nor the response size is limited by RAM.
+
+// {"name":"..."} for every file with the given extension in a directory
+class DirectoryNameList : public JsonListSource {
+public:
+  DirectoryNameList(const char* path, const char* extension, const char* message, const char* listKey)
+    : JsonListSource(message, listKey), extension(extension) {
+    if (sequenceManager.isStorageAvailable()) {
+      dir = fsOpen(path);
+    }
+  }
 
-  const int MAX_LIST = 20;
-  char names[MAX_LIST][MAX_SEQUENCE_NAME_LENGTH];
-  int count = sequenceManager.listSequences(names, MAX_LIST);
+protected:
+  bool nextItem(char* out, size_t size) override {
+    if (!dir) {
+      return false;
+    }
+    size_t extensionLength = strlen(extension);
+    for (File entry = dir.openNextFile(); entry; entry = dir.openNextFile()) {
+      if (entry.isDirectory()) {
+        continue;
+      }
+      const char* name = entry.name();
+      const char* slash = strrchr(name, '/');
+      if (slash != nullptr) {
+        name = slash + 1;
+      }
+      size_t length = strlen(name);
+      if (length <= extensionLength || length - extensionLength >= MAX_SEQUENCE_NAME_LENGTH ||
+          strcmp(name + length - extensionLength, extension) != 0) {
+        continue;
+      }
 
-  String json = "{\"ok\":true,\"message\":\"Sequence list loaded.\",\"sequences\":[";
-  for (int i = 0; i < count; i++) {
-    if (i > 0) json += ",";
-    json += "{\"name\":\"";
-    json += escapeJsonString(names[i]);
-    json += "\"}";
-  }
-  json += "],\"count\":";
-  json += String(count);
-  json += ",\"maxDisplayed\":";
-  json += String(MAX_LIST);
-  json += "}";
-
-  server.send(200, "application/json", json);
+      char baseName[MAX_SEQUENCE_NAME_LENGTH];
+      memcpy(baseName, name, length - extensionLength);
+      baseName[length - extensionLength] = '\0';
+
+      strlcpy(out, "{\"name\":", size);
+      appendJsonString(out, size, baseName);
+      strlcat(out, "}", size);
+      return true;
+    }
+    return false;
+  }
+
+private:
+  File dir;
+  const char* extension;
+};
+
+// {"name":"..."} for every sequence in the index. The names are copied a few
+// at a time, checked against the generation the response started with; the
+// index may grow (and move) meanwhile, which ends the list with an error.
+static const int SEQUENCE_LIST_CHUNK = 4;
+
+class SequenceIndexList : public JsonListSource {
+public:
+  SequenceIndexList()
+    : JsonListSource("Sequence list loaded.", "sequences"),
+      generation(sequenceManager.getIndexGeneration()), first(0), count(0), position(0),
+      lastChunk(false) {}
+
+protected:
+  bool nextItem(char* out, size_t size) override {
+    if (position >= count) {
+      if (lastChunk) {
+        return false;
+      }
+      first += count;
+      count = sequenceManager.listSequences(names, SEQUENCE_LIST_CHUNK, first, generation);
+      position = 0;
+      if (count < 0) {
+        count = 0;
+        lastChunk = true;
+        failList("Sequence list changed while it was sent - reload it.");
+        return false;
+      }
+      lastChunk = count < SEQUENCE_LIST_CHUNK;  // Short chunk - end of the index
+      if (count == 0) {
+        return false;
+      }
+    }
+    strlcpy(out, "{\"name\":", size);
+    appendJsonString(out, size, names[position++]);
+    strlcat(out, "}", size);
+    return true;
+  }
+
+private:
+  char names[SEQUENCE_LIST_CHUNK][MAX_SEQUENCE_NAME_LENGTH];
+  uint32_t generation;
+  uint16_t first;     // Index position of names[0]
+  int count;          // Names held in this chunk
+  int position;       // Next name to emit
+  bool lastChunk;
+};
+
+// IR button -> sequence assignments. config.buttons is a fixed table; an
+// edit from the serial CLI during the response shows up as either state.
+class ButtonMappingList : public JsonListSource {
+public:
+  ButtonMappingList() : JsonListSource("IR mappings loaded.", "mappings"), index(0) {}
+
+protected:
+  bool nextItem(char* out, size_t size) override {
+    while (index < config.buttonCount && index < sizeof(config.buttons) / sizeof(config.buttons[0])) {
+      const IRButton& button = config.buttons[index++];
+      if (!button.isConfigured) {
+        continue;
+      }
+      strlcpy(out, "{\"button\":", size);
+      appendJsonString(out, size, button.name);
+      strlcat(out, ",\"sequence\":", size);
+      appendJsonString(out, size, button.sequenceName);
+      strlcat(out, button.sequenceName[0] != '\0' ? ",\"mapped\":true}" : ",\"mapped\":false}", size);
+      return true;
+    }
+    return false;
+  }
+
+private:
+  uint8_t index;
+};
+
+// List ETags: what the list depends on plus a per-boot tag, since the
+// generations start over after a reboot
+static bool listNotModified(const char* kind, uint32_t generation) {
+  static const uint32_t bootTag = esp_random();
+  char etag[WEB_MAX_ETAG_LENGTH];
+  snprintf(etag, sizeof(etag), "\"%s-%08lx-%lx\"", kind, (unsigned long)bootTag, (unsigned long)generation);
+  return webRequest.notModified(etag);
+}
+
+void handleSeqList() {
+  if (!checkWebAuth()) return;
+  if (listNotModified("seq", sequenceManager.getIndexGeneration())) return;
+  webRequest.sendChunked("application/json", new SequenceIndexList());
 }
 
+void handleStateList() {
+  if (!checkWebAuth()) return;
+  if (listNotModified("scene", fsGeneration())) return;
+  webRequest.sendChunked("application/json",
+                         new DirectoryNameList(SCENES_DIR, SCENE_FILE_EXTENSION, "Scene list loaded.", "scenes"));
+}
+
 void handleSeqPlay() {
   if (!checkWebAuth()) return;
 
-  if (!server.hasArg("name")) {
+  if (!webRequest.hasArg("name")) {
     sendApiResponse(400, false, "Missing name parameter.");
     return;
   }
 
-  String name = server.arg("name");
+  String name = webRequest.arg("name");
   if (!sequenceManager.isValidSequenceName(name.c_str())) {
     sendApiResponse(400, false, "Invalid sequence name.");
     return;
@@ -5151,12 +6488,12 @@ void handleSeqResume() {
 void handleSeqLoop() {
   if (!checkWebAuth()) return;
 
-  if (!server.hasArg("name")) {
+  if (!webRequest.hasArg("name")) {
     sendApiResponse(400, false, "Missing name parameter.");
     return;
   }
 
-  String name = server.arg("name");
+  String name = webRequest.arg("name");
   if (!sequenceManager.isValidSequenceName(name.c_str())) {
     sendApiResponse(400, false, "Invalid sequence name.");
     return;
@@ -5175,12 +6512,12 @@ void handleSeqLoop() {
 void handleSeqDelete() {
   if (!checkWebAuth()) return;
 
-  if (!server.hasArg("name")) {
+  if (!webRequest.hasArg("name")) {
     sendApiResponse(400, false, "Missing name parameter.");
     return;
   }
 
-  String name = server.arg("name");
+  String name = webRequest.arg("name");
   if (!sequenceManager.isValidSequenceName(name.c_str())) {
     sendApiResponse(400, false, "Invalid sequence name.");
     return;
@@ -5199,12 +6536,12 @@ void handleSeqDelete() {
 void handleSeqVerify() {
   if (!checkWebAuth()) return;
 
-  if (!server.hasArg("name")) {
+  if (!webRequest.hasArg("name")) {
     sendApiResponse(400, false, "Missing name parameter.");
     return;
   }
 
-  String name = server.arg("name");
+  String name = webRequest.arg("name");
   if (!sequenceManager.isValidSequenceName(name.c_str())) {
     sendApiResponse(400, false, "Invalid sequence name.");
     return;
@@ -5256,20 +6593,25 @@ void handleSeqStats() {
   extraJson += "\"usedBytes\":" + String((unsigned long)stats.usedBytes) + ",";
   extraJson += "\"freeBytes\":" + String((unsigned long)stats.freeBytes) + ",";
   extraJson += "\"largestSequenceBytes\":" + String((unsigned long)stats.largestSequenceBytes) + ",";
-  extraJson += "\"largestSequenceName\":\"" + escapeJsonString(stats.largestSequenceName) + "\"";
+  extraJson += "\"largestSequenceName\":\"" + escapeJsonString(stats.largestSequenceName) + "\",";
+  extraJson += "\"cachedSequences\":" + String(stats.cachedSequences) + ",";
+  extraJson += "\"cacheBytes\":" + String((unsigned long)stats.cacheBytes) + ",";
+  extraJson += "\"cacheCapacityBytes\":" + String((unsigned long)stats.cacheCapacityBytes) + ",";
+  extraJson += "\"cacheHits\":" + String((unsigned long)stats.cacheHits) + ",";
+  extraJson += "\"cacheMisses\":" + String((unsigned long)stats.cacheMisses);
   sendApiResponse(200, true, "Sequence storage stats loaded.", extraJson);
 }
 
 void handleSeqDuplicate() {
   if (!checkWebAuth()) return;
 
-  if (!server.hasArg("source") || !server.hasArg("target")) {
+  if (!webRequest.hasArg("source") || !webRequest.hasArg("target")) {
     sendApiResponse(400, false, "Missing source or target parameter.");
     return;
   }
 
-  String sourceName = server.arg("source");
-  String targetName = server.arg("target");
+  String sourceName = webRequest.arg("source");
+  String targetName = webRequest.arg("target");
   if (!sequenceManager.isValidSequenceName(sourceName.c_str()) ||
       !sequenceManager.isValidSequenceName(targetName.c_str())) {
     sendApiResponse(400, false, "Invalid sequence name.");
@@ -5283,46 +6625,83 @@ void handleSeqDuplicate() {
                           : String("Failed to duplicate sequence: ") + sourceName + " -> " + targetName);
 }
 
+// /seq/export body: the binary records turned into JSON as the client reads
+class SequenceExportSource : public WebChunkSource {
+public:
+  SequenceExporter exporter;
+
+  size_t read(uint8_t* buffer, size_t maxLength) override {
+    return exporter.read(buffer, maxLength);
+  }
+};
+
 void handleSeqExport() {
   if (!checkWebAuth()) return;
 
-  if (!server.hasArg("name")) {
+  if (!webRequest.hasArg("name")) {
     sendApiResponse(400, false, "Missing name parameter.");
     return;
   }
 
-  String name = server.arg("name");
+  String name = webRequest.arg("name");
   if (!sequenceManager.isValidSequenceName(name.c_str())) {
     sendApiResponse(400, false, "Invalid sequence name.");
     return;
   }
 
-  String json;
+  SequenceExportSource* source = new SequenceExportSource();
   String errorMessage;
-  if (!sequenceManager.exportSequenceJson(name.c_str(), json, errorMessage)) {
+  if (!sequenceManager.exportSequenceJson(name.c_str(), source->exporter, errorMessage)) {
+    delete source;
     sendApiResponse(404, false, errorMessage);
     return;
   }
 
-  server.send(200, "application/json", json);
+  webRequest.sendChunked("application/json", source);
+}
+
+// /seq/import body: parsed and written to the temp file as it arrives
+class SequenceImportSink : public WebBodySink {
+public:
+  SequenceImporter importer;
+
+  void write(const uint8_t* data, size_t length) override {
+    importer.feed(data, length);
+  }
+};
+
+WebBodySink* createSequenceImportSink(size_t totalLength) {
+  SequenceImportSink* sink = new SequenceImportSink();
+  String errorMessage;
+  sink->importer.begin(errorMessage);   // A refusal is reported by finish()
+  return sink;
 }
 
 void handleSeqImport() {
   if (!checkWebAuth()) return;
 
-  String payload = server.hasArg("plain") ? server.arg("plain") : server.arg("data");
-  payload.trim();
+  String importedName;
+  String errorMessage;
+  bool success;
+  SequenceImportSink* sink = static_cast<SequenceImportSink*>(webRequest.bodySink());
+  if (sink != nullptr && (sink->importer.hasData() || sink->importer.failed())) {
+    success = sink->importer.finish(importedName, errorMessage);
+  } else {
+    // Form posts (data=...) arrive as an argument instead of a body
+    String payload = webRequest.arg("data");
+    payload.trim();
+
+    if (payload.length() == 0) {
+      sendApiResponse(400, false, "Missing sequence JSON payload.");
+      return;
+    }
 
-  if (payload.length() == 0) {
-    sendApiResponse(400, false, "Missing sequence JSON payload.");
-    return;
+    success = sequenceManager.importSequenceJson(payload, importedName, errorMessage);
   }
 
-  String importedName;
-  String errorMessage;
-  bool success = sequenceManager.importSequenceJson(payload, importedName, errorMessage);
   if (!success) {
-    int statusCode = errorMessage.indexOf("already exists") >= 0 ? 409 : 422;
+    int statusCode = errorMessage.indexOf("already exists") >= 0 ? 409 :
+                     (errorMessage.indexOf("in progress") >= 0 ? 503 : 422);
     sendApiResponse(statusCode, false, errorMessage);
     return;
   }
@@ -5336,12 +6715,12 @@ void handleSeqImport() {
 void handleSeqPlaylistAdd() {
   if (!checkWebAuth()) return;
 
-  if (!server.hasArg("name")) {
+  if (!webRequest.hasArg("name")) {
     sendApiResponse(400, false, "Missing name parameter.");
     return;
   }
 
-  String name = server.arg("name");
+  String name = webRequest.arg("name");
   if (!sequenceManager.isValidSequenceName(name.c_str())) {
     sendApiResponse(400, false, "Invalid sequence name.");
     return;
@@ -5361,7 +6740,7 @@ void handleSeqPlaylistRemove() {
   if (!checkWebAuth()) return;
 
   int index = 0;
-  if (!server.hasArg("index") || !safeParseInt(server.arg("index"), index, 1, MAX_PLAYLIST_ITEMS)) {
+  if (!webRequest.hasArg("index") || !safeParseInt(webRequest.arg("index"), index, 1, MAX_PLAYLIST_ITEMS)) {
     sendApiResponse(400, false, "Missing or invalid playlist index.");
     return;
   }
@@ -5377,9 +6756,9 @@ void handleSeqPlaylistMove() {
 
   int fromIndex = 0;
   int toIndex = 0;
-  if (!server.hasArg("from") || !server.hasArg("to") ||
-      !safeParseInt(server.arg("from"), fromIndex, 1, MAX_PLAYLIST_ITEMS) ||
-      !safeParseInt(server.arg("to"), toIndex, 1, MAX_PLAYLIST_ITEMS)) {
+  if (!webRequest.hasArg("from") || !webRequest.hasArg("to") ||
+      !safeParseInt(webRequest.arg("from"), fromIndex, 1, MAX_PLAYLIST_ITEMS) ||
+      !safeParseInt(webRequest.arg("to"), toIndex, 1, MAX_PLAYLIST_ITEMS)) {
     sendApiResponse(400, false, "Missing or invalid playlist move parameters.");
     return;
   }
@@ -5394,12 +6773,12 @@ void handleSeqPlaylistMove() {
 void handleSeqPlaylistSave() {
   if (!checkWebAuth()) return;
 
-  if (!server.hasArg("name")) {
+  if (!webRequest.hasArg("name")) {
     sendApiResponse(400, false, "Missing playlist name parameter.");
     return;
   }
 
-  String playlistName = server.arg("name");
+  String playlistName = webRequest.arg("name");
   if (!sequenceManager.isValidSequenceName(playlistName.c_str())) {
     sendApiResponse(400, false, "Invalid playlist name.");
     return;
@@ -5415,12 +6794,12 @@ void handleSeqPlaylistSave() {
 void handleSeqPlaylistLoad() {
   if (!checkWebAuth()) return;
 
-  if (!server.hasArg("name")) {
+  if (!webRequest.hasArg("name")) {
     sendApiResponse(400, false, "Missing playlist name parameter.");
     return;
   }
 
-  String playlistName = server.arg("name");
+  String playlistName = webRequest.arg("name");
   if (!sequenceManager.isValidSequenceName(playlistName.c_str())) {
     sendApiResponse(400, false, "Invalid playlist name.");
     return;
@@ -5435,22 +6814,10 @@ void handleSeqPlaylistLoad() {
 
 void handleSeqPlaylistList() {
   if (!checkWebAuth()) return;
+  if (listNotModified("pls", fsGeneration())) return;
 
-  const int MAX_LIST = 20;
-  char names[MAX_LIST][MAX_SEQUENCE_NAME_LENGTH];
-  int count = sequenceManager.listPlaylists(names, MAX_LIST);
-
-  String json = "{\"ok\":true,\"message\":\"Saved playlists loaded.\",\"playlists\":[";
-  for (int i = 0; i < count; i++) {
-    if (i > 0) json += ",";
-    json += "{\"name\":\"";
-    json += escapeJsonString(names[i]);
-    json += "\"}";
-  }
-  json += "],\"count\":";
-  json += String(count);
-  json += "}";
-  server.send(200, "application/json", json);
+  webRequest.sendChunked("application/json",
+                         new DirectoryNameList(PLAYLISTS_DIR, ".pls", "Saved playlists loaded.", "playlists"));
 }
 
 void handleSeqPlaylistClear() {
@@ -5499,44 +6866,34 @@ void handleSeqPlaylistGet() {
   json += sequenceManager.playlistIsActive() ? "true" : "false";
   json += "}";
 
-  server.send(200, "application/json", json);
+  // The playlist lives in RAM and changes in many places, so its tag is a
+  // hash of the reply (FNV-1a) rather than a counter
+  uint32_t hash = 2166136261UL;
+  for (size_t i = 0; i < json.length(); i++) {
+    hash = (hash ^ (uint8_t)json[i]) * 16777619UL;
+  }
+  if (listNotModified("playlist", hash)) return;
+
+  webRequest.send(200, "application/json", json);
 }
 
 void handleSeqMapList() {
   if (!checkWebAuth()) return;
+  if (listNotModified("map", irMappingGeneration)) return;
 
-  String json = "{\"ok\":true,\"message\":\"IR mappings loaded.\",\"mappings\":[";
-  bool first = true;
-
-  for (int i = 0; i < config.buttonCount; i++) {
-    if (config.buttons[i].isConfigured) {
-      if (!first) json += ",";
-      first = false;
-
-      json += "{\"button\":\"";
-      json += escapeJsonString(config.buttons[i].name);
-      json += "\",\"sequence\":\"";
-      json += escapeJsonString(config.buttons[i].sequenceName);
-      json += "\",\"mapped\":";
-      json += strlen(config.buttons[i].sequenceName) > 0 ? "true" : "false";
-      json += "}";
-    }
-  }
-
-  json += "]}";
-  server.send(200, "application/json", json);
+  webRequest.sendChunked("application/json", new ButtonMappingList());
 }
 
 void handleSeqMapSet() {
   if (!checkWebAuth()) return;
 
-  if (!server.hasArg("button") || !server.hasArg("sequence")) {
+  if (!webRequest.hasArg("button") || !webRequest.hasArg("sequence")) {
     sendApiResponse(400, false, "Missing button or sequence parameter.");
     return;
   }
 
-  String buttonName = server.arg("button");
-  String seqName = server.arg("sequence");
+  String buttonName = webRequest.arg("button");
+  String seqName = webRequest.arg("sequence");
 
   if (!sequenceManager.isValidSequenceName(seqName.c_str())) {
     sendApiResponse(400, false, "Invalid sequence name.");
@@ -5575,12 +6932,12 @@ void handleSeqMapSet() {
 void handleSeqMapClear() {
   if (!checkWebAuth()) return;
 
-  if (!server.hasArg("button")) {
+  if (!webRequest.hasArg("button")) {
     sendApiResponse(400, false, "Missing button parameter.");
     return;
   }
 
-  String buttonName = server.arg("button");
+  String buttonName = webRequest.arg("button");
   int buttonIndex = -1;
   for (int i = 0; i < config.buttonCount; i++) {
     if (config.buttons[i].isConfigured && strcmp(config.buttons[i].name, buttonName.c_str()) == 0) {
@@ -11,6 +11,8 @@
 
 #include <Arduino.h>
 #include "config.h"  // For Command enum and structures
+
+class WebBodySink;
 void initializeIR();
 // #include "Mp3Notify.h" // <-- THIS LINE MUST BE REMOVED OR COMMENTED OUT
 
@@ -19,8 +21,9 @@ void initializeIR();
 //========================================
 
 // Main web interface handlers
-void handleRoot();                    // Main web page
+void registerWebAssetRoutes();        // "/", style.css, app.js straight from flash
 void handleWebStatus();              // System status via web
+void handleMetrics();                // OpenMetrics counters/histograms
 void handleNotFound();               // 404 handler
 
 // Web authentication helper
@@ -39,11 +42,24 @@ void handlePulse();                  // Activate pulse mode
 // Audio control handlers
 void handleVolume();                 // Set volume
 void handlePlaySound();              // Play specific sound file
+void handleAudioHealth();            // DFPlayer link stats (JSON)
 
 // Servo control handlers
 void handleSetServos();              // Set multiple servo positions
+void setRemoteServoTargets(int eyePanPos, int eyeTiltPos, int headPanPos, int headTiltPos); // Latest wins, any task
+void printRemoteServoStats();        // Remote target requests, drops, latency
+void handleWebLinkInfo();            // WebSocket port and session token (JSON)
 void handleWebMode();                // Change personality mode via web
 
+// State snapshot handlers
+void handleState();                  // GET snapshot (JSON/binary), POST restore
+void handleStateSave();              // Store current state in a RAM slot or scene file
+void handleStateRecall();            // Apply a stored scene
+void handleStateSlots();             // RAM slots (JSON)
+void handleStateList();              // Scene files (JSON)
+void handleStateDelete();            // Delete a scene file
+void handleBatch();                  // Several commands in one request (POST JSON array)
+
 // Detail LED web handlers
 void handleDetailCount();            // Set detail LED count via web
 void handleDetailBrightnessWeb();    // Set detail LED brightness via web
@@ -64,6 +80,7 @@ void handleSeqStats();               // Sequence storage stats
 void handleSeqDuplicate();           // Duplicate sequence
 void handleSeqExport();              // Export raw sequence JSON
 void handleSeqImport();              // Import raw sequence JSON
+WebBodySink* createSequenceImportSink(size_t totalLength);  // Streamed /seq/import body
 void handleSeqPlaylistAdd();         // Add to playlist
 void handleSeqPlaylistRemove();      // Remove playlist item
 void handleSeqPlaylistMove();        // Reorder playlist item
@@ -83,19 +100,23 @@ void handleSeqMapClear();            // Clear IR mapping
 //========================================
 
 // Core command processing
-Command parseCommand(String cmd);
-void processCommand(String fullCommand);
-
-// Specialized command handlers
-void handleServoCommand(String params);
-void handleLEDCommand(String params);
-void handleDetailCommand(String params);  // NEW: Detail LED control (WS2812)
-void handleSoundCommand(String params);
-void handleTimingCommand(String params);
-void handleProfileCommand(String params);
-void handleWiFiCommand(String params);    // WiFi configuration
-void handleAPCommand(String params);       // Access Point configuration
-void handleSequenceCommand(String params); // Sequence recording and playback
+void initializeCLI();                // Reset line assembler, check command tables
+void pollSerialCommands();           // Feed available serial bytes, run completed lines
+Command parseCommand(uint8_t argc, char* argv[], uint8_t& consumed);
+void processCommand(char* line);     // Tokenizes line in place
+
+// Specialized command handlers (argv[0] is the sub-command)
+void handleServoCommand(uint8_t argc, char* argv[]);
+void handleLEDCommand(uint8_t argc, char* argv[]);
+void handleDetailCommand(uint8_t argc, char* argv[]);   // NEW: Detail LED control (WS2812)
+void handleSoundCommand(uint8_t argc, char* argv[]);
+void handleTimingCommand(uint8_t argc, char* argv[]);
+void handleProfileCommand(uint8_t argc, char* argv[]);
+void handleWiFiCommand(uint8_t argc, char* argv[]);     // WiFi configuration
+void handleAPCommand(uint8_t argc, char* argv[]);       // Access Point configuration
+void handleSequenceCommand(uint8_t argc, char* argv[]); // Sequence recording and playback
+void handleComboCommand(uint8_t argc, char* argv[]);    // IR button combos
+void handleStateCommand(uint8_t argc, char* argv[]);    // State snapshots and scenes
 
 //========================================
 // SYSTEM STATUS AND HELP FUNCTIONS
@@ -151,10 +172,11 @@ void handleDemoMode();               // Demo mode showing all features
 // Mode management
 void enterMonitorMode();             // Enter monitoring mode
 void enterDemoMode();                // Enter demo mode
-void runTestSequence(String params); // Start hardware test
+void stopDemoMode();                 // Leave demo mode and restore defaults
+void runTestSequence(uint8_t argc, char* argv[]); // Start hardware test
 
 // Sensor handling
-void handleSensors();                // Process all sensor inputs
+void handleSensors();                // Process all sensor inputs (every mode)
 
 //========================================
 // SERVO CONTROL FUNCTIONS
@@ -211,9 +233,11 @@ void setVolume(uint8_t volume);      // Set audio volume
 bool isValidServoPosition(int position);     // Validate servo position
 bool isValidBrightness(uint8_t brightness);  // Validate LED brightness
 bool isValidVolume(uint8_t volume);          // Validate audio volume
+bool safeParseInt(const char* str, int& value, int minVal, int maxVal); // Strict integer parse with range
 
 // String utilities
 String getModeName(PersonalityMode mode);    // Get mode name as string
+bool parseModeName(String name, PersonalityMode& mode);  // "scanning"/"alert"/"idle", any case
 
 //========================================
 // DIAGNOSTIC FUNCTIONS
@@ -237,10 +261,20 @@ void logSystemEvent(const char* event); // Log system events
 void initializeIR();                    // Initialize IR receiver (called from main)
 void stopIR();                          // Stop IR receiver
 void setIREnabled(bool enabled);        // Enable/disable IR
-bool checkForIRCommand(uint32_t& code); // Check for IR input
+bool checkForIRCommand(uint32_t& code); // Check for IR input (new presses only)
+bool readIRFrame(uint32_t& code, bool& isRepeat); // Read next IR frame incl. repeats
+bool popIREvent(IREvent& event);        // Pop next timestamped IR frame from the capture ring
+void printIRInputStats();               // Queue depth and input-to-action latency
+void updateIRJog(unsigned long currentMillis);    // Hold-to-repeat jog/release handling
+bool isIRJogActive();                   // A direction button is held, eyes belong to the jog
 
 // IR Command Processing
 void handleIRCommand(uint32_t code);     // Process received IR code
 void executeButtonCommand(const char* buttonName); // Execute button action
+bool isButtonCommandName(const char* buttonName);  // Has a built-in action (UP, OK, 1, ...)
+bool isIRJogButton(const char* buttonName);        // Direction button, starts a jog on press
+void dispatchIRButton(uint8_t buttonIndex);        // Run mapped sequence/action of a button
+void invalidateIRDispatchTable();        // Mark dispatch table stale (config.buttons changed)
+void rebuildIRDispatchTable();           // Rebuild IR code -> action hash table
 
 #endif // K2SO_HANDLERS_H
@@ -0,0 +1,473 @@
+/*
+================================================================================
+// K-2SO Controller IR Combo Matcher Implementation
+// Presses that start a combo are held back until the combo completes, times
+// out or diverges; all other presses dispatch immediately
+================================================================================
+*/
+
+#include <Arduino.h>
+#include <FS.h>
+#include <LittleFS.h>
+#include <ArduinoJson.h>
+#include "ircombos.h"
+#include "handlers.h"     // For dispatchIRButton, executeButtonCommand, isIRJogButton
+#include "sequences.h"
+#include "metrics.h"      // For fsOpen & co
+#include "globals.h"
+
+//========================================
+// COMBO STORAGE AND MATCHER STATE
+//========================================
+
+static IRCombo combos[IR_COMBO_MAX_COMBOS];
+static uint8_t comboCount = 0;
+
+static IRComboNode comboNodes[IR_COMBO_MAX_NODES];
+static uint8_t comboNodeCount = 0;
+static bool combosDirty = true;
+
+// Partial match
+static uint8_t matchNode = 0;                          // 0 = root
+static uint8_t pendingButtons[IR_COMBO_MAX_LENGTH];    // Presses held back so far
+static uint8_t pendingCount = 0;
+static unsigned long lastComboPress = 0;
+
+//========================================
+// INTERNAL HELPERS
+//========================================
+
+static bool parseComboAction(const String& text, IRComboAction& action) {
+  String lower = text;
+  lower.toLowerCase();
+  if (lower == "seq" || lower == "sequence") { action = COMBO_ACTION_SEQUENCE; return true; }
+  if (lower == "playlist")                   { action = COMBO_ACTION_PLAYLIST; return true; }
+  if (lower == "mode")                       { action = COMBO_ACTION_MODE;     return true; }
+  if (lower == "button")                     { action = COMBO_ACTION_BUTTON;   return true; }
+  return false;
+}
+
+static int findButtonIndexByName(const char* name) {
+  int buttonCount = constrain((int)config.buttonCount, 0, 21);
+  for (int i = 0; i < buttonCount; i++) {
+    if (strcmp(config.buttons[i].name, name) == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+static uint8_t findChild(uint8_t node, uint8_t buttonIndex) {
+  uint8_t child = comboNodes[node].firstChild;
+  while (child != IR_COMBO_NONE) {
+    if (comboNodes[child].buttonIndex == buttonIndex) {
+      return child;
+    }
+    child = comboNodes[child].nextSibling;
+  }
+  return IR_COMBO_NONE;
+}
+
+static void compileIRCombos() {
+  memset(comboNodes, 0, sizeof(comboNodes));
+  comboNodes[0].firstChild = IR_COMBO_NONE;
+  comboNodes[0].nextSibling = IR_COMBO_NONE;
+  comboNodes[0].comboIndex = -1;
+  comboNodeCount = 1;
+
+  for (uint8_t c = 0; c < comboCount; c++) {
+    const IRCombo& combo = combos[c];
+
+    // Resolve every key before touching the trie, so a combo with an
+    // unmapped key leaves no dead path behind
+    uint8_t buttonIndexes[IR_COMBO_MAX_LENGTH];
+    bool resolved = true;
+    for (uint8_t k = 0; k < combo.length; k++) {
+      int buttonIndex = findButtonIndexByName(combo.keys[k]);
+      if (buttonIndex < 0) {
+        Serial.printf("⚠️ Combo %d skipped: button '%s' not configured\n", c + 1, combo.keys[k]);
+        resolved = false;
+        break;
+      }
+      buttonIndexes[k] = (uint8_t)buttonIndex;
+    }
+    if (!resolved) {
+      continue;
+    }
+
+    uint8_t node = 0;
+    for (uint8_t k = 0; k < combo.length; k++) {
+      uint8_t child = findChild(node, buttonIndexes[k]);
+      if (child == IR_COMBO_NONE) {
+        child = comboNodeCount++;
+        comboNodes[child].buttonIndex = buttonIndexes[k];
+        comboNodes[child].firstChild = IR_COMBO_NONE;
+        comboNodes[child].nextSibling = comboNodes[node].firstChild;
+        comboNodes[child].comboIndex = -1;
+        comboNodes[node].firstChild = child;
+      }
+      node = child;
+    }
+
+    if (comboNodes[node].comboIndex < 0) {
+      comboNodes[node].comboIndex = c;  // Duplicate key sequences: first combo wins
+    }
+  }
+
+  combosDirty = false;
+  matchNode = 0;
+  pendingCount = 0;
+}
+
+static void runComboAction(const IRCombo& combo) {
+  Serial.print(F("🎮 IR combo: "));
+  for (uint8_t k = 0; k < combo.length; k++) {
+    Serial.print(combo.keys[k]);
+    Serial.print(' ');
+  }
+  Serial.printf("→ %s %s\n", getIRComboActionName(combo.action), combo.target);
+
+  if (!isAwake) {
+    isAwake = true;
+  }
+  lastActivityTime = millis();
+
+  switch (combo.action) {
+    case COMBO_ACTION_SEQUENCE:
+      sequenceManager.playSequence(combo.target, false);
+      break;
+    case COMBO_ACTION_PLAYLIST:
+      if (sequenceManager.playlistLoad(combo.target)) {
+        sequenceManager.playlistStart(false);
+      }
+      break;
+    case COMBO_ACTION_MODE:
+      // Reuse the personality buttons so eye colors and status LED follow
+      if (strcmp(combo.target, "scanning") == 0) executeButtonCommand("1");
+      else if (strcmp(combo.target, "alert") == 0) executeButtonCommand("2");
+      else if (strcmp(combo.target, "idle") == 0) executeButtonCommand("3");
+      break;
+    case COMBO_ACTION_BUTTON:
+      executeButtonCommand(combo.target);
+      break;
+  }
+}
+
+// Release held-back presses as ordinary single-button actions
+static void flushPendingButtons() {
+  uint8_t count = pendingCount;
+  uint8_t buttons[IR_COMBO_MAX_LENGTH];
+  memcpy(buttons, pendingButtons, count);
+
+  matchNode = 0;
+  pendingCount = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    dispatchIRButton(buttons[i]);
+  }
+}
+
+static bool saveIRCombos(String& errorMessage) {
+  DynamicJsonDocument doc(4096);
+  doc["version"] = 1;
+  JsonArray comboArray = doc.createNestedArray("combos");
+  for (uint8_t c = 0; c < comboCount; c++) {
+    JsonObject obj = comboArray.createNestedObject();
+    JsonArray keys = obj.createNestedArray("keys");
+    for (uint8_t k = 0; k < combos[c].length; k++) {
+      keys.add(combos[c].keys[k]);
+    }
+    obj["action"] = getIRComboActionName(combos[c].action);
+    obj["target"] = combos[c].target;
+  }
+
+  String tempPath = String(IR_COMBOS_FILE) + ".tmp";
+  File file = fsOpen(tempPath, "w");
+  if (!file) {
+    errorMessage = "Failed to open combo file for writing.";
+    return false;
+  }
+  size_t written = serializeJson(doc, file);
+  file.close();
+  if (written == 0) {
+    fsRemove(tempPath);
+    errorMessage = "Failed to write combo file.";
+    return false;
+  }
+
+  fsRemove(IR_COMBOS_FILE);
+  if (!fsRename(tempPath, IR_COMBOS_FILE)) {
+    errorMessage = "Failed to replace combo file.";
+    return false;
+  }
+  return true;
+}
+
+//========================================
+// LIFECYCLE
+//========================================
+
+void initializeIRCombos() {
+  comboCount = 0;
+  combosDirty = true;
+
+  File file = fsOpen(IR_COMBOS_FILE, "r");
+  if (!file) {
+    return;  // No combos defined yet
+  }
+
+  DynamicJsonDocument doc(4096);
+  DeserializationError error = deserializeJson(doc, file);
+  file.close();
+  if (error) {
+    Serial.print(F("⚠️ IR combo file parse error: "));
+    Serial.println(error.c_str());
+    return;
+  }
+
+  for (JsonObjectConst obj : doc["combos"].as<JsonArrayConst>()) {
+    if (comboCount >= IR_COMBO_MAX_COMBOS) break;
+
+    IRCombo& combo = combos[comboCount];
+    memset(&combo, 0, sizeof(combo));
+
+    JsonArrayConst keys = obj["keys"].as<JsonArrayConst>();
+    if (keys.isNull() || keys.size() < 2 || keys.size() > IR_COMBO_MAX_LENGTH) continue;
+    for (JsonVariantConst key : keys) {
+      strncpy(combo.keys[combo.length], key | "", sizeof(combo.keys[0]) - 1);
+      combo.length++;
+    }
+
+    if (!parseComboAction(String(obj["action"] | ""), combo.action)) continue;
+    strncpy(combo.target, obj["target"] | "", sizeof(combo.target) - 1);
+    comboCount++;
+  }
+
+  Serial.printf("- IR combos: %d loaded\n", comboCount);
+}
+
+void invalidateIRCombos() {
+  combosDirty = true;
+}
+
+//========================================
+// MATCHING
+//========================================
+
+bool feedIRCombo(uint8_t buttonIndex) {
+  if (combosDirty) {
+    compileIRCombos();
+  }
+  if (comboNodes[0].firstChild == IR_COMBO_NONE) {
+    return false;  // No combos - every press dispatches directly
+  }
+
+  unsigned long now = millis();
+  updateIRCombos(now);
+
+  uint8_t child = findChild(matchNode, buttonIndex);
+  if (child == IR_COMBO_NONE) {
+    if (matchNode == 0) {
+      return false;  // Not a combo prefix - no buffering delay
+    }
+    // Diverged mid-combo: release what we held, then retry from the root
+    flushPendingButtons();
+    child = findChild(0, buttonIndex);
+    if (child == IR_COMBO_NONE) {
+      return false;
+    }
+  }
+
+  pendingButtons[pendingCount++] = buttonIndex;
+  matchNode = child;
+  lastComboPress = now;
+
+  // Leaf: nothing longer can match, fire without waiting for the timeout.
+  // A leaf without a combo should not exist, but never swallow the presses.
+  if (comboNodes[child].firstChild == IR_COMBO_NONE) {
+    int8_t comboIndex = comboNodes[child].comboIndex;
+    if (comboIndex >= 0) {
+      resetIRComboMatch();
+      runComboAction(combos[comboIndex]);
+    } else {
+      flushPendingButtons();
+    }
+  }
+  return true;
+}
+
+void updateIRCombos(unsigned long currentMillis) {
+  if (matchNode == 0 || currentMillis - lastComboPress <= IR_COMBO_TIMEOUT_MS) {
+    return;
+  }
+
+  // Timed out: a complete shorter combo wins, otherwise replay the presses
+  int8_t comboIndex = comboNodes[matchNode].comboIndex;
+  if (comboIndex >= 0) {
+    resetIRComboMatch();
+    runComboAction(combos[comboIndex]);
+  } else {
+    flushPendingButtons();
+  }
+}
+
+void resetIRComboMatch() {
+  matchNode = 0;
+  pendingCount = 0;
+}
+
+//========================================
+// MANAGEMENT
+//========================================
+
+bool addIRCombo(const String& keyList, const String& action, const String& target, String& errorMessage) {
+  if (comboCount >= IR_COMBO_MAX_COMBOS) {
+    errorMessage = "Combo table full (" + String(IR_COMBO_MAX_COMBOS) + " max).";
+    return false;
+  }
+
+  IRCombo combo;
+  memset(&combo, 0, sizeof(combo));
+
+  int startIdx = 0;
+  for (int i = 0; i <= (int)keyList.length(); i++) {
+    if (i == (int)keyList.length() || keyList[i] == ',') {
+      if (i > startIdx) {
+        if (combo.length >= IR_COMBO_MAX_LENGTH) {
+          errorMessage = "Too many keys (max " + String(IR_COMBO_MAX_LENGTH) + ").";
+          return false;
+        }
+        String key = keyList.substring(startIdx, i);
+        key.toUpperCase();  // Button names are stored upper case (UP, OK, ...)
+        if (findButtonIndexByName(key.c_str()) < 0) {
+          errorMessage = "Unknown button: " + key;
+          return false;
+        }
+        strncpy(combo.keys[combo.length], key.c_str(), sizeof(combo.keys[0]) - 1);
+        combo.length++;
+      }
+      startIdx = i + 1;
+    }
+  }
+
+  if (combo.length < 2) {
+    errorMessage = "A combo needs at least 2 keys.";
+    return false;
+  }
+
+  // A pending first press is held until the combo times out, which would
+  // delay every jog of that direction button by IR_COMBO_TIMEOUT_MS
+  if (isIRJogButton(combo.keys[0])) {
+    errorMessage = String("A combo cannot start with direction button ") + combo.keys[0] + ".";
+    return false;
+  }
+
+  if (!parseComboAction(action, combo.action)) {
+    errorMessage = "Unknown action (use seq, playlist, mode or button).";
+    return false;
+  }
+
+  String targetValue = target;
+  if (combo.action == COMBO_ACTION_MODE) {
+    targetValue.toLowerCase();
+    if (targetValue != "scanning" && targetValue != "alert" && targetValue != "idle") {
+      errorMessage = "Mode must be scanning, alert or idle.";
+      return false;
+    }
+  } else if (combo.action == COMBO_ACTION_SEQUENCE) {
+    if (!sequenceManager.sequenceExists(targetValue.c_str())) {
+      errorMessage = "Sequence not found: " + targetValue;
+      return false;
+    }
+  } else if (combo.action == COMBO_ACTION_PLAYLIST) {
+    if (!sequenceManager.isValidSequenceName(targetValue.c_str())) {
+      errorMessage = "Invalid playlist name.";
+      return false;
+    }
+  } else {
+    targetValue.toUpperCase();  // Same spelling as the keys
+    if (targetValue.length() == 0) {
+      errorMessage = "Missing button name.";
+      return false;
+    }
+    if (!isButtonCommandName(targetValue.c_str())) {
+      errorMessage = "Unknown button action: " + targetValue;
+      return false;
+    }
+  }
+  strncpy(combo.target, targetValue.c_str(), sizeof(combo.target) - 1);
+
+  combos[comboCount++] = combo;
+  combosDirty = true;
+  if (!saveIRCombos(errorMessage)) {
+    comboCount--;
+    return false;
+  }
+  return true;
+}
+
+bool removeIRCombo(uint8_t index, String& errorMessage) {
+  if (index >= comboCount) {
+    errorMessage = "Combo index out of range.";
+    return false;
+  }
+
+  IRCombo removed = combos[index];
+  for (uint8_t i = index; i + 1 < comboCount; i++) {
+    combos[i] = combos[i + 1];
+  }
+  comboCount--;
+  combosDirty = true;
+
+  if (!saveIRCombos(errorMessage)) {
+    // Put it back so RAM matches flash
+    for (uint8_t i = comboCount; i > index; i--) {
+      combos[i] = combos[i - 1];
+    }
+    combos[index] = removed;
+    comboCount++;
+    return false;
+  }
+  return true;
+}
+
+bool clearIRCombos(String& errorMessage) {
+  comboCount = 0;
+  combosDirty = true;
+  if (fsExists(IR_COMBOS_FILE) && !fsRemove(IR_COMBOS_FILE)) {
+    errorMessage = "Failed to delete combo file.";
+    return false;
+  }
+  return true;
+}
+
+void printIRCombos() {
+  Serial.println(F("\n=== IR COMBOS ==="));
+  if (comboCount == 0) {
+    Serial.println(F("No combos defined."));
+    return;
+  }
+
+  for (uint8_t c = 0; c < comboCount; c++) {
+    Serial.printf("%2d: ", c + 1);
+    for (uint8_t k = 0; k < combos[c].length; k++) {
+      Serial.print(combos[c].keys[k]);
+      Serial.print(' ');
+    }
+    Serial.printf("→ %s %s\n", getIRComboActionName(combos[c].action), combos[c].target);
+  }
+  Serial.printf("Inter-press timeout: %d ms\n", IR_COMBO_TIMEOUT_MS);
+}
+
+uint8_t getIRComboCount() {
+  return comboCount;
+}
+
+const char* getIRComboActionName(IRComboAction action) {
+  switch (action) {
+    case COMBO_ACTION_SEQUENCE: return "seq";
+    case COMBO_ACTION_PLAYLIST: return "playlist";
+    case COMBO_ACTION_MODE:     return "mode";
+    case COMBO_ACTION_BUTTON:   return "button";
+  }
+  return "unknown";
+}
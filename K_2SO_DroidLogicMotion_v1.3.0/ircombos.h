@@ -0,0 +1,76 @@
+/*
+================================================================================
+// K-2SO Controller IR Combo Matcher Header
+// Timed button sequences (e.g. "* 1 2", "# #") matched incrementally through
+// a fixed-size trie that runs alongside the config.buttons dispatch table
+================================================================================
+*/
+
+#ifndef K2SO_IRCOMBOS_H
+#define K2SO_IRCOMBOS_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "sequences.h"   // For MAX_SEQUENCE_NAME_LENGTH
+
+//========================================
+// COMBO CONFIGURATION
+//========================================
+
+#define IR_COMBO_MAX_COMBOS     16      // Stored combos
+#define IR_COMBO_MAX_LENGTH     4       // Presses per combo (minimum 2)
+#define IR_COMBO_MAX_NODES      (IR_COMBO_MAX_COMBOS * IR_COMBO_MAX_LENGTH + 1)
+#define IR_COMBO_TIMEOUT_MS     800     // Max gap between presses of one combo
+#define IR_COMBO_NONE           0xFF    // Empty trie link
+#define IR_COMBOS_FILE          "/ir_combos.json"
+
+//========================================
+// DATA STRUCTURES
+//========================================
+
+// What a matched combo triggers
+enum IRComboAction {
+  COMBO_ACTION_SEQUENCE,    // Play sequence <target>
+  COMBO_ACTION_PLAYLIST,    // Load and play saved playlist <target>
+  COMBO_ACTION_MODE,        // Switch personality mode (scanning/alert/idle)
+  COMBO_ACTION_BUTTON       // Run built-in action of button <target>
+};
+
+// Stored combo definition (keys are button names, resolved at compile time)
+struct IRCombo {
+  uint8_t length;
+  char keys[IR_COMBO_MAX_LENGTH][16];           // Matches IRButton::name
+  IRComboAction action;
+  char target[MAX_SEQUENCE_NAME_LENGTH];
+};
+
+// Trie node over config.buttons indexes
+struct IRComboNode {
+  uint8_t buttonIndex;      // Button that leads to this node
+  uint8_t firstChild;       // IR_COMBO_NONE if leaf
+  uint8_t nextSibling;      // IR_COMBO_NONE if last child
+  int8_t comboIndex;        // Combo completed at this node, -1 if none
+};
+
+//========================================
+// FUNCTION DECLARATIONS
+//========================================
+
+// Lifecycle
+void initializeIRCombos();                             // Load combos from LittleFS (after sequenceManager.begin)
+void invalidateIRCombos();                             // Recompile trie on next press (config.buttons changed)
+
+// Matching (called from the IR input path)
+bool feedIRCombo(uint8_t buttonIndex);                 // True if the press was consumed by the matcher
+void updateIRCombos(unsigned long currentMillis);      // Resolve timed-out partial matches
+void resetIRComboMatch();                              // Drop a partial match without flushing
+
+// Management
+bool addIRCombo(const String& keyList, const String& action, const String& target, String& errorMessage);
+bool removeIRCombo(uint8_t index, String& errorMessage);
+bool clearIRCombos(String& errorMessage);
+void printIRCombos();                                  // List combos to Serial
+uint8_t getIRComboCount();
+const char* getIRComboActionName(IRComboAction action);
+
+#endif // K2SO_IRCOMBOS_H
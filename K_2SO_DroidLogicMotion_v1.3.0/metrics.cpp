@@ -0,0 +1,322 @@
+/*
+================================================================================
+// K-2SO Controller Metrics Implementation
+// A scrape copies every value into a snapshot on the main loop; the text is
+// then rendered from that copy one metric family at a time while the chunked
+// response goes out, so nothing large is ever held in a String.
+================================================================================
+*/
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <stdarg.h>
+#include <atomic>
+#include "metrics.h"
+#include "config.h"
+#include "webcontrol.h"   // For WebChunkSource, webRequest, getWebControlStats
+#include "weblink.h"      // For getWebLinkClientCount
+#include "webevents.h"    // For getWebEventClientCount
+#include "audiolink.h"    // For audioLink
+#include "sequences.h"    // For sequenceManager
+#include "globals.h"
+
+//========================================
+// METRIC DEFINITIONS
+//========================================
+
+struct MetricInfo {
+  const char* name;                     // Family name (no _total suffix)
+  const char* labels;                   // Sample labels or nullptr
+  const char* help;
+};
+
+// Entries of one family must be adjacent
+static const MetricInfo counterInfo[METRIC_COUNTER_COUNT] = {
+  {"k2so_led_shows", "strip=\"eyes\"", "NeoPixel show() calls"},
+  {"k2so_led_shows", "strip=\"detail\"", nullptr},
+  {"k2so_led_shows", "strip=\"status\"", nullptr},
+  {"k2so_littlefs_operations", "op=\"open_read\"", "LittleFS calls"},
+  {"k2so_littlefs_operations", "op=\"open_write\"", nullptr},
+  {"k2so_littlefs_operations", "op=\"remove\"", nullptr},
+  {"k2so_littlefs_operations", "op=\"rename\"", nullptr},
+  {"k2so_littlefs_operations", "op=\"exists\"", nullptr},
+  {"k2so_littlefs_operations", "op=\"mkdir\"", nullptr},
+  {"k2so_sequence_load_failures", nullptr, "Sequences that could not be loaded"},
+  {"k2so_playlist_prefetch_misses", nullptr, "Playlist items loaded at the transition instead of ahead"},
+  {"k2so_sequence_cache_lookups", "result=\"hit\"", "Sequence lookups in the PSRAM cache"},
+  {"k2so_sequence_cache_lookups", "result=\"miss\"", nullptr}
+};
+
+struct HistogramInfo {
+  const char* name;
+  const char* help;
+  uint8_t bucketCount;
+  uint32_t bounds[METRICS_MAX_BUCKETS]; // Upper bounds in microseconds
+};
+
+static const HistogramInfo histogramInfo[METRIC_HISTOGRAM_COUNT] = {
+  {"k2so_loop_duration_seconds", "One main loop pass", 9,
+   {250, 500, 1000, 2000, 5000, 10000, 20000, 50000, 200000}},
+  {"k2so_http_request_duration_seconds", "HTTP request queued until its handler finished", 9,
+   {1000, 5000, 10000, 25000, 50000, 100000, 250000, 1000000, 5000000}},
+  {"k2so_dfplayer_rtt_seconds", "DFPlayer command round trip", 8,
+   {1000, 5000, 10000, 20000, 50000, 100000, 500000, 1000000}},
+  {"k2so_sequence_load_duration_seconds", "Sequence file parsed into frames", 8,
+   {5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000}},
+  {"k2so_playlist_gap_seconds", "Playlist item due to end until the next item started", 10,
+   {100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000}}
+};
+
+// Read at scrape time on the main loop
+struct SampledMetric {
+  const char* name;
+  const char* type;                     // "gauge" or "counter"
+  const char* help;
+  uint32_t (*read)();
+};
+
+static const SampledMetric sampledMetrics[] = {
+  {"k2so_uptime_seconds", "gauge", "Time since boot",
+   []() -> uint32_t { return (millis() - uptimeStart) / 1000; }},
+  {"k2so_heap_free_bytes", "gauge", "Free heap",
+   []() -> uint32_t { return ESP.getFreeHeap(); }},
+  {"k2so_heap_min_free_bytes", "gauge", "Lowest free heap since boot",
+   []() -> uint32_t { return ESP.getMinFreeHeap(); }},
+  {"k2so_heap_largest_block_bytes", "gauge", "Largest allocatable heap block",
+   []() -> uint32_t { return ESP.getMaxAllocHeap(); }},
+  {"k2so_littlefs_used_bytes", "gauge", "LittleFS space in use",
+   []() -> uint32_t { return LittleFS.usedBytes(); }},
+  {"k2so_ir_commands", "counter", "IR commands executed",
+   []() -> uint32_t { return irCommandCount; }},
+  {"k2so_servo_movements", "counter", "Servo steps written",
+   []() -> uint32_t { return servoMovements; }},
+  {"k2so_http_requests", "counter", "HTTP requests handled on the main loop",
+   []() -> uint32_t { return getWebControlStats().requests; }},
+  {"k2so_http_rejected", "counter", "HTTP requests refused (busy or too large)",
+   []() -> uint32_t { return getWebControlStats().rejectedBusy + getWebControlStats().rejectedSize; }},
+  {"k2so_websocket_clients", "gauge", "Open WebSocket links",
+   []() -> uint32_t { return getWebLinkClientCount(); }},
+  {"k2so_event_stream_clients", "gauge", "Open /events streams",
+   []() -> uint32_t { return getWebEventClientCount(); }},
+  {"k2so_dfplayer_link_up", "gauge", "1 while the DFPlayer answers",
+   []() -> uint32_t { return audioLink.linkDown ? 0 : 1; }},
+  {"k2so_sequence_playing", "gauge", "1 while a sequence plays",
+   []() -> uint32_t { return sequenceManager.isPlaying() ? 1 : 0; }}
+};
+
+#define SAMPLED_METRIC_COUNT (sizeof(sampledMetrics) / sizeof(sampledMetrics[0]))
+
+//========================================
+// LIVE VALUES
+//========================================
+
+struct HistogramData {
+  uint32_t buckets[METRICS_MAX_BUCKETS + 1];  // Per bucket (not cumulative), last = +Inf
+  uint64_t sumMicros;
+  uint32_t count;
+};
+
+static std::atomic<uint32_t> counters[METRIC_COUNTER_COUNT];
+static HistogramData histograms[METRIC_HISTOGRAM_COUNT];
+
+void metricInc(MetricCounterId id, uint32_t amount) {
+  counters[id].fetch_add(amount, std::memory_order_relaxed);
+}
+
+void metricObserve(MetricHistogramId id, uint32_t micros) {
+  const HistogramInfo& info = histogramInfo[id];
+  HistogramData& data = histograms[id];
+  uint8_t bucket = 0;
+  while (bucket < info.bucketCount && micros > info.bounds[bucket]) {
+    bucket++;
+  }
+  data.buckets[bucket]++;
+  data.sumMicros += micros;
+  data.count++;
+}
+
+//========================================
+// FILESYSTEM WRAPPERS
+//========================================
+
+// Every call that can change a directory listing bumps it, so list
+// endpoints can tell "unchanged" without reading the directory
+static std::atomic<uint32_t> storageGeneration(0);
+
+uint32_t fsGeneration() {
+  return storageGeneration.load(std::memory_order_relaxed);
+}
+
+File fsOpen(const char* path, const char* mode) {
+  if (mode[0] == 'r' && mode[1] != '+') {
+    metricInc(METRIC_FS_OPEN_READ);
+  } else {
+    metricInc(METRIC_FS_OPEN_WRITE);
+    storageGeneration.fetch_add(1, std::memory_order_relaxed);
+  }
+  return LittleFS.open(path, mode);
+}
+
+File fsOpen(const String& path, const char* mode) {
+  return fsOpen(path.c_str(), mode);
+}
+
+bool fsRemove(const char* path) {
+  metricInc(METRIC_FS_REMOVE);
+  storageGeneration.fetch_add(1, std::memory_order_relaxed);
+  return LittleFS.remove(path);
+}
+
+bool fsRemove(const String& path) {
+  return fsRemove(path.c_str());
+}
+
+bool fsRename(const char* from, const char* to) {
+  metricInc(METRIC_FS_RENAME);
+  storageGeneration.fetch_add(1, std::memory_order_relaxed);
+  return LittleFS.rename(from, to);
+}
+
+bool fsRename(const String& from, const String& to) {
+  return fsRename(from.c_str(), to.c_str());
+}
+
+bool fsExists(const char* path) {
+  metricInc(METRIC_FS_EXISTS);
+  return LittleFS.exists(path);
+}
+
+bool fsExists(const String& path) {
+  return fsExists(path.c_str());
+}
+
+bool fsMkdir(const char* path) {
+  metricInc(METRIC_FS_MKDIR);
+  storageGeneration.fetch_add(1, std::memory_order_relaxed);
+  return LittleFS.mkdir(path);
+}
+
+//========================================
+// OPENMETRICS RENDERING
+//========================================
+
+struct MetricsSnapshot {
+  uint32_t counters[METRIC_COUNTER_COUNT];
+  uint32_t sampled[SAMPLED_METRIC_COUNT];
+  HistogramData histograms[METRIC_HISTOGRAM_COUNT];
+};
+
+// Seconds from microseconds without floating point: "1.250000"
+static int formatSeconds(char* out, size_t size, uint64_t micros) {
+  return snprintf(out, size, "%lu.%06lu",
+                  (unsigned long)(micros / 1000000), (unsigned long)(micros % 1000000));
+}
+
+class MetricsSource : public WebChunkSource {
+public:
+  MetricsSource() : item(0), pendingLength(0), pendingPos(0) {
+    for (uint8_t i = 0; i < METRIC_COUNTER_COUNT; i++) {
+      snapshot.counters[i] = counters[i].load(std::memory_order_relaxed);
+    }
+    for (uint8_t i = 0; i < SAMPLED_METRIC_COUNT; i++) {
+      snapshot.sampled[i] = sampledMetrics[i].read();
+    }
+    memcpy(snapshot.histograms, histograms, sizeof(histograms));
+  }
+
+  size_t read(uint8_t* buffer, size_t maxLength) override {
+    size_t written = 0;
+    while (written < maxLength) {
+      if (pendingPos >= pendingLength && !renderNextItem()) {
+        break;
+      }
+      size_t chunk = min(maxLength - written, pendingLength - pendingPos);
+      memcpy(buffer + written, pending + pendingPos, chunk);
+      written += chunk;
+      pendingPos += chunk;
+    }
+    return written;
+  }
+
+private:
+  // Items: counters, sampled metrics, histograms, then "# EOF"
+  bool renderNextItem() {
+    const uint16_t sampledStart = METRIC_COUNTER_COUNT;
+    const uint16_t histogramStart = sampledStart + SAMPLED_METRIC_COUNT;
+    const uint16_t eofItem = histogramStart + METRIC_HISTOGRAM_COUNT;
+
+    pendingLength = 0;
+    pendingPos = 0;
+    if (item < sampledStart) {
+      renderCounter(item);
+    } else if (item < histogramStart) {
+      renderSampled(item - sampledStart);
+    } else if (item < eofItem) {
+      renderHistogram(item - histogramStart);
+    } else if (item == eofItem) {
+      append("# EOF\n");
+    } else {
+      return false;
+    }
+    item++;
+    return true;
+  }
+
+  void append(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(pending + pendingLength, sizeof(pending) - pendingLength, format, args);
+    va_end(args);
+    if (length > 0) {
+      pendingLength = min(pendingLength + (size_t)length, sizeof(pending) - 1);
+    }
+  }
+
+  void renderCounter(uint8_t index) {
+    const MetricInfo& info = counterInfo[index];
+    if (index == 0 || strcmp(info.name, counterInfo[index - 1].name) != 0) {
+      append("# TYPE %s counter\n# HELP %s %s\n", info.name, info.name, info.help);
+    }
+    if (info.labels != nullptr) {
+      append("%s_total{%s} %lu\n", info.name, info.labels, (unsigned long)snapshot.counters[index]);
+    } else {
+      append("%s_total %lu\n", info.name, (unsigned long)snapshot.counters[index]);
+    }
+  }
+
+  void renderSampled(uint8_t index) {
+    const SampledMetric& metric = sampledMetrics[index];
+    bool counter = strcmp(metric.type, "counter") == 0;
+    append("# TYPE %s %s\n# HELP %s %s\n%s%s %lu\n", metric.name, metric.type,
+           metric.name, metric.help, metric.name, counter ? "_total" : "",
+           (unsigned long)snapshot.sampled[index]);
+  }
+
+  void renderHistogram(uint8_t index) {
+    const HistogramInfo& info = histogramInfo[index];
+    const HistogramData& data = snapshot.histograms[index];
+    char value[24];
+
+    append("# TYPE %s histogram\n# HELP %s %s\n", info.name, info.name, info.help);
+    uint32_t cumulative = 0;
+    for (uint8_t i = 0; i < info.bucketCount; i++) {
+      cumulative += data.buckets[i];
+      formatSeconds(value, sizeof(value), info.bounds[i]);
+      append("%s_bucket{le=\"%s\"} %lu\n", info.name, value, (unsigned long)cumulative);
+    }
+    cumulative += data.buckets[info.bucketCount];
+    append("%s_bucket{le=\"+Inf\"} %lu\n", info.name, (unsigned long)cumulative);
+    formatSeconds(value, sizeof(value), data.sumMicros);
+    append("%s_sum %s\n%s_count %lu\n", info.name, value, info.name, (unsigned long)data.count);
+  }
+
+  MetricsSnapshot snapshot;
+  uint16_t item;
+  char pending[METRICS_RENDER_BUFFER];
+  size_t pendingLength;
+  size_t pendingPos;
+};
+
+void sendMetrics() {
+  webRequest.sendChunked(METRICS_CONTENT_TYPE, new MetricsSource());
+}
@@ -0,0 +1,99 @@
+/*
+================================================================================
+// K-2SO Controller Metrics Header
+// Counters and fixed-bucket histograms that the subsystems update with a
+// table index and an add, plus gauges sampled at scrape time. Rendered as
+// OpenMetrics text for a Prometheus-style collector:
+//
+//   GET /metrics  (Basic auth)
+//
+// Counters may be bumped from any task; histograms are main loop only.
+================================================================================
+*/
+
+#ifndef K2SO_METRICS_H
+#define K2SO_METRICS_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <Adafruit_NeoPixel.h>
+
+//========================================
+// METRICS CONFIGURATION
+//========================================
+
+#define METRICS_MAX_BUCKETS         10      // Finite buckets per histogram (+Inf is extra)
+#define METRICS_RENDER_BUFFER       1024    // One rendered metric family
+#define METRICS_CONTENT_TYPE        "application/openmetrics-text; version=1.0.0; charset=utf-8"
+
+//========================================
+// METRIC IDS
+//========================================
+
+enum MetricCounterId : uint8_t {
+  METRIC_EYE_SHOWS,                     // NeoPixel show() per strip
+  METRIC_DETAIL_SHOWS,
+  METRIC_STATUS_SHOWS,
+  METRIC_FS_OPEN_READ,                  // LittleFS operations
+  METRIC_FS_OPEN_WRITE,
+  METRIC_FS_REMOVE,
+  METRIC_FS_RENAME,
+  METRIC_FS_EXISTS,
+  METRIC_FS_MKDIR,
+  METRIC_SEQUENCE_LOAD_FAILURES,
+  METRIC_PLAYLIST_PREFETCH_MISSES,      // Playlist item loaded at the boundary instead of ahead
+  METRIC_SEQUENCE_CACHE_HITS,           // Playback started from the PSRAM cache
+  METRIC_SEQUENCE_CACHE_MISSES,
+  METRIC_COUNTER_COUNT
+};
+
+enum MetricHistogramId : uint8_t {
+  METRIC_LOOP_TIME,                     // One loop() pass
+  METRIC_HTTP_LATENCY,                  // Request queued -> handler finished
+  METRIC_DFPLAYER_RTT,                  // DFPlayer command round trip
+  METRIC_SEQUENCE_LOAD,                 // Sequence file -> frames in RAM
+  METRIC_PLAYLIST_GAP,                  // Last frame of a playlist item due -> next item's first frame applied
+  METRIC_HISTOGRAM_COUNT
+};
+
+//========================================
+// FUNCTION DECLARATIONS
+//========================================
+
+void metricInc(MetricCounterId id, uint32_t amount = 1);
+void metricObserve(MetricHistogramId id, uint32_t micros);   // Main loop only
+void sendMetrics();                     // Snapshot + chunked reply (from a web handler)
+
+// LittleFS calls that should show up in the operation counters
+File fsOpen(const char* path, const char* mode = "r");
+File fsOpen(const String& path, const char* mode = "r");
+bool fsRemove(const char* path);
+bool fsRemove(const String& path);
+bool fsRename(const char* from, const char* to);
+bool fsRename(const String& from, const String& to);
+bool fsExists(const char* path);
+bool fsExists(const String& path);
+bool fsMkdir(const char* path);
+uint32_t fsGeneration();                // Changes with every create/write, rename, remove and mkdir
+
+//========================================
+// METERED NEOPIXEL
+//========================================
+
+// Counts its show() calls. show() is not virtual, so only calls made through
+// this type are counted - which is every call on the global strip objects.
+class MeteredNeoPixel : public Adafruit_NeoPixel {
+public:
+  MeteredNeoPixel(uint16_t count, int16_t pin, neoPixelType type, MetricCounterId counter)
+    : Adafruit_NeoPixel(count, pin, type), counter(counter) {}
+
+  void show() {
+    metricInc(counter);
+    Adafruit_NeoPixel::show();
+  }
+
+private:
+  MetricCounterId counter;
+};
+
+#endif // K2SO_METRICS_H
@@ -0,0 +1,343 @@
+/*
+================================================================================
+// K-2SO Controller Puppet Link Implementation
+// Byte-fed frame parser. Pose servo values go through the shared remote
+// servo targets (setRemoteServoTargets) like web and WebSocket input; the
+// eye/detail part waits in a latest-wins slot so only the newest colors are
+// shown once per loop.
+================================================================================
+*/
+
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+#include "puppetlink.h"
+#include "config.h"
+#include "animations.h"   // For setEyeColor, setEyeBrightness, stopAllAnimations
+#include "detailleds.h"   // For setDetailColor
+#include "sequences.h"    // For sequenceManager
+#include "statusled.h"    // For autoUpdateStatusLED
+#include "handlers.h"     // For setServoParameters, setRemoteServoTargets
+#include "globals.h"
+
+//========================================
+// PARSER AND POSE STATE
+//========================================
+
+enum PuppetParserState {
+  PUPPET_WAIT_SYNC1,
+  PUPPET_WAIT_SYNC2,
+  PUPPET_WAIT_TYPE,
+  PUPPET_WAIT_LENGTH,
+  PUPPET_WAIT_PAYLOAD,
+  PUPPET_WAIT_CRC_LO,
+  PUPPET_WAIT_CRC_HI
+};
+
+struct PuppetParser {
+  PuppetParserState state;
+  uint8_t type;
+  uint8_t length;
+  uint8_t received;
+  uint8_t payload[PUPPET_MAX_PAYLOAD];
+  uint16_t crc;
+  uint8_t crcLow;
+  unsigned long frameStart;
+};
+
+static PuppetParser parser = {};
+static PuppetLinkStats stats = {};
+
+static PuppetPose pendingPose;
+static bool posePending = false;
+
+static bool puppetActive = false;
+static unsigned long lastPoseTime = 0;
+
+// Last values written, so unchanged LEDs are not re-shown every frame
+static uint32_t appliedEyeColor = 0;
+static uint8_t appliedEyeBrightness = 0;
+static uint32_t appliedDetailColor = 0;
+static bool eyesOwned = false;
+static bool detailOwned = false;
+
+//========================================
+// CRC AND REPLIES
+//========================================
+
+static uint16_t crc16Update(uint16_t crc, uint8_t byte) {
+  crc ^= (uint16_t)byte << 8;
+  for (uint8_t bit = 0; bit < 8; bit++) {
+    crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+  }
+  return crc;
+}
+
+uint16_t puppetCrc16(const uint8_t* data, size_t length) {
+  uint16_t crc = 0xFFFF;
+  for (size_t i = 0; i < length; i++) {
+    crc = crc16Update(crc, data[i]);
+  }
+  return crc;
+}
+
+static void sendFrame(uint8_t type, const uint8_t* payload, uint8_t length) {
+  uint8_t header[4] = {PUPPET_SYNC1, PUPPET_SYNC2, type, length};
+  uint16_t crc = 0xFFFF;
+  crc = crc16Update(crc, type);
+  crc = crc16Update(crc, length);
+  for (uint8_t i = 0; i < length; i++) {
+    crc = crc16Update(crc, payload[i]);
+  }
+  uint8_t trailer[2] = {(uint8_t)(crc & 0xFF), (uint8_t)(crc >> 8)};
+
+  Serial.write(header, sizeof(header));
+  if (length > 0) {
+    Serial.write(payload, length);
+  }
+  Serial.write(trailer, sizeof(trailer));
+}
+
+static void putLE16(uint8_t* out, uint16_t value) {
+  out[0] = value & 0xFF;
+  out[1] = (value >> 8) & 0xFF;
+}
+
+static void putLE32(uint8_t* out, uint32_t value) {
+  out[0] = value & 0xFF;
+  out[1] = (value >> 8) & 0xFF;
+  out[2] = (value >> 16) & 0xFF;
+  out[3] = (value >> 24) & 0xFF;
+}
+
+// 31 bytes: unknownTypes is sent as 16 bits (saturated) so the reply fits
+// in PUPPET_MAX_PAYLOAD like every other frame
+static void sendStatsReply() {
+  uint8_t payload[31];
+  static_assert(sizeof(payload) <= PUPPET_MAX_PAYLOAD, "STATS_REPLY exceeds the frame payload limit");
+  putLE32(&payload[0],  stats.framesOk);
+  putLE32(&payload[4],  stats.crcErrors);
+  putLE32(&payload[8],  stats.lengthErrors);
+  putLE16(&payload[12], (uint16_t)min(stats.unknownTypes, (uint32_t)0xFFFF));
+  putLE32(&payload[14], stats.frameTimeouts);
+  putLE32(&payload[18], stats.posesApplied);
+  putLE32(&payload[22], stats.posesSuperseded);
+  putLE32(&payload[26], stats.releases);
+  payload[30] = stats.lastSequence;
+  sendFrame(PUPPET_TYPE_STATS_REPLY, payload, sizeof(payload));
+}
+
+//========================================
+// FRAME HANDLING
+//========================================
+
+static void handleFrame() {
+  switch (parser.type) {
+    case PUPPET_TYPE_POSE:
+      if (parser.length != sizeof(PuppetPose)) {
+        stats.lengthErrors++;
+        return;
+      }
+      if (posePending && (pendingPose.flags & (PUPPET_POSE_EYES | PUPPET_POSE_DETAIL))) {
+        stats.posesSuperseded++;
+      }
+      memcpy(&pendingPose, parser.payload, sizeof(PuppetPose));
+      posePending = true;
+      if (pendingPose.flags & PUPPET_POSE_SERVOS) {
+        // Coalesced and counted with the other remote inputs
+        setRemoteServoTargets(pendingPose.servo[0], pendingPose.servo[1],
+                              pendingPose.servo[2], pendingPose.servo[3]);
+      }
+      break;
+
+    case PUPPET_TYPE_PING:
+      sendFrame(PUPPET_TYPE_PONG, parser.payload, parser.length);
+      break;
+
+    case PUPPET_TYPE_RELEASE:
+      releasePuppet("host release");
+      break;
+
+    case PUPPET_TYPE_STATS:
+      sendStatsReply();
+      break;
+
+    default:
+      stats.unknownTypes++;
+      return;
+  }
+  stats.framesOk++;
+}
+
+bool puppetLinkFeed(uint8_t byte) {
+  switch (parser.state) {
+    case PUPPET_WAIT_SYNC1:
+      if (byte != PUPPET_SYNC1) {
+        return false;  // Text CLI byte
+      }
+      parser.state = PUPPET_WAIT_SYNC2;
+      parser.frameStart = millis();
+      return true;
+
+    case PUPPET_WAIT_SYNC2:
+      parser.state = (byte == PUPPET_SYNC2) ? PUPPET_WAIT_TYPE : PUPPET_WAIT_SYNC1;
+      return true;
+
+    case PUPPET_WAIT_TYPE:
+      parser.type = byte;
+      parser.crc = crc16Update(0xFFFF, byte);
+      parser.state = PUPPET_WAIT_LENGTH;
+      return true;
+
+    case PUPPET_WAIT_LENGTH:
+      if (byte > PUPPET_MAX_PAYLOAD) {
+        stats.lengthErrors++;
+        parser.state = PUPPET_WAIT_SYNC1;
+        return true;
+      }
+      parser.length = byte;
+      parser.received = 0;
+      parser.crc = crc16Update(parser.crc, byte);
+      parser.state = (byte == 0) ? PUPPET_WAIT_CRC_LO : PUPPET_WAIT_PAYLOAD;
+      return true;
+
+    case PUPPET_WAIT_PAYLOAD:
+      parser.payload[parser.received++] = byte;
+      parser.crc = crc16Update(parser.crc, byte);
+      if (parser.received >= parser.length) {
+        parser.state = PUPPET_WAIT_CRC_LO;
+      }
+      return true;
+
+    case PUPPET_WAIT_CRC_LO:
+      // Checked together with the high byte so a bad frame never leaks its
+      // last byte into the text CLI
+      parser.crcLow = byte;
+      parser.state = PUPPET_WAIT_CRC_HI;
+      return true;
+
+    case PUPPET_WAIT_CRC_HI:
+      parser.state = PUPPET_WAIT_SYNC1;
+      if (byte != (parser.crc >> 8) || parser.crcLow != (parser.crc & 0xFF)) {
+        stats.crcErrors++;
+        return true;
+      }
+      handleFrame();
+      return true;
+  }
+  return false;
+}
+
+//========================================
+// POSE APPLICATION
+//========================================
+
+static void takeControl() {
+  puppetActive = true;
+  eyesOwned = false;
+  detailOwned = false;
+
+  // The PC owns the motion now - stop anything that would fight it
+  if (sequenceManager.isPlaying()) {
+    sequenceManager.stopPlayback();
+  }
+  Serial.println(F("🎮 Puppet link active"));
+}
+
+// Servo values were already handed to setRemoteServoTargets() when the
+// frame arrived; only control, eyes and detail LEDs are handled here
+static void applyPose(const PuppetPose& pose) {
+  if (!puppetActive) {
+    takeControl();
+  }
+
+  if (pose.flags & PUPPET_POSE_EYES) {
+    uint32_t color = Adafruit_NeoPixel::Color(pose.eyeRgb[0], pose.eyeRgb[1], pose.eyeRgb[2]);
+    if (!eyesOwned) {
+      stopAllAnimations();
+      eyesOwned = true;
+      appliedEyeBrightness = pose.eyeBrightness + 1;  // Force first write
+    }
+    if (pose.eyeBrightness != appliedEyeBrightness) {
+      setEyeBrightness(pose.eyeBrightness);
+      appliedEyeBrightness = pose.eyeBrightness;
+    }
+    if (color != appliedEyeColor || currentPixelMode != SOLID_COLOR) {
+      setEyeColor(color, color);
+      appliedEyeColor = color;
+    }
+  }
+
+  if (pose.flags & PUPPET_POSE_DETAIL) {
+    uint32_t color = ((uint32_t)pose.detailRgb[0] << 16) |
+                     ((uint32_t)pose.detailRgb[1] << 8) |
+                     pose.detailRgb[2];
+    if (!detailOwned || color != appliedDetailColor) {
+      setDetailColor(pose.detailRgb[0], pose.detailRgb[1], pose.detailRgb[2]);
+      appliedDetailColor = color;
+      detailOwned = true;
+    }
+  }
+
+  stats.posesApplied++;
+  stats.lastSequence = pose.sequence;
+  lastPoseTime = millis();
+  lastActivityTime = lastPoseTime;
+}
+
+//========================================
+// LIFECYCLE
+//========================================
+
+void updatePuppetLink() {
+  unsigned long now = millis();
+
+  if (parser.state != PUPPET_WAIT_SYNC1 && now - parser.frameStart > PUPPET_FRAME_TIMEOUT_MS) {
+    stats.frameTimeouts++;
+    parser.state = PUPPET_WAIT_SYNC1;
+  }
+
+  // Poses only drive the hardware in normal operation (not during tests,
+  // learning or scanner mode); a pending pose keeps being superseded meanwhile.
+  // The servo part is held back the same way, as remote targets are only
+  // written by the normal-mode servo tick.
+  if (posePending && operatingMode == MODE_NORMAL) {
+    posePending = false;
+    applyPose(pendingPose);
+  }
+
+  if (puppetActive && now - lastPoseTime > PUPPET_RELEASE_TIMEOUT_MS) {
+    releasePuppet("no frames");
+  }
+}
+
+bool isPuppetActive() {
+  return puppetActive;
+}
+
+void releasePuppet(const char* reason) {
+  posePending = false;
+  if (!puppetActive) {
+    return;
+  }
+
+  puppetActive = false;
+  stats.releases++;
+  setServoParameters();  // Resume autonomous movement intervals
+  autoUpdateStatusLED();
+  Serial.printf("Puppet link released (%s)\n", reason);
+}
+
+void printPuppetLinkStats() {
+  Serial.println(F("\n=== PUPPET LINK ==="));
+  Serial.printf("State: %s\n", puppetActive ? "Active (PC control)" : "Idle");
+  if (puppetActive) {
+    Serial.printf("Last pose: %lu ms ago (seq %u)\n", millis() - lastPoseTime, stats.lastSequence);
+  }
+  Serial.printf("Frames OK: %lu\n", (unsigned long)stats.framesOk);
+  Serial.printf("Poses applied: %lu, eye/detail superseded: %lu (servos: 'servo stats')\n",
+                (unsigned long)stats.posesApplied, (unsigned long)stats.posesSuperseded);
+  Serial.printf("Errors: CRC %lu, length %lu, unknown type %lu, timeout %lu\n",
+                (unsigned long)stats.crcErrors, (unsigned long)stats.lengthErrors,
+                (unsigned long)stats.unknownTypes, (unsigned long)stats.frameTimeouts);
+  Serial.printf("Releases: %lu\n", (unsigned long)stats.releases);
+}
@@ -0,0 +1,85 @@
+/*
+================================================================================
+// K-2SO Controller Puppet Link Header
+// Framed binary protocol on the USB serial port for live puppeteering from a
+// PC. Frames share the port with the text CLI; the sync bytes never occur in
+// typed commands.
+//
+// Frame:  0xA5 0x5A <type> <len> <payload[len]> <crc16 lo> <crc16 hi>
+// CRC:    CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) over type, len, payload
+// Host reference client: tools/puppet_client.py
+================================================================================
+*/
+
+#ifndef K2SO_PUPPETLINK_H
+#define K2SO_PUPPETLINK_H
+
+#include <Arduino.h>
+
+//========================================
+// PROTOCOL CONFIGURATION
+//========================================
+
+#define PUPPET_SYNC1                0xA5
+#define PUPPET_SYNC2                0x5A
+#define PUPPET_MAX_PAYLOAD          32
+#define PUPPET_FRAME_TIMEOUT_MS     50      // Abandon a half-received frame
+#define PUPPET_RELEASE_TIMEOUT_MS   500     // Hand control back after this much silence
+
+// Frame types (host -> device)
+#define PUPPET_TYPE_POSE            0x01    // PuppetPose payload
+#define PUPPET_TYPE_PING            0x02    // Echoed back as PONG
+#define PUPPET_TYPE_RELEASE         0x03    // Return to autonomous behavior
+#define PUPPET_TYPE_STATS           0x04    // Request link counters
+
+// Frame types (device -> host)
+#define PUPPET_TYPE_PONG            0x82
+#define PUPPET_TYPE_STATS_REPLY     0x84
+
+// PuppetPose.flags
+#define PUPPET_POSE_SERVOS          0x01    // servo[] valid
+#define PUPPET_POSE_EYES            0x02    // eyeRgb / eyeBrightness valid
+#define PUPPET_POSE_DETAIL          0x04    // detailRgb valid
+
+//========================================
+// DATA STRUCTURES
+//========================================
+
+// POSE payload, 13 bytes on the wire
+struct PuppetPose {
+  uint8_t sequence;         // Host counter, echoed in stats
+  uint8_t flags;            // PUPPET_POSE_*
+  uint8_t servo[4];         // Eye pan, eye tilt, head pan, head tilt (degrees)
+  uint8_t eyeRgb[3];
+  uint8_t eyeBrightness;
+  uint8_t detailRgb[3];
+} __attribute__((packed));
+
+// Link counters
+struct PuppetLinkStats {
+  uint32_t framesOk;            // Valid frames of any type
+  uint32_t crcErrors;
+  uint32_t lengthErrors;        // Oversized or wrong-size payloads
+  uint32_t unknownTypes;
+  uint32_t frameTimeouts;       // Frames abandoned mid-way
+  uint32_t posesApplied;        // Poses taken by the main loop
+  uint32_t posesSuperseded;     // Eye/detail parts replaced before the loop applied them
+  uint32_t releases;            // Control handed back (frame or timeout)
+  uint8_t lastSequence;
+};
+
+//========================================
+// FUNCTION DECLARATIONS
+//========================================
+
+// Called from the serial poller for every received byte.
+// Returns true if the byte belongs to a binary frame.
+bool puppetLinkFeed(uint8_t byte);
+
+void updatePuppetLink();                // Apply the latest pose, release on silence (call in loop)
+bool isPuppetActive();                  // PC currently owns servos/eyes
+void releasePuppet(const char* reason);
+void printPuppetLinkStats();
+uint16_t puppetCrc16(const uint8_t* data, size_t length);
+
+#endif // K2SO_PUPPETLINK_H
@@ -0,0 +1,544 @@
+/*
+================================================================================
+// K-2SO Controller Scene Snapshot Implementation
+// Capture reads the live globals; restore writes them back directly and
+// sends one update per LED strip, so a scene appears in a single loop pass
+// instead of through a chain of setters that each redraw.
+================================================================================
+*/
+
+#include <Arduino.h>
+#include <ESP32Servo.h>
+#include <stddef.h>
+#include "scenes.h"
+#include "config.h"
+#include "animations.h"   // For animState, setEyeColorAndBrightness, start*Mode
+#include "detailleds.h"   // For detailState, detailLEDs
+#include "statusled.h"    // For setStatusLEDState, statusLEDOff
+#include "handlers.h"     // For setVolume, setServoParameters, getModeName, parseModeName
+#include "puppetlink.h"   // For puppetCrc16, releasePuppet
+#include "metrics.h"      // For fsOpen, fsExists, fsMkdir, fsRemove
+#include "globals.h"
+
+static ServoState* const servoAxes[4] = { &eyePan, &eyeTilt, &headPan, &headTilt };
+static const char* const SERVO_AXIS_NAMES[4] = { "eyePan", "eyeTilt", "headPan", "headTilt" };
+
+static void sealStateSnapshot(StateSnapshot& snapshot) {
+  snapshot.crc = puppetCrc16((const uint8_t*)&snapshot, offsetof(StateSnapshot, crc));
+}
+
+//========================================
+// CAPTURE
+//========================================
+
+void captureStateSnapshot(StateSnapshot& snapshot) {
+  memset(&snapshot, 0, sizeof(snapshot));
+  snapshot.magic = STATE_SNAPSHOT_MAGIC;
+  snapshot.version = STATE_SNAPSHOT_VERSION;
+
+  for (uint8_t axis = 0; axis < 4; axis++) {
+    snapshot.servoCurrent[axis] = constrain(servoAxes[axis]->currentPosition, 0, 180);
+    snapshot.servoTarget[axis] = constrain(servoAxes[axis]->targetPosition, 0, 180);
+  }
+
+  // A running fade is stored as the color it ends on
+  PixelMode mode = currentPixelMode;
+  if (mode == FADE_COLOR || mode == FADE_OFF) {
+    snapshot.leftEyeColor = animState.fadeTargetColorLeft;
+    snapshot.rightEyeColor = animState.fadeTargetColorRight;
+    mode = SOLID_COLOR;
+  } else if (mode == SOLID_COLOR) {
+    snapshot.leftEyeColor = leftEyeCurrentColor;
+    snapshot.rightEyeColor = rightEyeCurrentColor;
+  } else {
+    snapshot.leftEyeColor = animState.baseColorLeft;
+    snapshot.rightEyeColor = animState.baseColorRight;
+  }
+  snapshot.pixelMode = mode;
+  snapshot.eyeBrightness = currentBrightness;
+
+  snapshot.detailPattern = detailState.pattern;
+  snapshot.detailCount = detailState.activeCount;
+  snapshot.detailBrightness = detailState.brightness;
+  snapshot.detailRed = detailState.red;
+  snapshot.detailGreen = detailState.green;
+  snapshot.detailBlue = detailState.blue;
+
+  // The target state, so a short activity flash is not what gets stored
+  snapshot.statusState = statusLEDAnim.targetState;
+  snapshot.statusBrightness = config.statusLedBrightness;
+
+  snapshot.volume = currentVolume;
+  snapshot.personalityMode = currentMode;
+
+  if (isAwake)                    snapshot.flags |= STATE_FLAG_AWAKE;
+  if (detailState.enabled)        snapshot.flags |= STATE_FLAG_DETAIL_ENABLED;
+  if (detailState.autoColorMode)  snapshot.flags |= STATE_FLAG_DETAIL_AUTO;
+  if (config.statusLedEnabled)    snapshot.flags |= STATE_FLAG_STATUS_ENABLED;
+
+  if (sequenceManager.isPlaying()) {
+    snapshot.flags |= STATE_FLAG_PLAYING;
+    if (sequenceManager.isPaused())  snapshot.flags |= STATE_FLAG_PAUSED;
+    if (sequenceManager.isLooping()) snapshot.flags |= STATE_FLAG_LOOP;
+    strncpy(snapshot.sequence, sequenceManager.getCurrentSequenceName(), sizeof(snapshot.sequence) - 1);
+    snapshot.frame = sequenceManager.getCurrentFrame();
+  }
+
+  sealStateSnapshot(snapshot);
+}
+
+//========================================
+// VALIDATION AND RESTORE
+//========================================
+
+bool validateStateSnapshot(const StateSnapshot& snapshot, String& errorMessage) {
+  if (snapshot.magic != STATE_SNAPSHOT_MAGIC || snapshot.version != STATE_SNAPSHOT_VERSION) {
+    errorMessage = "Not a version " + String(STATE_SNAPSHOT_VERSION) + " state snapshot";
+    return false;
+  }
+  for (uint8_t axis = 0; axis < 4; axis++) {
+    if (snapshot.servoCurrent[axis] > 180 || snapshot.servoTarget[axis] > 180) {
+      errorMessage = String("Invalid ") + SERVO_AXIS_NAMES[axis] + " position";
+      return false;
+    }
+  }
+  if (snapshot.pixelMode > ALARM) {
+    errorMessage = "Invalid eye mode";
+    return false;
+  }
+  if (snapshot.detailPattern > DETAIL_PATTERN_RANDOM ||
+      snapshot.detailCount < 1 || snapshot.detailCount > MAX_DETAIL_LEDS) {
+    errorMessage = "Invalid detail LED pattern or count";
+    return false;
+  }
+  if (snapshot.statusState > STATUS_CONFIG_MODE) {
+    errorMessage = "Invalid status LED state";
+    return false;
+  }
+  if (!isValidVolume(snapshot.volume)) {
+    errorMessage = "Invalid volume";
+    return false;
+  }
+  if (snapshot.personalityMode > MODE_IDLE) {
+    errorMessage = "Invalid mode";
+    return false;
+  }
+  if (memchr(snapshot.sequence, '\0', sizeof(snapshot.sequence)) == nullptr ||
+      ((snapshot.flags & STATE_FLAG_PLAYING) && !sequenceManager.isValidSequenceName(snapshot.sequence))) {
+    errorMessage = "Invalid sequence name";
+    return false;
+  }
+  return true;
+}
+
+// Eyes already show the base colors; this only starts the effect on top
+static void startEyeMode(PixelMode mode, uint32_t color) {
+  bool ringModes = (activeEyeLEDCount == 13);
+  switch (mode) {
+    case FLICKER:      startFlickerMode(color); break;
+    case PULSE:        startPulseMode(color); break;
+    case SCANNER:      startScannerMode(color); break;
+    case HEARTBEAT:    startHeartbeatMode(); break;
+    case ALARM:        startAlarmMode(); break;
+    case IRIS:         if (ringModes) startIrisMode(); break;
+    case TARGETING:    if (ringModes) startTargetingMode(); break;
+    case RING_SCANNER: if (ringModes) startRingScannerMode(); break;
+    case SPIRAL:       if (ringModes) startSpiralMode(); break;
+    case FOCUS:        if (ringModes) startFocusMode(); break;
+    case RADAR:        if (ringModes) startRadarMode(); break;
+    default:           break;  // Solid color
+  }
+}
+
+bool applyStateSnapshot(const StateSnapshot& snapshot, String& errorMessage) {
+  bool complete = true;
+  if (isPuppetActive()) {
+    releasePuppet("state restore");
+  }
+
+  // Playback first - starting a sequence applies its frame, and the values
+  // below are what this tick should end up showing
+  if (snapshot.flags & STATE_FLAG_PLAYING) {
+    if (!sequenceManager.playSequence(snapshot.sequence, snapshot.flags & STATE_FLAG_LOOP,
+                                      false, snapshot.frame)) {
+      errorMessage = "Sequence '" + String(snapshot.sequence) + "' could not be played";
+      complete = false;
+    } else if (snapshot.flags & STATE_FLAG_PAUSED) {
+      sequenceManager.pausePlayback();
+    }
+  } else {
+    sequenceManager.stopPlayback();
+  }
+
+  // Behaviour
+  currentMode = (PersonalityMode)snapshot.personalityMode;
+  isAwake = snapshot.flags & STATE_FLAG_AWAKE;
+  setServoParameters();
+  lastActivityTime = millis();
+
+  // Servos jump to the stored position and continue towards the stored target
+  for (uint8_t axis = 0; axis < 4; axis++) {
+    ServoState& servo = *servoAxes[axis];
+    int current = constrain(snapshot.servoCurrent[axis], servo.minRange, servo.maxRange);
+    int target = constrain(snapshot.servoTarget[axis], servo.minRange, servo.maxRange);
+    if (servo.currentPosition != current) {
+      servo.currentPosition = current;
+      servo.servoObject->write(current);
+    }
+    servo.targetPosition = target;
+    servo.isMoving = (target != current);
+    servo.previousMillis = millis();
+  }
+
+  // Eyes: one show for color + brightness, effects draw from the next update
+  setEyeColorAndBrightness(snapshot.leftEyeColor, snapshot.rightEyeColor, snapshot.eyeBrightness);
+  startEyeMode((PixelMode)snapshot.pixelMode, snapshot.leftEyeColor);
+
+  // Detail LEDs: state written directly, the pattern redraws on its next step
+  detailState.activeCount = snapshot.detailCount;
+  detailState.brightness = snapshot.detailBrightness;
+  detailState.red = snapshot.detailRed;
+  detailState.green = snapshot.detailGreen;
+  detailState.blue = snapshot.detailBlue;
+  detailState.pattern = (DetailPattern)snapshot.detailPattern;
+  detailState.enabled = snapshot.flags & STATE_FLAG_DETAIL_ENABLED;
+  detailState.autoColorMode = snapshot.flags & STATE_FLAG_DETAIL_AUTO;
+  detailState.animationStep = 0;
+  detailState.animationProgress = 0.0;
+  detailState.lastUpdate = millis();
+  detailLEDs.setBrightness(snapshot.detailBrightness);
+  detailLEDs.clear();
+  detailLEDs.show();
+
+  // Status LED
+  config.statusLedEnabled = snapshot.flags & STATE_FLAG_STATUS_ENABLED;
+  config.statusLedBrightness = snapshot.statusBrightness;
+  statusLED.setBrightness(snapshot.statusBrightness);
+  if (config.statusLedEnabled) {
+    setStatusLEDState((StatusLEDState)snapshot.statusState);
+  } else {
+    statusLEDOff();
+  }
+
+  // Only talk to the DFPlayer if something changes
+  if (snapshot.volume != currentVolume) {
+    setVolume(snapshot.volume);
+  }
+
+  return complete;
+}
+
+//========================================
+// BINARY AND JSON ENCODING
+//========================================
+
+bool stateSnapshotFromBinary(const uint8_t* data, size_t length, StateSnapshot& snapshot, String& errorMessage) {
+  if (data == nullptr || length != sizeof(StateSnapshot)) {
+    errorMessage = "Binary snapshot must be " + String(sizeof(StateSnapshot)) + " bytes";
+    return false;
+  }
+  memcpy(&snapshot, data, sizeof(snapshot));
+  if (puppetCrc16(data, offsetof(StateSnapshot, crc)) != snapshot.crc) {
+    errorMessage = "Snapshot CRC mismatch";
+    return false;
+  }
+  return validateStateSnapshot(snapshot, errorMessage);
+}
+
+void stateSnapshotToJson(const StateSnapshot& snapshot, JsonObject out) {
+  out["version"] = snapshot.version;
+  out["mode"] = getModeName((PersonalityMode)snapshot.personalityMode);
+  out["awake"] = (bool)(snapshot.flags & STATE_FLAG_AWAKE);
+
+  JsonObject servos = out.createNestedObject("servos");
+  for (uint8_t axis = 0; axis < 4; axis++) {
+    JsonObject servo = servos.createNestedObject(SERVO_AXIS_NAMES[axis]);
+    servo["current"] = snapshot.servoCurrent[axis];
+    servo["target"] = snapshot.servoTarget[axis];
+  }
+
+  JsonObject eyes = out.createNestedObject("eyes");
+  eyes["mode"] = snapshot.pixelMode;
+  eyes["left"] = snapshot.leftEyeColor;
+  eyes["right"] = snapshot.rightEyeColor;
+  eyes["brightness"] = snapshot.eyeBrightness;
+
+  JsonObject detail = out.createNestedObject("detail");
+  detail["enabled"] = (bool)(snapshot.flags & STATE_FLAG_DETAIL_ENABLED);
+  detail["auto"] = (bool)(snapshot.flags & STATE_FLAG_DETAIL_AUTO);
+  detail["pattern"] = snapshot.detailPattern;
+  detail["count"] = snapshot.detailCount;
+  detail["brightness"] = snapshot.detailBrightness;
+  detail["color"] = ((uint32_t)snapshot.detailRed << 16) | ((uint32_t)snapshot.detailGreen << 8) |
+                    snapshot.detailBlue;
+
+  JsonObject status = out.createNestedObject("status");
+  status["enabled"] = (bool)(snapshot.flags & STATE_FLAG_STATUS_ENABLED);
+  status["state"] = snapshot.statusState;
+  status["brightness"] = snapshot.statusBrightness;
+
+  out["volume"] = snapshot.volume;
+
+  JsonObject playback = out.createNestedObject("playback");
+  playback["playing"] = (bool)(snapshot.flags & STATE_FLAG_PLAYING);
+  playback["paused"] = (bool)(snapshot.flags & STATE_FLAG_PAUSED);
+  playback["loop"] = (bool)(snapshot.flags & STATE_FLAG_LOOP);
+  playback["sequence"] = snapshot.sequence;
+  playback["frame"] = snapshot.frame;
+}
+
+static void setFlag(StateSnapshot& snapshot, uint8_t flag, JsonVariantConst value) {
+  if (value.isNull()) {
+    return;
+  }
+  if (value.as<bool>()) {
+    snapshot.flags |= flag;
+  } else {
+    snapshot.flags &= ~flag;
+  }
+}
+
+bool stateSnapshotFromJson(JsonObjectConst in, StateSnapshot& snapshot, String& errorMessage) {
+  captureStateSnapshot(snapshot);
+
+  const char* modeName = in["mode"];
+  if (modeName != nullptr) {
+    PersonalityMode mode;
+    if (!parseModeName(modeName, mode)) {
+      errorMessage = "Invalid mode";
+      return false;
+    }
+    snapshot.personalityMode = mode;
+  }
+  setFlag(snapshot, STATE_FLAG_AWAKE, in["awake"]);
+
+  // An axis given without a target holds still at its new position
+  JsonObjectConst servos = in["servos"];
+  for (uint8_t axis = 0; axis < 4; axis++) {
+    JsonObjectConst servo = servos[SERVO_AXIS_NAMES[axis]];
+    if (servo.isNull()) {
+      continue;
+    }
+    snapshot.servoCurrent[axis] = servo["current"] | snapshot.servoCurrent[axis];
+    snapshot.servoTarget[axis] = servo["target"] | snapshot.servoCurrent[axis];
+  }
+
+  JsonObjectConst eyes = in["eyes"];
+  snapshot.pixelMode = eyes["mode"] | snapshot.pixelMode;
+  snapshot.leftEyeColor = eyes["left"] | snapshot.leftEyeColor;
+  snapshot.rightEyeColor = eyes["right"] | snapshot.rightEyeColor;
+  snapshot.eyeBrightness = eyes["brightness"] | snapshot.eyeBrightness;
+
+  JsonObjectConst detail = in["detail"];
+  setFlag(snapshot, STATE_FLAG_DETAIL_ENABLED, detail["enabled"]);
+  setFlag(snapshot, STATE_FLAG_DETAIL_AUTO, detail["auto"]);
+  snapshot.detailPattern = detail["pattern"] | snapshot.detailPattern;
+  snapshot.detailCount = detail["count"] | snapshot.detailCount;
+  snapshot.detailBrightness = detail["brightness"] | snapshot.detailBrightness;
+  if (!detail["color"].isNull()) {
+    uint32_t color = detail["color"];
+    snapshot.detailRed = (color >> 16) & 0xFF;
+    snapshot.detailGreen = (color >> 8) & 0xFF;
+    snapshot.detailBlue = color & 0xFF;
+  }
+
+  JsonObjectConst status = in["status"];
+  setFlag(snapshot, STATE_FLAG_STATUS_ENABLED, status["enabled"]);
+  snapshot.statusState = status["state"] | snapshot.statusState;
+  snapshot.statusBrightness = status["brightness"] | snapshot.statusBrightness;
+
+  snapshot.volume = in["volume"] | snapshot.volume;
+
+  JsonObjectConst playback = in["playback"];
+  setFlag(snapshot, STATE_FLAG_PLAYING, playback["playing"]);
+  setFlag(snapshot, STATE_FLAG_PAUSED, playback["paused"]);
+  setFlag(snapshot, STATE_FLAG_LOOP, playback["loop"]);
+  const char* sequence = playback["sequence"];
+  if (sequence != nullptr) {
+    memset(snapshot.sequence, 0, sizeof(snapshot.sequence));
+    strncpy(snapshot.sequence, sequence, sizeof(snapshot.sequence) - 1);
+  }
+  snapshot.frame = playback["frame"] | snapshot.frame;
+  if (!(snapshot.flags & STATE_FLAG_PLAYING)) {
+    snapshot.flags &= ~(STATE_FLAG_PAUSED | STATE_FLAG_LOOP);
+  }
+
+  sealStateSnapshot(snapshot);
+  return validateStateSnapshot(snapshot, errorMessage);
+}
+
+//========================================
+// RAM RING
+//========================================
+
+struct SceneSlot {
+  bool used;
+  unsigned long savedAt;
+  StateSnapshot snapshot;
+};
+
+static SceneSlot sceneSlots[SCENE_RAM_SLOTS];
+static uint8_t nextSceneSlot = 0;
+
+bool storeSceneSlot(uint8_t slot, const StateSnapshot& snapshot) {
+  if (slot >= SCENE_RAM_SLOTS) {
+    return false;
+  }
+  sceneSlots[slot].used = true;
+  sceneSlots[slot].savedAt = millis();
+  sceneSlots[slot].snapshot = snapshot;
+  nextSceneSlot = (slot + 1) % SCENE_RAM_SLOTS;
+  return true;
+}
+
+uint8_t storeSceneSlot(const StateSnapshot& snapshot) {
+  uint8_t slot = nextSceneSlot;
+  storeSceneSlot(slot, snapshot);
+  return slot;
+}
+
+bool getSceneSlot(uint8_t slot, StateSnapshot& snapshot) {
+  if (slot >= SCENE_RAM_SLOTS || !sceneSlots[slot].used) {
+    return false;
+  }
+  snapshot = sceneSlots[slot].snapshot;
+  return true;
+}
+
+bool getSceneSlotAge(uint8_t slot, unsigned long& ageMs) {
+  if (slot >= SCENE_RAM_SLOTS || !sceneSlots[slot].used) {
+    return false;
+  }
+  ageMs = millis() - sceneSlots[slot].savedAt;
+  return true;
+}
+
+//========================================
+// SCENE FILES
+//========================================
+
+static bool checkSceneName(const char* name, String& errorMessage) {
+  if (!sequenceManager.isStorageAvailable()) {
+    errorMessage = "Storage not available";
+    return false;
+  }
+  if (!sequenceManager.isValidSequenceName(name)) {
+    errorMessage = "Invalid scene name. Use only A-Z, a-z, 0-9, _ and - (1-31 chars).";
+    return false;
+  }
+  return true;
+}
+
+static String getScenePath(const char* name) {
+  return String(SCENES_DIR) + "/" + name + SCENE_FILE_EXTENSION;
+}
+
+bool saveSceneFile(const char* name, const StateSnapshot& snapshot, String& errorMessage) {
+  if (!checkSceneName(name, errorMessage)) {
+    return false;
+  }
+  if (!fsExists(SCENES_DIR) && !fsMkdir(SCENES_DIR)) {
+    errorMessage = "Cannot create " SCENES_DIR;
+    return false;
+  }
+
+  String path = getScenePath(name);
+  File file = fsOpen(path, "w");
+  if (!file) {
+    errorMessage = "Cannot write scene file";
+    return false;
+  }
+  size_t written = file.write((const uint8_t*)&snapshot, sizeof(snapshot));
+  file.close();
+  if (written != sizeof(snapshot)) {
+    fsRemove(path);
+    errorMessage = "Scene file write incomplete";
+    return false;
+  }
+  return true;
+}
+
+bool loadSceneFile(const char* name, StateSnapshot& snapshot, String& errorMessage) {
+  if (!checkSceneName(name, errorMessage)) {
+    return false;
+  }
+  String path = getScenePath(name);
+  if (!fsExists(path)) {
+    errorMessage = "Scene not found";
+    return false;
+  }
+  File file = fsOpen(path, "r");
+  if (!file) {
+    errorMessage = "Cannot read scene file";
+    return false;
+  }
+  uint8_t buffer[sizeof(StateSnapshot) + 1];  // One extra byte catches oversized files
+  size_t length = file.read(buffer, sizeof(buffer));
+  file.close();
+  return stateSnapshotFromBinary(buffer, length, snapshot, errorMessage);
+}
+
+bool deleteSceneFile(const char* name, String& errorMessage) {
+  if (!checkSceneName(name, errorMessage)) {
+    return false;
+  }
+  String path = getScenePath(name);
+  if (!fsExists(path)) {
+    errorMessage = "Scene not found";
+    return false;
+  }
+  if (!fsRemove(path)) {
+    errorMessage = "Delete failed";
+    return false;
+  }
+  return true;
+}
+
+//========================================
+// SERIAL OUTPUT
+//========================================
+
+void printStateSnapshot(const StateSnapshot& snapshot) {
+  Serial.printf("Mode: %s (%s)\n", getModeName((PersonalityMode)snapshot.personalityMode).c_str(),
+                (snapshot.flags & STATE_FLAG_AWAKE) ? "awake" : "sleeping");
+  for (uint8_t axis = 0; axis < 4; axis++) {
+    Serial.printf("  %-8s %3u -> %3u\n", SERVO_AXIS_NAMES[axis],
+                  snapshot.servoCurrent[axis], snapshot.servoTarget[axis]);
+  }
+  Serial.printf("Eyes: mode %u, L 0x%06lX R 0x%06lX, brightness %u\n", snapshot.pixelMode,
+                (unsigned long)snapshot.leftEyeColor, (unsigned long)snapshot.rightEyeColor,
+                snapshot.eyeBrightness);
+  Serial.printf("Detail: %s%s, pattern %u, %u LEDs, RGB(%u,%u,%u), brightness %u\n",
+                (snapshot.flags & STATE_FLAG_DETAIL_ENABLED) ? "on" : "off",
+                (snapshot.flags & STATE_FLAG_DETAIL_AUTO) ? " (auto color)" : "",
+                snapshot.detailPattern, snapshot.detailCount,
+                snapshot.detailRed, snapshot.detailGreen, snapshot.detailBlue, snapshot.detailBrightness);
+  Serial.printf("Status LED: %s, %s, brightness %u\n",
+                (snapshot.flags & STATE_FLAG_STATUS_ENABLED) ? "on" : "off",
+                getStatusLEDStateName((StatusLEDState)snapshot.statusState).c_str(),
+                snapshot.statusBrightness);
+  Serial.printf("Volume: %u\n", snapshot.volume);
+  if (snapshot.flags & STATE_FLAG_PLAYING) {
+    Serial.printf("Playback: %s frame %u%s%s\n", snapshot.sequence, snapshot.frame,
+                  (snapshot.flags & STATE_FLAG_PAUSED) ? " (paused)" : "",
+                  (snapshot.flags & STATE_FLAG_LOOP) ? " (looping)" : "");
+  } else {
+    Serial.println(F("Playback: stopped"));
+  }
+}
+
+void printSceneSlots() {
+  Serial.println(F("\n=== SCENE SLOTS (RAM) ==="));
+  for (uint8_t slot = 0; slot < SCENE_RAM_SLOTS; slot++) {
+    unsigned long age;
+    if (!getSceneSlotAge(slot, age)) {
+      Serial.printf("  %u: (empty)\n", slot);
+      continue;
+    }
+    const StateSnapshot& snapshot = sceneSlots[slot].snapshot;
+    Serial.printf("  %u: %s, %s, saved %lu s ago%s\n", slot,
+                  getModeName((PersonalityMode)snapshot.personalityMode).c_str(),
+                  (snapshot.flags & STATE_FLAG_PLAYING) ? snapshot.sequence : "no sequence",
+                  age / 1000, slot == nextSceneSlot ? "  <- next" : "");
+  }
+}
@@ -0,0 +1,124 @@
+/*
+================================================================================
+// K-2SO Controller Scene Snapshot Header
+// Captures the whole visible state of the droid - servo positions, eyes,
+// detail LEDs, status LED, volume, personality mode and sequence playback -
+// into one fixed-size record, and puts it back in a single main loop tick.
+//
+//   GET  /state                  Current state as JSON (?format=bin: binary)
+//   POST /state                  Restore from a JSON or binary body
+//   /state/save?slot=N|name=X    Store in RAM slot N (no args: next ring slot)
+//                                or as /scenes/X.bin on LittleFS
+//   /state/recall?slot=N|name=X  Apply a stored scene
+//   /state/slots, /state/list    RAM slots / saved scene files
+//   /state/delete?name=X
+//
+// The binary form is the StateSnapshot struct as stored in RAM and in the
+// scene files, sealed with a CRC-16. JSON restores may leave fields out;
+// those keep their current value.
+================================================================================
+*/
+
+#ifndef K2SO_SCENES_H
+#define K2SO_SCENES_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "config.h"
+#include "sequences.h"    // For MAX_SEQUENCE_NAME_LENGTH
+
+//========================================
+// SCENE CONFIGURATION
+//========================================
+
+#define SCENES_DIR                  "/scenes"
+#define SCENE_FILE_EXTENSION        ".bin"
+#define SCENE_RAM_SLOTS             8       // Quick recall slots (lost on reboot)
+#define STATE_SNAPSHOT_MAGIC        0x534B  // "KS"
+#define STATE_SNAPSHOT_VERSION      1
+#define STATE_JSON_SIZE             1536    // ArduinoJson pool for one snapshot (parsed keys copied)
+
+// StateSnapshot::flags
+#define STATE_FLAG_AWAKE            0x01
+#define STATE_FLAG_PLAYING          0x02
+#define STATE_FLAG_PAUSED           0x04
+#define STATE_FLAG_LOOP             0x08
+#define STATE_FLAG_DETAIL_ENABLED   0x10
+#define STATE_FLAG_DETAIL_AUTO      0x20
+#define STATE_FLAG_STATUS_ENABLED   0x40
+
+//========================================
+// DATA STRUCTURES
+//========================================
+
+// Binary snapshot (little endian, 68 bytes)
+struct __attribute__((packed)) StateSnapshot {
+  uint16_t magic;
+  uint8_t version;
+  uint8_t flags;                        // STATE_FLAG_*
+
+  // Servos in degrees: eyePan, eyeTilt, headPan, headTilt
+  uint8_t servoCurrent[4];
+  uint8_t servoTarget[4];
+
+  // Eyes
+  uint8_t pixelMode;                    // PixelMode (fades are stored as their end color)
+  uint8_t eyeBrightness;
+  uint32_t leftEyeColor;
+  uint32_t rightEyeColor;
+
+  // Detail LEDs
+  uint8_t detailPattern;                // DetailPattern
+  uint8_t detailCount;
+  uint8_t detailBrightness;
+  uint8_t detailRed;
+  uint8_t detailGreen;
+  uint8_t detailBlue;
+
+  // Status LED
+  uint8_t statusState;                  // StatusLEDState
+  uint8_t statusBrightness;
+
+  // Audio and behaviour
+  uint8_t volume;
+  uint8_t personalityMode;              // PersonalityMode
+
+  // Playback (sequence empty = nothing playing)
+  uint16_t frame;
+  char sequence[MAX_SEQUENCE_NAME_LENGTH];
+
+  uint16_t crc;                         // CRC-16 of all bytes before it
+};
+
+static_assert(sizeof(StateSnapshot) == 68, "StateSnapshot layout changed - bump STATE_SNAPSHOT_VERSION");
+
+//========================================
+// FUNCTION DECLARATIONS
+//========================================
+
+// Snapshot and restore (main loop)
+void captureStateSnapshot(StateSnapshot& snapshot);    // Current state, sealed
+bool applyStateSnapshot(const StateSnapshot& snapshot, String& errorMessage);  // False: sequence not restored
+bool validateStateSnapshot(const StateSnapshot& snapshot, String& errorMessage);
+
+// Encodings
+bool stateSnapshotFromBinary(const uint8_t* data, size_t length, StateSnapshot& snapshot, String& errorMessage);
+void stateSnapshotToJson(const StateSnapshot& snapshot, JsonObject out);
+bool stateSnapshotFromJson(JsonObjectConst in, StateSnapshot& snapshot, String& errorMessage);  // Missing = current
+
+// RAM ring
+uint8_t storeSceneSlot(const StateSnapshot& snapshot); // Next ring slot (oldest is replaced)
+bool storeSceneSlot(uint8_t slot, const StateSnapshot& snapshot);
+bool getSceneSlot(uint8_t slot, StateSnapshot& snapshot);
+bool getSceneSlotAge(uint8_t slot, unsigned long& ageMs);  // False if empty
+
+// Scene files on LittleFS
+bool saveSceneFile(const char* name, const StateSnapshot& snapshot, String& errorMessage);
+bool loadSceneFile(const char* name, StateSnapshot& snapshot, String& errorMessage);
+bool deleteSceneFile(const char* name, String& errorMessage);
+
+// Serial output
+void printStateSnapshot(const StateSnapshot& snapshot);
+void printSceneSlots();
+
+#endif // K2SO_SCENES_H
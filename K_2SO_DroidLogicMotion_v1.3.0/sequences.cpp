@@ -2,91 +2,175 @@
 #include "globals.h"
 #include "animations.h"   // For PixelMode enum, setEyeColor, setEyeBrightness
 #include "detailleds.h"   // For detailState, setDetailColor, setDetailBrightness, setDetailPattern
+#include "audiolink.h"    // For supervised DFPlayer commands
+#include "metrics.h"      // For fsOpen & co, load time histogram
 #include <ArduinoJson.h>
 #include <ESP32Servo.h>   // For Servo class methods
+#include <atomic>
 
 // Global instance
 SequenceManager sequenceManager;
 
 namespace {
-bool loadFramesFromJsonDocument(const JsonDocument& doc,
-                                SequenceFrame*& frames,
-                                uint16_t& frameCount,
-                                String& errorMessage) {
-  frameCount = doc["frameCount"] | 0;
-  if (frameCount == 0 || frameCount > MAX_FRAMES_PER_SEQUENCE) {
-    errorMessage = "Invalid frame count in sequence JSON.";
-    frames = nullptr;
-    frameCount = 0;
+// CRC-32 (IEEE, same as zlib), nibble table. Start with 0, pass the previous
+// result to continue over several pieces.
+uint32_t sequenceCrc32(uint32_t crc, const void* data, size_t length) {
+  static const uint32_t table[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+  };
+  const uint8_t* bytes = (const uint8_t*)data;
+  crc = ~crc;
+  for (size_t i = 0; i < length; i++) {
+    crc = table[(crc ^ bytes[i]) & 0x0F] ^ (crc >> 4);
+    crc = table[(crc ^ (bytes[i] >> 4)) & 0x0F] ^ (crc >> 4);
+  }
+  return ~crc;
+}
+
+void fillSequenceHeader(SequenceFileHeader& header, const char* name, uint16_t frameCount,
+                        uint32_t totalDuration, uint16_t flags, uint32_t crc) {
+  memset(&header, 0, sizeof(header));
+  header.magic = SEQUENCE_FILE_MAGIC;
+  header.version = SEQUENCE_FILE_VERSION;
+  header.headerSize = sizeof(SequenceFileHeader);
+  header.recordSize = sizeof(SequenceFrame);
+  strncpy(header.name, name, MAX_SEQUENCE_NAME_LENGTH - 1);
+  header.frameCount = frameCount;
+  header.flags = flags;
+  header.totalDuration = totalDuration;
+  header.crc = crc;
+}
+
+// Reads and checks the header; the file is left at the first record
+bool readSequenceHeader(File& file, SequenceFileHeader& header, String& errorMessage) {
+  if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header)) {
+    errorMessage = "Sequence file is truncated.";
     return false;
   }
+  header.name[MAX_SEQUENCE_NAME_LENGTH - 1] = '\0';
 
-  JsonArrayConst framesArray = doc["frames"].as<JsonArrayConst>();
-  if (framesArray.isNull()) {
-    errorMessage = "Missing frames array in sequence JSON.";
-    frames = nullptr;
-    frameCount = 0;
+  if (header.magic != SEQUENCE_FILE_MAGIC) {
+    errorMessage = "Not a sequence file.";
+    return false;
+  }
+  if (header.version != SEQUENCE_FILE_VERSION ||
+      header.headerSize != sizeof(SequenceFileHeader) ||
+      header.recordSize != sizeof(SequenceFrame)) {
+    errorMessage = "Unsupported sequence file version.";
+    return false;
+  }
+  if (header.frameCount == 0 || header.frameCount > MAX_FRAMES_PER_SEQUENCE) {
+    errorMessage = "Declared frame count is invalid.";
+    return false;
+  }
+  if (file.size() != sizeof(header) + (size_t)header.frameCount * sizeof(SequenceFrame)) {
+    errorMessage = "Sequence file size does not match its frame count.";
     return false;
   }
+  return true;
+}
 
-  uint16_t actualFrameCount = framesArray.size();
-  if (actualFrameCount == 0) {
-    errorMessage = "Sequence JSON contains no frames.";
-    frames = nullptr;
-    frameCount = 0;
+// JSON .seq files written by older firmware; only read to convert them
+bool loadLegacySequence(const String& path, SequenceFrame*& frames, uint16_t& frameCount, String& errorMessage) {
+  frames = nullptr;
+  frameCount = 0;
+
+  File file = fsOpen(path, "r");
+  if (!file) {
+    errorMessage = "File could not be opened.";
     return false;
   }
 
-  if (actualFrameCount != frameCount) {
-    errorMessage = "Declared frame count does not match actual frames array.";
-    frames = nullptr;
-    frameCount = actualFrameCount;
+  DynamicJsonDocument doc(16384);
+  if (doc.capacity() == 0) {
+    file.close();
+    errorMessage = "Out of memory for JSON document.";
+    return false;
+  }
+  DeserializationError error = deserializeJson(doc, file);
+  file.close();
+  if (error) {
+    errorMessage = String("JSON parse error: ") + error.c_str();
     return false;
   }
 
-  frames = new SequenceFrame[frameCount];
+  uint16_t declaredCount = doc["frameCount"] | 0;
+  JsonArrayConst framesArray = doc["frames"].as<JsonArrayConst>();
+  if (declaredCount == 0 || declaredCount > MAX_FRAMES_PER_SEQUENCE || framesArray.isNull()) {
+    errorMessage = "Invalid frame count or frames array.";
+    return false;
+  }
+
+  frames = new SequenceFrame[declaredCount];
   if (frames == nullptr) {
-    errorMessage = "Memory allocation failed for imported sequence.";
-    frameCount = 0;
+    errorMessage = "Memory allocation failed.";
     return false;
   }
 
-  uint16_t idx = 0;
   for (JsonObjectConst frameObj : framesArray) {
+    if (frameCount >= declaredCount) break;
+
+    SequenceFrame& frame = frames[frameCount++];
+    memset(&frame, 0, sizeof(frame));
     JsonObjectConst servos = frameObj["s"].as<JsonObjectConst>();
 
-    frames[idx].duration = frameObj["d"] | 1000;
-    frames[idx].eyePan = servos["ep"] | 90;
-    frames[idx].eyeTilt = servos["et"] | 90;
-    frames[idx].headPan = servos["hp"] | 90;
-    frames[idx].headTilt = servos["ht"] | 90;
-    frames[idx].eyeMode = frameObj["em"] | 0;
-    frames[idx].eyeColor = frameObj["ec"] | 0x007FFF;
-    frames[idx].eyeBrightness = frameObj["eb"] | 150;
-    frames[idx].detailMode = frameObj["dm"] | 0;
-    frames[idx].detailColor = frameObj["dc"] | 0x007FFF;
-    frames[idx].detailBrightness = frameObj["db"] | 150;
-    frames[idx].soundFile = frameObj["sf"] | 0;
-    frames[idx].soundFolder = frameObj["so"] | 0;
-    frames[idx].volume = frameObj["v"] | 20;
-    idx++;
+    frame.duration = frameObj["d"] | 1000;
+    frame.eyePan = servos["ep"] | 90;
+    frame.eyeTilt = servos["et"] | 90;
+    frame.headPan = servos["hp"] | 90;
+    frame.headTilt = servos["ht"] | 90;
+    frame.eyeMode = frameObj["em"] | 0;
+    frame.eyeColor = frameObj["ec"] | 0x007FFF;
+    frame.eyeBrightness = frameObj["eb"] | 150;
+    frame.detailMode = frameObj["dm"] | 0;
+    frame.detailColor = frameObj["dc"] | 0x007FFF;
+    frame.detailBrightness = frameObj["db"] | 150;
+    frame.soundFile = frameObj["sf"] | 0;
+    frame.soundFolder = frameObj["so"] | 0;
+    frame.volume = frameObj["v"] | 20;
+  }
+
+  if (frameCount == 0) {
+    delete[] frames;
+    frames = nullptr;
+    errorMessage = "Sequence file contains no frames.";
+    return false;
   }
-
   return true;
 }
 
+// Index record for an open .sqb file. An unreadable header still gives a
+// record (frameCount 0), so the file can be listed and deleted.
+void describeSequenceFile(File& file, const char* name, uint32_t generation, SequenceInfo& info) {
+  memset(&info, 0, sizeof(info));
+  strncpy(info.name, name, MAX_SEQUENCE_NAME_LENGTH - 1);
+  info.fileSize = file.size();
+  info.generation = generation;
+
+  SequenceFileHeader header;
+  String errorMessage;
+  if (readSequenceHeader(file, header, errorMessage)) {
+    info.frameCount = header.frameCount;
+    info.version = header.version;
+    info.flags = header.flags;
+    info.totalDuration = header.totalDuration;
+    info.crc = header.crc;
+  }
+}
+
 bool writeTextFileWithBackup(const String& path, const String& content, String& errorMessage) {
   String tempPath = path + ".tmp";
   String backupPath = path + ".bak";
 
-  if (LittleFS.exists(tempPath)) {
-    LittleFS.remove(tempPath);
+  if (fsExists(tempPath)) {
+    fsRemove(tempPath);
   }
-  if (LittleFS.exists(backupPath)) {
-    LittleFS.remove(backupPath);
+  if (fsExists(backupPath)) {
+    fsRemove(backupPath);
   }
 
-  File file = LittleFS.open(tempPath, "w");
+  File file = fsOpen(tempPath, "w");
   if (!file) {
     errorMessage = "Failed to open temporary file for writing.";
     return false;
@@ -94,31 +178,31 @@ bool writeTextFileWithBackup(const String& path, const String& content, String&
 
   if (file.print(content) != content.length()) {
     file.close();
-    LittleFS.remove(tempPath);
+    fsRemove(tempPath);
     errorMessage = "Failed to write file contents.";
     return false;
   }
 
   file.close();
 
-  bool hadExistingFile = LittleFS.exists(path);
-  if (hadExistingFile && !LittleFS.rename(path, backupPath)) {
-    LittleFS.remove(tempPath);
+  bool hadExistingFile = fsExists(path);
+  if (hadExistingFile && !fsRename(path, backupPath)) {
+    fsRemove(tempPath);
     errorMessage = "Failed to protect existing file before replace.";
     return false;
   }
 
-  if (!LittleFS.rename(tempPath, path)) {
-    if (hadExistingFile && LittleFS.exists(backupPath)) {
-      LittleFS.rename(backupPath, path);
+  if (!fsRename(tempPath, path)) {
+    if (hadExistingFile && fsExists(backupPath)) {
+      fsRename(backupPath, path);
     }
-    LittleFS.remove(tempPath);
+    fsRemove(tempPath);
     errorMessage = "Failed to replace destination file.";
     return false;
   }
 
-  if (LittleFS.exists(backupPath)) {
-    LittleFS.remove(backupPath);
+  if (fsExists(backupPath)) {
+    fsRemove(backupPath);
   }
 
   errorMessage = "";
@@ -126,6 +210,214 @@ bool writeTextFileWithBackup(const String& path, const String& content, String&
 }
 }
 
+// ============================================================================
+// PSRAM SEQUENCE CACHE
+// ============================================================================
+
+SequenceCache::SequenceCache() {
+  for (uint8_t i = 0; i < SEQUENCE_CACHE_ENTRIES; i++) {
+    entries[i].name[0] = '\0';
+    entries[i].frames = nullptr;
+    entries[i].frameCount = 0;
+    entries[i].pins = 0;
+    entries[i].stale = false;
+    entries[i].warm = false;
+    entries[i].lastUsed = 0;
+  }
+  capacityBytes = 0;
+  usedBytes = 0;
+  useClock = 0;
+  hits = 0;
+  misses = 0;
+  enabled = false;
+}
+
+bool SequenceCache::begin() {
+  if (!psramFound()) {
+    Serial.println(F("⚠️ No PSRAM - sequences are streamed from flash"));
+    enabled = false;
+    return false;
+  }
+
+  // Leave at least half of the free PSRAM to everything else
+  size_t budget = ESP.getFreePsram() / 2;
+  capacityBytes = budget < SEQUENCE_CACHE_BYTES ? budget : SEQUENCE_CACHE_BYTES;
+  enabled = capacityBytes >= sizeof(SequenceFrame);
+
+  Serial.print(F("✓ Sequence cache: "));
+  Serial.print(capacityBytes / 1024);
+  Serial.println(F(" KB PSRAM"));
+  return enabled;
+}
+
+SequenceCacheEntry* SequenceCache::find(const char* name) {
+  if (!enabled) {
+    return nullptr;
+  }
+
+  for (uint8_t i = 0; i < SEQUENCE_CACHE_ENTRIES; i++) {
+    SequenceCacheEntry& entry = entries[i];
+    if (entry.frames != nullptr && !entry.stale && strcmp(entry.name, name) == 0) {
+      entry.lastUsed = ++useClock;
+      hits++;
+      metricInc(METRIC_SEQUENCE_CACHE_HITS);
+      return &entry;
+    }
+  }
+
+  misses++;
+  metricInc(METRIC_SEQUENCE_CACHE_MISSES);
+  return nullptr;
+}
+
+bool SequenceCache::contains(const char* name) const {
+  for (uint8_t i = 0; i < SEQUENCE_CACHE_ENTRIES; i++) {
+    const SequenceCacheEntry& entry = entries[i];
+    if (entry.frames != nullptr && !entry.stale && strcmp(entry.name, name) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+SequenceFrame* SequenceCache::allocate(uint16_t frameCount) {
+  size_t bytes = (size_t)frameCount * sizeof(SequenceFrame);
+  if (!enabled || frameCount == 0 || bytes > capacityBytes || !makeRoom(bytes)) {
+    return nullptr;
+  }
+  return (SequenceFrame*)ps_malloc(bytes);
+}
+
+// Takes ownership of frames (from allocate()). nullptr if every slot is taken.
+SequenceCacheEntry* SequenceCache::insert(const char* name, SequenceFrame* frames, uint16_t frameCount, bool warm) {
+  remove(name);
+
+  for (uint8_t i = 0; i < SEQUENCE_CACHE_ENTRIES; i++) {
+    SequenceCacheEntry& entry = entries[i];
+    if (entry.frames != nullptr) {
+      continue;
+    }
+    strncpy(entry.name, name, MAX_SEQUENCE_NAME_LENGTH - 1);
+    entry.name[MAX_SEQUENCE_NAME_LENGTH - 1] = '\0';
+    entry.frames = frames;
+    entry.frameCount = frameCount;
+    entry.pins = 0;
+    entry.stale = false;
+    entry.warm = warm;
+    entry.lastUsed = ++useClock;
+    usedBytes += (size_t)frameCount * sizeof(SequenceFrame);
+    return &entry;
+  }
+  return nullptr;
+}
+
+void SequenceCache::clearWarm() {
+  for (uint8_t i = 0; i < SEQUENCE_CACHE_ENTRIES; i++) {
+    entries[i].warm = false;
+  }
+}
+
+bool SequenceCache::markWarm(const char* name) {
+  for (uint8_t i = 0; i < SEQUENCE_CACHE_ENTRIES; i++) {
+    SequenceCacheEntry& entry = entries[i];
+    if (entry.frames != nullptr && !entry.stale && strcmp(entry.name, name) == 0) {
+      entry.warm = true;
+      return true;
+    }
+  }
+  return false;
+}
+
+void SequenceCache::remove(const char* name) {
+  for (uint8_t i = 0; i < SEQUENCE_CACHE_ENTRIES; i++) {
+    SequenceCacheEntry& entry = entries[i];
+    if (entry.frames == nullptr || entry.stale || strcmp(entry.name, name) != 0) {
+      continue;
+    }
+    if (entry.pins > 0) {
+      entry.stale = true;  // Still playing; freed by the last unpin()
+    } else {
+      release(entry);
+    }
+  }
+}
+
+void SequenceCache::clear() {
+  for (uint8_t i = 0; i < SEQUENCE_CACHE_ENTRIES; i++) {
+    SequenceCacheEntry& entry = entries[i];
+    if (entry.frames == nullptr) {
+      continue;
+    }
+    if (entry.pins > 0) {
+      entry.stale = true;
+    } else {
+      release(entry);
+    }
+  }
+}
+
+void SequenceCache::pin(SequenceCacheEntry* entry) {
+  entry->pins++;
+}
+
+void SequenceCache::unpin(SequenceCacheEntry* entry) {
+  if (entry->pins > 0) {
+    entry->pins--;
+  }
+  if (entry->pins == 0 && entry->stale) {
+    release(*entry);
+  }
+}
+
+uint8_t SequenceCache::getEntryCount() const {
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < SEQUENCE_CACHE_ENTRIES; i++) {
+    if (entries[i].frames != nullptr && !entries[i].stale) {
+      count++;
+    }
+  }
+  return count;
+}
+
+bool SequenceCache::makeRoom(size_t bytes) {
+  while (true) {
+    bool slotFree = false;
+    SequenceCacheEntry* oldest = nullptr;
+    for (uint8_t i = 0; i < SEQUENCE_CACHE_ENTRIES; i++) {
+      SequenceCacheEntry& entry = entries[i];
+      if (entry.frames == nullptr) {
+        slotFree = true;
+      } else if (entry.pins == 0 && !entry.warm &&
+                 (oldest == nullptr || entry.lastUsed < oldest->lastUsed)) {
+        oldest = &entry;
+      }
+    }
+
+    if (slotFree && usedBytes + bytes <= capacityBytes) {
+      return true;
+    }
+    if (oldest == nullptr) {
+      return false;  // Everything left is playing or warm
+    }
+    release(*oldest);
+  }
+}
+
+void SequenceCache::release(SequenceCacheEntry& entry) {
+  usedBytes -= (size_t)entry.frameCount * sizeof(SequenceFrame);
+  free(entry.frames);
+  entry.frames = nullptr;
+  entry.frameCount = 0;
+  entry.name[0] = '\0';
+  entry.pins = 0;
+  entry.stale = false;
+  entry.warm = false;
+}
+
+// ============================================================================
+// SEQUENCE MANAGER
+// ============================================================================
+
 SequenceManager::SequenceManager() {
   recording.state = REC_IDLE;
   recording.frameCount = 0;
@@ -136,7 +428,19 @@ SequenceManager::SequenceManager() {
   playback.isPaused = false;
   playback.currentFrameIndex = 0;
   playback.totalFrames = 0;
-  playback.frames = nullptr;
+  playback.ringHead = 0;
+  playback.ringCount = 0;
+  playback.nextReadFrame = 0;
+  playback.fileCrc = 0;
+  playback.crc = 0;
+  playback.crcTracking = false;
+  playback.streamFailed = false;
+  playback.cached = nullptr;
+  playback.prefetch.cached = nullptr;
+  playback.prefetch.attempted = false;
+  playback.prefetch.ready = false;
+  playback.prefetch.count = 0;
+  playback.lastTransitionGap = 0;
   playback.loop = false;
   playback.soundTriggered = false;
   playback.pauseElapsed = 0;
@@ -147,14 +451,18 @@ SequenceManager::SequenceManager() {
   playback.playlist.loop = false;
   playback.playlist.active = false;
 
+  index = nullptr;
+  indexCount = 0;
+  indexCapacity = 0;
+  indexGeneration = 0;
+
   sdAvailable = false;
+  cacheWarmPending = false;
 }
 
 SequenceManager::~SequenceManager() {
-  if (playback.frames != nullptr) {
-    delete[] playback.frames;
-    playback.frames = nullptr;
-  }
+  closePlaybackStream();
+  delete[] index;
   if (recording.frames != nullptr) {
     delete[] recording.frames;
     recording.frames = nullptr;
@@ -162,6 +470,8 @@ SequenceManager::~SequenceManager() {
 }
 
 bool SequenceManager::begin() {
+  cache.begin();
+
   // Initialize LittleFS
   if (!LittleFS.begin(false)) {
     Serial.println(F("⚠️ LittleFS mount failed - sequences disabled"));
@@ -183,6 +493,11 @@ bool SequenceManager::begin() {
     return false;
   }
 
+  if (!loadSequenceIndex()) {
+    rebuildSequenceIndex();
+  }
+  migrateLegacySequences();
+
   Serial.println(F("  Storage: ESP32-S3-Zero 4MB Flash (~1.5-2MB for sequences)"));
   return true;
 }
@@ -196,6 +511,7 @@ bool SequenceManager::formatStorage() {
     cancelRecording();
   }
 
+  cache.clear();
   LittleFS.end();
 
   if (!LittleFS.format()) {
@@ -221,24 +537,101 @@ bool SequenceManager::formatStorage() {
   playback.playlist.loop = false;
   playback.playlist.active = false;
 
+  indexGeneration++;
+  indexCount = 0;
+  writeSequenceIndex();
+
   Serial.println(F("LittleFS formatted. Sequence storage is ready."));
   return true;
 }
 
 bool SequenceManager::ensureSequenceDir() {
-  if (!LittleFS.exists(SEQUENCES_DIR)) {
-    return LittleFS.mkdir(SEQUENCES_DIR);
+  if (!fsExists(SEQUENCES_DIR)) {
+    return fsMkdir(SEQUENCES_DIR);
   }
   return true;
 }
 
 bool SequenceManager::ensurePlaylistDir() {
-  if (!LittleFS.exists(PLAYLISTS_DIR)) {
-    return LittleFS.mkdir(PLAYLISTS_DIR);
+  if (!fsExists(PLAYLISTS_DIR)) {
+    return fsMkdir(PLAYLISTS_DIR);
   }
   return true;
 }
 
+// Converts JSON .seq files left by older firmware into .sqb, one per pass so
+// the directory is never modified while it is being listed
+void SequenceManager::migrateLegacySequences() {
+  uint16_t converted = 0;
+
+  while (true) {
+    String legacyName;
+    File dir = fsOpen(SEQUENCES_DIR);
+    if (!dir) {
+      return;
+    }
+    File entry = dir.openNextFile();
+    while (entry) {
+      if (!entry.isDirectory()) {
+        String filename = String(entry.name());
+        int lastSlash = filename.lastIndexOf('/');
+        if (lastSlash >= 0) {
+          filename = filename.substring(lastSlash + 1);
+        }
+        if (filename.endsWith(SEQUENCE_LEGACY_EXTENSION)) {
+          legacyName = filename.substring(0, filename.length() - strlen(SEQUENCE_LEGACY_EXTENSION));
+          entry.close();
+          break;
+        }
+      }
+      entry.close();
+      entry = dir.openNextFile();
+    }
+    dir.close();
+
+    if (legacyName.length() == 0) {
+      break;
+    }
+
+    String legacyPath = String(SEQUENCES_DIR) + "/" + legacyName + SEQUENCE_LEGACY_EXTENSION;
+    SequenceFrame* frames = nullptr;
+    uint16_t frameCount = 0;
+    String errorMessage;
+    bool ok = isValidSequenceName(legacyName.c_str()) &&
+              loadLegacySequence(legacyPath, frames, frameCount, errorMessage);
+    if (ok && !sequenceExists(legacyName.c_str())) {
+      ok = saveSequenceToSD(legacyName.c_str(), frames, frameCount);
+      if (!ok) {
+        errorMessage = "Could not write the converted file.";
+      }
+    }
+    delete[] frames;
+
+    // Either way the .seq must go, or the next pass would find it again
+    bool cleaned;
+    if (ok) {
+      cleaned = fsRemove(legacyPath);
+      converted++;
+    } else {
+      Serial.print(F("⚠️ Could not convert sequence '"));
+      Serial.print(legacyName);
+      Serial.print(F("': "));
+      Serial.println(errorMessage.length() > 0 ? errorMessage : String("Invalid sequence name."));
+      cleaned = fsRename(legacyPath, legacyPath + ".bad");
+    }
+    if (!cleaned) {
+      Serial.println(F("⚠️ Legacy sequence cleanup failed - conversion stopped"));
+      break;
+    }
+  }
+
+  if (converted > 0) {
+    Serial.print(F("✓ Converted "));
+    Serial.print(converted);
+    Serial.println(F(" sequence(s) to the binary format"));
+  }
+}
+
 bool SequenceManager::isValidSequenceName(const char* name) const {
   if (name == nullptr) {
     return false;
@@ -264,7 +657,7 @@ bool SequenceManager::isValidSequenceName(const char* name) const {
 }
 
 String SequenceManager::getSequencePath(const char* name) {
-  String path = String(SEQUENCES_DIR) + "/" + String(name) + ".seq";
+  String path = String(SEQUENCES_DIR) + "/" + String(name) + SEQUENCE_FILE_EXTENSION;
   return path;
 }
 
@@ -409,6 +802,8 @@ bool SequenceManager::addCurrentStateAsFrame(uint16_t duration) {
 }
 
 void SequenceManager::captureCurrentState(SequenceFrame& frame) {
+  memset(&frame, 0, sizeof(frame));  // Records are written raw, padding included
+
   // Capture current servo positions from ServoState structures
   frame.eyePan = eyePan.currentPosition;
   frame.eyeTilt = eyeTilt.currentPosition;
@@ -494,7 +889,7 @@ bool SequenceManager::cancelRecording() {
 // PLAYBACK FUNCTIONS
 // ============================================================================
 
-bool SequenceManager::playSequence(const char* name, bool loop, bool preservePlaylist) {
+bool SequenceManager::playSequence(const char* name, bool loop, bool preservePlaylist, uint16_t startFrame) {
   if (!sdAvailable) {
     Serial.println(F("❌ SD card not available"));
     return false;
@@ -514,15 +909,16 @@ bool SequenceManager::playSequence(const char* name, bool loop, bool preservePla
     stopPlayback(preservePlaylist);
   }
 
-  // Load sequence from SD
-  SequenceFrame* frames = nullptr;
-  uint16_t frameCount = 0;
-
-  if (!loadSequenceFromSD(name, frames, frameCount)) {
+  // Open the file and read the first few frames; the rest follows while playing
+  playback.loop = loop;
+  unsigned long loadStart = micros();
+  if (!openPlaybackStream(name, startFrame)) {
+    metricInc(METRIC_SEQUENCE_LOAD_FAILURES);
     Serial.print(F("❌ Failed to load sequence: "));
     Serial.println(name);
     return false;
   }
+  metricObserve(METRIC_SEQUENCE_LOAD, micros() - loadStart);
 
   // Initialize playback
   playback.isPlaying = true;
@@ -531,11 +927,7 @@ bool SequenceManager::playSequence(const char* name, bool loop, bool preservePla
   playback.pauseElapsed = 0;
   strncpy(playback.currentSequenceName, name, MAX_SEQUENCE_NAME_LENGTH - 1);
   playback.currentSequenceName[MAX_SEQUENCE_NAME_LENGTH - 1] = '\0';
-  playback.currentFrameIndex = 0;
-  playback.totalFrames = frameCount;
   playback.frameStartTime = millis();
-  playback.loop = loop;
-  playback.frames = frames;
 
   Serial.print(F("▶️ Playing: "));
   Serial.print(name);
@@ -545,81 +937,396 @@ bool SequenceManager::playSequence(const char* name, bool loop, bool preservePla
     Serial.println();
   }
 
-  // Apply first frame immediately (LEDs, details, sound, servos)
-  if (frameCount > 0) {
-    SequenceFrame& first = frames[0];
-    eyePan.targetPosition = first.eyePan;
-    eyePan.isMoving = true;
-    eyeTilt.targetPosition = first.eyeTilt;
-    eyeTilt.isMoving = true;
-    headPan.targetPosition = first.headPan;
-    headPan.isMoving = true;
-    headTilt.targetPosition = first.headTilt;
-    headTilt.isMoving = true;
+  // Apply the start frame immediately (LEDs, details, sound, servos)
+  SequenceFrame& first = playback.ring[playback.ringHead];
+  eyePan.targetPosition = first.eyePan;
+  eyePan.isMoving = true;
+  eyeTilt.targetPosition = first.eyeTilt;
+  eyeTilt.isMoving = true;
+  headPan.targetPosition = first.headPan;
+  headPan.isMoving = true;
+  headTilt.targetPosition = first.headTilt;
+  headTilt.isMoving = true;
+
+  if (first.eyeMode < 14) {
+    currentPixelMode = static_cast<PixelMode>(first.eyeMode);
+    setEyeColor(first.eyeColor, first.eyeColor);
+    setEyeBrightness(first.eyeBrightness);
+  }
+  if (first.detailMode < 5) {
+    setDetailPattern(static_cast<DetailPattern>(first.detailMode));
+    setDetailColor((first.detailColor >> 16) & 0xFF,
+                   (first.detailColor >> 8) & 0xFF,
+                   first.detailColor & 0xFF);
+    setDetailBrightness(first.detailBrightness);
+  }
+  if (first.soundFile > 0) {
+    audioPlayFolderTrack(first.soundFolder, first.soundFile);
+    if (first.volume > 0) audioSetVolume(first.volume);
+    playback.soundTriggered = true;
+  }
+
+  return true;
+}
 
-    if (first.eyeMode < 14) {
-      currentPixelMode = static_cast<PixelMode>(first.eyeMode);
-      setEyeColor(first.eyeColor, first.eyeColor);
-      setEyeBrightness(first.eyeBrightness);
+// Positions the stream at startFrame (0 if out of range) and fills the ring.
+// playback.loop must already be set, the ring wraps to record 0 when looping.
+// A sequence that is not cached yet is loaded into the cache if it fits,
+// otherwise it is read from the file as it plays.
+bool SequenceManager::openPlaybackStream(const char* name, uint16_t startFrame) {
+  closePlaybackStream();
+
+  File file;
+  uint16_t frameCount;
+  uint32_t fileCrc = 0;
+  SequenceCacheEntry* entry = cache.find(name);
+  if (entry != nullptr) {
+    frameCount = entry->frameCount;
+  } else {
+    String path = getSequencePath(name);
+    file = fsOpen(path, "r");
+    if (!file) {
+      Serial.print(F("❌ File not found: "));
+      Serial.println(path);
+      return false;
+    }
+
+    SequenceFileHeader header;
+    String errorMessage;
+    if (!readSequenceHeader(file, header, errorMessage) ||
+        !cacheSequenceFrames(name, file, header, entry, errorMessage)) {
+      file.close();
+      Serial.print(F("❌ Invalid sequence file '"));
+      Serial.print(name);
+      Serial.print(F("': "));
+      Serial.println(errorMessage);
+      return false;
     }
-    if (first.detailMode < 5) {
-      setDetailPattern(static_cast<DetailPattern>(first.detailMode));
-      setDetailColor((first.detailColor >> 16) & 0xFF,
-                     (first.detailColor >> 8) & 0xFF,
-                     first.detailColor & 0xFF);
-      setDetailBrightness(first.detailBrightness);
+    frameCount = header.frameCount;
+    fileCrc = header.crc;
+    if (entry != nullptr) {
+      file.close();
     }
-    if (first.soundFile > 0) {
-      mp3.playFolderTrack(first.soundFolder, first.soundFile);
-      if (first.volume > 0) mp3.setVolume(first.volume);
-      playback.soundTriggered = true;
+  }
+
+  if (startFrame >= frameCount) {
+    startFrame = 0;
+  }
+  if (entry != nullptr) {
+    cache.pin(entry);
+    playback.cached = entry;
+  } else {
+    if (startFrame > 0 && !file.seek(sizeof(SequenceFileHeader) + (size_t)startFrame * sizeof(SequenceFrame))) {
+      file.close();
+      Serial.println(F("❌ Could not seek to the start frame"));
+      return false;
     }
+    playback.file = file;
   }
 
+  playback.totalFrames = frameCount;
+  playback.currentFrameIndex = startFrame;
+  playback.nextReadFrame = startFrame;
+  playback.fileCrc = fileCrc;
+  playback.crc = 0;
+  playback.crcTracking = (entry == nullptr && startFrame == 0);  // Cached frames were checked on load
+  playback.streamFailed = false;
+
+  refillPlaybackRing();
+  if (playback.ringCount == 0) {
+    closePlaybackStream();
+    return false;
+  }
   return true;
 }
 
-void SequenceManager::updatePlayback() {
-  if (!playback.isPlaying || playback.frames == nullptr) {
+void SequenceManager::closePlaybackStream() {
+  if (playback.file) {
+    playback.file.close();
+  }
+  if (playback.cached != nullptr) {
+    cache.unpin(playback.cached);
+    playback.cached = nullptr;
+  }
+  discardPrefetch();
+  playback.ringHead = 0;
+  playback.ringCount = 0;
+  playback.nextReadFrame = 0;
+  playback.streamFailed = false;
+}
+
+// Reads records into the free ring slots. Each frame is range-checked as it
+// arrives; the CRC can only be compared once the last record has been read,
+// so a damaged file plays up to that point and then stops instead of looping.
+void SequenceManager::refillPlaybackRing() {
+  while (!playback.streamFailed && playback.ringCount < SEQUENCE_PLAYBACK_RING) {
+    if (playback.nextReadFrame >= playback.totalFrames) {
+      if (playback.crcTracking && playback.crc != playback.fileCrc) {
+        Serial.print(F("⚠️ CRC mismatch in '"));
+        Serial.print(playback.currentSequenceName);
+        Serial.println(F("' - file is damaged"));
+        playback.streamFailed = true;
+        return;
+      }
+      if (!playback.loop) {
+        return;
+      }
+      if (playback.cached == nullptr && !playback.file.seek(sizeof(SequenceFileHeader))) {
+        playback.streamFailed = true;
+        return;
+      }
+      playback.nextReadFrame = 0;
+      playback.crc = 0;
+      playback.crcTracking = (playback.cached == nullptr);
+    }
+
+    SequenceFrame& frame = playback.ring[(playback.ringHead + playback.ringCount) % SEQUENCE_PLAYBACK_RING];
+    if (playback.cached != nullptr) {
+      frame = playback.cached->frames[playback.nextReadFrame];
+    } else {
+      if (playback.file.read((uint8_t*)&frame, sizeof(frame)) != sizeof(frame) || !validateFrame(frame)) {
+        Serial.print(F("⚠️ Unreadable frame "));
+        Serial.print(playback.nextReadFrame + 1);
+        Serial.println(F(" in sequence file"));
+        playback.streamFailed = true;
+        return;
+      }
+      if (playback.crcTracking) {
+        playback.crc = sequenceCrc32(playback.crc, &frame, sizeof(frame));
+      }
+    }
+    playback.nextReadFrame++;
+    playback.ringCount++;
+  }
+}
+
+// Reads all records of a file positioned after its header into a new cache
+// entry. False only if the file is damaged. entry stays nullptr (and the
+// file where it was) if the sequence is too long or there is no room.
+bool SequenceManager::cacheSequenceFrames(const char* name, File& file, const SequenceFileHeader& header,
+                                          SequenceCacheEntry*& entry, String& errorMessage, bool warm) {
+  entry = nullptr;
+  if (header.frameCount > SEQUENCE_CACHE_MAX_FRAMES) {
+    return true;
+  }
+  SequenceFrame* frames = cache.allocate(header.frameCount);
+  if (frames == nullptr) {
+    return true;
+  }
+
+  size_t length = (size_t)header.frameCount * sizeof(SequenceFrame);
+  if (file.read((uint8_t*)frames, length) != length) {
+    free(frames);
+    errorMessage = "Sequence file could not be read.";
+    return false;
+  }
+  if (sequenceCrc32(0, frames, length) != header.crc) {
+    free(frames);
+    errorMessage = "CRC mismatch - file is damaged.";
+    return false;
+  }
+  for (uint16_t i = 0; i < header.frameCount; i++) {
+    if (!validateFrame(frames[i])) {
+      free(frames);
+      errorMessage = String("Frame ") + (i + 1) + " is out of range.";
+      return false;
+    }
+  }
+
+  entry = cache.insert(name, frames, header.frameCount, warm);
+  if (entry == nullptr) {
+    free(frames);
+    if (!file.seek(sizeof(SequenceFileHeader))) {
+      errorMessage = "Sequence file could not be read.";
+      return false;
+    }
+  }
+  return true;
+}
+
+// Opens the item after the current one and reads its first frames, so the
+// switch at the end of this sequence is a copy. Failures stay quiet here;
+// the regular load at the boundary reports them.
+void SequenceManager::prefetchNextPlaylistItem() {
+  PlaylistPrefetch& next = playback.prefetch;
+  next.attempted = true;
+
+  uint8_t index = playback.playlist.currentIndex + 1;
+  if (index >= playback.playlist.count) {
+    if (!playback.playlist.loop || playback.playlist.count == 0) {
+      return;  // Last item
+    }
+    index = 0;
+  }
+
+  const char* name = playback.playlist.sequences[index];
+  if (!isValidSequenceName(name)) {
     return;
   }
 
-  // Skip update if paused
-  if (playback.isPaused) {
+  // A cached item needs no file at all
+  SequenceCacheEntry* entry = cache.find(name);
+  if (entry != nullptr) {
+    uint8_t count = entry->frameCount < SEQUENCE_PLAYBACK_RING ? entry->frameCount : SEQUENCE_PLAYBACK_RING;
+    memcpy(next.frames, entry->frames, (size_t)count * sizeof(SequenceFrame));
+    cache.pin(entry);
+    next.cached = entry;
+    next.playlistIndex = index;
+    strncpy(next.name, name, MAX_SEQUENCE_NAME_LENGTH - 1);
+    next.name[MAX_SEQUENCE_NAME_LENGTH - 1] = '\0';
+    next.count = count;
+    next.totalFrames = entry->frameCount;
+    next.fileCrc = 0;
+    next.crc = 0;
+    next.ready = true;
     return;
   }
 
-  // Bounds check - prevent array out-of-bounds access
-  if (playback.currentFrameIndex >= playback.totalFrames) {
-    stopPlayback();
-    Serial.println(F("⚠️ Frame index out of bounds, stopping playback"));
+  File file = fsOpen(getSequencePath(name), "r");
+  if (!file) {
     return;
   }
 
-  // Check if current frame duration has elapsed
-  SequenceFrame& currentFrame = playback.frames[playback.currentFrameIndex];
-  unsigned long elapsed = millis() - playback.frameStartTime;
-  bool newFrame = false;
+  SequenceFileHeader header;
+  String errorMessage;
+  if (!readSequenceHeader(file, header, errorMessage)) {
+    file.close();
+    return;
+  }
 
-  if (elapsed >= currentFrame.duration) {
-    // Move to next frame
-    playback.currentFrameIndex++;
-    playback.soundTriggered = false;  // Reset sound trigger for new frame
-    newFrame = true;
+  uint8_t count = header.frameCount < SEQUENCE_PLAYBACK_RING ? header.frameCount : SEQUENCE_PLAYBACK_RING;
+  size_t length = (size_t)count * sizeof(SequenceFrame);
+  if (file.read((uint8_t*)next.frames, length) != length) {
+    file.close();
+    return;
+  }
+  for (uint8_t i = 0; i < count; i++) {
+    if (!validateFrame(next.frames[i])) {
+      file.close();
+      return;
+    }
+  }
 
-    // Check if sequence is complete
-    if (playback.currentFrameIndex >= playback.totalFrames) {
-      // Check if playlist is active
-      if (playback.playlist.active) {
-        // Move to next sequence in playlist
-        uint8_t nextIndex = playback.playlist.currentIndex + 1;
+  next.file = file;
+  next.playlistIndex = index;
+  strncpy(next.name, name, MAX_SEQUENCE_NAME_LENGTH - 1);
+  next.name[MAX_SEQUENCE_NAME_LENGTH - 1] = '\0';
+  next.count = count;
+  next.totalFrames = header.frameCount;
+  next.fileCrc = header.crc;
+  next.crc = sequenceCrc32(0, next.frames, length);
+  next.ready = true;
+}
 
-        if (nextIndex >= playback.playlist.count) {
-          // Playlist complete
-          if (playback.playlist.loop) {
-            // Loop playlist
-            nextIndex = 0;
-          } else {
+// Makes the prefetched item the playing sequence if it is still the one that
+// comes next. Its first frame starts at startTime, where the last one ended.
+bool SequenceManager::takePrefetchedSequence(uint8_t playlistIndex, unsigned long startTime) {
+  PlaylistPrefetch& next = playback.prefetch;
+  if (!next.ready || next.playlistIndex != playlistIndex ||
+      strcmp(next.name, playback.playlist.sequences[playlistIndex]) != 0) {
+    discardPrefetch();
+    return false;
+  }
+
+  if (playback.file) {
+    playback.file.close();
+  }
+  if (playback.cached != nullptr) {
+    cache.unpin(playback.cached);
+  }
+  playback.file = next.file;
+  next.file = File();
+  playback.cached = next.cached;  // The pin moves along
+  next.cached = nullptr;
+
+  memcpy(playback.ring, next.frames, (size_t)next.count * sizeof(SequenceFrame));
+  playback.ringHead = 0;
+  playback.ringCount = next.count;
+  playback.nextReadFrame = next.count;
+  playback.totalFrames = next.totalFrames;
+  playback.currentFrameIndex = 0;
+  playback.fileCrc = next.fileCrc;
+  playback.crc = next.crc;
+  playback.crcTracking = (playback.cached == nullptr);
+  playback.streamFailed = false;
+  playback.loop = false;
+  playback.frameStartTime = startTime;
+  strncpy(playback.currentSequenceName, next.name, MAX_SEQUENCE_NAME_LENGTH - 1);
+  playback.currentSequenceName[MAX_SEQUENCE_NAME_LENGTH - 1] = '\0';
+
+  next.ready = false;
+  next.attempted = false;
+  return true;
+}
+
+void SequenceManager::discardPrefetch() {
+  if (playback.prefetch.file) {
+    playback.prefetch.file.close();
+  }
+  if (playback.prefetch.cached != nullptr) {
+    cache.unpin(playback.prefetch.cached);
+    playback.prefetch.cached = nullptr;
+  }
+  playback.prefetch.ready = false;
+  playback.prefetch.attempted = false;
+}
+
+void SequenceManager::updatePlayback() {
+  if (!playback.isPlaying) {
+    return;
+  }
+
+  // Skip update if paused
+  if (playback.isPaused) {
+    return;
+  }
+
+  // Read ahead while the current frame holds (nothing to do once the ring is full)
+  refillPlaybackRing();
+
+  // Once this file has been read to the end, the next playlist item is next
+  if (playback.playlist.active && !playback.loop && !playback.prefetch.attempted &&
+      playback.nextReadFrame >= playback.totalFrames) {
+    prefetchNextPlaylistItem();
+  }
+
+  // Bounds check - the ring always holds the current frame while playing
+  if (playback.ringCount == 0 || playback.currentFrameIndex >= playback.totalFrames) {
+    stopPlayback();
+    Serial.println(F("⚠️ Frame index out of bounds, stopping playback"));
+    return;
+  }
+
+  // Check if current frame duration has elapsed
+  SequenceFrame& currentFrame = playback.ring[playback.ringHead];
+  unsigned long elapsed = millis() - playback.frameStartTime;
+  bool newFrame = false;
+
+  if (elapsed >= currentFrame.duration) {
+    unsigned long transitionStart = micros();
+    unsigned long frameEnd = playback.frameStartTime + currentFrame.duration;
+    uint32_t lateMs = elapsed - currentFrame.duration;
+
+    // Move to next frame
+    playback.currentFrameIndex++;
+    playback.ringHead = (playback.ringHead + 1) % SEQUENCE_PLAYBACK_RING;
+    playback.ringCount--;
+    playback.soundTriggered = false;  // Reset sound trigger for new frame
+    newFrame = true;
+
+    // Check if sequence is complete
+    if (playback.currentFrameIndex >= playback.totalFrames) {
+      // Check if playlist is active
+      if (playback.playlist.active) {
+        // Move to next sequence in playlist
+        uint8_t nextIndex = playback.playlist.currentIndex + 1;
+
+        if (nextIndex >= playback.playlist.count) {
+          // Playlist complete
+          if (playback.playlist.loop) {
+            // Loop playlist
+            nextIndex = 0;
+          } else {
             // Stop playback
             playback.playlist.active = false;
             stopPlayback();
@@ -641,27 +1348,34 @@ void SequenceManager::updatePlayback() {
         Serial.print(F("⏭️ Next in playlist: "));
         Serial.println(nextSeq);
 
-        // Stop current and play next
-        if (playback.frames != nullptr) {
-          delete[] playback.frames;
-          playback.frames = nullptr;
-        }
-        if (!playSequence(nextSeq, false, true)) {
-          playback.playlist.active = false;
-          playback.playlist.loop = false;
-          playback.playlist.currentIndex = 0;
-          playback.isPaused = false;
-          playback.pauseElapsed = 0;
-          playback.soundTriggered = false;
-          playback.currentFrameIndex = 0;
-          playback.totalFrames = 0;
-          playback.loop = false;
-          playback.currentSequenceName[0] = '\0';
-          Serial.println(F("Playlist stopped - failed to load next sequence."));
+        // Swap in the prefetched item at the frame boundary; its first
+        // frame is applied below like any other new frame
+        if (takePrefetchedSequence(nextIndex, frameEnd)) {
+          playback.playlist.currentIndex = nextIndex;
+          playback.lastTransitionGap = lateMs * 1000UL + (micros() - transitionStart);
+          metricObserve(METRIC_PLAYLIST_GAP, playback.lastTransitionGap);
+        } else {
+          // Not prefetched (or the playlist changed): stop current and play next
+          metricInc(METRIC_PLAYLIST_PREFETCH_MISSES);
+          if (!playSequence(nextSeq, false, true)) {
+            playback.playlist.active = false;
+            playback.playlist.loop = false;
+            playback.playlist.currentIndex = 0;
+            playback.isPaused = false;
+            playback.pauseElapsed = 0;
+            playback.soundTriggered = false;
+            playback.currentFrameIndex = 0;
+            playback.totalFrames = 0;
+            playback.loop = false;
+            playback.currentSequenceName[0] = '\0';
+            Serial.println(F("Playlist stopped - failed to load next sequence."));
+            return;
+          }
+          playback.playlist.currentIndex = nextIndex;
+          playback.lastTransitionGap = lateMs * 1000UL + (micros() - transitionStart);
+          metricObserve(METRIC_PLAYLIST_GAP, playback.lastTransitionGap);
           return;
         }
-        playback.playlist.currentIndex = nextIndex;
-        return;
 
       } else if (playback.loop) {
         // Loop single sequence
@@ -677,10 +1391,20 @@ void SequenceManager::updatePlayback() {
     } else {
       playback.frameStartTime = millis();
     }
+
+    // Ring drained: the reads fell behind or the file went bad
+    if (playback.ringCount == 0) {
+      refillPlaybackRing();
+      if (playback.ringCount == 0) {
+        stopPlayback();
+        Serial.println(F("⚠️ Sequence file could not be read, stopping playback"));
+        return;
+      }
+    }
   }
 
   // Get current frame
-  SequenceFrame& frame = playback.frames[playback.currentFrameIndex];
+  SequenceFrame& frame = playback.ring[playback.ringHead];
 
   // Servo targets are set every loop for smooth interpolated movement
   if (eyePan.targetPosition != frame.eyePan) {
@@ -724,9 +1448,9 @@ void SequenceManager::updatePlayback() {
 
   // Trigger sound if specified
   if (frame.soundFile > 0 && !playback.soundTriggered) {
-    mp3.playFolderTrack(frame.soundFolder, frame.soundFile);
+    audioPlayFolderTrack(frame.soundFolder, frame.soundFile);
     if (frame.volume > 0) {
-      mp3.setVolume(frame.volume);
+      audioSetVolume(frame.volume);
     }
     playback.soundTriggered = true;
   }
@@ -742,11 +1466,7 @@ bool SequenceManager::stopPlayback(bool preservePlaylist) {
     playback.playlist.active = false;  // Deactivate playlist if active
   }
 
-  // Free memory
-  if (playback.frames != nullptr) {
-    delete[] playback.frames;
-    playback.frames = nullptr;
-  }
+  closePlaybackStream();
 
   Serial.println(F("⏹️ Playback stopped"));
   return true;
@@ -783,6 +1503,72 @@ float SequenceManager::getPlaybackProgress() {
   return (float)playback.currentFrameIndex / (float)playback.totalFrames;
 }
 
+// Loads the sequences a remote button or the playlist can start into the
+// cache, so starting them touches no file. Requested at boot and whenever the
+// IR mappings, the playlist or one of the files change, and run from the loop.
+// Cached ones are only re-marked; once the cache is full of warm entries the
+// rest stay streamed rather than evicting what this pass just loaded.
+void SequenceManager::warmSequenceCache() {
+  if (!sdAvailable || !cache.isEnabled()) {
+    return;
+  }
+
+  cache.clearWarm();  // Sequences no longer mapped become ordinary LRU entries
+  uint8_t buttonCount = config.buttonCount < 21 ? config.buttonCount : 21;
+  for (uint8_t i = 0; i < buttonCount + playback.playlist.count; i++) {
+    char name[MAX_SEQUENCE_NAME_LENGTH];
+    strncpy(name, i < buttonCount ? config.buttons[i].sequenceName : playback.playlist.sequences[i - buttonCount],
+            MAX_SEQUENCE_NAME_LENGTH - 1);
+    name[MAX_SEQUENCE_NAME_LENGTH - 1] = '\0';
+    if (!isValidSequenceName(name) || cache.markWarm(name) || findIndexEntry(name) == nullptr) {
+      continue;  // Mapped but not recorded yet, or cached already
+    }
+
+    File file = fsOpen(getSequencePath(name), "r");
+    if (!file) {
+      continue;
+    }
+    SequenceFileHeader header;
+    SequenceCacheEntry* entry = nullptr;
+    String errorMessage;
+    if (!readSequenceHeader(file, header, errorMessage) ||
+        !cacheSequenceFrames(name, file, header, entry, errorMessage, true)) {
+      Serial.print(F("⚠️ Not cached '"));
+      Serial.print(name);
+      Serial.print(F("': "));
+      Serial.println(errorMessage);
+    } else if (entry == nullptr && header.frameCount <= SEQUENCE_CACHE_MAX_FRAMES) {
+      file.close();
+      Serial.println(F("⚠️ Sequence cache full - remaining mapped sequences are streamed"));
+      return;
+    }
+    file.close();
+  }
+}
+
+void SequenceManager::updateCacheWarm() {
+  if (!cacheWarmPending) {
+    return;
+  }
+  cacheWarmPending = false;
+  warmSequenceCache();
+}
+
+// A sequence file was written, renamed or removed
+void SequenceManager::sequenceChanged(const char* name) {
+  indexGeneration++;
+  SequenceInfo info;
+  if (readIndexEntry(name, info)) {
+    storeIndexEntry(info);
+  } else {
+    removeIndexEntry(name);
+  }
+  writeSequenceIndex();
+
+  cache.remove(name);
+  requestCacheWarm();
+}
+
 // ============================================================================
 // SEQUENCE MANAGEMENT
 // ============================================================================
@@ -801,17 +1587,22 @@ bool SequenceManager::deleteSequence(const char* name) {
     Serial.println(F("Stopping playback before delete."));
     stopPlayback();
   }
+  if (playback.prefetch.ready && strcmp(playback.prefetch.name, name) == 0) {
+    discardPrefetch();  // The transition then reports it missing
+  }
 
   String path = getSequencePath(name);
-  if (!LittleFS.exists(path)) {
+  if (!fsExists(path)) {
     Serial.print(F("❌ Sequence not found: "));
     Serial.println(name);
     return false;
   }
 
-  if (LittleFS.remove(path)) {
+  beginSequenceChange();
+  if (fsRemove(path)) {
     Serial.print(F("🗑️ Deleted: "));
     Serial.println(name);
+    sequenceChanged(name);
     return true;
   }
 
@@ -827,8 +1618,7 @@ bool SequenceManager::sequenceExists(const char* name) {
     return false;
   }
 
-  String path = getSequencePath(name);
-  return LittleFS.exists(path);
+  return findIndexEntry(name) != nullptr;
 }
 
 bool SequenceManager::duplicateSequence(const char* sourceName, const char* targetName) {
@@ -851,24 +1641,71 @@ bool SequenceManager::duplicateSequence(const char* sourceName, const char* targ
     return false;
   }
 
-  SequenceFrame* frames = nullptr;
-  uint16_t frameCount = 0;
-  if (!loadSequenceFromSD(sourceName, frames, frameCount)) {
+  File source = fsOpen(getSequencePath(sourceName), "r");
+  if (!source) {
+    Serial.println(F("Source sequence could not be opened."));
     return false;
   }
 
-  bool saved = saveSequenceToSD(targetName, frames, frameCount);
-  delete[] frames;
+  SequenceFileHeader header;
+  String errorMessage;
+  if (!readSequenceHeader(source, header, errorMessage)) {
+    source.close();
+    Serial.print(F("❌ "));
+    Serial.println(errorMessage);
+    return false;
+  }
 
-  if (saved) {
-    Serial.print(F("Duplicated sequence '"));
-    Serial.print(sourceName);
-    Serial.print(F("' to '"));
-    Serial.print(targetName);
-    Serial.println(F("'"));
+  size_t freeSpace = LittleFS.totalBytes() - LittleFS.usedBytes();
+  if (freeSpace < source.size() + 1024) {  // Keep 1KB safety margin
+    source.close();
+    Serial.println(F("❌ Insufficient storage for the copy"));
+    return false;
   }
 
-  return saved;
+  // Copied record by record (any length), checked against the source CRC
+  String targetPath = getSequencePath(targetName);
+  String tempPath = targetPath + ".tmp";
+  File target = fsOpen(tempPath, "w");
+  if (!target) {
+    source.close();
+    Serial.println(F("❌ Failed to open file for writing"));
+    return false;
+  }
+
+  SequenceFileHeader copy;
+  fillSequenceHeader(copy, targetName, header.frameCount, header.totalDuration, header.flags, header.crc);
+  bool copied = target.write((const uint8_t*)&copy, sizeof(copy)) == sizeof(copy);
+
+  uint8_t buffer[SEQUENCE_PLAYBACK_RING * sizeof(SequenceFrame)];
+  size_t remaining = (size_t)header.frameCount * sizeof(SequenceFrame);
+  uint32_t crc = 0;
+  while (copied && remaining > 0) {
+    size_t chunk = remaining < sizeof(buffer) ? remaining : sizeof(buffer);
+    copied = source.read(buffer, chunk) == chunk && target.write(buffer, chunk) == chunk;
+    crc = sequenceCrc32(crc, buffer, chunk);
+    remaining -= chunk;
+  }
+  source.close();
+  target.close();
+
+  if (copied && crc == header.crc) {
+    beginSequenceChange();
+  }
+  if (!copied || crc != header.crc || !fsRename(tempPath, targetPath)) {
+    fsRemove(tempPath);
+    Serial.println(copied && crc != header.crc ? F("❌ Source sequence is damaged (CRC mismatch)")
+                                               : F("❌ Failed to write the copy"));
+    return false;
+  }
+
+  Serial.print(F("Duplicated sequence '"));
+  Serial.print(sourceName);
+  Serial.print(F("' to '"));
+  Serial.print(targetName);
+  Serial.println(F("'"));
+  sequenceChanged(targetName);
+  return true;
 }
 
 bool SequenceManager::renameSequence(const char* oldName, const char* newName) {
@@ -884,16 +1721,43 @@ bool SequenceManager::renameSequence(const char* oldName, const char* newName) {
   String oldPath = getSequencePath(oldName);
   String newPath = getSequencePath(newName);
 
-  if (!LittleFS.exists(oldPath)) {
+  if (!fsExists(oldPath)) {
     return false;
   }
 
-  if (LittleFS.exists(newPath)) {
+  if (fsExists(newPath)) {
     Serial.println(F("❌ Target name already exists"));
     return false;
   }
 
-  return LittleFS.rename(oldPath, newPath);
+  if (playback.isPlaying && strcmp(playback.currentSequenceName, oldName) == 0) {
+    Serial.println(F("Stopping playback before rename."));
+    stopPlayback();
+  }
+  if (playback.prefetch.ready && strcmp(playback.prefetch.name, oldName) == 0) {
+    discardPrefetch();
+  }
+
+  beginSequenceChange();
+  if (!fsRename(oldPath, newPath)) {
+    return false;
+  }
+
+  // The header carries the name as well (outside the CRC); the file name
+  // stays authoritative if this fails
+  char headerName[MAX_SEQUENCE_NAME_LENGTH] = {};
+  strncpy(headerName, newName, MAX_SEQUENCE_NAME_LENGTH - 1);
+  File file = fsOpen(newPath, "r+");
+  if (!file || !file.seek(offsetof(SequenceFileHeader, name)) ||
+      file.write((const uint8_t*)headerName, sizeof(headerName)) != sizeof(headerName)) {
+    Serial.println(F("⚠️ Renamed, but the name inside the file was not updated"));
+  }
+  if (file) {
+    file.close();
+  }
+  sequenceChanged(oldName);
+  sequenceChanged(newName);
+  return true;
 }
 
 bool SequenceManager::verifySequence(const char* name, SequenceVerifyInfo& info, String& errorMessage) {
@@ -910,7 +1774,7 @@ bool SequenceManager::verifySequence(const char* name, SequenceVerifyInfo& info,
   }
 
   String path = getSequencePath(name);
-  File file = LittleFS.open(path, "r");
+  File file = fsOpen(path, "r");
   if (!file) {
     errorMessage = "Sequence file could not be opened.";
     return false;
@@ -920,53 +1784,80 @@ bool SequenceManager::verifySequence(const char* name, SequenceVerifyInfo& info,
   strncpy(info.name, name, MAX_SEQUENCE_NAME_LENGTH - 1);
   info.name[MAX_SEQUENCE_NAME_LENGTH - 1] = '\0';
 
-  DynamicJsonDocument doc(16384);
-  if (doc.capacity() == 0) {
+  SequenceFileHeader header;
+  if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header)) {
     file.close();
-    errorMessage = "Out of memory for sequence verification.";
+    errorMessage = "Sequence file is truncated.";
     return false;
   }
 
-  DeserializationError error = deserializeJson(doc, file);
-  file.close();
-  if (error) {
-    errorMessage = String("JSON parse error: ") + error.c_str();
+  if (header.magic != SEQUENCE_FILE_MAGIC) {
+    file.close();
+    errorMessage = "Not a sequence file.";
     return false;
   }
 
-  info.declaredFrameCount = doc["frameCount"] | 0;
-  info.totalDuration = doc["totalDuration"] | 0;
-  info.version = doc["version"] | 1;
+  info.declaredFrameCount = header.frameCount;
+  info.totalDuration = header.totalDuration;
+  info.version = header.version;
 
-  JsonArrayConst framesArray = doc["frames"].as<JsonArrayConst>();
-  if (framesArray.isNull()) {
-    errorMessage = "Missing frames array.";
+  if (header.version != SEQUENCE_FILE_VERSION ||
+      header.headerSize != sizeof(SequenceFileHeader) ||
+      header.recordSize != sizeof(SequenceFrame)) {
+    file.close();
+    errorMessage = "Unsupported sequence file version.";
     return false;
   }
 
-  info.actualFrameCount = framesArray.size();
-  if (info.actualFrameCount == 0) {
+  size_t recordBytes = info.fileSize - sizeof(header);
+  info.actualFrameCount = recordBytes / sizeof(SequenceFrame);
+  if (recordBytes == 0) {
+    file.close();
     errorMessage = "Sequence contains no frames.";
     return false;
   }
 
   if (info.declaredFrameCount == 0 || info.declaredFrameCount > MAX_FRAMES_PER_SEQUENCE) {
+    file.close();
     errorMessage = "Declared frame count is invalid.";
     return false;
   }
 
-  if (info.actualFrameCount != info.declaredFrameCount) {
-    errorMessage = "Declared frame count does not match actual frames array.";
+  if (info.actualFrameCount != info.declaredFrameCount || recordBytes % sizeof(SequenceFrame) != 0) {
+    file.close();
+    errorMessage = "Declared frame count does not match file size.";
     return false;
   }
 
-  for (JsonObjectConst frameObj : framesArray) {
-    uint16_t duration = frameObj["d"] | 0;
-    if (duration == 0) {
-      errorMessage = "At least one frame has an invalid duration.";
+  // One record at a time: CRC, frame limits and the stored total
+  uint32_t crc = 0;
+  uint32_t totalDuration = 0;
+  for (uint16_t i = 0; i < info.actualFrameCount; i++) {
+    SequenceFrame frame;
+    if (file.read((uint8_t*)&frame, sizeof(frame)) != sizeof(frame)) {
+      file.close();
+      errorMessage = "Sequence file could not be read.";
+      return false;
+    }
+    crc = sequenceCrc32(crc, &frame, sizeof(frame));
+    totalDuration += frame.duration;
+    if (!validateFrame(frame)) {
+      file.close();
+      errorMessage = String("Frame ") + String(i + 1) + " is out of range.";
       return false;
     }
   }
+  file.close();
+
+  if (crc != header.crc) {
+    errorMessage = "CRC mismatch - sequence file is damaged.";
+    return false;
+  }
+
+  if (totalDuration != header.totalDuration) {
+    errorMessage = "Total duration does not match the frames.";
+    return false;
+  }
 
   errorMessage = "Sequence verified successfully.";
   return true;
@@ -982,13 +1873,17 @@ bool SequenceManager::verifyAllSequences(uint16_t& okCount, uint16_t& failCount,
     return false;
   }
 
-  File dir = LittleFS.open(SEQUENCES_DIR);
+  File dir = fsOpen(SEQUENCES_DIR);
   if (!dir) {
     report = "Could not open sequence directory.";
     return false;
   }
 
+  // Every file is read anyway, so the directory itself is walked and the
+  // index is checked against it on the way
   report.reserve(1024);
+  uint16_t fileCount = 0;
+  bool indexStale = false;
   File entry = dir.openNextFile();
   while (entry) {
     if (!entry.isDirectory()) {
@@ -997,17 +1892,25 @@ bool SequenceManager::verifyAllSequences(uint16_t& okCount, uint16_t& failCount,
       if (lastSlash >= 0) {
         filename = filename.substring(lastSlash + 1);
       }
-      if (filename.endsWith(".seq")) {
-        filename.remove(filename.length() - 4);
+      if (filename.endsWith(SEQUENCE_FILE_EXTENSION)) {
+        filename.remove(filename.length() - strlen(SEQUENCE_FILE_EXTENSION));
         SequenceVerifyInfo info;
         String errorMessage;
-        if (verifySequence(filename.c_str(), info, errorMessage)) {
+        bool ok = verifySequence(filename.c_str(), info, errorMessage);
+        if (ok) {
           okCount++;
           report += "[OK] ";
         } else {
           failCount++;
           report += "[FAIL] ";
         }
+
+        fileCount++;
+        SequenceInfo* indexed = findIndexEntry(filename.c_str());
+        if (indexed == nullptr || indexed->fileSize != info.fileSize ||
+            (ok && indexed->frameCount != info.declaredFrameCount)) {
+          indexStale = true;
+        }
         report += filename;
         if (errorMessage.length() > 0) {
           report += " - ";
@@ -1021,6 +1924,12 @@ bool SequenceManager::verifyAllSequences(uint16_t& okCount, uint16_t& failCount,
   }
 
   dir.close();
+
+  if (indexStale || fileCount != indexCount) {
+    rebuildSequenceIndex();
+    report += "Sequence index was out of date and has been rebuilt.\n";
+  }
+
   if (okCount == 0 && failCount == 0) {
     report = "No sequences found.";
     return true;
@@ -1029,9 +1938,9 @@ bool SequenceManager::verifyAllSequences(uint16_t& okCount, uint16_t& failCount,
   return failCount == 0;
 }
 
-bool SequenceManager::exportSequenceJson(const char* name, String& jsonOut, String& errorMessage) {
-  jsonOut = "";
-
+// Hands back an exporter that turns the records into JSON piece by piece,
+// so exports of any size are copied out in small pieces by the caller
+bool SequenceManager::exportSequenceJson(const char* name, SequenceExporter& exporter, String& errorMessage) {
   if (!sdAvailable) {
     errorMessage = "Sequence storage is not available.";
     return false;
@@ -1043,84 +1952,49 @@ bool SequenceManager::exportSequenceJson(const char* name, String& jsonOut, Stri
   }
 
   String path = getSequencePath(name);
-  File file = LittleFS.open(path, "r");
+  File file = fsOpen(path, "r");
   if (!file) {
     errorMessage = "Sequence file could not be opened.";
     return false;
   }
 
-  jsonOut = file.readString();
-  file.close();
-
-  if (jsonOut.length() == 0) {
-    errorMessage = "Sequence file is empty.";
+  SequenceFileHeader header;
+  if (!readSequenceHeader(file, header, errorMessage)) {
+    file.close();
     return false;
   }
 
-  errorMessage = "Sequence exported successfully.";
+  strncpy(header.name, name, MAX_SEQUENCE_NAME_LENGTH - 1);  // File name wins
+  exporter.begin(file, header);
   return true;
 }
 
+// Whole document already in RAM (form posts); parsed by the same streaming
+// importer as uploads and serial pastes
 bool SequenceManager::importSequenceJson(const String& json, String& importedName, String& errorMessage) {
   importedName = "";
 
-  if (!sdAvailable) {
-    errorMessage = "Sequence storage is not available.";
-    return false;
-  }
-
   if (json.length() == 0) {
     errorMessage = "No sequence JSON received.";
     return false;
   }
 
-  DynamicJsonDocument doc(16384);
-  if (doc.capacity() == 0) {
-    errorMessage = "Out of memory for sequence import.";
-    return false;
-  }
-
-  DeserializationError error = deserializeJson(doc, json);
-  if (error) {
-    errorMessage = String("JSON parse error: ") + error.c_str();
-    return false;
-  }
-
-  const char* name = doc["name"] | "";
-  if (!isValidSequenceName(name)) {
-    errorMessage = "Invalid sequence name in JSON.";
-    return false;
-  }
-
-  if (sequenceExists(name)) {
-    errorMessage = "Sequence already exists. Delete or rename it first.";
-    return false;
-  }
-
-  SequenceFrame* frames = nullptr;
-  uint16_t frameCount = 0;
-  if (!loadFramesFromJsonDocument(doc, frames, frameCount, errorMessage)) {
-    if (frames != nullptr) {
-      delete[] frames;
-    }
-    return false;
-  }
-
-  bool saved = saveSequenceToSD(name, frames, frameCount);
-  delete[] frames;
-
-  if (!saved) {
-    errorMessage = "Failed to save imported sequence.";
+  SequenceImporter importer;
+  if (!importer.begin(errorMessage)) {
     return false;
   }
 
-  importedName = String(name);
-  errorMessage = "Sequence imported successfully.";
-  return true;
+  importer.feed((const uint8_t*)json.c_str(), json.length());
+  return importer.finish(importedName, errorMessage);
 }
 
 bool SequenceManager::getStorageStats(SequenceStorageStats& stats) {
   memset(&stats, 0, sizeof(stats));
+  stats.cachedSequences = cache.getEntryCount();
+  stats.cacheBytes = cache.getUsedBytes();
+  stats.cacheCapacityBytes = cache.getCapacityBytes();
+  stats.cacheHits = cache.getHits();
+  stats.cacheMisses = cache.getMisses();
 
   if (!sdAvailable) {
     return false;
@@ -1130,34 +2004,16 @@ bool SequenceManager::getStorageStats(SequenceStorageStats& stats) {
   stats.usedBytes = LittleFS.usedBytes();
   stats.freeBytes = (stats.totalBytes >= stats.usedBytes) ? (stats.totalBytes - stats.usedBytes) : 0;
 
-  File seqDir = LittleFS.open(SEQUENCES_DIR);
-  if (seqDir) {
-    File entry = seqDir.openNextFile();
-    while (entry) {
-      if (!entry.isDirectory()) {
-        String filename = String(entry.name());
-        int lastSlash = filename.lastIndexOf('/');
-        if (lastSlash >= 0) {
-          filename = filename.substring(lastSlash + 1);
-        }
-        if (filename.endsWith(".seq")) {
-          stats.sequenceCount++;
-          size_t fileSize = entry.size();
-          if (fileSize > stats.largestSequenceBytes) {
-            stats.largestSequenceBytes = fileSize;
-            filename.remove(filename.length() - 4);
-            strncpy(stats.largestSequenceName, filename.c_str(), MAX_SEQUENCE_NAME_LENGTH - 1);
-            stats.largestSequenceName[MAX_SEQUENCE_NAME_LENGTH - 1] = '\0';
-          }
-        }
-      }
-      entry.close();
-      entry = seqDir.openNextFile();
+  stats.sequenceCount = indexCount;
+  for (uint16_t i = 0; i < indexCount; i++) {
+    if (index[i].fileSize > stats.largestSequenceBytes) {
+      stats.largestSequenceBytes = index[i].fileSize;
+      strncpy(stats.largestSequenceName, index[i].name, MAX_SEQUENCE_NAME_LENGTH - 1);
+      stats.largestSequenceName[MAX_SEQUENCE_NAME_LENGTH - 1] = '\0';
     }
-    seqDir.close();
   }
 
-  File playlistDir = LittleFS.open(PLAYLISTS_DIR);
+  File playlistDir = fsOpen(PLAYLISTS_DIR);
   if (playlistDir) {
     File entry = playlistDir.openNextFile();
     while (entry) {
@@ -1185,38 +2041,43 @@ int SequenceManager::listSequences(char names[][MAX_SEQUENCE_NAME_LENGTH], int m
     return 0;
   }
 
-  File dir = LittleFS.open(SEQUENCES_DIR);
-  if (!dir) {
-    return 0;
-  }
-
   int count = 0;
-  File entry = dir.openNextFile();
-
-  while (entry && count < maxCount) {
-    if (!entry.isDirectory()) {
-      String filename = String(entry.name());
-      // Remove directory path if present
-      int lastSlash = filename.lastIndexOf('/');
-      if (lastSlash >= 0) {
-        filename = filename.substring(lastSlash + 1);
-      }
-      if (filename.endsWith(".seq")) {
-        // Remove .seq extension
-        filename.remove(filename.length() - 4);
-        strncpy(names[count], filename.c_str(), MAX_SEQUENCE_NAME_LENGTH - 1);
-        names[count][MAX_SEQUENCE_NAME_LENGTH - 1] = '\0';
-        count++;
-      }
-    }
-    entry.close();
-    entry = dir.openNextFile();
+  while (count < maxCount && count < indexCount) {
+    strncpy(names[count], index[count].name, MAX_SEQUENCE_NAME_LENGTH - 1);
+    names[count][MAX_SEQUENCE_NAME_LENGTH - 1] = '\0';
+    count++;
   }
-
-  dir.close();
   return count;
 }
 
+// Copies names [first, first + maxCount) for a list streamed from the network
+// task. The main loop bumps the generation before touching the records (and
+// may move them), so a copy is only trusted if the generation held across it.
+int SequenceManager::listSequences(char names[][MAX_SEQUENCE_NAME_LENGTH], int maxCount,
+                                   uint16_t first, uint32_t generation) {
+  if (indexGeneration.load(std::memory_order_acquire) != generation) {
+    return -1;
+  }
+  if (!sdAvailable) {
+    return 0;
+  }
+
+  const SequenceInfo* records = index;
+  uint16_t total = indexCount;
+  int count = 0;
+  while (count < maxCount && first + count < total) {
+    memcpy(names[count], records[first + count].name, MAX_SEQUENCE_NAME_LENGTH);
+    names[count][MAX_SEQUENCE_NAME_LENGTH - 1] = '\0';
+    count++;
+  }
+
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (indexGeneration.load(std::memory_order_relaxed) != generation) {
+    return -1;
+  }
+  return count;
+}
+
 bool SequenceManager::getSequenceInfo(const char* name, SequenceInfo& info) {
   if (!sdAvailable) {
     return false;
@@ -1226,41 +2087,211 @@ bool SequenceManager::getSequenceInfo(const char* name, SequenceInfo& info) {
     return false;
   }
 
-  String path = getSequencePath(name);
-  File file = LittleFS.open(path, "r");
+  SequenceInfo* entry = findIndexEntry(name);
+  if (entry == nullptr || entry->frameCount == 0) {
+    return false;
+  }
+
+  info = *entry;
+  return true;
+}
 
+// ============================================================================
+// SEQUENCE INDEX
+// ============================================================================
+
+// Reads the whole index with one read. False if it is missing or damaged.
+bool SequenceManager::loadSequenceIndex() {
+  File file = fsOpen(SEQUENCE_INDEX_PATH, "r");
   if (!file) {
     return false;
   }
 
-  StaticJsonDocument<64> filter;
-  filter["frameCount"] = true;
-  filter["totalDuration"] = true;
-  filter["version"] = true;
-
-  DynamicJsonDocument doc(256);
-  if (doc.capacity() == 0) {
-    file.close();
-    return false;
+  SequenceIndexHeader header;
+  bool ok = file.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+            header.magic == SEQUENCE_INDEX_MAGIC &&
+            header.version == SEQUENCE_INDEX_VERSION &&
+            header.headerSize == sizeof(SequenceIndexHeader) &&
+            header.recordSize == sizeof(SequenceInfo) &&
+            file.size() == sizeof(header) + (size_t)header.count * sizeof(SequenceInfo);
+
+  SequenceInfo* records = nullptr;
+  uint16_t capacity = 0;
+  if (ok) {
+    capacity = header.count > 16 ? header.count : 16;
+    records = new SequenceInfo[capacity];
+    size_t length = (size_t)header.count * sizeof(SequenceInfo);
+    ok = records != nullptr &&
+         file.read((uint8_t*)records, length) == length &&
+         sequenceCrc32(0, records, length) == header.crc;
   }
-
-  DeserializationError error = deserializeJson(doc, file, DeserializationOption::Filter(filter));
   file.close();
 
-  if (error) {
+  if (!ok) {
+    delete[] records;
+    Serial.println(F("⚠️ Sequence index missing or damaged"));
     return false;
   }
 
-  // Fill info structure
-  strncpy(info.name, name, MAX_SEQUENCE_NAME_LENGTH - 1);
-  info.name[MAX_SEQUENCE_NAME_LENGTH - 1] = '\0';
-  info.frameCount = doc["frameCount"] | 0;
-  info.totalDuration = doc["totalDuration"] | 0;
-  info.version = doc["version"] | 1;
-
+  for (uint16_t i = 0; i < header.count; i++) {
+    records[i].name[MAX_SEQUENCE_NAME_LENGTH - 1] = '\0';
+  }
+  delete[] index;
+  index = records;
+  indexCount = header.count;
+  indexCapacity = capacity;
+  indexGeneration = header.generation;
+  return true;
+}
+
+// Reads the header of every .sqb file; only needed when the index is gone
+bool SequenceManager::rebuildSequenceIndex() {
+  indexGeneration++;
+  indexCount = 0;
+
+  File dir = fsOpen(SEQUENCES_DIR);
+  if (!dir) {
+    return false;
+  }
+
+  size_t extensionLength = strlen(SEQUENCE_FILE_EXTENSION);
+  for (File entry = dir.openNextFile(); entry; entry = dir.openNextFile()) {
+    String filename = String(entry.name());
+    int lastSlash = filename.lastIndexOf('/');
+    if (lastSlash >= 0) {
+      filename = filename.substring(lastSlash + 1);
+    }
+    if (!entry.isDirectory() && filename.endsWith(SEQUENCE_FILE_EXTENSION)) {
+      filename.remove(filename.length() - extensionLength);
+      if (isValidSequenceName(filename.c_str())) {
+        SequenceInfo info;
+        describeSequenceFile(entry, filename.c_str(), indexGeneration, info);
+        storeIndexEntry(info);
+      }
+    }
+    entry.close();
+  }
+  dir.close();
+
+  Serial.print(F("✓ Sequence index rebuilt: "));
+  Serial.print(indexCount);
+  Serial.println(F(" sequence(s)"));
+  return writeSequenceIndex();
+}
+
+// Written next to the old index and moved into place. A power loss in
+// between leaves no index, which the next boot rebuilds.
+bool SequenceManager::writeSequenceIndex() {
+  size_t length = (size_t)indexCount * sizeof(SequenceInfo);
+  SequenceIndexHeader header;
+  memset(&header, 0, sizeof(header));
+  header.magic = SEQUENCE_INDEX_MAGIC;
+  header.version = SEQUENCE_INDEX_VERSION;
+  header.headerSize = sizeof(SequenceIndexHeader);
+  header.recordSize = sizeof(SequenceInfo);
+  header.count = indexCount;
+  header.generation = indexGeneration;
+  header.crc = sequenceCrc32(0, index, length);
+
+  File file = fsOpen(SEQUENCE_INDEX_TEMP_PATH, "w");
+  if (!file) {
+    Serial.println(F("⚠️ Could not write the sequence index"));
+    return false;
+  }
+  bool ok = file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+            (length == 0 || file.write((const uint8_t*)index, length) == length);
+  file.close();
+
+  if (ok && fsExists(SEQUENCE_INDEX_PATH)) {
+    ok = fsRemove(SEQUENCE_INDEX_PATH);
+  }
+  if (ok) {
+    ok = fsRename(SEQUENCE_INDEX_TEMP_PATH, SEQUENCE_INDEX_PATH);
+  }
+  if (!ok) {
+    fsRemove(SEQUENCE_INDEX_TEMP_PATH);
+    Serial.println(F("⚠️ Could not write the sequence index"));
+  }
+  return ok;
+}
+
+// Called before a sequence file is written, renamed or removed. The RAM
+// copy stays valid; sequenceChanged() writes the file again afterwards, and
+// if the change fails or power is lost first, the next boot rebuilds it.
+void SequenceManager::beginSequenceChange() {
+  if (fsExists(SEQUENCE_INDEX_PATH)) {
+    fsRemove(SEQUENCE_INDEX_PATH);
+  }
+}
+
+SequenceInfo* SequenceManager::findIndexEntry(const char* name) {
+  uint16_t low = 0;
+  uint16_t high = indexCount;
+  while (low < high) {
+    uint16_t middle = (low + high) / 2;
+    int order = strcmp(index[middle].name, name);
+    if (order == 0) {
+      return &index[middle];
+    }
+    if (order < 0) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return nullptr;
+}
+
+bool SequenceManager::readIndexEntry(const char* name, SequenceInfo& info) {
+  File file = fsOpen(getSequencePath(name), "r");
+  if (!file) {
+    return false;
+  }
+  describeSequenceFile(file, name, indexGeneration, info);
+  file.close();
+  return true;
+}
+
+bool SequenceManager::storeIndexEntry(const SequenceInfo& info) {
+  uint16_t position = 0;
+  while (position < indexCount && strcmp(index[position].name, info.name) < 0) {
+    position++;
+  }
+  if (position < indexCount && strcmp(index[position].name, info.name) == 0) {
+    index[position] = info;
+    return true;
+  }
+
+  if (indexCount >= indexCapacity) {
+    uint16_t capacity = indexCapacity > 0 ? indexCapacity * 2 : 16;
+    SequenceInfo* grown = new SequenceInfo[capacity];
+    if (grown == nullptr) {
+      return false;
+    }
+    if (indexCount > 0) {
+      memcpy(grown, index, (size_t)indexCount * sizeof(SequenceInfo));
+    }
+    delete[] index;
+    index = grown;
+    indexCapacity = capacity;
+  }
+
+  memmove(&index[position + 1], &index[position], (size_t)(indexCount - position) * sizeof(SequenceInfo));
+  index[position] = info;
+  indexCount++;
   return true;
 }
 
+void SequenceManager::removeIndexEntry(const char* name) {
+  SequenceInfo* entry = findIndexEntry(name);
+  if (entry == nullptr) {
+    return;
+  }
+  uint16_t position = entry - index;
+  memmove(&index[position], &index[position + 1], (size_t)(indexCount - position - 1) * sizeof(SequenceInfo));
+  indexCount--;
+}
+
 // ============================================================================
 // FILE I/O
 // ============================================================================
@@ -1275,28 +2306,17 @@ bool SequenceManager::saveSequenceToSD(const char* name, const SequenceFrame* fr
     return false;
   }
 
-  // Check available heap memory before allocating JSON buffer
-  size_t freeHeap = ESP.getFreeHeap();
-  size_t requiredHeap = 40000;
-  if (freeHeap < requiredHeap) {
-    Serial.print(F("❌ Insufficient heap memory: "));
-    Serial.print(freeHeap);
-    Serial.print(F(" bytes free, need "));
-    Serial.println(requiredHeap);
-    return false;
-  }
-
-  // Check available LittleFS space (estimate ~80 bytes per frame)
-  size_t estimatedSize = 200 + (frameCount * 80);  // Header + frames
+  // Check available LittleFS space (header plus fixed-size records)
+  size_t fileSize = sizeof(SequenceFileHeader) + (size_t)frameCount * sizeof(SequenceFrame);
   size_t totalBytes = LittleFS.totalBytes();
   size_t usedBytes = LittleFS.usedBytes();
   size_t freeSpace = totalBytes - usedBytes;
 
-  if (freeSpace < estimatedSize + 1024) {  // Keep 1KB safety margin
+  if (freeSpace < fileSize + 1024) {  // Keep 1KB safety margin
     Serial.print(F("❌ Insufficient storage: "));
     Serial.print(freeSpace);
-    Serial.print(F(" bytes free, need ~"));
-    Serial.println(estimatedSize);
+    Serial.print(F(" bytes free, need "));
+    Serial.println(fileSize);
     return false;
   }
 
@@ -1304,98 +2324,73 @@ bool SequenceManager::saveSequenceToSD(const char* name, const SequenceFrame* fr
   String tempPath = path + ".tmp";
   String backupPath = path + ".bak";
 
-  // Calculate total duration
+  // Calculate total duration, flags and CRC over the records as written
   uint32_t totalDuration = 0;
+  uint16_t flags = 0;
+  uint32_t crc = 0;
   for (uint16_t i = 0; i < frameCount; i++) {
-    totalDuration += frames[i].duration;
-  }
-
-  // Create JSON document
-  DynamicJsonDocument doc(16384); // Large buffer for up to ~200 frames
-  if (doc.capacity() == 0) {
-    Serial.println(F("Error: Out of memory for JSON document."));
-    return false;
-  }
-
-  doc["name"] = name;
-  doc["version"] = 1;
-  doc["frameCount"] = frameCount;
-  doc["totalDuration"] = totalDuration;
-
-  JsonArray framesArray = doc.createNestedArray("frames");
-
-  for (uint16_t i = 0; i < frameCount; i++) {
-    JsonObject frame = framesArray.createNestedObject();
-    frame["d"] = frames[i].duration;
-
-    // Servos (compact notation)
-    JsonObject servos = frame.createNestedObject("s");
-    servos["ep"] = frames[i].eyePan;
-    servos["et"] = frames[i].eyeTilt;
-    servos["hp"] = frames[i].headPan;
-    servos["ht"] = frames[i].headTilt;
-
-    // Eyes
-    frame["em"] = frames[i].eyeMode;
-    frame["ec"] = frames[i].eyeColor;
-    frame["eb"] = frames[i].eyeBrightness;
-
-    // Detail LED
-    frame["dm"] = frames[i].detailMode;
-    frame["dc"] = frames[i].detailColor;
-    frame["db"] = frames[i].detailBrightness;
-
-    // Audio
-    if (frames[i].soundFile > 0) {
-      frame["sf"] = frames[i].soundFile;
-      frame["so"] = frames[i].soundFolder;
-      frame["v"] = frames[i].volume;
+    SequenceFrame record = frames[i];
+    memset(record.reserved, 0, sizeof(record.reserved));
+    totalDuration += record.duration;
+    if (record.soundFile > 0) {
+      flags |= SEQUENCE_FLAG_SOUND;
     }
+    crc = sequenceCrc32(crc, &record, sizeof(record));
   }
 
-  if (LittleFS.exists(tempPath)) {
-    LittleFS.remove(tempPath);
+  SequenceFileHeader header;
+  fillSequenceHeader(header, name, frameCount, totalDuration, flags, crc);
+
+  if (fsExists(tempPath)) {
+    fsRemove(tempPath);
   }
-  if (LittleFS.exists(backupPath)) {
-    LittleFS.remove(backupPath);
+  if (fsExists(backupPath)) {
+    fsRemove(backupPath);
   }
 
   // Write to temporary file first so the last good sequence is preserved
-  File file = LittleFS.open(tempPath, "w");
+  File file = fsOpen(tempPath, "w");
   if (!file) {
     Serial.println(F("❌ Failed to open file for writing"));
     return false;
   }
 
-  if (serializeJson(doc, file) == 0) {
-    Serial.println(F("❌ Failed to write JSON"));
-    file.close();
-    LittleFS.remove(tempPath);
-    return false;
+  bool written = file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+  for (uint16_t i = 0; written && i < frameCount; i++) {
+    SequenceFrame record = frames[i];
+    memset(record.reserved, 0, sizeof(record.reserved));
+    written = file.write((const uint8_t*)&record, sizeof(record)) == sizeof(record);
   }
-
   file.close();
 
-  bool hadExistingFile = LittleFS.exists(path);
-  if (hadExistingFile && !LittleFS.rename(path, backupPath)) {
-    LittleFS.remove(tempPath);
+  if (!written) {
+    Serial.println(F("❌ Failed to write sequence file"));
+    fsRemove(tempPath);
+    return false;
+  }
+
+  beginSequenceChange();
+  bool hadExistingFile = fsExists(path);
+  if (hadExistingFile && !fsRename(path, backupPath)) {
+    fsRemove(tempPath);
     Serial.println(F("Failed to protect existing sequence before replace."));
     return false;
   }
 
-  if (!LittleFS.rename(tempPath, path)) {
-    if (hadExistingFile && LittleFS.exists(backupPath)) {
-      LittleFS.rename(backupPath, path);
+  if (!fsRename(tempPath, path)) {
+    if (hadExistingFile && fsExists(backupPath)) {
+      fsRename(backupPath, path);
     }
-    LittleFS.remove(tempPath);
+    fsRemove(tempPath);
     Serial.println(F("Failed to replace sequence file."));
     return false;
   }
 
-  if (LittleFS.exists(backupPath)) {
-    LittleFS.remove(backupPath);
+  if (fsExists(backupPath)) {
+    fsRemove(backupPath);
   }
 
+  sequenceChanged(name);
   return true;
 }
 
@@ -1409,19 +2404,8 @@ bool SequenceManager::loadSequenceFromSD(const char* name, SequenceFrame*& frame
     return false;
   }
 
-  // Check available heap memory before allocating JSON buffer
-  size_t freeHeap = ESP.getFreeHeap();
-  size_t requiredHeap = 40000;
-  if (freeHeap < requiredHeap) {
-    Serial.print(F("❌ Insufficient heap memory: "));
-    Serial.print(freeHeap);
-    Serial.print(F(" bytes free, need "));
-    Serial.println(requiredHeap);
-    return false;
-  }
-
   String path = getSequencePath(name);
-  File file = LittleFS.open(path, "r");
+  File file = fsOpen(path, "r");
 
   if (!file) {
     Serial.print(F("❌ File not found: "));
@@ -1429,91 +2413,701 @@ bool SequenceManager::loadSequenceFromSD(const char* name, SequenceFrame*& frame
     return false;
   }
 
-  // Parse JSON
-  DynamicJsonDocument doc(16384);
-  if (doc.capacity() == 0) {
+  SequenceFileHeader header;
+  String errorMessage;
+  if (!readSequenceHeader(file, header, errorMessage)) {
     file.close();
-    Serial.println(F("Error: Out of memory for JSON document."));
-    return false;
-  }
-  DeserializationError error = deserializeJson(doc, file);
-  file.close();
-
-  if (error) {
-    Serial.print(F("❌ JSON parse error in '"));
-    Serial.print(name);
-    Serial.print(F("': "));
-    Serial.println(error.c_str());
-    return false;
-  }
-
-  // Get frame count
-  frameCount = doc["frameCount"] | 0;
-  if (frameCount == 0 || frameCount > MAX_FRAMES_PER_SEQUENCE) {
-    Serial.print(F("❌ Invalid frame count in '"));
+    Serial.print(F("❌ Invalid sequence file '"));
     Serial.print(name);
     Serial.print(F("': "));
-    Serial.println(frameCount);
+    Serial.println(errorMessage);
     return false;
   }
 
   // Allocate memory
-  frames = new SequenceFrame[frameCount];
+  frames = new SequenceFrame[header.frameCount];
   if (frames == nullptr) {
+    file.close();
     Serial.print(F("❌ Memory allocation failed for '"));
     Serial.print(name);
     Serial.print(F("' ("));
-    Serial.print(frameCount);
+    Serial.print(header.frameCount);
     Serial.println(F(" frames)"));
     return false;
   }
 
-  // Load frames
-  JsonArray framesArray = doc["frames"];
-  uint16_t idx = 0;
-
-  for (JsonObject frameObj : framesArray) {
-    if (idx >= frameCount) break;
-
-    frames[idx].duration = frameObj["d"] | 1000;
-
-    // Servos
-    JsonObject servos = frameObj["s"];
-    frames[idx].eyePan = servos["ep"] | 90;
-    frames[idx].eyeTilt = servos["et"] | 90;
-    frames[idx].headPan = servos["hp"] | 90;
-    frames[idx].headTilt = servos["ht"] | 90;
-
-    // Eyes
-    frames[idx].eyeMode = frameObj["em"] | 0;
-    frames[idx].eyeColor = frameObj["ec"] | 0x007FFF;
-    frames[idx].eyeBrightness = frameObj["eb"] | 150;
-
-    // Detail LED
-    frames[idx].detailMode = frameObj["dm"] | 0;
-    frames[idx].detailColor = frameObj["dc"] | 0x007FFF;
-    frames[idx].detailBrightness = frameObj["db"] | 150;
-
-    // Audio
-    frames[idx].soundFile = frameObj["sf"] | 0;
-    frames[idx].soundFolder = frameObj["so"] | 0;
-    frames[idx].volume = frameObj["v"] | 20;
-
-    idx++;
-  }
+  // Records are stored exactly as they sit in memory - one read, no parsing
+  size_t recordBytes = (size_t)header.frameCount * sizeof(SequenceFrame);
+  size_t bytesRead = file.read((uint8_t*)frames, recordBytes);
+  file.close();
 
-  if (idx == 0) {
+  if (bytesRead != recordBytes || sequenceCrc32(0, frames, recordBytes) != header.crc) {
     delete[] frames;
     frames = nullptr;
     frameCount = 0;
-    Serial.println(F("Error: Sequence file contains no frames."));
+    Serial.print(F("❌ CRC mismatch in '"));
+    Serial.print(name);
+    Serial.println(F("' - file is damaged"));
     return false;
   }
 
-  frameCount = idx;
+  frameCount = header.frameCount;
   return true;
 }
 
+// ============================================================================
+// STREAMING IMPORT
+// ============================================================================
+
+namespace {
+std::atomic<bool> importBusy(false);
+
+// Where each frame key lands in SequenceFrame. Servo keys live in the
+// nested "s" object.
+struct ImportField {
+  const char* key;
+  bool servo;
+  uint8_t size;
+  size_t offset;
+};
+
+const ImportField IMPORT_FIELDS[] = {
+  { "d",  false, 2, offsetof(SequenceFrame, duration) },
+  { "ep", true,  1, offsetof(SequenceFrame, eyePan) },
+  { "et", true,  1, offsetof(SequenceFrame, eyeTilt) },
+  { "hp", true,  1, offsetof(SequenceFrame, headPan) },
+  { "ht", true,  1, offsetof(SequenceFrame, headTilt) },
+  { "em", false, 1, offsetof(SequenceFrame, eyeMode) },
+  { "ec", false, 4, offsetof(SequenceFrame, eyeColor) },
+  { "eb", false, 1, offsetof(SequenceFrame, eyeBrightness) },
+  { "dm", false, 1, offsetof(SequenceFrame, detailMode) },
+  { "dc", false, 4, offsetof(SequenceFrame, detailColor) },
+  { "db", false, 1, offsetof(SequenceFrame, detailBrightness) },
+  { "sf", false, 1, offsetof(SequenceFrame, soundFile) },
+  { "so", false, 1, offsetof(SequenceFrame, soundFolder) },
+  { "v",  false, 1, offsetof(SequenceFrame, volume) }
+};
+
+bool parseImportNumber(const char* text, uint32_t& value) {
+  char* end = nullptr;
+  double number = strtod(text, &end);
+  if (end == text || *end != '\0' || number < 0 || number > 4294967295.0 || number != floor(number)) {
+    return false;
+  }
+  value = (uint32_t)number;
+  return true;
+}
+
+// Same defaults as a missing key in older JSON .seq files
+void setImportFrameDefaults(SequenceFrame& frame) {
+  memset(&frame, 0, sizeof(frame));
+  frame.duration = 1000;
+  frame.eyePan = 90;
+  frame.eyeTilt = 90;
+  frame.headPan = 90;
+  frame.headTilt = 90;
+  frame.eyeMode = 0;
+  frame.eyeColor = 0x007FFF;
+  frame.eyeBrightness = 150;
+  frame.detailMode = 0;
+  frame.detailColor = 0x007FFF;
+  frame.detailBrightness = 150;
+  frame.soundFile = 0;
+  frame.soundFolder = 0;
+  frame.volume = 20;
+}
+}
+
+SequenceImporter::SequenceImporter()
+  : claimed(false), started(false), parseState(PARSE_START), lexState(LEX_NONE),
+    stringIsKey(false), unicodeDigits(0), depth(0), objectBits(0),
+    inFrames(false), inFrame(false), inServos(false), framesSeen(false),
+    tokenLength(0), tokenOverflow(false), declaredFrameCount(-1), frameCount(0), totalDuration(0),
+    flags(0), crc(0) {
+  token[0] = '\0';
+  key[0] = '\0';
+  name[0] = '\0';
+  error[0] = '\0';
+  setImportFrameDefaults(frame);
+}
+
+SequenceImporter::~SequenceImporter() {
+  release();
+}
+
+bool SequenceImporter::begin(String& errorMessage) {
+  if (!sequenceManager.isStorageAvailable()) {
+    fail("Sequence storage is not available.");
+  } else if (importBusy.exchange(true)) {
+    fail("Another sequence import is in progress.");
+  } else {
+    claimed = true;
+    if (LittleFS.totalBytes() - LittleFS.usedBytes() < 4096) {
+      fail("Not enough storage for an import.");
+    } else if (!sequenceManager.ensureSequenceDir()) {
+      fail("Failed to create sequence directory.");
+    } else {
+      file = fsOpen(SEQUENCE_IMPORT_TEMP_PATH, "w");
+      if (!file) {
+        fail("Failed to open temporary file for writing.");
+      } else {
+        writeHeader();
+      }
+    }
+  }
+
+  errorMessage = error;
+  return !failed();
+}
+
+bool SequenceImporter::feed(const uint8_t* data, size_t length) {
+  for (size_t i = 0; i < length && !failed(); i++) {
+    feedChar((char)data[i]);
+  }
+  return !failed();
+}
+
+bool SequenceImporter::finish(String& importedName, String& errorMessage) {
+  importedName = "";
+
+  if (!failed()) {
+    if (!started) {
+      fail("No sequence JSON received.");
+    } else if (parseState != PARSE_DONE) {
+      fail("JSON parse error: IncompleteInput");
+    } else if (name[0] == '\0') {
+      fail("Invalid sequence name in JSON.");
+    } else if (declaredFrameCount < 0) {
+      fail("Invalid frame count in sequence JSON.");
+    } else if (!framesSeen) {
+      fail("Missing frames array in sequence JSON.");
+    } else if (frameCount == 0) {
+      fail("Sequence JSON contains no frames.");
+    } else if (declaredFrameCount != frameCount) {
+      fail("Declared frame count does not match actual frames array.");
+    }
+  }
+
+  if (!failed()) {
+    writeHeader();
+  }
+
+  if (!failed()) {
+    file.close();
+    String path = sequenceManager.getSequencePath(name);
+    if (fsExists(path)) {
+      fail("Sequence already exists. Delete or rename it first.");
+    } else {
+      sequenceManager.beginSequenceChange();
+      if (!fsRename(SEQUENCE_IMPORT_TEMP_PATH, path)) {
+        fail("Failed to save imported sequence.");
+      }
+    }
+  }
+
+  if (failed()) {
+    errorMessage = error;
+    return false;
+  }
+
+  claimed = false;
+  importBusy = false;
+  sequenceManager.sequenceChanged(name);
+  importedName = name;
+  errorMessage = "Sequence imported successfully.";
+  return true;
+}
+
+bool SequenceImporter::feedChar(char c) {
+  switch (lexState) {
+    case LEX_STRING:
+      if (c == '"') {
+        return finishToken(LEX_STRING);
+      }
+      if (c == '\\') {
+        lexState = LEX_ESCAPE;
+        return true;
+      }
+      if ((uint8_t)c < 0x20) {
+        return fail("JSON parse error: InvalidInput");
+      }
+      appendToken(c);
+      return true;
+
+    case LEX_ESCAPE:
+      lexState = LEX_STRING;
+      switch (c) {
+        case '"': case '\\': case '/': break;
+        case 'b': c = '\b'; break;
+        case 'f': c = '\f'; break;
+        case 'n': c = '\n'; break;
+        case 'r': c = '\r'; break;
+        case 't': c = '\t'; break;
+        case 'u':
+          lexState = LEX_UNICODE;
+          unicodeDigits = 0;
+          c = '?';            // Never valid in the values we keep
+          break;
+        default:
+          return fail("JSON parse error: InvalidInput");
+      }
+      appendToken(c);
+      return true;
+
+    case LEX_UNICODE:
+      if (!isxdigit((uint8_t)c)) {
+        return fail("JSON parse error: InvalidInput");
+      }
+      if (++unicodeDigits == 4) {
+        lexState = LEX_STRING;
+      }
+      return true;
+
+    case LEX_NUMBER:
+      if (isdigit((uint8_t)c) || c == '.' || c == 'e' || c == 'E' || c == '+' || c == '-') {
+        appendToken(c);
+        return true;
+      }
+      if (!finishToken(LEX_NUMBER)) {
+        return false;
+      }
+      break;                  // c still needs to be looked at
+
+    case LEX_LITERAL:
+      if (isalpha((uint8_t)c)) {
+        appendToken(c);
+        return true;
+      }
+      if (!finishToken(LEX_LITERAL)) {
+        return false;
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+    return true;
+  }
+  started = true;
+
+  switch (parseState) {
+    case PARSE_START:
+      if (c != '{') {
+        return fail("Sequence JSON must be an object.");
+      }
+      return openContainer(true);
+
+    case PARSE_OBJECT_FIRST:
+      if (c == '}') {
+        return closeContainer(true);
+      }
+      // fall through
+    case PARSE_OBJECT_KEY:
+      if (c != '"') {
+        return fail("JSON parse error: InvalidInput");
+      }
+      beginToken(LEX_STRING);
+      stringIsKey = true;
+      return true;
+
+    case PARSE_COLON:
+      if (c != ':') {
+        return fail("JSON parse error: InvalidInput");
+      }
+      parseState = PARSE_VALUE;
+      return true;
+
+    case PARSE_ARRAY_FIRST:
+      if (c == ']') {
+        return closeContainer(false);
+      }
+      // fall through
+    case PARSE_VALUE:
+      return startValue(c);
+
+    case PARSE_AFTER_VALUE:
+      if (c == ',') {
+        parseState = (objectBits & (1u << (depth - 1))) ? PARSE_OBJECT_KEY : PARSE_VALUE;
+        return true;
+      }
+      if (c == '}' || c == ']') {
+        return closeContainer(c == '}');
+      }
+      return fail("JSON parse error: InvalidInput");
+
+    default:
+      return fail("Unexpected data after sequence JSON.");
+  }
+}
+
+bool SequenceImporter::startValue(char c) {
+  if (c == '{' || c == '[') {
+    return openContainer(c == '{');
+  }
+  if (c == '"') {
+    beginToken(LEX_STRING);
+    stringIsKey = false;
+    return true;
+  }
+  if (c == '-' || isdigit((uint8_t)c)) {
+    beginToken(LEX_NUMBER);
+    appendToken(c);
+    return true;
+  }
+  if (isalpha((uint8_t)c)) {
+    beginToken(LEX_LITERAL);
+    appendToken(c);
+    return true;
+  }
+  return fail("JSON parse error: InvalidInput");
+}
+
+void SequenceImporter::beginToken(LexState state) {
+  lexState = state;
+  tokenLength = 0;
+  tokenOverflow = false;
+  token[0] = '\0';
+}
+
+void SequenceImporter::appendToken(char c) {
+  if (tokenLength >= sizeof(token) - 1) {
+    tokenOverflow = true;   // Only the first bytes are kept, enough for any value we use
+    return;
+  }
+  token[tokenLength++] = c;
+  token[tokenLength] = '\0';
+}
+
+bool SequenceImporter::finishToken(LexState state) {
+  lexState = LEX_NONE;
+
+  if (state == LEX_STRING && stringIsKey) {
+    // Long keys are none of ours; an empty key matches nothing
+    if (tokenOverflow || tokenLength >= sizeof(key)) {
+      key[0] = '\0';
+    } else {
+      memcpy(key, token, tokenLength + 1);
+    }
+    parseState = PARSE_COLON;
+    return true;
+  }
+
+  if (state == LEX_STRING) {
+    return storeValue(VALUE_STRING);
+  }
+  if (state == LEX_NUMBER) {
+    return storeValue(VALUE_NUMBER);
+  }
+  if (strcmp(token, "true") == 0 || strcmp(token, "false") == 0) {
+    return storeValue(VALUE_BOOL);
+  }
+  if (strcmp(token, "null") == 0) {
+    return storeValue(VALUE_NULL);
+  }
+  return fail("JSON parse error: InvalidInput");
+}
+
+bool SequenceImporter::openContainer(bool isObject) {
+  if (depth >= 16) {
+    return fail("JSON parse error: TooDeep");
+  }
+
+  if (depth == 1 && strcmp(key, "frames") == 0) {
+    if (isObject || framesSeen) {
+      return fail("Missing frames array in sequence JSON.");
+    }
+    inFrames = true;
+    framesSeen = true;
+  } else if (inFrames && !inFrame && depth == 2) {
+    if (!isObject) {
+      return fail("Sequence frames must be JSON objects.");
+    }
+    // Stop an oversized body before it fills the flash (or wraps the count)
+    if (frameCount >= MAX_FRAMES_PER_SEQUENCE) {
+      return fail("Invalid frame count in sequence JSON.");
+    }
+    if (declaredFrameCount >= 0 && frameCount >= declaredFrameCount) {
+      return fail("Declared frame count does not match actual frames array.");
+    }
+    setImportFrameDefaults(frame);
+    inFrame = true;
+  } else if (inFrame && depth == 3 && isObject && strcmp(key, "s") == 0) {
+    inServos = true;
+  }
+
+  if (isObject) {
+    objectBits |= (1u << depth);
+  } else {
+    objectBits &= ~(1u << depth);
+  }
+  depth++;
+  parseState = isObject ? PARSE_OBJECT_FIRST : PARSE_ARRAY_FIRST;
+  return true;
+}
+
+bool SequenceImporter::closeContainer(bool isObject) {
+  bool openIsObject = (objectBits & (1u << (depth - 1))) != 0;
+  if (openIsObject != isObject) {
+    return fail("JSON parse error: InvalidInput");
+  }
+  depth--;
+
+  if (inServos && depth == 3) {
+    inServos = false;
+  } else if (inFrame && depth == 2) {
+    inFrame = false;
+    if (!writeFrame()) {
+      return false;
+    }
+  } else if (inFrames && depth == 1) {
+    inFrames = false;
+  }
+
+  return valueDone();
+}
+
+bool SequenceImporter::storeValue(ValueKind kind) {
+  if (depth == 1) {
+    if (strcmp(key, "name") == 0) {
+      if (kind != VALUE_STRING || tokenOverflow || !sequenceManager.isValidSequenceName(token)) {
+        return fail("Invalid sequence name in JSON.");
+      }
+      // No index lookup here: chunks are parsed in the network task while the
+      // main loop may move the index. finish() rejects an existing name.
+      strncpy(name, token, sizeof(name) - 1);
+      name[sizeof(name) - 1] = '\0';
+    } else if (strcmp(key, "frameCount") == 0) {
+      uint32_t value = 0;
+      if (kind != VALUE_NUMBER || tokenOverflow || !parseImportNumber(token, value) ||
+          value == 0 || value > MAX_FRAMES_PER_SEQUENCE) {
+        return fail("Invalid frame count in sequence JSON.");
+      }
+      declaredFrameCount = value;
+    } else if (strcmp(key, "frames") == 0) {
+      return fail("Missing frames array in sequence JSON.");
+    }
+    return valueDone();
+  }
+
+  if (inFrames && !inFrame && depth == 2) {
+    return fail("Sequence frames must be JSON objects.");
+  }
+
+  bool frameField = (inFrame && !inServos && depth == 3) || (inServos && depth == 4);
+  if (!frameField || kind == VALUE_NULL) {
+    return valueDone();     // Not ours, or null = key missing
+  }
+
+  uint32_t value = 0;
+  if (kind != VALUE_NUMBER || tokenOverflow || !parseImportNumber(token, value)) {
+    char message[sizeof(error)];
+    snprintf(message, sizeof(message), "Frame %u: '%s' must be a whole number.", frameCount + 1, key);
+    return fail(message);
+  }
+  if (!storeFrameField(value)) {
+    return false;
+  }
+  return valueDone();
+}
+
+bool SequenceImporter::storeFrameField(uint32_t value) {
+  for (const ImportField& field : IMPORT_FIELDS) {
+    if (field.servo != inServos || strcmp(field.key, key) != 0) {
+      continue;
+    }
+
+    uint32_t maxValue = field.size == 1 ? 0xFF : (field.size == 2 ? 0xFFFF : 0xFFFFFFFF);
+    if (value > maxValue) {
+      char message[sizeof(error)];
+      snprintf(message, sizeof(message), "Frame %u: '%s' out of range.", frameCount + 1, key);
+      return fail(message);
+    }
+
+    uint8_t* target = (uint8_t*)&frame + field.offset;
+    if (field.size == 1) {
+      *target = (uint8_t)value;
+    } else if (field.size == 2) {
+      uint16_t value16 = (uint16_t)value;
+      memcpy(target, &value16, sizeof(value16));
+    } else {
+      memcpy(target, &value, sizeof(value));
+    }
+    return true;
+  }
+  return true;                // Unknown keys are ignored like the loader does
+}
+
+bool SequenceImporter::valueDone() {
+  parseState = depth == 0 ? PARSE_DONE : PARSE_AFTER_VALUE;
+  return true;
+}
+
+bool SequenceImporter::writeFrame() {
+  if (!sequenceManager.validateFrame(frame)) {
+    char message[sizeof(error)];
+    snprintf(message, sizeof(message),
+             "Frame %u invalid (servos 0-180, duration 1-60000 ms, volume 0-30).", frameCount + 1);
+    return fail(message);
+  }
+
+  // Same record as saveSequenceToSD
+  if (file.write((const uint8_t*)&frame, sizeof(frame)) != sizeof(frame)) {
+    return fail("Failed to write sequence file (storage full?).");
+  }
+
+  crc = sequenceCrc32(crc, &frame, sizeof(frame));
+  if (frame.soundFile > 0) {
+    flags |= SEQUENCE_FLAG_SOUND;
+  }
+  frameCount++;
+  totalDuration += frame.duration;
+  return true;
+}
+
+bool SequenceImporter::writeHeader() {
+  SequenceFileHeader header;
+  fillSequenceHeader(header, name, frameCount, totalDuration, flags, crc);
+  size_t end = file.position();
+  if (!file.seek(0) || file.write((const uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+      (end > sizeof(header) && !file.seek(end))) {
+    return fail("Failed to write sequence file.");
+  }
+  return true;
+}
+
+// First error wins; the temp file and the import claim are released at once
+bool SequenceImporter::fail(const char* message) {
+  if (error[0] == '\0') {
+    strncpy(error, message, sizeof(error) - 1);
+    error[sizeof(error) - 1] = '\0';
+  }
+  release();
+  return false;
+}
+
+void SequenceImporter::release() {
+  if (!claimed) {
+    return;
+  }
+  if (file) {
+    file.close();
+  }
+  fsRemove(SEQUENCE_IMPORT_TEMP_PATH);
+  claimed = false;
+  importBusy = false;
+}
+
+// ============================================================================
+// JSON EXPORT
+// ============================================================================
+
+namespace {
+enum ExportStage : uint8_t {
+  EXPORT_IDLE,
+  EXPORT_HEADER,
+  EXPORT_FRAMES,
+  EXPORT_FOOTER,
+  EXPORT_DONE
+};
+}
+
+SequenceExporter::SequenceExporter()
+  : nextFrame(0), stage(EXPORT_IDLE), pendingLength(0), pendingPos(0) {
+  memset(&header, 0, sizeof(header));
+  pending[0] = '\0';
+}
+
+SequenceExporter::~SequenceExporter() {
+  if (file) {
+    file.close();
+  }
+}
+
+void SequenceExporter::begin(File sequenceFile, const SequenceFileHeader& sequenceHeader) {
+  file = sequenceFile;
+  header = sequenceHeader;
+  nextFrame = 0;
+  stage = EXPORT_HEADER;
+  pendingLength = 0;
+  pendingPos = 0;
+}
+
+size_t SequenceExporter::read(uint8_t* buffer, size_t maxLength) {
+  size_t written = 0;
+  while (written < maxLength) {
+    if (pendingPos >= pendingLength && !fillPending()) {
+      break;
+    }
+    size_t count = pendingLength - pendingPos;
+    if (count > maxLength - written) {
+      count = maxLength - written;
+    }
+    memcpy(buffer + written, pending + pendingPos, count);
+    pendingPos += count;
+    written += count;
+  }
+  return written;
+}
+
+// Next piece of JSON in the layout of the old .seq files ("version" is the
+// interchange schema, not SEQUENCE_FILE_VERSION). A record that cannot be
+// read ends the output early, which the receiver sees as invalid JSON.
+bool SequenceExporter::fillPending() {
+  int length = 0;
+  pendingLength = 0;
+  pendingPos = 0;
+
+  switch (stage) {
+    case EXPORT_HEADER:
+      length = snprintf(pending, sizeof(pending),
+                        "{\"name\":\"%s\",\"version\":1,\"frameCount\":%u,\"totalDuration\":%lu,\"frames\":[",
+                        header.name, (unsigned)header.frameCount, (unsigned long)header.totalDuration);
+      stage = EXPORT_FRAMES;
+      break;
+
+    case EXPORT_FRAMES: {
+      SequenceFrame frame;
+      if (nextFrame >= header.frameCount) {
+        length = snprintf(pending, sizeof(pending), "]}");
+        stage = EXPORT_FOOTER;
+        break;
+      }
+      if (file.read((uint8_t*)&frame, sizeof(frame)) != sizeof(frame)) {
+        file.close();
+        stage = EXPORT_DONE;
+        return false;
+      }
+      length = snprintf(pending, sizeof(pending),
+                        "%s{\"d\":%u,\"s\":{\"ep\":%u,\"et\":%u,\"hp\":%u,\"ht\":%u},"
+                        "\"em\":%u,\"ec\":%lu,\"eb\":%u,\"dm\":%u,\"dc\":%lu,\"db\":%u",
+                        nextFrame > 0 ? "," : "",
+                        frame.duration, frame.eyePan, frame.eyeTilt, frame.headPan, frame.headTilt,
+                        frame.eyeMode, (unsigned long)frame.eyeColor, frame.eyeBrightness,
+                        frame.detailMode, (unsigned long)frame.detailColor, frame.detailBrightness);
+      if (frame.soundFile > 0) {
+        length += snprintf(pending + length, sizeof(pending) - length, ",\"sf\":%u,\"so\":%u,\"v\":%u",
+                           frame.soundFile, frame.soundFolder, frame.volume);
+      }
+      pending[length++] = '}';
+      nextFrame++;
+      break;
+    }
+
+    case EXPORT_FOOTER:
+      file.close();
+      stage = EXPORT_DONE;
+      return false;
+
+    default:
+      return false;
+  }
+
+  pendingLength = length > 0 ? (size_t)length : 0;
+  return pendingLength > 0;
+}
+
 // ============================================================================
 // UTILITY
 // ============================================================================
@@ -1550,6 +3144,9 @@ void SequenceManager::printSequenceInfo(const char* name) {
   Serial.print(F("│ Duration: "));
   Serial.print(info.totalDuration / 1000.0, 2);
   Serial.println(F(" seconds"));
+  Serial.print(F("│ Size: "));
+  Serial.print((unsigned long)info.fileSize);
+  Serial.println(F(" bytes"));
   Serial.print(F("│ Version: "));
   Serial.println(info.version);
   Serial.println(F("└────────────────────────────────────"));
@@ -1585,6 +3182,7 @@ bool SequenceManager::playlistAdd(const char* name) {
   Serial.print(F(" ("));
   Serial.print(playback.playlist.count);
   Serial.println(F(" items)"));
+  requestCacheWarm();
 
   return true;
 }
@@ -1759,7 +3357,7 @@ bool SequenceManager::playlistLoad(const char* name) {
   }
 
   String path = getPlaylistPath(name);
-  File file = LittleFS.open(path, "r");
+  File file = fsOpen(path, "r");
   if (!file) {
     Serial.println(F("Saved playlist not found."));
     return false;
@@ -1808,6 +3406,7 @@ bool SequenceManager::playlistLoad(const char* name) {
   Serial.print(F("Loaded playlist '"));
   Serial.print(name);
   Serial.println(F("'"));
+  requestCacheWarm();
   return true;
 }
 
@@ -1816,7 +3415,7 @@ int SequenceManager::listPlaylists(char names[][MAX_SEQUENCE_NAME_LENGTH], int m
     return 0;
   }
 
-  File dir = LittleFS.open(PLAYLISTS_DIR);
+  File dir = fsOpen(PLAYLISTS_DIR);
   if (!dir) {
     return 0;
   }
@@ -1884,4 +3483,10 @@ void SequenceManager::playlistPrint() {
     Serial.print(playback.playlist.sequences[playback.playlist.currentIndex]);
     Serial.println(F(")"));
   }
+
+  if (playback.lastTransitionGap > 0) {
+    Serial.print(F("Last transition gap: "));
+    Serial.print(playback.lastTransitionGap);
+    Serial.println(F(" us"));
+  }
 }
@@ -2,16 +2,33 @@
 #define SEQUENCES_H
 
 #include <Arduino.h>
+#include <atomic>
 #include <FS.h>
 #include <LittleFS.h>
 #include "config.h"
 #include "globals.h"  // For ServoState, PixelMode, DetailPattern, mp3, etc.
 
 // Maximum limits
-#define MAX_FRAMES_PER_SEQUENCE 200
+#define MAX_FRAMES_PER_SEQUENCE 10000  // Playback streams from flash, so only storage limits this
 #define MAX_SEQUENCE_NAME_LENGTH 32
 #define MAX_RECORDING_FRAMES 200
+#define SEQUENCE_PLAYBACK_RING 8       // Frames read ahead of the one playing
+#define SEQUENCE_CACHE_ENTRIES 16      // Decoded sequences kept in PSRAM
+#define SEQUENCE_CACHE_BYTES (512UL * 1024UL)  // PSRAM budget for their frames
+#define SEQUENCE_CACHE_MAX_FRAMES 1000 // Longer sequences are always streamed
 #define SEQUENCES_DIR "/sequences"
+#define SEQUENCE_FILE_EXTENSION ".sqb"
+#define SEQUENCE_LEGACY_EXTENSION ".seq"  // JSON files of older firmware, converted by begin()
+#define SEQUENCE_FILE_MAGIC 0x5153324B      // "K2SQ"
+#define SEQUENCE_FILE_VERSION 2             // 1 = JSON .seq
+#define SEQUENCE_FLAG_SOUND 0x0001          // At least one frame triggers a sound
+#define SEQUENCE_JSON_FRAME_MAX 192         // One exported frame as JSON
+#define SEQUENCE_IMPORT_TEMP_PATH SEQUENCES_DIR "/.import.tmp"
+#define SEQUENCE_IMPORT_TOKEN_MAX 40   // Longest string/number the importer keeps
+#define SEQUENCE_INDEX_PATH SEQUENCES_DIR "/.index"   // Metadata of every .sqb, see SequenceIndexHeader
+#define SEQUENCE_INDEX_TEMP_PATH SEQUENCES_DIR "/.index.tmp"
+#define SEQUENCE_INDEX_MAGIC 0x5849324B     // "K2IX"
+#define SEQUENCE_INDEX_VERSION 1
 #define PLAYLISTS_DIR "/playlists"
 
 // Storage capacity (ESP32-S3-Zero: 4MB Flash)
@@ -26,8 +43,14 @@ enum RecordingState {
   REC_PAUSED
 };
 
-// Sequence frame structure - captures a single moment in time
+// Sequence frame structure - captures a single moment in time. Also the
+// record format of .sqb files, so the fields are ordered to leave no
+// padding (little endian, 24 bytes).
 struct SequenceFrame {
+  // LED colors
+  uint32_t eyeColor;        // RGB color (24-bit)
+  uint32_t detailColor;     // RGB color (24-bit)
+
   uint16_t duration;        // Duration to hold this frame (ms)
 
   // Servo positions (0-180)
@@ -38,28 +61,66 @@ struct SequenceFrame {
 
   // Eye animation settings
   uint8_t eyeMode;          // Animation mode (0-13)
-  uint32_t eyeColor;        // RGB color (24-bit)
   uint8_t eyeBrightness;    // 0-255
 
   // Detail LED settings
   uint8_t detailMode;       // Detail pattern (0-4)
-  uint32_t detailColor;     // RGB color (24-bit)
   uint8_t detailBrightness; // 0-255
 
   // Audio settings
   uint8_t soundFile;        // 0 = no sound, 1-255 = file number
   uint8_t soundFolder;      // Folder number (1-99)
   uint8_t volume;           // 0-30
+
+  uint8_t reserved[3];      // Zero
+};
+
+static_assert(sizeof(SequenceFrame) == 24, "SequenceFrame is the .sqb record - bump SEQUENCE_FILE_VERSION");
+
+// .sqb file: this header, then frameCount SequenceFrame records
+struct __attribute__((packed)) SequenceFileHeader {
+  uint32_t magic;           // SEQUENCE_FILE_MAGIC
+  uint8_t version;          // SEQUENCE_FILE_VERSION
+  uint8_t headerSize;       // sizeof(SequenceFileHeader)
+  uint16_t recordSize;      // sizeof(SequenceFrame)
+  char name[MAX_SEQUENCE_NAME_LENGTH];
+  uint16_t frameCount;
+  uint16_t flags;           // SEQUENCE_FLAG_*
+  uint32_t totalDuration;   // ms
+  uint32_t crc;             // CRC-32 of the records (the header is checked field by field)
 };
 
-// Sequence metadata
+static_assert(sizeof(SequenceFileHeader) == 52, "SequenceFileHeader layout changed - bump SEQUENCE_FILE_VERSION");
+
+// Sequence metadata. Also the record format of the index file (little
+// endian, 52 bytes), copied from the .sqb header when the file changes.
 struct SequenceInfo {
   char name[MAX_SEQUENCE_NAME_LENGTH];
-  uint16_t frameCount;
-  uint32_t totalDuration;  // Total duration in ms
+  uint16_t frameCount;      // 0 = header unreadable (the file is still listed)
   uint8_t version;          // Format version
+  uint8_t flags;            // SEQUENCE_FLAG_*
+  uint32_t totalDuration;   // Total duration in ms
+  uint32_t fileSize;        // Bytes
+  uint32_t crc;             // Record CRC from the header
+  uint32_t generation;      // Index generation of the last change to this file
+};
+
+static_assert(sizeof(SequenceInfo) == 52, "SequenceInfo is the index record - bump SEQUENCE_INDEX_VERSION");
+
+// Index file: this header, then count SequenceInfo records sorted by name
+struct __attribute__((packed)) SequenceIndexHeader {
+  uint32_t magic;           // SEQUENCE_INDEX_MAGIC
+  uint8_t version;          // SEQUENCE_INDEX_VERSION
+  uint8_t headerSize;       // sizeof(SequenceIndexHeader)
+  uint16_t recordSize;      // sizeof(SequenceInfo)
+  uint16_t count;
+  uint16_t reserved;        // Zero
+  uint32_t generation;      // Incremented by every change
+  uint32_t crc;             // CRC-32 of the records
 };
 
+static_assert(sizeof(SequenceIndexHeader) == 20, "SequenceIndexHeader layout changed - bump SEQUENCE_INDEX_VERSION");
+
 struct SequenceVerifyInfo {
   char name[MAX_SEQUENCE_NAME_LENGTH];
   uint16_t declaredFrameCount;
@@ -77,6 +138,11 @@ struct SequenceStorageStats {
   uint16_t sequenceCount;
   uint16_t playlistCount;
   char largestSequenceName[MAX_SEQUENCE_NAME_LENGTH];
+  uint8_t cachedSequences;
+  size_t cacheBytes;
+  size_t cacheCapacityBytes;                          // 0 = no PSRAM, cache off
+  uint32_t cacheHits;
+  uint32_t cacheMisses;
 };
 
 // Recording session state
@@ -98,6 +164,32 @@ struct Playlist {
   bool active;
 };
 
+// One decoded sequence in the PSRAM cache
+struct SequenceCacheEntry {
+  char name[MAX_SEQUENCE_NAME_LENGTH];                // Empty = free slot
+  SequenceFrame* frames;
+  uint16_t frameCount;
+  uint8_t pins;                                       // Playback and playlist prefetch
+  bool stale;                                         // File changed while pinned, freed on last unpin
+  bool warm;                                          // IR-mapped or playlist item, never evicted
+  uint32_t lastUsed;
+};
+
+// Next playlist item, opened and read ahead while the current one plays
+struct PlaylistPrefetch {
+  bool attempted;                                     // Once per playing sequence
+  bool ready;
+  uint8_t playlistIndex;
+  char name[MAX_SEQUENCE_NAME_LENGTH];
+  File file;                                          // Positioned after frames[count - 1]
+  SequenceCacheEntry* cached;                         // Instead of file when the item is cached
+  SequenceFrame frames[SEQUENCE_PLAYBACK_RING];
+  uint8_t count;
+  uint16_t totalFrames;
+  uint32_t fileCrc;
+  uint32_t crc;                                       // Of frames[0..count)
+};
+
 // Playback state
 struct PlaybackState {
   bool isPlaying;
@@ -109,23 +201,110 @@ struct PlaybackState {
   unsigned long pauseElapsed;                         // Time elapsed when paused
   bool loop;
   bool soundTriggered;                                // Prevent multiple sound triggers per frame
-  SequenceFrame* frames;
+
+  // Frames are streamed from the open .sqb file (or the cached copy)
+  // through a small ring; ring[ringHead] is the frame at currentFrameIndex
+  File file;
+  SequenceCacheEntry* cached;                         // Pinned while playing, nullptr = streaming
+  SequenceFrame ring[SEQUENCE_PLAYBACK_RING];
+  uint8_t ringHead;
+  uint8_t ringCount;
+  uint16_t nextReadFrame;                             // Record the file is positioned at
+  uint32_t fileCrc;                                   // From the header
+  uint32_t crc;                                       // Running CRC of the records read so far
+  bool crcTracking;                                   // Reading started at record 0
+  bool streamFailed;                                  // Read error, bad frame or CRC mismatch
   Playlist playlist;  // For chaining sequences
+  PlaylistPrefetch prefetch;
+  uint32_t lastTransitionGap;                         // us, last playlist item change (0 = none yet)
+};
+
+class SequenceExporter;
+
+// Decoded sequences in PSRAM, least recently used evicted first. Entries in
+// use by playback are pinned; removing one of those only marks it stale.
+// Warm entries (what a remote button or the playlist starts) are never
+// evicted; a one-off play that does not fit is streamed instead.
+class SequenceCache {
+public:
+  SequenceCache();
+
+  bool begin();                                       // False without PSRAM (cache stays off)
+  bool isEnabled() const { return enabled; }
+  SequenceCacheEntry* find(const char* name);         // Counts hit/miss, marks as used
+  bool contains(const char* name) const;
+  SequenceFrame* allocate(uint16_t frameCount);       // Evicts as needed; free() if not inserted
+  SequenceCacheEntry* insert(const char* name, SequenceFrame* frames, uint16_t frameCount, bool warm = false);
+  void clearWarm();                                   // Start of a warm pass
+  bool markWarm(const char* name);                    // False if not cached
+  void remove(const char* name);
+  void clear();
+  void pin(SequenceCacheEntry* entry);
+  void unpin(SequenceCacheEntry* entry);
+
+  uint8_t getEntryCount() const;
+  size_t getUsedBytes() const { return usedBytes; }
+  size_t getCapacityBytes() const { return enabled ? capacityBytes : 0; }
+  uint32_t getHits() const { return hits; }
+  uint32_t getMisses() const { return misses; }
+
+private:
+  bool makeRoom(size_t bytes);                        // Evicts unpinned, non-warm entries, oldest first
+  void release(SequenceCacheEntry& entry);
+
+  SequenceCacheEntry entries[SEQUENCE_CACHE_ENTRIES];
+  size_t capacityBytes;
+  size_t usedBytes;
+  uint32_t useClock;
+  uint32_t hits;
+  uint32_t misses;
+  bool enabled;
 };
 
 // Global sequence manager
 class SequenceManager {
 private:
+  friend class SequenceImporter;
+
   RecordingSession recording;
   PlaybackState playback;
   bool sdAvailable;
+  SequenceCache cache;
+  bool cacheWarmPending;
 
+  // Index of all sequence files, kept in RAM and written through to
+  // SEQUENCE_INDEX_PATH on every change. The generation is bumped before
+  // the records change so network-task readers can detect a concurrent edit.
+  SequenceInfo* index;
+  uint16_t indexCount;
+  uint16_t indexCapacity;
+  std::atomic<uint32_t> indexGeneration;
+
   // Helper functions
   bool ensureSequenceDir();
   bool ensurePlaylistDir();
   String getSequencePath(const char* name);
   String getPlaylistPath(const char* name);
   bool validateFrame(const SequenceFrame& frame);
+  bool openPlaybackStream(const char* name, uint16_t startFrame);
+  void closePlaybackStream();
+  void refillPlaybackRing();
+  void prefetchNextPlaylistItem();
+  bool takePrefetchedSequence(uint8_t playlistIndex, unsigned long startTime);
+  void discardPrefetch();
+  bool cacheSequenceFrames(const char* name, File& file, const SequenceFileHeader& header,
+                           SequenceCacheEntry*& entry, String& errorMessage, bool warm = false);
+  void warmSequenceCache();                           // Load IR-mapped and playlist sequences into PSRAM
+  void sequenceChanged(const char* name);             // Re-index, drop the cached copy, re-warm if mapped
+  void beginSequenceChange();                         // Index file off disk until sequenceChanged()
+  bool loadSequenceIndex();
+  bool rebuildSequenceIndex();                        // From the .sqb headers
+  bool writeSequenceIndex();
+  SequenceInfo* findIndexEntry(const char* name);
+  bool readIndexEntry(const char* name, SequenceInfo& info);  // From the file, false if it is gone
+  bool storeIndexEntry(const SequenceInfo& info);     // Insert or replace, sorted by name
+  void removeIndexEntry(const char* name);
+  void migrateLegacySequences();   // .seq (JSON) -> .sqb, once per file
 
 public:
   SequenceManager();
@@ -135,6 +314,8 @@ public:
   bool begin();
   bool isStorageAvailable() { return sdAvailable; }
   bool formatStorage();
+  void requestCacheWarm() { cacheWarmPending = true; }  // Mappings or playlist changed
+  void updateCacheWarm();                             // Runs a requested warm (call in loop)
   bool isValidSequenceName(const char* name) const;
 
   // Recording functions
@@ -148,12 +329,16 @@ public:
   const char* getRecordingName() { return recording.name; }
 
   // Playback functions
-  bool playSequence(const char* name, bool loop = false, bool preservePlaylist = false);
+  bool playSequence(const char* name, bool loop = false, bool preservePlaylist = false,
+                    uint16_t startFrame = 0);
   bool stopPlayback(bool preservePlaylist = false);
   bool pausePlayback();
   bool resumePlayback();
   void updatePlayback(); // Call in main loop
   bool isPlaying() { return playback.isPlaying; }
+  bool isPaused() { return playback.isPaused; }
+  bool isLooping() { return playback.loop; }
+  const char* getCurrentSequenceName() { return playback.currentSequenceName; }
   uint16_t getCurrentFrame() { return playback.currentFrameIndex; }
   uint16_t getTotalFrames() { return playback.totalFrames; }
   float getPlaybackProgress(); // Returns 0.0-1.0
@@ -180,12 +365,16 @@ public:
   bool duplicateSequence(const char* sourceName, const char* targetName);
   bool renameSequence(const char* oldName, const char* newName);
   int listSequences(char names[][MAX_SEQUENCE_NAME_LENGTH], int maxCount);
+  int listSequences(char names[][MAX_SEQUENCE_NAME_LENGTH], int maxCount,
+                    uint16_t first, uint32_t generation);  // Any task; -1 if the index changed
   bool getSequenceInfo(const char* name, SequenceInfo& info);
   bool verifySequence(const char* name, SequenceVerifyInfo& info, String& errorMessage);
   bool verifyAllSequences(uint16_t& okCount, uint16_t& failCount, String& report);
-  bool exportSequenceJson(const char* name, String& jsonOut, String& errorMessage);
+  bool exportSequenceJson(const char* name, SequenceExporter& exporter, String& errorMessage);
   bool importSequenceJson(const String& json, String& importedName, String& errorMessage);
   bool getStorageStats(SequenceStorageStats& stats);
+  uint16_t getSequenceCount() { return indexCount; }
+  uint32_t getIndexGeneration() { return indexGeneration; }  // Changes with any sequence file
 
   // File I/O
   bool saveSequenceToSD(const char* name, const SequenceFrame* frames, uint16_t frameCount);
@@ -197,6 +386,105 @@ public:
   void printSequenceInfo(const char* name);
 };
 
+// Incremental sequence JSON import. Bytes are fed in as they arrive (HTTP
+// body chunks, serial paste); each completed frame is validated and appended
+// to a temp file as a .sqb record, so memory use is this object whatever
+// the sequence length. finish() writes the header over the zeroed one at the
+// start and moves the file into place. One import at a time.
+class SequenceImporter {
+public:
+  SequenceImporter();
+  ~SequenceImporter();                                   // Drops an unfinished import
+
+  bool begin(String& errorMessage);                      // Claim the import, open the temp file
+  bool feed(const uint8_t* data, size_t length);         // False once the input was rejected
+  bool finish(String& importedName, String& errorMessage);
+  bool hasData() const { return started; }               // Something besides whitespace arrived
+  bool complete() const { return parseState == PARSE_DONE; }
+  bool failed() const { return error[0] != '\0'; }
+
+private:
+  enum ParseState : uint8_t {
+    PARSE_START,              // Root object expected
+    PARSE_OBJECT_FIRST,       // After '{': key or '}'
+    PARSE_OBJECT_KEY,         // After ',' in an object
+    PARSE_COLON,
+    PARSE_VALUE,              // After ':' or ',' in an array
+    PARSE_ARRAY_FIRST,        // After '[': value or ']'
+    PARSE_AFTER_VALUE,        // ',' or closing bracket
+    PARSE_DONE
+  };
+
+  enum LexState : uint8_t { LEX_NONE, LEX_STRING, LEX_ESCAPE, LEX_UNICODE, LEX_NUMBER, LEX_LITERAL };
+  enum ValueKind : uint8_t { VALUE_STRING, VALUE_NUMBER, VALUE_BOOL, VALUE_NULL };
+
+  bool feedChar(char c);
+  bool startValue(char c);
+  void beginToken(LexState state);
+  void appendToken(char c);
+  bool finishToken(LexState state);                      // String, number or literal just ended
+  bool openContainer(bool isObject);
+  bool closeContainer(bool isObject);
+  bool storeValue(ValueKind kind);
+  bool storeFrameField(uint32_t value);
+  bool valueDone();
+  bool writeFrame();
+  bool writeHeader();
+  bool fail(const char* message);
+  void release();
+
+  File file;
+  bool claimed;
+  bool started;
+  ParseState parseState;
+  LexState lexState;
+  bool stringIsKey;
+  uint8_t unicodeDigits;
+  uint8_t depth;
+  uint16_t objectBits;                                   // Bit n set: level n+1 is an object
+
+  bool inFrames;                                         // Inside the root "frames" array
+  bool inFrame;
+  bool inServos;
+  bool framesSeen;
+
+  char token[SEQUENCE_IMPORT_TOKEN_MAX];
+  uint8_t tokenLength;
+  bool tokenOverflow;
+  char key[16];
+
+  char name[MAX_SEQUENCE_NAME_LENGTH];
+  int32_t declaredFrameCount;                            // -1 = not given
+  uint16_t frameCount;
+  uint32_t totalDuration;
+  uint16_t flags;
+  uint32_t crc;
+  SequenceFrame frame;
+  char error[80];
+};
+
+// Interchange JSON of a stored sequence, produced one frame record at a
+// time (seq export, /seq/export). Set up by SequenceManager::exportSequenceJson.
+class SequenceExporter {
+public:
+  SequenceExporter();
+  ~SequenceExporter();
+
+  void begin(File file, const SequenceFileHeader& header);  // Takes the file, positioned at the records
+  size_t read(uint8_t* buffer, size_t maxLength);           // 0 = finished
+
+private:
+  bool fillPending();
+
+  File file;
+  SequenceFileHeader header;
+  uint16_t nextFrame;
+  uint8_t stage;                                          // Header, frames, footer, done
+  char pending[SEQUENCE_JSON_FRAME_MAX];
+  size_t pendingLength;
+  size_t pendingPos;
+};
+
 // Global instance
 extern SequenceManager sequenceManager;
 
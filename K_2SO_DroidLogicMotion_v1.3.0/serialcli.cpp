@@ -0,0 +1,230 @@
+/*
+================================================================================
+// K-2SO Controller Serial CLI Engine Implementation
+// Bytes are assembled into a fixed buffer as they arrive, split in place
+// into argv tokens and resolved through sorted tables by binary search.
+// Prompts turn multi-step questions into callbacks driven by the poller.
+================================================================================
+*/
+
+#include <Arduino.h>
+#include "serialcli.h"
+
+static char cliEmptyToken[] = "";
+
+//========================================
+// LINE ASSEMBLY
+//========================================
+
+char* cliFeedChar(CLILineAssembler& assembler, char c) {
+  if (c == '\n' && assembler.lastWasCR) {
+    assembler.lastWasCR = false;
+    return nullptr;
+  }
+  assembler.lastWasCR = (c == '\r');
+
+  if (c == '\r' || c == '\n') {
+    bool overflowed = assembler.overflow;
+    uint16_t length = assembler.length;
+    assembler.length = 0;
+    assembler.overflow = false;
+
+    if (overflowed) {
+      Serial.printf("⚠️ Command too long (max %d chars) - discarded\n", CLI_LINE_MAX - 1);
+      return nullptr;
+    }
+    if (length == 0) {
+      return nullptr;
+    }
+    assembler.buffer[length] = '\0';
+    return assembler.buffer;
+  }
+
+  // Backspace / DEL from interactive terminals
+  if (c == '\b' || c == 0x7F) {
+    if (assembler.length > 0 && !assembler.overflow) {
+      assembler.length--;
+    }
+    return nullptr;
+  }
+
+  if (assembler.overflow) {
+    return nullptr;
+  }
+  if (assembler.length >= CLI_LINE_MAX - 1) {
+    assembler.overflow = true;
+    return nullptr;
+  }
+
+  assembler.buffer[assembler.length++] = c;
+  return nullptr;
+}
+
+//========================================
+// TOKENIZER
+//========================================
+
+uint8_t cliTokenize(char* line, char* argv[], uint8_t maxArgs) {
+  uint8_t argc = 0;
+  char* p = line;
+
+  while (*p != '\0' && argc < maxArgs) {
+    while (*p == ' ' || *p == '\t') {
+      p++;
+    }
+    if (*p == '\0') {
+      break;
+    }
+
+    // Quoted token keeps its spaces ("HONOR Magic V2")
+    if (*p == '"') {
+      p++;
+      argv[argc++] = p;
+      while (*p != '\0' && *p != '"') {
+        p++;
+      }
+    } else {
+      argv[argc++] = p;
+      while (*p != '\0' && *p != ' ' && *p != '\t') {
+        p++;
+      }
+    }
+
+    if (*p != '\0') {
+      *p++ = '\0';
+    }
+  }
+
+  // Handlers index argv[1], argv[2] without checking argc first
+  for (uint8_t i = argc; i < maxArgs; i++) {
+    argv[i] = cliEmptyToken;
+  }
+  return argc;
+}
+
+//========================================
+// TABLE LOOKUP
+//========================================
+
+int cliLookup(const CLITableEntry* table, uint8_t count, const char* name) {
+  int low = 0;
+  int high = (int)count - 1;
+
+  while (low <= high) {
+    int mid = (low + high) / 2;
+    int cmp = strcasecmp(name, table[mid].name);
+    if (cmp == 0) {
+      return mid;
+    }
+    if (cmp < 0) {
+      high = mid - 1;
+    } else {
+      low = mid + 1;
+    }
+  }
+  return -1;
+}
+
+bool cliTableSorted(const CLITableEntry* table, uint8_t count) {
+  for (uint8_t i = 0; i < count; i++) {
+    if (i > 0 && strcmp(table[i - 1].name, table[i].name) >= 0) {
+      Serial.printf("❌ CLI table out of order at '%s'\n", table[i].name);
+      return false;
+    }
+    if (table[i].subTable != nullptr && !cliTableSorted(table[i].subTable, table[i].subCount)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool cliIs(const char* token, const char* word) {
+  return strcasecmp(token, word) == 0;
+}
+
+//========================================
+// INTERACTIVE PROMPTS
+//========================================
+
+void cliPromptBegin(CLIPrompt& prompt, CLIPromptHandler handler, const char* arg, unsigned long timeoutMs) {
+  prompt.handler = handler;
+  prompt.raw = false;
+  prompt.quietReported = false;
+  prompt.timeoutMs = timeoutMs;
+  prompt.quietMs = 0;
+  prompt.lastInputAt = millis();
+  if (arg == nullptr) {
+    arg = "";
+  }
+  strncpy(prompt.arg, arg, sizeof(prompt.arg) - 1);
+  prompt.arg[sizeof(prompt.arg) - 1] = '\0';
+}
+
+void cliPromptBeginRaw(CLIPrompt& prompt, CLIPromptHandler handler, unsigned long timeoutMs, unsigned long quietMs) {
+  // Keeps prompt.arg so a wizard can carry its context into the data phase
+  prompt.handler = handler;
+  prompt.raw = true;
+  prompt.quietReported = true;  // No pause to report before the first byte
+  prompt.timeoutMs = timeoutMs;
+  prompt.quietMs = quietMs;
+  prompt.lastInputAt = millis();
+}
+
+bool cliPromptActive(const CLIPrompt& prompt) {
+  return prompt.handler != nullptr;
+}
+
+// Runs the handler and closes the prompt unless the handler kept it open
+// or replaced it with the next step
+static void cliPromptDispatch(CLIPrompt& prompt, CLIPromptEvent event, const char* input) {
+  CLIPromptHandler handler = prompt.handler;
+  bool keepOpen = handler(event, input, prompt.arg);
+  if (!keepOpen && prompt.handler == handler) {
+    prompt.handler = nullptr;
+  }
+}
+
+void cliPromptFeedLine(CLIPrompt& prompt, char* line) {
+  if (prompt.handler == nullptr) {
+    return;
+  }
+  while (*line == ' ' || *line == '\t') {
+    line++;
+  }
+  size_t length = strlen(line);
+  while (length > 0 && (line[length - 1] == ' ' || line[length - 1] == '\t')) {
+    line[--length] = '\0';
+  }
+
+  prompt.lastInputAt = millis();
+  cliPromptDispatch(prompt, CLI_PROMPT_LINE, line);
+}
+
+void cliPromptFeedByte(CLIPrompt& prompt, char c) {
+  if (prompt.handler == nullptr) {
+    return;
+  }
+  char input[2] = {c, '\0'};
+  prompt.lastInputAt = millis();
+  prompt.quietReported = false;
+  cliPromptDispatch(prompt, CLI_PROMPT_BYTE, input);
+}
+
+void cliPromptPoll(CLIPrompt& prompt) {
+  if (prompt.handler == nullptr) {
+    return;
+  }
+  unsigned long idle = millis() - prompt.lastInputAt;
+
+  if (prompt.raw && prompt.quietMs > 0 && !prompt.quietReported && idle > prompt.quietMs) {
+    prompt.quietReported = true;
+    cliPromptDispatch(prompt, CLI_PROMPT_QUIET, "");
+    return;
+  }
+
+  if (idle > prompt.timeoutMs) {
+    CLIPromptHandler handler = prompt.handler;
+    prompt.handler = nullptr;  // A timeout always closes the prompt
+    handler(CLI_PROMPT_TIMEOUT, "", prompt.arg);
+  }
+}
@@ -0,0 +1,92 @@
+/*
+================================================================================
+// K-2SO Controller Serial CLI Engine Header
+// Fixed-buffer line assembler, in-place tokenizer, sorted command tables and
+// interactive prompts. Nothing here allocates; the main loop never waits for
+// a newline or for an answer.
+================================================================================
+*/
+
+#ifndef K2SO_SERIALCLI_H
+#define K2SO_SERIALCLI_H
+
+#include <Arduino.h>
+
+//========================================
+// CLI CONFIGURATION
+//========================================
+
+#define CLI_LINE_MAX            192     // Longest accepted command line (incl. terminator)
+#define CLI_MAX_ARGS            12      // Tokens per line, extra tokens are ignored
+#define CLI_PROMPT_ARG_MAX      32      // Context string kept with a pending prompt
+
+//========================================
+// DATA STRUCTURES
+//========================================
+
+// Line assembler state - bytes are fed in as they arrive
+struct CLILineAssembler {
+  char buffer[CLI_LINE_MAX];
+  uint16_t length;
+  bool overflow;            // Line outgrew the buffer, discard until newline
+  bool lastWasCR;           // Swallow the '\n' of a CRLF pair
+};
+
+// Command table entry. Tables must be sorted by name (strcmp order, lowercase)
+// because lookups use binary search. An entry with a sub-table consumes the
+// next token as well ("ir on" -> CMD_IR_ON).
+struct CLITableEntry {
+  const char* name;
+  uint8_t id;
+  const CLITableEntry* subTable;
+  uint8_t subCount;
+};
+
+// Prompt events delivered to a CLIPromptHandler
+enum CLIPromptEvent : uint8_t {
+  CLI_PROMPT_LINE,          // input = typed answer (line mode)
+  CLI_PROMPT_BYTE,          // input = single received byte (raw mode)
+  CLI_PROMPT_QUIET,         // Raw mode: input paused for quietMs after data
+  CLI_PROMPT_TIMEOUT        // No input for timeoutMs, input = ""
+};
+
+// Return true to keep the prompt open. A handler may start the next prompt
+// of a wizard with cliPromptBegin()/cliPromptBeginRaw() and return true.
+typedef bool (*CLIPromptHandler)(CLIPromptEvent event, const char* input, const char* arg);
+
+// A pending question. While one is open the serial poller routes lines (or,
+// in raw mode, every byte) to the handler instead of the command parser.
+struct CLIPrompt {
+  CLIPromptHandler handler;     // nullptr = no prompt pending
+  bool raw;                     // Deliver bytes instead of lines (pasted data)
+  bool quietReported;           // CLI_PROMPT_QUIET already sent for this pause
+  unsigned long timeoutMs;      // Inactivity timeout
+  unsigned long quietMs;        // Raw mode pause detection, 0 = off
+  unsigned long lastInputAt;
+  char arg[CLI_PROMPT_ARG_MAX]; // Copied context, e.g. the sequence to delete
+};
+
+#define CLI_TABLE_SIZE(table)   ((uint8_t)(sizeof(table) / sizeof((table)[0])))
+
+//========================================
+// FUNCTION DECLARATIONS
+//========================================
+
+// Line assembly
+char* cliFeedChar(CLILineAssembler& assembler, char c);          // Complete line or nullptr
+
+// Tokenizing and lookup
+uint8_t cliTokenize(char* line, char* argv[], uint8_t maxArgs);  // In place; unused argv slots point at ""
+int cliLookup(const CLITableEntry* table, uint8_t count, const char* name);  // Index or -1
+bool cliTableSorted(const CLITableEntry* table, uint8_t count);  // Startup sanity check
+bool cliIs(const char* token, const char* word);                 // Case-insensitive token match
+
+// Interactive prompts
+void cliPromptBegin(CLIPrompt& prompt, CLIPromptHandler handler, const char* arg, unsigned long timeoutMs);
+void cliPromptBeginRaw(CLIPrompt& prompt, CLIPromptHandler handler, unsigned long timeoutMs, unsigned long quietMs);
+bool cliPromptActive(const CLIPrompt& prompt);
+void cliPromptFeedLine(CLIPrompt& prompt, char* line);           // Trims, then hands the answer over
+void cliPromptFeedByte(CLIPrompt& prompt, char c);
+void cliPromptPoll(CLIPrompt& prompt);                            // Timeout / quiet detection (call every loop)
+
+#endif // K2SO_SERIALCLI_H
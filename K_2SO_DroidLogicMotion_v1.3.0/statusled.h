@@ -11,6 +11,7 @@
 #include <Arduino.h>
 #include <Adafruit_NeoPixel.h>
 #include "config.h"
+#include "metrics.h"    // For MeteredNeoPixel
 
 //========================================
 // STATUS LED FUNCTION DECLARATIONS
@@ -96,7 +97,7 @@ String getStatusLEDStateName(StatusLEDState state);  // Get state name as string
 //========================================
 
 // Status LED hardware object (defined in main)
-extern Adafruit_NeoPixel statusLED;
+extern MeteredNeoPixel statusLED;
 
 // Status LED animation state (defined in main)
 extern StatusLEDAnimation statusLEDAnim;
@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+"""
+Web UI asset pipeline: webui/*.html|css|js -> webassets.h
+
+Every file in webui/ is minified, gzip-compressed and emitted as a PROGMEM
+byte array with a content hash. index.html references the other assets as
+{{style.css}} / {{app.js}}; those placeholders become "/style.css?v=<hash>",
+so the browser may cache them forever and only revalidates the page itself.
+
+Runs automatically as a PlatformIO pre-build script (see platformio.ini) and
+only rewrites webassets.h when the output actually changes. Arduino IDE users
+run it by hand after editing webui/ and commit the result:
+
+    python3 tools/build_webui.py
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    env = None
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SOURCE_DIR = os.path.join(PROJECT_DIR, "webui")
+OUTPUT = os.path.join(PROJECT_DIR, "webassets.h")
+
+CONTENT_TYPES = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+}
+
+PLACEHOLDER_RE = re.compile(r"\{\{([\w.-]+)\}\}")
+
+
+# ----------------------------------------------------------------------------
+# Minifiers - conservative on purpose, the UI must behave exactly as written
+# ----------------------------------------------------------------------------
+
+def minify_html(text):
+    text = re.sub(r"<!--.*?-->", "", text, flags=re.S)
+    return "\n".join(line.strip() for line in text.splitlines() if line.strip()) + "\n"
+
+
+def minify_css(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = " ".join(line.strip() for line in text.splitlines() if line.strip())
+    text = re.sub(r"\s*([{};,])\s*", r"\1", text)
+    text = re.sub(r":\s+", ":", text)
+    return text.replace(";}", "}") + "\n"
+
+
+def minify_js(text):
+    # Line structure is kept so automatic semicolon insertion is unaffected
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    lines = []
+    for line in text.splitlines():
+        line = line.strip()
+        if not line or line.startswith("// "):
+            continue
+        lines.append(line)
+    return "\n".join(lines) + "\n"
+
+
+MINIFIERS = {".html": minify_html, ".css": minify_css, ".js": minify_js}
+
+
+# ----------------------------------------------------------------------------
+# Header generation
+# ----------------------------------------------------------------------------
+
+def symbol_for(filename):
+    return "WEBUI_" + re.sub(r"\W", "_", filename).upper()
+
+
+def c_array(name, data):
+    rows = []
+    for i in range(0, len(data), 16):
+        rows.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]))
+    return "static const uint8_t %s[] PROGMEM = {\n%s\n};\n" % (name, ",\n".join(rows))
+
+
+def load_assets():
+    assets = {}
+    for filename in sorted(os.listdir(SOURCE_DIR)):
+        extension = os.path.splitext(filename)[1]
+        if extension not in CONTENT_TYPES:
+            continue
+        with open(os.path.join(SOURCE_DIR, filename), encoding="utf-8") as f:
+            source = f.read()
+        assets[filename] = {"source": source, "minified": MINIFIERS[extension](source),
+                            "type": CONTENT_TYPES[extension]}
+    if "index.html" not in assets:
+        sys.exit("build_webui: webui/index.html missing")
+    return assets
+
+
+def resolve_placeholders(assets):
+    """Sub-resources first, so their hashes are known when index.html is finalized."""
+    for filename, asset in assets.items():
+        if filename != "index.html":
+            asset["hash"] = hashlib.sha1(asset["minified"].encode("utf-8")).hexdigest()[:16]
+
+    def url_for(match):
+        target = match.group(1)
+        if target not in assets or target == "index.html":
+            sys.exit("build_webui: unknown asset {{%s}} in index.html" % target)
+        return "/%s?v=%s" % (target, assets[target]["hash"])
+
+    index = assets["index.html"]
+    index["minified"] = PLACEHOLDER_RE.sub(url_for, index["minified"])
+    index["hash"] = hashlib.sha1(index["minified"].encode("utf-8")).hexdigest()[:16]
+
+
+def render(assets):
+    arrays = []
+    rows = []
+    summary = []
+    # index.html first - the firmware serves WEBUI_ASSETS[0] for "/"
+    order = ["index.html"] + [name for name in assets if name != "index.html"]
+    for filename in order:
+        asset = assets[filename]
+        compressed = gzip.compress(asset["minified"].encode("utf-8"), compresslevel=9, mtime=0)
+        symbol = symbol_for(filename)
+        arrays.append(c_array(symbol, compressed))
+        path = "/" if filename == "index.html" else "/" + filename
+        rows.append('  {"%s", "%s", %s, sizeof(%s), "\\"%s\\"", %s}' % (
+            path, asset["type"], symbol, symbol, asset["hash"],
+            "false" if filename == "index.html" else "true"))
+        summary.append("// %-11s %6d bytes source, %6d minified, %5d gzip" % (
+            filename, len(asset["source"].encode("utf-8")),
+            len(asset["minified"].encode("utf-8")), len(compressed)))
+
+    return """/*
+================================================================================
+// K-2SO Controller Web UI Assets
+// GENERATED by tools/build_webui.py from webui/ - do not edit by hand.
+%s
+================================================================================
+*/
+
+#ifndef K2SO_WEBASSETS_H
+#define K2SO_WEBASSETS_H
+
+#include <Arduino.h>
+#include "webpage.h"      // For WebAsset
+
+%s
+static const WebAsset WEBUI_ASSETS[] = {
+%s
+};
+
+#define WEBUI_ASSET_COUNT       %d
+
+#endif // K2SO_WEBASSETS_H
+""" % ("\n".join(summary), "\n".join(arrays), ",\n".join(rows), len(rows))
+
+
+def main():
+    assets = load_assets()
+    resolve_placeholders(assets)
+    output = render(assets)
+
+    try:
+        with open(OUTPUT, encoding="utf-8") as f:
+            current = f.read()
+    except OSError:
+        current = None
+
+    if current == output:
+        print("webassets.h up to date")
+        return
+    with open(OUTPUT, "w", encoding="utf-8", newline="\n") as f:
+        f.write(output)
+    print("webassets.h regenerated (%s)" % ", ".join(
+        "%s %s" % (name, assets[name]["hash"]) for name in assets))
+
+
+if env is not None or __name__ == "__main__":
+    main()
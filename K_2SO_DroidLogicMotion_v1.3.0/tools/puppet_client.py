@@ -0,0 +1,322 @@
+#!/usr/bin/env python3
+"""
+K-2SO puppet link reference client.
+
+Speaks the framed binary protocol from puppetlink.h over the USB serial port:
+
+    0xA5 0x5A <type> <len> <payload[len]> <crc16 lo> <crc16 hi>
+
+CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) over type, len and payload.
+Text output from the firmware is interleaved on the same port; the reader
+skips everything that is not a valid frame.
+
+Usage:
+    puppet_client.py loopback                    # offline codec self-check
+    puppet_client.py loopback --port COM5        # PING/PONG round trips on the device
+    puppet_client.py pose --port COM5 90 90 90 90 --eye 255 0 0 --detail 0 0 255
+    puppet_client.py sweep --port COM5 --rate 100 --seconds 10
+    puppet_client.py stats --port COM5
+    puppet_client.py release --port COM5
+
+Requires pyserial for anything that talks to the device (pip install pyserial).
+"""
+
+import argparse
+import math
+import os
+import struct
+import sys
+import time
+
+SYNC1 = 0xA5
+SYNC2 = 0x5A
+MAX_PAYLOAD = 32
+
+TYPE_POSE = 0x01
+TYPE_PING = 0x02
+TYPE_RELEASE = 0x03
+TYPE_STATS = 0x04
+TYPE_PONG = 0x82
+TYPE_STATS_REPLY = 0x84
+
+POSE_SERVOS = 0x01
+POSE_EYES = 0x02
+POSE_DETAIL = 0x04
+
+POSE_FORMAT = "<BB4B3BB3B"          # Matches struct PuppetPose (13 bytes)
+STATS_FORMAT = "<3IH4IB"            # Matches sendStatsReply() (31 bytes)
+STATS_FIELDS = ("framesOk", "crcErrors", "lengthErrors", "unknownTypes",
+                "frameTimeouts", "posesApplied", "posesSuperseded", "releases",
+                "lastSequence")
+
+
+# ----------------------------------------------------------------------------
+# Codec
+# ----------------------------------------------------------------------------
+
+def crc16(data, crc=0xFFFF):
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def encode_frame(frame_type, payload=b""):
+    if len(payload) > MAX_PAYLOAD:
+        raise ValueError("payload too long (%d > %d)" % (len(payload), MAX_PAYLOAD))
+    body = bytes([frame_type, len(payload)]) + bytes(payload)
+    crc = crc16(body)
+    return bytes([SYNC1, SYNC2]) + body + bytes([crc & 0xFF, crc >> 8])
+
+
+def encode_pose(sequence, servos=None, eye=None, brightness=255, detail=None):
+    flags = 0
+    if servos is not None:
+        flags |= POSE_SERVOS
+    if eye is not None:
+        flags |= POSE_EYES
+    if detail is not None:
+        flags |= POSE_DETAIL
+    servos = servos or (0, 0, 0, 0)
+    eye = eye or (0, 0, 0)
+    detail = detail or (0, 0, 0)
+    payload = struct.pack(POSE_FORMAT, sequence & 0xFF, flags,
+                          *[int(v) & 0xFF for v in servos],
+                          *[int(v) & 0xFF for v in eye], int(brightness) & 0xFF,
+                          *[int(v) & 0xFF for v in detail])
+    return encode_frame(TYPE_POSE, payload)
+
+
+class FrameDecoder:
+    """Byte-fed decoder, same state machine as puppetLinkFeed()."""
+
+    def __init__(self):
+        self.state = "sync1"
+        self.frames = []
+        self.text = bytearray()
+        self.crc_errors = 0
+        self.length_errors = 0
+
+    def feed(self, data):
+        for byte in data:
+            self._feed_byte(byte)
+        frames, self.frames = self.frames, []
+        return frames
+
+    def _feed_byte(self, byte):
+        if self.state == "sync1":
+            if byte == SYNC1:
+                self.state = "sync2"
+            else:
+                self.text.append(byte)
+        elif self.state == "sync2":
+            self.state = "type" if byte == SYNC2 else "sync1"
+        elif self.state == "type":
+            self.type = byte
+            self.state = "length"
+        elif self.state == "length":
+            if byte > MAX_PAYLOAD:
+                self.length_errors += 1
+                self.state = "sync1"
+                return
+            self.length = byte
+            self.payload = bytearray()
+            self.state = "payload" if byte else "crc_lo"
+        elif self.state == "payload":
+            self.payload.append(byte)
+            if len(self.payload) >= self.length:
+                self.state = "crc_lo"
+        elif self.state == "crc_lo":
+            self.crc_lo = byte
+            self.state = "crc_hi"
+        elif self.state == "crc_hi":
+            self.state = "sync1"
+            expected = crc16(bytes([self.type, self.length]) + bytes(self.payload))
+            if (byte << 8 | self.crc_lo) != expected:
+                self.crc_errors += 1
+                return
+            self.frames.append((self.type, bytes(self.payload)))
+
+
+# ----------------------------------------------------------------------------
+# Device link
+# ----------------------------------------------------------------------------
+
+class PuppetLink:
+    def __init__(self, port, baud=115200):
+        try:
+            import serial
+        except ImportError:
+            sys.exit("pyserial is required: pip install pyserial")
+        self.port = serial.Serial(port, baud, timeout=0.01)
+        self.decoder = FrameDecoder()
+
+    def send(self, frame):
+        self.port.write(frame)
+
+    def wait_for(self, frame_type, timeout):
+        deadline = time.monotonic() + timeout
+        while time.monotonic() < deadline:
+            for received_type, payload in self.decoder.feed(self.port.read(256)):
+                if received_type == frame_type:
+                    return payload
+        return None
+
+    def drain_text(self):
+        self.decoder.feed(self.port.read(4096))
+        text, self.decoder.text = bytes(self.decoder.text), bytearray()
+        return text.decode("utf-8", errors="replace")
+
+
+# ----------------------------------------------------------------------------
+# Commands
+# ----------------------------------------------------------------------------
+
+def offline_loopback():
+    """Encode frames, corrupt some, interleave CLI text and decode again."""
+    decoder = FrameDecoder()
+    stream = bytearray(b"status\r\n")
+    expected = []
+    for sequence in range(200):
+        frame = encode_pose(sequence, servos=(sequence % 180, 90, 45, 135),
+                            eye=(sequence, 0, 255 - sequence), detail=(0, sequence, 0))
+        stream += frame
+        expected.append((TYPE_POSE, frame[4:-2]))
+        if sequence % 50 == 0:
+            stream += b"seq list\n"
+    ping = encode_frame(TYPE_PING, os.urandom(MAX_PAYLOAD))
+    stream += ping
+    expected.append((TYPE_PING, ping[4:-2]))
+
+    stats_values = (1000, 2, 3, 4, 5, 900, 80, 6, 199)
+    stats_reply = encode_frame(TYPE_STATS_REPLY, struct.pack(STATS_FORMAT, *stats_values))
+    stream += stats_reply
+    expected.append((TYPE_STATS_REPLY, stats_reply[4:-2]))
+
+    corrupted = bytearray(encode_pose(7, servos=(1, 2, 3, 4)))
+    corrupted[6] ^= 0x40
+    stream += corrupted
+
+    frames = decoder.feed(bytes(stream))
+    ok = frames == expected and decoder.crc_errors == 1 and decoder.length_errors == 0
+    ok = ok and struct.unpack(STATS_FORMAT, frames[-1][1]) == stats_values
+    text = decoder.text.decode()
+    ok = ok and text.count("seq list") == 4 and text.startswith("status")
+    print("offline loopback: %d frames decoded, %d CRC error(s), text intact: %s -> %s"
+          % (len(frames), decoder.crc_errors, "yes" if "status" in text else "no",
+             "PASS" if ok else "FAIL"))
+    return 0 if ok else 1
+
+
+def device_loopback(link, count):
+    rtts = []
+    failures = 0
+    for i in range(count):
+        payload = os.urandom(1 + i % MAX_PAYLOAD)
+        start = time.perf_counter()
+        link.send(encode_frame(TYPE_PING, payload))
+        reply = link.wait_for(TYPE_PONG, 0.5)
+        if reply != payload:
+            failures += 1
+            continue
+        rtts.append((time.perf_counter() - start) * 1000.0)
+
+    link.send(encode_frame(TYPE_STATS))
+    reply = link.wait_for(TYPE_STATS_REPLY, 1.0)
+    if reply is None or len(reply) != struct.calcsize(STATS_FORMAT):
+        print("device loopback: no valid STATS_REPLY")
+        failures += 1
+    if rtts:
+        rtts.sort()
+        print("device loopback: %d/%d ok, RTT min %.2f ms, median %.2f ms, max %.2f ms"
+              % (len(rtts), count, rtts[0], rtts[len(rtts) // 2], rtts[-1]))
+    print("result: %s" % ("PASS" if failures == 0 else "FAIL (%d lost/corrupt)" % failures))
+    return 0 if failures == 0 else 1
+
+
+def print_stats(link):
+    link.send(encode_frame(TYPE_STATS))
+    reply = link.wait_for(TYPE_STATS_REPLY, 1.0)
+    if reply is None:
+        print("no stats reply")
+        return 1
+    for name, value in zip(STATS_FIELDS, struct.unpack(STATS_FORMAT, reply)):
+        print("%-16s %d" % (name, value))
+    return 0
+
+
+def sweep(link, rate, seconds):
+    period = 1.0 / rate
+    start = time.perf_counter()
+    next_send = start
+    sequence = 0
+    while time.perf_counter() - start < seconds:
+        t = time.perf_counter() - start
+        pan = 90 + 40 * math.sin(2 * math.pi * 0.25 * t)
+        tilt = 90 + 20 * math.sin(2 * math.pi * 0.5 * t)
+        glow = int(128 + 127 * math.sin(2 * math.pi * 1.0 * t))
+        link.send(encode_pose(sequence, servos=(pan, tilt, pan, tilt),
+                              eye=(glow, 0, 0), brightness=255))
+        sequence += 1
+        next_send += period
+        delay = next_send - time.perf_counter()
+        if delay > 0:
+            time.sleep(delay)
+        link.drain_text()
+    print("sent %d poses in %.1f s (%.1f Hz)" % (sequence, seconds, sequence / seconds))
+    return print_stats(link)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="K-2SO puppet link reference client")
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    p = sub.add_parser("loopback", help="codec self-check, or PING/PONG with --port")
+    p.add_argument("--port")
+    p.add_argument("--count", type=int, default=100)
+
+    p = sub.add_parser("pose", help="send a single pose")
+    p.add_argument("--port", required=True)
+    p.add_argument("servos", type=int, nargs=4, metavar=("EP", "ET", "HP", "HT"))
+    p.add_argument("--eye", type=int, nargs=3, metavar=("R", "G", "B"))
+    p.add_argument("--brightness", type=int, default=255)
+    p.add_argument("--detail", type=int, nargs=3, metavar=("R", "G", "B"))
+
+    p = sub.add_parser("sweep", help="stream a sine-wave pose at a fixed rate")
+    p.add_argument("--port", required=True)
+    p.add_argument("--rate", type=float, default=50.0)
+    p.add_argument("--seconds", type=float, default=10.0)
+
+    for name in ("stats", "release"):
+        p = sub.add_parser(name)
+        p.add_argument("--port", required=True)
+
+    args = parser.parse_args()
+
+    if args.command == "loopback" and not args.port:
+        return offline_loopback()
+
+    link = PuppetLink(args.port)
+    time.sleep(0.1)
+    link.drain_text()
+
+    if args.command == "loopback":
+        return device_loopback(link, args.count)
+    if args.command == "pose":
+        link.send(encode_pose(0, servos=args.servos, eye=args.eye,
+                              brightness=args.brightness, detail=args.detail))
+        return 0
+    if args.command == "sweep":
+        return sweep(link, args.rate, args.seconds)
+    if args.command == "stats":
+        return print_stats(link)
+    if args.command == "release":
+        link.send(encode_frame(TYPE_RELEASE))
+        return 0
+    return 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,673 @@
+/*
+================================================================================
+// K-2SO Controller Web UI Assets
+// GENERATED by tools/build_webui.py from webui/ - do not edit by hand.
+// index.html   10586 bytes source,   7861 minified,  1752 gzip
+// app.js       35447 bytes source,  27700 minified,  6303 gzip
+// style.css    12355 bytes source,   9238 minified,  2145 gzip
+================================================================================
+*/
+
+#ifndef K2SO_WEBASSETS_H
+#define K2SO_WEBASSETS_H
+
+#include <Arduino.h>
+#include "webpage.h"      // For WebAsset
+
+static const uint8_t WEBUI_INDEX_HTML[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x99, 0xcb, 0x72, 0xdb, 0x36,
+  0x14, 0x40, 0xf7, 0xf9, 0x0a, 0x94, 0x1b, 0xbb, 0x33, 0xa1, 0x25, 0xf9, 0x91, 0xc8, 0x89, 0xa5,
+  0x8e, 0x6c, 0xc9, 0xb1, 0xea, 0x97, 0x2a, 0xd9, 0xce, 0x74, 0x09, 0x91, 0x90, 0x84, 0x06, 0x24,
+  0x58, 0x00, 0x92, 0xa3, 0x65, 0x37, 0x5d, 0x74, 0x93, 0xa6, 0xed, 0x24, 0xed, 0xaa, 0xbf, 0xd0,
+  0x55, 0x27, 0xdd, 0xf6, 0x53, 0xfa, 0x03, 0xed, 0x27, 0xf4, 0x02, 0x20, 0xad, 0x47, 0x48, 0x59,
+  0xa2, 0xd5, 0xce, 0x78, 0x4c, 0x11, 0x17, 0x38, 0xb8, 0xbc, 0x2f, 0x80, 0xe0, 0xc1, 0x27, 0xf5,
+  0xcb, 0xa3, 0xab, 0x2f, 0x5b, 0x0d, 0x34, 0x50, 0x01, 0xab, 0x3e, 0x3a, 0xd0, 0x17, 0xc4, 0x70,
+  0xd8, 0xaf, 0x38, 0x24, 0x74, 0x74, 0x03, 0xc1, 0x3e, 0x5c, 0x02, 0xa2, 0x30, 0xf2, 0x06, 0x58,
+  0x48, 0xa2, 0x2a, 0xce, 0xf5, 0xd5, 0xb1, 0x5b, 0x76, 0x92, 0xe6, 0x10, 0x07, 0xa4, 0xe2, 0x8c,
+  0x28, 0xb9, 0x8d, 0xb8, 0x50, 0x0e, 0xf2, 0x78, 0xa8, 0x48, 0x08, 0xdd, 0x6e, 0xa9, 0xaf, 0x06,
+  0x15, 0x9f, 0x8c, 0xa8, 0x47, 0x5c, 0x73, 0xf3, 0x18, 0xd1, 0x90, 0x2a, 0x8a, 0x99, 0x2b, 0x3d,
+  0xcc, 0x48, 0xa5, 0xb4, 0x55, 0xd4, 0x18, 0x45, 0x15, 0x23, 0xd5, 0x53, 0x77, 0xbb, 0x73, 0x89,
+  0x8e, 0x60, 0xb4, 0xe0, 0x8c, 0x11, 0x71, 0x50, 0xb0, 0xed, 0x33, 0xd3, 0xf8, 0x44, 0x7a, 0x82,
+  0x46, 0x8a, 0xf2, 0x70, 0x6a, 0xa6, 0x96, 0xe0, 0x3d, 0x22, 0x25, 0x34, 0x62, 0x86, 0x2c, 0xa7,
+  0x2e, 0x38, 0xf5, 0xa7, 0x68, 0xa8, 0x09, 0x7d, 0x45, 0x0f, 0x7b, 0x64, 0x4e, 0x71, 0x3c, 0x54,
+  0x03, 0x2e, 0xa6, 0x60, 0x35, 0x7f, 0x84, 0x43, 0x8f, 0xf8, 0x31, 0xa2, 0x33, 0x96, 0x8a, 0x04,
+  0x52, 0x8f, 0x62, 0x34, 0x7c, 0x85, 0x04, 0x61, 0x15, 0x47, 0xaa, 0x31, 0x23, 0x72, 0x40, 0x08,
+  0x3c, 0xef, 0x40, 0x90, 0x5e, 0xc5, 0x29, 0x98, 0xa6, 0x2d, 0x4f, 0xca, 0xcf, 0x46, 0x15, 0x5c,
+  0x24, 0x3b, 0xbb, 0x04, 0x7b, 0xdd, 0x9d, 0x5d, 0xaf, 0xbc, 0xbf, 0xbd, 0xab, 0x07, 0x17, 0x62,
+  0x53, 0x76, 0xb9, 0x3f, 0x86, 0x8b, 0x4f, 0x47, 0xc8, 0x63, 0x58, 0xca, 0x8a, 0x13, 0x60, 0x1a,
+  0xba, 0x7a, 0x7a, 0xb8, 0x12, 0xe1, 0xcc, 0x0a, 0x3d, 0xfb, 0x04, 0xae, 0x24, 0x9e, 0x79, 0x68,
+  0xed, 0x93, 0xed, 0x44, 0x18, 0x37, 0xba, 0xc6, 0x50, 0x4e, 0xd5, 0xaa, 0x8a, 0x3a, 0x0a, 0xab,
+  0xa1, 0x84, 0x09, 0xb7, 0x67, 0x51, 0xd2, 0xb4, 0xbb, 0x7d, 0x41, 0x7d, 0x27, 0x55, 0x42, 0x61,
+  0x74, 0xba, 0x84, 0xe1, 0x2e, 0x61, 0x4e, 0xf5, 0x9c, 0xfb, 0xe4, 0xa0, 0x00, 0xe2, 0xd4, 0x4e,
+  0x23, 0xcc, 0x86, 0xc4, 0x41, 0xd4, 0x07, 0xad, 0x87, 0x42, 0x80, 0x31, 0x75, 0x7f, 0x50, 0xeb,
+  0xa8, 0x76, 0x71, 0xd1, 0xbc, 0x78, 0x91, 0x8c, 0xcc, 0x04, 0xdc, 0x3b, 0x7f, 0xf2, 0x64, 0x4b,
+  0x68, 0x20, 0x8d, 0x2d, 0xec, 0x00, 0xa7, 0x5a, 0x7b, 0x59, 0x3b, 0x6d, 0x3c, 0x7c, 0xfe, 0x6b,
+  0x08, 0xbc, 0x80, 0xac, 0x30, 0xbf, 0x1d, 0xe0, 0x54, 0x8b, 0xc5, 0x67, 0xe6, 0xef, 0xe1, 0x2a,
+  0x1c, 0x0b, 0x42, 0x50, 0xbb, 0x76, 0xbe, 0x94, 0x12, 0x3d, 0xe8, 0x7c, 0x4e, 0x02, 0x2e, 0xc6,
+  0xa0, 0x02, 0x3a, 0x3d, 0x9c, 0x9b, 0x3e, 0x53, 0x99, 0x95, 0x82, 0x8e, 0x88, 0x11, 0x4f, 0x12,
+  0x2d, 0x25, 0xe8, 0xb4, 0xd8, 0xed, 0x43, 0xaa, 0x45, 0xd8, 0x84, 0x5d, 0x77, 0xa8, 0x14, 0x0f,
+  0x13, 0x71, 0x2c, 0x70, 0xbb, 0x0a, 0xf2, 0x99, 0x87, 0x1e, 0xa3, 0xde, 0x2b, 0x3d, 0x48, 0x19,
+  0xac, 0xdc, 0x2c, 0x3e, 0x46, 0xa5, 0x32, 0xfc, 0xb3, 0xd7, 0x4f, 0x9d, 0xea, 0x5f, 0xdf, 0xbe,
+  0x3b, 0x28, 0x58, 0xc6, 0xca, 0xb0, 0xfd, 0x84, 0xb6, 0x3f, 0x85, 0x7b, 0x9b, 0x1b, 0x67, 0x50,
+  0x33, 0xff, 0x0c, 0xf0, 0x7d, 0x6e, 0x60, 0xac, 0x99, 0xb9, 0x18, 0xd4, 0xf7, 0xcb, 0xa0, 0x90,
+  0x47, 0x74, 0x69, 0x9b, 0x22, 0xda, 0x86, 0x1a, 0x63, 0x31, 0x57, 0xb3, 0xde, 0xbf, 0x79, 0xd8,
+  0x73, 0x4e, 0xd9, 0xce, 0xa8, 0xf6, 0xc3, 0x43, 0x9e, 0x32, 0xfe, 0x33, 0xa0, 0x5f, 0x1e, 0xe4,
+  0xce, 0xc4, 0x64, 0x06, 0xf5, 0xe3, 0xc3, 0x1e, 0xf1, 0x2e, 0xd6, 0x0c, 0xec, 0xe7, 0x29, 0x58,
+  0x4a, 0xae, 0x99, 0xb0, 0x8e, 0xb8, 0xa4, 0x3a, 0x17, 0xe4, 0x5c, 0xca, 0x26, 0xed, 0xae, 0x4f,
+  0x65, 0xc4, 0xf0, 0x38, 0x4b, 0x1c, 0xe7, 0x74, 0x63, 0x4c, 0x50, 0x0b, 0x87, 0x29, 0xd3, 0xdc,
+  0xf5, 0x9c, 0x4a, 0x6a, 0x32, 0x26, 0xd0, 0xb9, 0xc5, 0x61, 0xd2, 0xfd, 0xe2, 0x9f, 0xbf, 0x65,
+  0x67, 0x71, 0x0e, 0x2d, 0xae, 0x28, 0x53, 0xcb, 0xab, 0xa1, 0x7b, 0xaf, 0x5f, 0x8f, 0x13, 0x58,
+  0x27, 0x57, 0x30, 0x87, 0x5e, 0x56, 0xff, 0x13, 0x7b, 0x18, 0x3d, 0x56, 0x30, 0x88, 0x56, 0x64,
+  0x91, 0x45, 0xd6, 0x52, 0x6d, 0xb5, 0x93, 0x32, 0x6b, 0x2d, 0x23, 0xbe, 0x1b, 0xc3, 0xe4, 0x47,
+  0xdb, 0x08, 0xc6, 0x85, 0x6b, 0x03, 0x5a, 0x7e, 0x5c, 0x86, 0x63, 0x31, 0x14, 0x13, 0x41, 0xfc,
+  0xd9, 0x0c, 0x39, 0xd2, 0xa2, 0xcd, 0x0d, 0x68, 0xdf, 0x80, 0xbc, 0x68, 0x37, 0xea, 0x99, 0x49,
+  0x36, 0x81, 0xf4, 0x61, 0xdd, 0x09, 0x53, 0x31, 0x46, 0xa2, 0x41, 0x2f, 0xda, 0x8d, 0xc6, 0xc5,
+  0x12, 0xa8, 0xae, 0xb1, 0x6f, 0x0a, 0x49, 0x0b, 0x34, 0xe8, 0xf0, 0xec, 0xba, 0xb1, 0x04, 0xe7,
+  0x76, 0x00, 0x4b, 0x6b, 0x2a, 0xc8, 0x48, 0x34, 0xe9, 0xe5, 0x49, 0xf3, 0x6a, 0x19, 0x14, 0xef,
+  0xf5, 0x52, 0x41, 0xd0, 0xae, 0x31, 0x97, 0xc7, 0xc7, 0x0b, 0x4b, 0x07, 0x0e, 0x69, 0x80, 0x8d,
+  0x4f, 0x33, 0xdd, 0x31, 0xd5, 0x65, 0xbe, 0x60, 0xd5, 0x12, 0xd1, 0xe6, 0x46, 0x4f, 0x37, 0x12,
+  0xa1, 0xe7, 0x3c, 0x3e, 0x6b, 0x1e, 0x9d, 0x36, 0xda, 0x99, 0xca, 0x2f, 0x07, 0x8c, 0x86, 0x4c,
+  0x1a, 0x4b, 0xb4, 0xae, 0xcf, 0x3a, 0x8d, 0xc5, 0xf5, 0x8f, 0x51, 0x9f, 0x88, 0xd9, 0x5d, 0xab,
+  0xc9, 0x9b, 0xb9, 0x0e, 0x71, 0x2e, 0x1d, 0x0a, 0xda, 0x1f, 0xa8, 0x10, 0xf6, 0xe8, 0xe8, 0x40,
+  0x46, 0x38, 0x9c, 0xeb, 0x35, 0x95, 0x45, 0xdd, 0xbb, 0x9e, 0x37, 0xa6, 0xb1, 0x5a, 0xda, 0x83,
+  0x5d, 0x93, 0x1e, 0x53, 0x3d, 0x28, 0x18, 0x1a, 0xcc, 0x44, 0xc3, 0x68, 0xa8, 0x90, 0x1a, 0x47,
+  0xb0, 0x7f, 0x17, 0xf0, 0xb6, 0x02, 0x63, 0x67, 0x80, 0xf3, 0xa8, 0x4e, 0xdc, 0x1a, 0xd0, 0xb0,
+  0xe2, 0x14, 0xe1, 0x8a, 0x5f, 0x57, 0x9c, 0xed, 0xbd, 0x3d, 0x07, 0x99, 0x99, 0x2b, 0x0e, 0x4c,
+  0xa2, 0xad, 0x62, 0xb8, 0xc6, 0x2a, 0x13, 0x85, 0x37, 0xd5, 0x80, 0xca, 0x2d, 0xd3, 0xef, 0x53,
+  0x67, 0xcd, 0xd9, 0x5c, 0x87, 0xd7, 0x10, 0xca, 0xd0, 0x59, 0xa3, 0x9e, 0x2b, 0xa9, 0x57, 0x74,
+  0x82, 0x9d, 0x66, 0x18, 0xaa, 0xfb, 0x7c, 0xe0, 0x1b, 0xb5, 0x4c, 0xd7, 0xd8, 0x09, 0x7b, 0x39,
+  0x5d, 0x30, 0x45, 0x9a, 0xf1, 0x41, 0x29, 0xf6, 0x41, 0xf9, 0xce, 0x03, 0x7b, 0xb3, 0xf6, 0xaf,
+  0x4f, 0x06, 0x66, 0x38, 0xe0, 0xff, 0x08, 0x46, 0xab, 0xfe, 0xe1, 0xfa, 0x42, 0x72, 0x1e, 0xb8,
+  0x7a, 0x60, 0xd6, 0xe7, 0x08, 0xf7, 0x5b, 0xe7, 0x61, 0xf5, 0xc6, 0xce, 0xd7, 0xc2, 0x0a, 0x76,
+  0x94, 0xa1, 0xae, 0xba, 0xf0, 0x0e, 0x6c, 0xcb, 0x6e, 0xf3, 0xe2, 0x34, 0x4f, 0xbd, 0x99, 0x03,
+  0xf6, 0xb0, 0x6f, 0x4a, 0xce, 0x71, 0xad, 0xde, 0x58, 0x03, 0xce, 0x1b, 0x60, 0x5b, 0xc2, 0x8e,
+  0x4e, 0x6a, 0x9d, 0x75, 0x00, 0x33, 0x6b, 0x62, 0x5e, 0x20, 0x04, 0x87, 0xcf, 0x03, 0xb3, 0x96,
+  0xd6, 0x2e, 0xea, 0x97, 0xe7, 0xf9, 0x91, 0x8d, 0x10, 0x77, 0xa1, 0x3a, 0x2c, 0x5e, 0x78, 0xd6,
+  0x52, 0xa7, 0x6a, 0x43, 0x9f, 0x2e, 0x7a, 0xc7, 0x5b, 0x2d, 0xff, 0x6e, 0x38, 0x1b, 0x06, 0xe4,
+  0xbe, 0xdc, 0x1b, 0x99, 0x5e, 0x77, 0x19, 0x97, 0x33, 0xe1, 0x2c, 0x25, 0x35, 0xcd, 0x76, 0x8a,
+  0x53, 0x59, 0x36, 0x9b, 0x64, 0x56, 0xc3, 0x25, 0x0a, 0x0f, 0xd4, 0x27, 0x3f, 0x3b, 0xad, 0x62,
+  0xf1, 0x8c, 0xf7, 0xf4, 0xc6, 0xb3, 0xa3, 0xdb, 0x37, 0x4b, 0x00, 0xfd, 0xe7, 0xd7, 0x9f, 0xbe,
+  0x43, 0x4d, 0x54, 0x0b, 0xec, 0xa9, 0x55, 0x66, 0x2c, 0x2c, 0x26, 0x6d, 0x27, 0xa4, 0x43, 0x32,
+  0xc0, 0x23, 0xca, 0x45, 0x4e, 0xce, 0x4e, 0xc2, 0x39, 0x16, 0x44, 0x0e, 0xd0, 0x65, 0x48, 0x72,
+  0x82, 0x76, 0x13, 0xd0, 0x11, 0x23, 0x58, 0xc0, 0x86, 0x09, 0x9d, 0x70, 0xa9, 0x28, 0x23, 0x32,
+  0x27, 0x70, 0x2f, 0x01, 0x7e, 0x31, 0xa4, 0x44, 0xe5, 0x84, 0x3c, 0x49, 0x20, 0x6d, 0x93, 0x82,
+  0xe8, 0x86, 0x53, 0x2f, 0xef, 0x13, 0x3e, 0x4d, 0x58, 0x35, 0x46, 0x84, 0x42, 0xa6, 0x31, 0x27,
+  0xaa, 0x7c, 0xe7, 0x3d, 0xce, 0x3f, 0x26, 0xad, 0x25, 0x7f, 0x93, 0xb8, 0x40, 0xf6, 0x00, 0x6f,
+  0x3e, 0x7f, 0x03, 0x68, 0xcd, 0x8e, 0x62, 0x2b, 0x85, 0x7d, 0x2f, 0x06, 0xe6, 0x28, 0x39, 0xde,
+  0xf2, 0x70, 0x08, 0x09, 0xd3, 0x37, 0x27, 0x7c, 0x33, 0xb5, 0x49, 0xb7, 0x6c, 0x6e, 0x24, 0x72,
+  0x5d, 0x97, 0x26, 0xe7, 0x7f, 0x19, 0xf6, 0x49, 0x66, 0xb0, 0x68, 0xac, 0x2d, 0x9a, 0xc5, 0x35,
+  0x42, 0x0d, 0xad, 0x9d, 0x35, 0xda, 0x57, 0x4b, 0x12, 0xa9, 0xcf, 0x48, 0x16, 0x50, 0xcb, 0x34,
+  0xaf, 0x59, 0x3f, 0x6b, 0xe4, 0x31, 0x3b, 0x32, 0xe7, 0xbe, 0x15, 0x47, 0x9f, 0xaa, 0x42, 0x05,
+  0x84, 0xba, 0x11, 0x3e, 0x43, 0x25, 0x54, 0x40, 0x6e, 0xe9, 0xf9, 0x3d, 0xe7, 0x66, 0x5f, 0x0f,
+  0x49, 0xe8, 0x11, 0x74, 0x8e, 0x43, 0xdc, 0x27, 0x01, 0x09, 0x55, 0x4a, 0x65, 0x1d, 0x76, 0x33,
+  0x86, 0xa5, 0x9e, 0x82, 0xc6, 0x32, 0x97, 0x51, 0xa9, 0x62, 0x3f, 0xc5, 0x4d, 0x67, 0xba, 0x65,
+  0xb6, 0x37, 0x09, 0x22, 0x35, 0x76, 0x03, 0xd8, 0x43, 0xc0, 0xf4, 0xb0, 0x3b, 0xe4, 0xd8, 0x07,
+  0x87, 0xa1, 0x64, 0x84, 0xdc, 0xda, 0xda, 0x5a, 0xf0, 0x2e, 0x0d, 0xe1, 0xab, 0x67, 0x99, 0x6c,
+  0x4d, 0x13, 0x43, 0x04, 0x58, 0xf4, 0x29, 0xac, 0x59, 0x1c, 0x2c, 0x19, 0x3c, 0x43, 0xdb, 0xc5,
+  0xe8, 0xf5, 0xf3, 0x8f, 0x83, 0x0a, 0x7c, 0x93, 0x0c, 0x9d, 0xf1, 0x8a, 0x9d, 0xbb, 0x19, 0xe8,
+  0x4f, 0x09, 0xfa, 0xdc, 0xca, 0xfe, 0x42, 0x9f, 0x77, 0x2e, 0xb3, 0x5f, 0x16, 0x17, 0xb3, 0x6e,
+  0x88, 0xa0, 0xbd, 0x71, 0x8d, 0x31, 0x8d, 0xb3, 0x37, 0x90, 0xb4, 0x6c, 0x55, 0xda, 0x80, 0xdf,
+  0x26, 0xa6, 0xd7, 0x87, 0xca, 0xe6, 0x50, 0xcd, 0xfc, 0x58, 0x11, 0xc4, 0xc0, 0xcc, 0x9d, 0x29,
+  0xa7, 0x68, 0x4e, 0x9b, 0xf4, 0x74, 0xc1, 0xbd, 0xe7, 0xc0, 0xc9, 0x86, 0xc1, 0x24, 0x22, 0x9c,
+  0xfb, 0x42, 0xa5, 0x05, 0x3e, 0xea, 0x62, 0xef, 0xd5, 0x22, 0xf7, 0xd9, 0x33, 0x63, 0x1b, 0x2b,
+  0x51, 0xdc, 0x3f, 0x39, 0x34, 0x6f, 0x42, 0x6a, 0x2c, 0xe5, 0xfa, 0x15, 0x3d, 0xd2, 0xc2, 0x43,
+  0x49, 0xcc, 0xa1, 0xe4, 0x9b, 0x0f, 0x7f, 0x7f, 0x78, 0x83, 0xcc, 0x7d, 0x4e, 0xef, 0xb6, 0x89,
+  0xd4, 0x2b, 0xb5, 0x86, 0xbd, 0xfb, 0x1d, 0xd9, 0xbb, 0x9c, 0xa8, 0x8e, 0xe2, 0x91, 0xd5, 0xea,
+  0x0f, 0xad, 0x95, 0xbe, 0x5d, 0xa6, 0x20, 0xe4, 0x74, 0x8c, 0xb6, 0xe0, 0x12, 0x8e, 0xc9, 0x90,
+  0xd2, 0xb0, 0xc7, 0x27, 0x4e, 0xd3, 0x4d, 0x4d, 0xdd, 0x52, 0x7d, 0x74, 0xc1, 0x27, 0x09, 0x8c,
+  0x68, 0x88, 0x12, 0xf1, 0xa3, 0x75, 0x3a, 0x32, 0x19, 0xd8, 0xc1, 0x23, 0xd2, 0x12, 0x1c, 0xea,
+  0x88, 0xc9, 0x06, 0xb8, 0x5b, 0xd1, 0xf4, 0x09, 0x48, 0xd7, 0x9e, 0x09, 0x48, 0xdf, 0xe5, 0x04,
+  0x69, 0xcb, 0x26, 0xc1, 0xa0, 0x7f, 0xe7, 0xd6, 0xc7, 0x86, 0x02, 0x2c, 0xcb, 0xdf, 0x20, 0x7d,
+  0x93, 0x93, 0x63, 0xb6, 0x3f, 0x16, 0xf4, 0xfe, 0xad, 0x0e, 0x2a, 0xd3, 0xb0, 0xc2, 0x26, 0x3d,
+  0x47, 0x70, 0x35, 0xdb, 0xe8, 0xd0, 0xaa, 0x78, 0x8e, 0xa3, 0x08, 0x2a, 0x7a, 0xda, 0x4a, 0x41,
+  0x85, 0x1b, 0x58, 0xe9, 0xd4, 0x5a, 0x41, 0x45, 0x3c, 0x62, 0xf9, 0xc5, 0x02, 0x26, 0x8b, 0x39,
+  0x29, 0xcb, 0x45, 0xea, 0xc5, 0x7e, 0xbe, 0x45, 0x52, 0x78, 0x15, 0xa7, 0x00, 0x43, 0xb7, 0xbe,
+  0xd2, 0x1f, 0x4c, 0x4b, 0x3b, 0xc5, 0x27, 0x65, 0x5c, 0xde, 0x2b, 0xf9, 0x65, 0xaf, 0xbc, 0x5f,
+  0x7e, 0xea, 0xc0, 0x46, 0xdf, 0xf6, 0xd4, 0x23, 0xe3, 0x4f, 0xa6, 0x05, 0xfb, 0x91, 0xfa, 0x5f,
+  0xa7, 0xeb, 0x07, 0xaa, 0xb5, 0x1e, 0x00, 0x00
+};
+
+static const uint8_t WEBUI_APP_JS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x3d, 0xed, 0x72, 0xdb, 0x48,
+  0x72, 0xff, 0xf5, 0x14, 0xb3, 0xda, 0x3d, 0x01, 0xcc, 0x4a, 0x24, 0x2d, 0x7f, 0xac, 0x97, 0xb4,
+  0xa4, 0xb3, 0x64, 0x79, 0x4f, 0x59, 0xd9, 0x56, 0x59, 0xb6, 0x77, 0x5d, 0x5e, 0xd7, 0x11, 0x24,
+  0x86, 0x12, 0x56, 0x20, 0x40, 0x03, 0xa0, 0x3e, 0x56, 0xc7, 0xaa, 0xe4, 0x09, 0x52, 0xa9, 0x4a,
+  0x2e, 0x7f, 0x52, 0x95, 0xaa, 0x3c, 0x41, 0x7e, 0x5d, 0xe5, 0x77, 0x1e, 0x65, 0x5f, 0x20, 0x79,
+  0x84, 0xf4, 0xc7, 0xcc, 0x60, 0x00, 0x82, 0x14, 0x45, 0xc9, 0xbb, 0xba, 0x2b, 0xdb, 0xc4, 0xa0,
+  0xa7, 0xbb, 0xa7, 0xa7, 0xa7, 0xa7, 0xbb, 0xa7, 0x07, 0x1b, 0xca, 0x4c, 0xa4, 0x99, 0x97, 0x8d,
+  0xd2, 0xb7, 0x43, 0xdf, 0xcb, 0xe4, 0x5e, 0x94, 0xc9, 0xe4, 0xd4, 0x0b, 0xdb, 0x4b, 0x21, 0xbc,
+  0x09, 0x83, 0x34, 0xab, 0x6a, 0x0f, 0xd2, 0x9d, 0x38, 0x8a, 0x64, 0x2f, 0x93, 0xbe, 0xd8, 0x10,
+  0x59, 0x32, 0x92, 0xdc, 0x7e, 0x26, 0xbb, 0xfb, 0x41, 0x74, 0x02, 0x6d, 0xd1, 0x28, 0x0c, 0xdb,
+  0xc2, 0xfe, 0x5f, 0xa3, 0x21, 0x7e, 0x90, 0xdd, 0xc3, 0xb8, 0x77, 0x02, 0x80, 0x59, 0x2c, 0xb2,
+  0x63, 0x29, 0xfc, 0x24, 0x0e, 0x7c, 0xe1, 0x22, 0xb0, 0x38, 0x3b, 0x0e, 0x42, 0x68, 0x09, 0xd2,
+  0x9e, 0x46, 0x5d, 0x63, 0x1e, 0xbc, 0x34, 0x7b, 0x2d, 0x7b, 0x71, 0xe2, 0x07, 0xd1, 0x11, 0x60,
+  0xee, 0x7b, 0x61, 0x0a, 0xe4, 0xfc, 0xb8, 0x37, 0x1a, 0xc8, 0x28, 0xab, 0x7b, 0xbe, 0xbf, 0x7b,
+  0x0a, 0x3f, 0xf6, 0x81, 0x57, 0x19, 0xc9, 0xc4, 0x75, 0x9e, 0xbd, 0x7a, 0x01, 0xec, 0x65, 0xd8,
+  0x16, 0x7b, 0xbe, 0xf4, 0x9d, 0x55, 0xd1, 0x1f, 0x45, 0xbd, 0x2c, 0x88, 0x23, 0xb7, 0x26, 0x2e,
+  0x97, 0x80, 0x40, 0x1a, 0x87, 0xb2, 0x1e, 0xc6, 0x47, 0xae, 0xf3, 0xfd, 0xda, 0xfa, 0xe1, 0x2b,
+  0x81, 0xf0, 0x49, 0x1c, 0x86, 0x32, 0x11, 0x41, 0x14, 0x64, 0x81, 0x17, 0x06, 0xbf, 0x40, 0xc7,
+  0x5a, 0x7b, 0x09, 0x84, 0x93, 0x64, 0x87, 0x96, 0x84, 0x52, 0x17, 0x5a, 0x7b, 0x12, 0xe5, 0xf1,
+  0x34, 0x0c, 0x0f, 0x41, 0x2a, 0x31, 0x35, 0x85, 0x40, 0xeb, 0x50, 0x7e, 0x1a, 0xc9, 0xa8, 0x27,
+  0x91, 0x17, 0xdd, 0x76, 0x10, 0x7a, 0x17, 0x28, 0x47, 0xc6, 0xa1, 0x5b, 0xf7, 0x5e, 0xbf, 0xf0,
+  0x86, 0x43, 0x18, 0x11, 0xb5, 0x10, 0x91, 0x7d, 0x23, 0xec, 0xd4, 0x7d, 0xd8, 0x6c, 0x36, 0x91,
+  0x0c, 0x8b, 0xe2, 0x07, 0x16, 0xab, 0x9b, 0xb7, 0xd0, 0x88, 0x0f, 0xb3, 0x44, 0x7a, 0x03, 0xd3,
+  0xff, 0x3b, 0x6f, 0x20, 0x87, 0xc0, 0x03, 0xb5, 0x02, 0x66, 0x7c, 0x31, 0x86, 0x3f, 0x7a, 0xec,
+  0xa2, 0x6a, 0x28, 0x20, 0x8e, 0x11, 0xfd, 0xce, 0xd9, 0xab, 0x52, 0x07, 0x90, 0x7b, 0x2a, 0x33,
+  0xfd, 0xe4, 0xda, 0x5d, 0x56, 0xc5, 0x3a, 0x33, 0x3b, 0xb6, 0x29, 0xc5, 0xc3, 0x49, 0x42, 0x41,
+  0x5f, 0xb8, 0x55, 0xc8, 0x69, 0x4e, 0x42, 0xe9, 0x25, 0x06, 0x7f, 0x25, 0xd4, 0x54, 0xce, 0x48,
+  0xd7, 0x80, 0xfc, 0xb8, 0x34, 0x54, 0x5b, 0xa0, 0x81, 0x45, 0x0b, 0xf9, 0x98, 0xd4, 0xec, 0x49,
+  0x2e, 0x2a, 0x60, 0x90, 0xcc, 0x64, 0x73, 0x49, 0x3a, 0x30, 0xd8, 0x8d, 0x4d, 0xc0, 0x36, 0xbf,
+  0x46, 0x8c, 0x57, 0x45, 0x60, 0x93, 0xf0, 0xd2, 0x8b, 0xa8, 0x67, 0x94, 0x56, 0x94, 0xd5, 0x40,
+  0x8d, 0xe1, 0x0b, 0xd7, 0x31, 0x2b, 0xca, 0x01, 0x04, 0xe2, 0x2c, 0x88, 0xfc, 0xf8, 0xac, 0x56,
+  0x13, 0x89, 0xcc, 0x46, 0x49, 0xa4, 0xd6, 0x6a, 0xd4, 0x8f, 0xdb, 0x4b, 0x59, 0x72, 0x81, 0xbd,
+  0xe0, 0x37, 0x30, 0xeb, 0x9d, 0x79, 0x41, 0x06, 0x40, 0x9e, 0xff, 0x74, 0x18, 0xbc, 0x96, 0xe9,
+  0x10, 0x16, 0x84, 0x74, 0xb9, 0xb5, 0x2f, 0xb3, 0xde, 0xb1, 0xeb, 0x34, 0xce, 0xd2, 0x06, 0x42,
+  0x3b, 0x35, 0x64, 0x48, 0xf4, 0x3c, 0x68, 0x15, 0xae, 0x4c, 0x92, 0x38, 0x41, 0xf2, 0x30, 0xdc,
+  0x37, 0xc1, 0x40, 0xc6, 0xa3, 0xcc, 0x2d, 0x32, 0xb7, 0x2a, 0xee, 0x35, 0x59, 0x1d, 0x34, 0x0f,
+  0x63, 0x5a, 0x6f, 0x60, 0x65, 0x78, 0xe5, 0xc3, 0x74, 0xc9, 0xb3, 0xdc, 0x12, 0xb8, 0x9d, 0xb3,
+  0xb4, 0xd5, 0x68, 0x7c, 0x75, 0x19, 0xc6, 0x40, 0x03, 0x06, 0x5b, 0x3f, 0x8e, 0xd3, 0x6c, 0xfc,
+  0xd5, 0x25, 0x12, 0xaf, 0x0f, 0xbd, 0xec, 0x78, 0xbc, 0x95, 0xc5, 0x27, 0x32, 0xda, 0x50, 0x4d,
+  0xf4, 0x30, 0xee, 0xa0, 0x36, 0x10, 0x82, 0x7a, 0x1c, 0xc5, 0x43, 0x19, 0x01, 0x5e, 0x2d, 0xf6,
+  0xdc, 0x08, 0x31, 0x04, 0xea, 0xcd, 0x84, 0x3a, 0x56, 0xac, 0xb9, 0xfb, 0xcc, 0xb8, 0xb2, 0x55,
+  0xaf, 0xa2, 0xf0, 0x82, 0x87, 0x2d, 0x53, 0x21, 0xfd, 0x20, 0x4b, 0xc5, 0x00, 0x8c, 0x89, 0xe8,
+  0x27, 0xf1, 0x80, 0x6c, 0x57, 0x2a, 0x13, 0x30, 0x13, 0x62, 0x67, 0x7f, 0x0f, 0xa5, 0xa1, 0xec,
+  0x21, 0x0c, 0x40, 0xcd, 0x2a, 0x1a, 0x45, 0x5e, 0xaf, 0xb9, 0xad, 0xc9, 0xed, 0x5f, 0x88, 0x0c,
+  0x1a, 0x43, 0x87, 0x76, 0x66, 0x6c, 0x0d, 0x68, 0x20, 0xd3, 0xd4, 0x3b, 0x92, 0x38, 0x26, 0x89,
+  0x0b, 0x5d, 0x0d, 0x0c, 0x0c, 0x46, 0x78, 0xa1, 0xe4, 0x8c, 0x54, 0xa4, 0xfb, 0xf7, 0x87, 0xaf,
+  0x5e, 0x82, 0x90, 0x12, 0x98, 0x3d, 0x02, 0xac, 0xc3, 0x48, 0xbc, 0x5a, 0x09, 0x5b, 0x2f, 0x8c,
+  0x53, 0x69, 0xc9, 0x07, 0x55, 0xc7, 0xc8, 0x68, 0x43, 0x4b, 0xa9, 0x56, 0x90, 0x1c, 0x2f, 0xa9,
+  0x6a, 0xdb, 0x37, 0xcd, 0x58, 0x8d, 0x67, 0x69, 0xc5, 0x7d, 0x05, 0x53, 0x34, 0x13, 0x32, 0xf2,
+  0xb5, 0x52, 0xf7, 0xe2, 0xc1, 0xc0, 0x8b, 0x7c, 0xa3, 0xdb, 0x9a, 0x97, 0xbf, 0xfc, 0x45, 0xef,
+  0x2a, 0x75, 0x54, 0xd8, 0x0b, 0x1a, 0xb8, 0xf8, 0x02, 0xf8, 0x36, 0xd2, 0xac, 0xbf, 0x3a, 0xd8,
+  0x7d, 0xa9, 0x95, 0x5e, 0xef, 0x0f, 0xba, 0x13, 0xd2, 0x30, 0xc8, 0xb5, 0x56, 0xaa, 0x2d, 0xcb,
+  0x62, 0x65, 0x52, 0xb6, 0x68, 0x6c, 0xa4, 0x66, 0xc7, 0x19, 0xc4, 0xbe, 0xa4, 0x35, 0x66, 0x9a,
+  0xcd, 0x06, 0x74, 0x24, 0xb3, 0xdd, 0x50, 0xe2, 0xcf, 0xed, 0x8b, 0x3d, 0xdf, 0x75, 0x7a, 0xa3,
+  0x24, 0x81, 0x87, 0x17, 0xd8, 0xa3, 0x56, 0xcf, 0xe4, 0x79, 0xa6, 0x76, 0x23, 0xd4, 0x48, 0xec,
+  0x5d, 0x47, 0x64, 0x6d, 0x65, 0x77, 0x11, 0x6c, 0x7b, 0x94, 0x65, 0xa0, 0x27, 0x6e, 0xfe, 0x16,
+  0xd4, 0x7c, 0x3f, 0x3e, 0x93, 0xc9, 0x8e, 0x07, 0x53, 0x4b, 0x13, 0xca, 0x6c, 0xc0, 0x1a, 0x3d,
+  0x99, 0x97, 0x8f, 0xf4, 0x02, 0x36, 0xc4, 0x01, 0x4f, 0xdf, 0x14, 0x46, 0x08, 0x9d, 0xd8, 0x12,
+  0xce, 0xd3, 0x1f, 0x9e, 0x7e, 0xbf, 0xeb, 0x88, 0x96, 0x70, 0x0e, 0xf7, 0x77, 0x77, 0x0f, 0xf6,
+  0x5e, 0x7e, 0xe7, 0x18, 0x9a, 0xa3, 0x61, 0x06, 0x93, 0x7a, 0x2d, 0xa2, 0x6f, 0xb9, 0x4b, 0x99,
+  0x68, 0x3f, 0x4e, 0x06, 0x5e, 0xc6, 0x2f, 0xd5, 0x60, 0x19, 0x79, 0x3e, 0xc0, 0x7e, 0x22, 0xe5,
+  0x0b, 0x39, 0x88, 0x93, 0x8b, 0x39, 0x09, 0x5a, 0x1d, 0xaa, 0xc9, 0xf1, 0x4b, 0x45, 0x2e, 0x87,
+  0xce, 0x49, 0x76, 0x93, 0xe0, 0xe8, 0x38, 0x8b, 0x60, 0xcd, 0xcd, 0x49, 0x32, 0xef, 0x70, 0x18,
+  0x06, 0xbe, 0x4c, 0x80, 0x30, 0x18, 0xee, 0x91, 0x34, 0x62, 0xcd, 0x01, 0xda, 0xf3, 0x60, 0x79,
+  0x87, 0x9d, 0xa7, 0xcc, 0x90, 0x8d, 0x4a, 0xf1, 0x7b, 0x1a, 0x87, 0xa3, 0xb9, 0xe7, 0x83, 0x81,
+  0xa7, 0xf0, 0xc9, 0x2f, 0xdb, 0x57, 0xf5, 0x9e, 0xc5, 0x9f, 0x46, 0xa1, 0x78, 0x1b, 0xaa, 0xad,
+  0x2d, 0xe7, 0x0e, 0x17, 0xb0, 0x93, 0xaa, 0x5d, 0xb0, 0xc8, 0xf4, 0x94, 0xbd, 0x90, 0x31, 0x25,
+  0xda, 0xe5, 0x2b, 0xf6, 0xa1, 0xbd, 0xbb, 0xe0, 0x11, 0xae, 0xac, 0x88, 0x2f, 0x98, 0x17, 0xd3,
+  0xa5, 0x56, 0xbd, 0xf9, 0x6a, 0x37, 0xf4, 0x29, 0x6d, 0x41, 0x06, 0x5a, 0x9c, 0x79, 0xa9, 0xf8,
+  0x79, 0x84, 0x5b, 0x94, 0x77, 0x2a, 0x7d, 0xdc, 0xe1, 0x4b, 0x2e, 0x67, 0x09, 0x7d, 0xc9, 0xd7,
+  0xa8, 0x72, 0xc9, 0xf2, 0x1d, 0x9a, 0x9b, 0xe3, 0x51, 0xa2, 0x46, 0x3f, 0xb1, 0x47, 0xf3, 0xee,
+  0x48, 0xe6, 0x3b, 0x55, 0xbb, 0xa3, 0xd5, 0x07, 0x76, 0x62, 0x7e, 0xe5, 0xd4, 0x34, 0x28, 0x7b,
+  0x41, 0x00, 0x3a, 0x75, 0xda, 0x70, 0x16, 0xba, 0x5e, 0xef, 0x44, 0xaf, 0x7d, 0xd3, 0xf3, 0x38,
+  0x3e, 0x3b, 0x48, 0xe2, 0xa3, 0x04, 0xd4, 0x09, 0x37, 0x84, 0xa1, 0xda, 0x11, 0x18, 0x63, 0x69,
+  0x7e, 0x3b, 0x3f, 0x8d, 0xd6, 0x1f, 0x6e, 0x3f, 0x12, 0x5f, 0x5d, 0x0e, 0xeb, 0x7a, 0xfe, 0xc6,
+  0x62, 0x0d, 0x36, 0x40, 0xf0, 0x33, 0xa9, 0x95, 0x7e, 0x8d, 0x1b, 0xe6, 0x67, 0x3a, 0x16, 0x2e,
+  0x3e, 0x0c, 0x65, 0x82, 0xfe, 0xf1, 0xf8, 0x0f, 0xb5, 0x0e, 0x59, 0x7c, 0x1e, 0x40, 0x85, 0xa3,
+  0x4e, 0x72, 0x05, 0xef, 0xbc, 0xb0, 0xcb, 0xe5, 0x83, 0x44, 0x45, 0xad, 0xde, 0xe1, 0xda, 0x2c,
+  0x5d, 0x9e, 0x17, 0x1c, 0xad, 0x9a, 0xf4, 0xca, 0x81, 0x38, 0x7b, 0x7e, 0x28, 0xd1, 0x9c, 0x09,
+  0x09, 0x3b, 0x83, 0xd0, 0x5e, 0x28, 0x74, 0xf4, 0x46, 0xa9, 0xf4, 0x6b, 0xb3, 0x04, 0x70, 0xff,
+  0xf9, 0x63, 0x18, 0x2a, 0x83, 0xe7, 0x42, 0x70, 0x55, 0xcf, 0x8e, 0x41, 0x0a, 0x28, 0x2c, 0xd9,
+  0xba, 0x97, 0x42, 0x03, 0xb7, 0x44, 0xb1, 0xf3, 0x2a, 0xcb, 0x4f, 0x37, 0xd3, 0x83, 0x6a, 0x4b,
+  0x0b, 0x8d, 0xe9, 0xea, 0x92, 0x92, 0x63, 0xb1, 0x19, 0xac, 0xf5, 0x0b, 0xf0, 0x8a, 0xea, 0xfd,
+  0x30, 0x8e, 0x13, 0xd7, 0x7a, 0x23, 0xfe, 0x0e, 0x5d, 0x2f, 0xd1, 0x28, 0x40, 0xd7, 0xc0, 0xa4,
+  0x37, 0xc5, 0x98, 0x96, 0x15, 0xfe, 0x3d, 0x75, 0x2a, 0x86, 0x8a, 0xf5, 0xf2, 0x6c, 0x14, 0x86,
+  0x35, 0xdd, 0xdd, 0x98, 0x89, 0x5a, 0x69, 0x63, 0xf5, 0x44, 0xeb, 0xb7, 0x57, 0xcc, 0xb5, 0x06,
+  0xab, 0x2b, 0xc5, 0x80, 0xfd, 0xdf, 0x41, 0xb7, 0x6e, 0x88, 0xde, 0xd3, 0x35, 0x66, 0xbe, 0x0a,
+  0x0f, 0xcf, 0xa6, 0x33, 0x87, 0x22, 0xe4, 0xbd, 0x2b, 0x75, 0x61, 0x69, 0x5c, 0x0e, 0x83, 0x2a,
+  0xc3, 0x32, 0x6d, 0x1c, 0x22, 0xef, 0x34, 0x38, 0xf2, 0xb2, 0x38, 0xc1, 0x05, 0xac, 0xc0, 0xd2,
+  0xa2, 0xf3, 0x8e, 0x96, 0xe8, 0x50, 0x0d, 0x06, 0x06, 0x52, 0x15, 0x65, 0x28, 0x31, 0x7a, 0x18,
+  0x89, 0x3f, 0x4d, 0x12, 0xef, 0xa2, 0x8e, 0x2e, 0xaa, 0x5b, 0x89, 0x1c, 0x5c, 0x89, 0x7a, 0x1f,
+  0x0c, 0x90, 0x3b, 0xc4, 0xbe, 0x43, 0xbd, 0x8e, 0xb0, 0x33, 0x98, 0x69, 0xed, 0x73, 0x95, 0x6d,
+  0x93, 0x77, 0x1e, 0x90, 0xb9, 0x80, 0x8e, 0xf2, 0x9c, 0xa8, 0x92, 0x06, 0x26, 0xf1, 0x08, 0x30,
+  0x7d, 0xdb, 0x14, 0x5f, 0xa3, 0x10, 0xfc, 0xba, 0x77, 0x2e, 0xd3, 0x0f, 0x04, 0xf3, 0x11, 0xb1,
+  0x35, 0x6b, 0xa0, 0x91, 0xdf, 0x36, 0x8d, 0xf1, 0x19, 0xc6, 0x69, 0x80, 0x52, 0x41, 0x54, 0x1f,
+  0x10, 0xa5, 0xdb, 0xac, 0x41, 0xb4, 0xf0, 0xb8, 0x09, 0x36, 0x85, 0x1e, 0xef, 0xc1, 0x23, 0xfd,
+  0x58, 0x2f, 0xb6, 0xdf, 0xaf, 0x7d, 0xd4, 0x38, 0x94, 0x1f, 0x87, 0xd2, 0x38, 0x14, 0x0e, 0x10,
+  0x36, 0x48, 0xeb, 0x3f, 0xc7, 0x41, 0xe4, 0x3a, 0xc2, 0x51, 0x63, 0xd2, 0x90, 0xe8, 0x28, 0x1a,
+  0x21, 0xc2, 0x56, 0x51, 0xe5, 0x72, 0xd2, 0x76, 0x91, 0x0b, 0x5a, 0x35, 0x6b, 0x07, 0x8d, 0x22,
+  0xfc, 0x03, 0x4d, 0xc7, 0xad, 0xd7, 0xeb, 0x86, 0x28, 0x2f, 0xab, 0x55, 0xf1, 0xa0, 0x59, 0x15,
+  0xb5, 0x15, 0xe3, 0x6a, 0xa0, 0xc1, 0x31, 0x18, 0x8f, 0x24, 0x51, 0x51, 0x97, 0x89, 0xc6, 0x74,
+  0xdc, 0x95, 0x1a, 0x9b, 0x4d, 0x53, 0xa3, 0xe1, 0xea, 0x31, 0x4c, 0x4b, 0x76, 0x9c, 0xc4, 0x67,
+  0xbc, 0x43, 0x60, 0x20, 0xe6, 0x3a, 0x2f, 0x65, 0x76, 0x16, 0x27, 0x27, 0x39, 0x36, 0xdc, 0xca,
+  0xa2, 0x38, 0x13, 0xf1, 0x49, 0x6e, 0xf5, 0x71, 0x15, 0x59, 0x41, 0x9f, 0xc2, 0xf7, 0x73, 0x8a,
+  0xd9, 0x90, 0xf6, 0x62, 0x6e, 0x2c, 0xa2, 0x54, 0x5e, 0xec, 0x62, 0xee, 0x27, 0x21, 0x98, 0xed,
+  0x7d, 0xde, 0x82, 0x8b, 0x49, 0x54, 0x8c, 0x87, 0x79, 0x63, 0x17, 0x92, 0xd0, 0x15, 0x3c, 0xc8,
+  0x49, 0x17, 0xde, 0x48, 0x66, 0xc2, 0x83, 0x9f, 0x11, 0x24, 0x4e, 0xc6, 0xd7, 0x3a, 0x6c, 0x94,
+  0x3c, 0xcf, 0x0c, 0xae, 0x34, 0x0a, 0x22, 0x9c, 0x20, 0x94, 0x7e, 0x0b, 0xec, 0x29, 0xc3, 0x57,
+  0xe3, 0xa6, 0x38, 0x88, 0x35, 0xb4, 0xac, 0x99, 0x00, 0xae, 0xf2, 0x56, 0xf2, 0x42, 0x1e, 0x78,
+  0x11, 0x20, 0xba, 0x90, 0x6f, 0x82, 0x30, 0x5b, 0x15, 0xc7, 0x10, 0x63, 0x51, 0x0b, 0xfe, 0xc0,
+  0x26, 0x93, 0xb8, 0xb1, 0x16, 0x4e, 0xe7, 0x10, 0x6c, 0x21, 0x77, 0x1d, 0xf3, 0x2f, 0x84, 0xc4,
+  0x9f, 0xaa, 0xbb, 0xfe, 0x49, 0xcd, 0x9d, 0x9a, 0x95, 0x65, 0x2a, 0x2e, 0xa6, 0x39, 0xc8, 0xdb,
+  0x89, 0x04, 0x5e, 0x40, 0xb8, 0x25, 0x61, 0x62, 0x0f, 0x6d, 0x29, 0x78, 0x96, 0x80, 0x30, 0xd7,
+  0xf5, 0x29, 0xcb, 0xaa, 0xd3, 0x30, 0x43, 0xde, 0x62, 0x9a, 0x1b, 0x66, 0x00, 0x2b, 0x8a, 0xf8,
+  0x46, 0x3e, 0x90, 0x15, 0xc5, 0xc6, 0x46, 0x3e, 0xa0, 0x15, 0xcd, 0xd0, 0x46, 0x61, 0x64, 0xbc,
+  0x4a, 0x0b, 0x8b, 0xf4, 0x26, 0x43, 0xc5, 0xa1, 0x3d, 0x97, 0xd2, 0xc7, 0x3d, 0x06, 0x66, 0x9d,
+  0x18, 0x16, 0x83, 0xf8, 0x94, 0x72, 0x98, 0x4e, 0x3a, 0xea, 0xf5, 0x70, 0x8b, 0xae, 0x59, 0x6e,
+  0xc7, 0x84, 0x49, 0xa0, 0x4e, 0xc6, 0x50, 0xb2, 0xaa, 0x38, 0xac, 0x06, 0x93, 0x59, 0x9c, 0x49,
+  0x72, 0xac, 0x52, 0x2d, 0x32, 0xae, 0xf4, 0xb3, 0xae, 0x92, 0x11, 0x40, 0x9f, 0x9e, 0x99, 0x3a,
+  0x6c, 0x22, 0x5e, 0x18, 0xe2, 0x6c, 0x1c, 0x43, 0x64, 0x31, 0x39, 0x1b, 0x45, 0x07, 0xb9, 0x9c,
+  0x2c, 0xe5, 0x04, 0x92, 0x7a, 0xfa, 0xb6, 0xb9, 0x2a, 0xf2, 0x3f, 0xc5, 0x0d, 0x74, 0x51, 0x49,
+  0xce, 0x8a, 0x88, 0xb8, 0x3b, 0xa0, 0x9b, 0x58, 0xec, 0xfc, 0x06, 0x06, 0xee, 0xfc, 0xcf, 0x7f,
+  0xcd, 0x32, 0x40, 0x8a, 0xf0, 0x14, 0x14, 0xf8, 0xea, 0x6a, 0x1c, 0x8a, 0xe7, 0x2a, 0x1c, 0xea,
+  0xd5, 0x7c, 0x38, 0xa6, 0x31, 0xa2, 0xdf, 0x19, 0x2c, 0x55, 0x46, 0x60, 0x27, 0x0e, 0x41, 0x65,
+  0x7a, 0xf8, 0x77, 0xbe, 0x3f, 0x15, 0x96, 0x97, 0x52, 0x9e, 0x2b, 0xf6, 0x2c, 0x54, 0x16, 0xc6,
+  0x52, 0xb9, 0x1e, 0x8a, 0x6a, 0xb6, 0x7b, 0x21, 0x19, 0x58, 0xf4, 0x8e, 0xbd, 0xe8, 0xe8, 0x1a,
+  0xaa, 0xbd, 0xc3, 0xbd, 0x16, 0x50, 0xed, 0xfd, 0xdd, 0x67, 0x37, 0x53, 0xec, 0x9c, 0x52, 0x85,
+  0x18, 0x9f, 0x46, 0xc1, 0x80, 0x72, 0x97, 0xae, 0xa7, 0x7f, 0xdd, 0x58, 0x9c, 0x39, 0xa6, 0x39,
+  0x44, 0x6a, 0x18, 0x60, 0x8f, 0xf3, 0x1a, 0x22, 0xcd, 0x7b, 0x2e, 0x22, 0xd6, 0xbc, 0xf7, 0xe7,
+  0x13, 0xee, 0xb6, 0x49, 0x80, 0xb8, 0x94, 0xbc, 0x98, 0x33, 0x33, 0x53, 0x9d, 0xb3, 0x20, 0x0c,
+  0xed, 0xc9, 0xfd, 0x6c, 0x1b, 0xf6, 0x2b, 0x7a, 0x47, 0x9b, 0x95, 0xde, 0x70, 0xe6, 0xf0, 0xd7,
+  0x3a, 0x8d, 0x9c, 0xe4, 0x16, 0x61, 0xd8, 0xc8, 0x31, 0xcd, 0xe5, 0xc2, 0xe5, 0xe3, 0xab, 0x9a,
+  0x82, 0x2b, 0x26, 0xc0, 0xea, 0x3c, 0xd7, 0x0c, 0x54, 0x4a, 0xf8, 0x1d, 0xa5, 0x70, 0xe6, 0x90,
+  0xee, 0xac, 0x6c, 0xd0, 0x34, 0xc9, 0xbe, 0x5b, 0x5c, 0xb2, 0x4c, 0x6e, 0x31, 0xa9, 0xf2, 0x98,
+  0x16, 0x90, 0xa8, 0xea, 0xb8, 0xa0, 0x34, 0x31, 0x3e, 0x3c, 0xa4, 0xb0, 0xa8, 0x0f, 0x04, 0x5f,
+  0x8e, 0x06, 0x5d, 0x39, 0xcd, 0xb2, 0x7a, 0x23, 0x3f, 0x98, 0xc7, 0x71, 0x31, 0x28, 0xb7, 0x10,
+  0x25, 0xc8, 0x21, 0xc7, 0x3c, 0xcd, 0xff, 0x28, 0x8e, 0xe8, 0x80, 0xd3, 0x23, 0x22, 0x45, 0x24,
+  0xf3, 0xbb, 0x11, 0x08, 0x9d, 0x07, 0xe7, 0xd7, 0xb2, 0x0a, 0x38, 0xb2, 0x9b, 0x59, 0x04, 0x23,
+  0x9c, 0x6a, 0x8d, 0x45, 0x87, 0xdb, 0x45, 0x27, 0x7b, 0x8a, 0x6c, 0x29, 0x59, 0x7f, 0xb5, 0x68,
+  0x11, 0x6c, 0x0b, 0xff, 0x02, 0xa9, 0xe2, 0x3f, 0xb3, 0xfd, 0x39, 0xdb, 0xcb, 0x27, 0xda, 0x65,
+  0x77, 0x0d, 0x01, 0xf4, 0x9e, 0x86, 0x07, 0xdc, 0x38, 0x74, 0x15, 0x09, 0xbc, 0x1d, 0x0e, 0x75,
+  0x24, 0x30, 0xef, 0x04, 0x58, 0xd8, 0xae, 0x25, 0x7d, 0xea, 0x77, 0x23, 0xe1, 0x6b, 0xe9, 0x8d,
+  0x27, 0x3d, 0x31, 0x5b, 0x06, 0x1e, 0xbc, 0x38, 0xa5, 0x96, 0x82, 0xd1, 0xf8, 0x34, 0x92, 0xc9,
+  0xc5, 0xa1, 0x0c, 0x21, 0x16, 0x89, 0xd1, 0xe7, 0x73, 0x1d, 0x0a, 0x87, 0xd6, 0xba, 0x59, 0x04,
+  0x46, 0x03, 0xe2, 0xa9, 0x5d, 0x0f, 0x84, 0x0f, 0x4f, 0x9c, 0xbd, 0x80, 0x1f, 0xf5, 0x1e, 0x04,
+  0xdf, 0x29, 0xe6, 0x8b, 0xea, 0x89, 0x44, 0x67, 0x17, 0xe6, 0x9f, 0x70, 0x3b, 0x2a, 0xb3, 0xa4,
+  0xb2, 0x10, 0xd4, 0xc6, 0xd4, 0x67, 0x24, 0x3f, 0x73, 0xb6, 0xd0, 0xf5, 0x79, 0xa1, 0xc6, 0x82,
+  0xb3, 0x6a, 0x23, 0x40, 0x96, 0xed, 0x67, 0x8b, 0x07, 0xcf, 0xf7, 0x0b, 0x0c, 0xd8, 0x52, 0x28,
+  0x1e, 0x60, 0x48, 0x60, 0x0c, 0x13, 0x36, 0xda, 0x92, 0x1d, 0xc7, 0xa3, 0x04, 0xb3, 0x1b, 0x76,
+  0x7e, 0x8e, 0x61, 0x44, 0x43, 0xdc, 0x7f, 0xd4, 0xcc, 0x73, 0x21, 0x83, 0x20, 0x1a, 0x65, 0xb2,
+  0x04, 0x6b, 0x80, 0xff, 0xc0, 0xc0, 0xd0, 0xe9, 0x51, 0xde, 0x05, 0x5e, 0xa6, 0x74, 0xce, 0xac,
+  0x61, 0x1e, 0x35, 0xcd, 0x69, 0x56, 0x07, 0x62, 0x12, 0xa4, 0x0d, 0x9a, 0x76, 0x98, 0x25, 0x94,
+  0x63, 0xaa, 0x53, 0xca, 0x09, 0x9c, 0x01, 0x77, 0x1d, 0x26, 0xbd, 0xe9, 0xd4, 0xc6, 0x2d, 0x50,
+  0x72, 0x26, 0x7b, 0x15, 0x18, 0x92, 0x9a, 0x09, 0xd3, 0x69, 0x4f, 0x0a, 0x45, 0xc5, 0xc8, 0xdd,
+  0x8b, 0x4c, 0xa6, 0x3a, 0x66, 0xa4, 0x07, 0xf1, 0x44, 0xdc, 0x6b, 0xae, 0x3f, 0x30, 0xe7, 0x73,
+  0xdc, 0x08, 0x73, 0x23, 0xb6, 0x9d, 0x76, 0x09, 0xec, 0xc1, 0xe3, 0x87, 0xdf, 0x3c, 0x32, 0x90,
+  0x56, 0x96, 0x89, 0x41, 0x1a, 0x0a, 0x13, 0x76, 0xfe, 0x1e, 0x7b, 0xcf, 0x02, 0x54, 0xb8, 0x10,
+  0xf6, 0xc5, 0xb6, 0x53, 0x3a, 0x77, 0x9c, 0x0c, 0x97, 0xf3, 0xaa, 0x13, 0xc5, 0xbc, 0x69, 0xa0,
+  0x1c, 0x92, 0x55, 0xf1, 0x42, 0x00, 0x85, 0x02, 0x18, 0x03, 0x5a, 0x4c, 0xd1, 0x2b, 0xb5, 0x2c,
+  0xa4, 0xea, 0x2b, 0x96, 0x07, 0x03, 0xaf, 0x9d, 0xf2, 0xbe, 0xaa, 0xab, 0x1c, 0x74, 0x67, 0xb3,
+  0x64, 0x64, 0xc8, 0x2b, 0x46, 0x86, 0xd0, 0xe3, 0x22, 0x94, 0x75, 0x76, 0xa2, 0x2d, 0xea, 0x98,
+  0x4a, 0xf9, 0xf2, 0x81, 0xef, 0x3d, 0xea, 0xf7, 0x29, 0x99, 0xf2, 0x65, 0xbf, 0xff, 0xe0, 0x9b,
+  0x87, 0xdf, 0x38, 0xbc, 0x8a, 0x68, 0xd7, 0x2c, 0x8c, 0xb2, 0x68, 0x38, 0x72, 0x89, 0x88, 0x30,
+  0x86, 0x31, 0xac, 0x09, 0x2f, 0xcb, 0xe4, 0x00, 0x74, 0x1d, 0x36, 0x0f, 0x30, 0x67, 0x78, 0xfc,
+  0x41, 0x10, 0xf5, 0x7a, 0xdd, 0x29, 0x1a, 0x12, 0x2b, 0x05, 0x3e, 0x81, 0x8f, 0x6d, 0x21, 0x55,
+  0xd9, 0x94, 0x37, 0x9f, 0x52, 0xc9, 0x86, 0x65, 0xc1, 0x53, 0x66, 0x24, 0x5f, 0x5a, 0x72, 0x3e,
+  0x51, 0xf6, 0xb8, 0x8c, 0x67, 0x4d, 0xf5, 0x47, 0x2a, 0x72, 0x9a, 0x1c, 0x51, 0x1e, 0x20, 0x4b,
+  0xcb, 0x8d, 0x29, 0xa6, 0x6c, 0xea, 0x41, 0xd4, 0x0b, 0x47, 0xbe, 0x4c, 0x0d, 0x37, 0x35, 0x96,
+  0x7e, 0xc9, 0x54, 0x84, 0xcc, 0xb3, 0x53, 0xab, 0x48, 0x00, 0xdb, 0x76, 0xf5, 0xb7, 0x18, 0x53,
+  0x81, 0x3b, 0x6d, 0x4c, 0x6d, 0x06, 0x4b, 0xf9, 0x69, 0x7b, 0xc2, 0xcc, 0x16, 0x91, 0x5d, 0x0c,
+  0x65, 0xce, 0x65, 0x5f, 0xbd, 0xb7, 0xb9, 0xec, 0x25, 0x12, 0x36, 0x03, 0xa5, 0xa1, 0xae, 0xe3,
+  0x07, 0xa7, 0x88, 0x5c, 0x43, 0x96, 0x3c, 0x43, 0x85, 0xd7, 0x7a, 0xaf, 0xd4, 0x37, 0x4d, 0xdf,
+  0x00, 0x20, 0xe6, 0xd7, 0x97, 0x74, 0x46, 0xb5, 0x05, 0x7b, 0xd2, 0x39, 0x2e, 0xa3, 0x2c, 0x1e,
+  0xb6, 0xc4, 0x7a, 0x73, 0x78, 0x0e, 0x6b, 0x1c, 0x5d, 0x5c, 0xfd, 0x00, 0xa6, 0x08, 0xc7, 0xd2,
+  0x12, 0xf7, 0x1e, 0x0e, 0xcf, 0xc5, 0xfa, 0x43, 0x6c, 0xeb, 0xc6, 0x89, 0x2f, 0x93, 0xb5, 0x04,
+  0x46, 0x39, 0x4a, 0x5b, 0xe2, 0x31, 0xb6, 0xd1, 0xda, 0x68, 0x61, 0x4d, 0x59, 0x86, 0x94, 0x81,
+  0x99, 0xb5, 0x33, 0xc9, 0x88, 0xba, 0x71, 0x08, 0x04, 0x7e, 0x59, 0xa3, 0x4c, 0x75, 0x8b, 0xca,
+  0x55, 0xda, 0x4b, 0x26, 0xdc, 0x6a, 0x89, 0x14, 0xcf, 0x4a, 0xf7, 0xa2, 0xd7, 0x08, 0x2d, 0x9a,
+  0xf5, 0xfb, 0xe0, 0x5a, 0x7b, 0x58, 0x50, 0x80, 0xac, 0x1f, 0x91, 0x91, 0x69, 0x81, 0x4f, 0x8b,
+  0x42, 0x52, 0xa7, 0x10, 0x4a, 0xa3, 0x69, 0xf5, 0xad, 0x4b, 0xff, 0xe1, 0x37, 0xf7, 0x0b, 0xab,
+  0x6f, 0x8c, 0x1c, 0x9e, 0xaf, 0xa5, 0xc7, 0x9e, 0x1f, 0x9f, 0xe1, 0x69, 0xcc, 0x03, 0xe0, 0xfc,
+  0xde, 0x3a, 0xfc, 0x95, 0x1c, 0x75, 0x3d, 0xb7, 0xb9, 0x4a, 0xff, 0xaf, 0xdf, 0x07, 0x09, 0x76,
+  0xac, 0x60, 0xbf, 0x1b, 0xfb, 0x17, 0x75, 0x0f, 0xfc, 0x86, 0xc8, 0xdf, 0x39, 0x0e, 0x42, 0xf0,
+  0x28, 0x95, 0xf8, 0x38, 0xdd, 0xa7, 0xeb, 0x2c, 0xf4, 0x29, 0x40, 0x49, 0xb8, 0x66, 0x3c, 0x98,
+  0x2a, 0xa7, 0x11, 0xbd, 0x1a, 0x65, 0xa5, 0x21, 0x39, 0x15, 0x88, 0x8a, 0xe4, 0x59, 0x83, 0x4a,
+  0xe4, 0xa9, 0x96, 0x83, 0x6b, 0x96, 0x74, 0x51, 0x87, 0xb1, 0x7a, 0x40, 0x7a, 0x86, 0x9e, 0xd0,
+  0x7b, 0xb6, 0x70, 0xc8, 0x63, 0xe9, 0x90, 0x65, 0xe9, 0x8f, 0x27, 0xf2, 0x42, 0x9d, 0x71, 0x15,
+  0xe6, 0x00, 0x06, 0x87, 0x35, 0x37, 0x97, 0x22, 0x4b, 0xbc, 0x28, 0xc5, 0xdd, 0xa6, 0xc5, 0x3f,
+  0x43, 0x40, 0xfe, 0xa3, 0x0b, 0x13, 0xf8, 0x87, 0x5a, 0x5b, 0x8c, 0x41, 0x67, 0xa6, 0xc2, 0x34,
+  0x09, 0x60, 0x3c, 0x41, 0xc2, 0x08, 0xe5, 0x0a, 0x1a, 0xcd, 0xab, 0x08, 0x18, 0x26, 0xc6, 0x85,
+  0x49, 0xc4, 0x2c, 0x4c, 0x61, 0x12, 0x69, 0xe4, 0xb5, 0x99, 0xd5, 0x8b, 0xc0, 0x22, 0x28, 0x4a,
+  0x64, 0x17, 0x2d, 0xaa, 0x53, 0x33, 0x65, 0xb3, 0xe8, 0x68, 0x0c, 0xf6, 0x63, 0x70, 0x7c, 0xe0,
+  0x9f, 0xa3, 0x97, 0x78, 0xf6, 0x47, 0x9a, 0xb8, 0xf7, 0xf2, 0xe0, 0xed, 0x1b, 0x27, 0x8f, 0xb2,
+  0xd2, 0xb3, 0x00, 0x1d, 0x5d, 0xee, 0x00, 0x68, 0x69, 0x51, 0xc3, 0xc4, 0x0b, 0xa7, 0xe7, 0xb4,
+  0xd4, 0xaf, 0x1d, 0xfc, 0x35, 0x59, 0xcc, 0xd8, 0x85, 0x99, 0x3b, 0x69, 0x2b, 0x98, 0x7b, 0x00,
+  0xa3, 0xbd, 0x6e, 0x27, 0xed, 0x79, 0x51, 0xa4, 0xcc, 0x49, 0x01, 0x6a, 0xdd, 0x86, 0xf2, 0x42,
+  0x99, 0x64, 0x13, 0x20, 0xf7, 0x6d, 0x90, 0xc0, 0x67, 0x65, 0x28, 0x40, 0x24, 0x86, 0xb1, 0xd7,
+  0x0c, 0xcb, 0x29, 0x2a, 0x27, 0x61, 0xf7, 0xb7, 0x00, 0x7b, 0x64, 0x60, 0xbf, 0x2b, 0xc0, 0x1e,
+  0x25, 0x52, 0x46, 0x13, 0xd0, 0x5d, 0x03, 0xbd, 0x5d, 0x80, 0xee, 0xaa, 0x5d, 0xb7, 0x00, 0x7c,
+  0x66, 0x80, 0x7f, 0x28, 0x00, 0x93, 0x3d, 0x99, 0x80, 0x7e, 0x0a, 0x3b, 0xe1, 0xd9, 0xdb, 0x21,
+  0x40, 0xb2, 0xa8, 0x87, 0x09, 0xfd, 0xfb, 0x4c, 0xf6, 0xbd, 0x51, 0x48, 0x55, 0x7f, 0xc5, 0x6c,
+  0xe7, 0xbd, 0xc7, 0x2a, 0xdd, 0x09, 0x3f, 0x2a, 0x71, 0x3d, 0xc3, 0xf9, 0x9f, 0x17, 0x9b, 0xc2,
+  0x55, 0x8d, 0x69, 0x5f, 0xf6, 0xb3, 0xb9, 0x30, 0x69, 0x2c, 0x2a, 0x07, 0x3b, 0x89, 0x89, 0xd6,
+  0xc9, 0x5c, 0xa8, 0xec, 0xe1, 0x15, 0xd1, 0xf1, 0xfe, 0x18, 0x52, 0xfd, 0xef, 0xa8, 0x77, 0x4c,
+  0x4e, 0xe5, 0x8f, 0xab, 0xd6, 0xc3, 0xfb, 0x99, 0x2b, 0x83, 0xe0, 0x28, 0xc3, 0x55, 0x58, 0x1c,
+  0x14, 0x04, 0xe6, 0xf8, 0x30, 0x0b, 0x5b, 0xa7, 0x67, 0x99, 0x7e, 0x68, 0x7e, 0x84, 0x0d, 0x31,
+  0x00, 0x2c, 0x3f, 0xb6, 0x2d, 0x98, 0xf7, 0xd5, 0x30, 0xef, 0x79, 0x83, 0xbc, 0x8a, 0x03, 0x19,
+  0xf9, 0x13, 0xf4, 0xc9, 0xb9, 0xb2, 0x99, 0xc0, 0xe3, 0x54, 0x8b, 0x60, 0xf9, 0x48, 0x95, 0x5e,
+  0xed, 0x46, 0x3e, 0x73, 0xab, 0x82, 0xc6, 0x37, 0x15, 0x4c, 0x17, 0xc1, 0xdf, 0xcf, 0x04, 0x7f,
+  0x6f, 0x4e, 0xfc, 0x82, 0x7e, 0x1f, 0x31, 0xdb, 0x0c, 0xad, 0xe5, 0x34, 0x6d, 0xb0, 0xf7, 0x05,
+  0xb0, 0xf7, 0x16, 0xd8, 0x7b, 0x2b, 0x58, 0x39, 0x3c, 0x0b, 0x86, 0xf2, 0x19, 0x88, 0xc1, 0x8b,
+  0x7a, 0x68, 0xe1, 0x1f, 0x36, 0xd9, 0x9f, 0x24, 0xc7, 0xdb, 0xeb, 0xa6, 0x2e, 0x51, 0xac, 0x09,
+  0x75, 0x32, 0xac, 0x5b, 0xde, 0xd7, 0xb4, 0x6c, 0x26, 0x01, 0xcb, 0x58, 0x35, 0x24, 0xf3, 0xbe,
+  0x89, 0xc7, 0xc7, 0x97, 0xd3, 0xf5, 0x33, 0xf7, 0x39, 0x67, 0xa9, 0x1d, 0x79, 0x98, 0x1a, 0x72,
+  0x82, 0x8d, 0xf7, 0x57, 0xb1, 0xf1, 0x7e, 0x92, 0x8d, 0x8a, 0xe5, 0x5b, 0xc1, 0x4a, 0x69, 0x59,
+  0xb2, 0xa3, 0x5b, 0x54, 0x51, 0x2e, 0xb0, 0x2c, 0xaa, 0xa4, 0xaa, 0x63, 0x86, 0x1e, 0x93, 0x29,
+  0x8f, 0x67, 0x32, 0xf3, 0x82, 0x70, 0x07, 0xdc, 0x8f, 0x6c, 0x8e, 0x4c, 0x9d, 0x9f, 0x43, 0xcf,
+  0x4c, 0xd7, 0xcd, 0x95, 0x87, 0xb3, 0x90, 0x2d, 0x96, 0x8c, 0x63, 0xde, 0x21, 0x4e, 0x01, 0x0c,
+  0x0b, 0xa4, 0xe4, 0x54, 0xf7, 0xb9, 0x73, 0xf8, 0x95, 0x29, 0x23, 0x46, 0x72, 0xad, 0x64, 0xb2,
+  0x5f, 0xea, 0x72, 0x5b, 0x92, 0xdc, 0xbe, 0x61, 0xc6, 0x58, 0xc9, 0xa3, 0x7b, 0x93, 0xc4, 0xf1,
+  0x2d, 0xca, 0xf4, 0x00, 0xc3, 0xc4, 0x24, 0x72, 0x87, 0xfc, 0xef, 0x94, 0x94, 0x1c, 0x0f, 0x7d,
+  0x8e, 0xa4, 0x9c, 0x6f, 0x23, 0xdd, 0x52, 0x48, 0x41, 0x44, 0xea, 0xd7, 0x7c, 0x39, 0x4f, 0x6b,
+  0x78, 0xaa, 0x1f, 0x0f, 0x50, 0x3d, 0x2c, 0x96, 0x91, 0x53, 0x3c, 0x2d, 0x74, 0x52, 0x72, 0x5d,
+  0x79, 0x4f, 0xcb, 0xcd, 0xe5, 0x62, 0x9c, 0x35, 0x25, 0xbb, 0x91, 0xd7, 0x05, 0xd6, 0xf2, 0x12,
+  0xe6, 0x6b, 0x68, 0xa7, 0xea, 0xbb, 0x45, 0x7d, 0x37, 0x54, 0xed, 0xdb, 0x75, 0xa5, 0x9e, 0xf2,
+  0xf8, 0xb8, 0x12, 0x6d, 0x21, 0x61, 0x2b, 0x5c, 0x92, 0xb9, 0xf9, 0x4d, 0x64, 0x3e, 0x29, 0xd0,
+  0xf2, 0x0d, 0x09, 0x3d, 0xfa, 0x3c, 0x3a, 0xee, 0xb1, 0x1d, 0x78, 0x43, 0xd1, 0x60, 0x5e, 0x5c,
+  0x83, 0x7e, 0xbf, 0x4c, 0x52, 0x34, 0x29, 0xae, 0xa3, 0x60, 0xd6, 0x30, 0x64, 0x04, 0xef, 0x1c,
+  0xeb, 0x61, 0x1d, 0xf6, 0x82, 0x86, 0xde, 0x05, 0x06, 0xe7, 0xc6, 0xf4, 0x93, 0x67, 0xc4, 0x31,
+  0xb1, 0xe3, 0xe8, 0x3a, 0x26, 0x43, 0x20, 0x4f, 0x48, 0x38, 0x58, 0xad, 0x1e, 0xf0, 0x7d, 0x89,
+  0x06, 0x16, 0xf2, 0x38, 0xb5, 0x7c, 0x96, 0x73, 0xa4, 0x53, 0x2a, 0x7e, 0x26, 0xe5, 0x56, 0xe6,
+  0xc3, 0xda, 0x35, 0x15, 0x3b, 0x25, 0x54, 0xd8, 0x9a, 0xd7, 0xea, 0x7e, 0x51, 0xd2, 0x8a, 0xf2,
+  0x64, 0xba, 0x1a, 0xff, 0xca, 0x8a, 0x1e, 0xb2, 0x9e, 0x00, 0x12, 0x07, 0xd1, 0x40, 0xb1, 0xbc,
+  0xc6, 0xaa, 0x3a, 0xcc, 0x39, 0x58, 0xb3, 0x4c, 0x45, 0x7b, 0x93, 0xfd, 0x63, 0xbe, 0xbb, 0xc0,
+  0x45, 0x2e, 0x15, 0x34, 0x4b, 0x74, 0xa6, 0xa2, 0x57, 0x19, 0x44, 0x4d, 0x01, 0xc0, 0x2e, 0x45,
+  0x7c, 0xd2, 0xa2, 0x0b, 0x02, 0xab, 0x3a, 0x77, 0xd1, 0x62, 0x16, 0x8b, 0x97, 0x17, 0x12, 0xd9,
+  0x87, 0x71, 0x1f, 0xeb, 0x1a, 0xe3, 0x77, 0x81, 0x3c, 0x33, 0xa5, 0x0d, 0xe5, 0xe8, 0xfc, 0x26,
+  0x77, 0xc3, 0xa8, 0xbe, 0xac, 0xb2, 0xc0, 0x6c, 0x12, 0x6b, 0x69, 0xa9, 0x97, 0x2a, 0xbf, 0x66,
+  0x5d, 0xf7, 0x49, 0xe5, 0xa7, 0x06, 0x15, 0x6e, 0xd7, 0x8c, 0x89, 0xc6, 0xc7, 0x67, 0xc1, 0xe9,
+  0xac, 0x42, 0xe3, 0xd4, 0xa2, 0x6e, 0x4a, 0xd6, 0xa8, 0x04, 0x4a, 0xbf, 0x49, 0x51, 0xa4, 0xc5,
+  0x96, 0x7a, 0x28, 0xa3, 0xa3, 0xec, 0x98, 0xe6, 0x8f, 0xdc, 0x2b, 0x45, 0x08, 0xf4, 0x1b, 0x9c,
+  0xec, 0x3f, 0xbd, 0x79, 0xb1, 0x8f, 0xfa, 0xff, 0xc4, 0x07, 0xd2, 0x94, 0xcc, 0xda, 0x58, 0xc6,
+  0x2c, 0xe4, 0xc5, 0x9a, 0x9a, 0x8c, 0xe5, 0xcd, 0x97, 0xb1, 0xc8, 0xd1, 0x7b, 0xa7, 0x30, 0x9b,
+  0x68, 0x24, 0x9e, 0x34, 0xa0, 0xc7, 0xa6, 0x63, 0xd7, 0x0b, 0xe1, 0x7a, 0x3a, 0xce, 0x06, 0xa1,
+  0x5a, 0x4f, 0x25, 0x36, 0x74, 0xf2, 0x0c, 0x5a, 0x78, 0x96, 0x08, 0xf4, 0x6b, 0x4c, 0x45, 0xd8,
+  0xc4, 0x75, 0x87, 0x35, 0x08, 0xfd, 0x06, 0xcb, 0x9b, 0xd5, 0xef, 0x22, 0x08, 0xc2, 0x97, 0x37,
+  0xbf, 0xba, 0x94, 0x10, 0x1e, 0x0f, 0xe5, 0x9f, 0x00, 0x11, 0xa2, 0xad, 0x63, 0x73, 0x6d, 0xcc,
+  0x9c, 0x55, 0x77, 0xf4, 0x68, 0x2a, 0x53, 0xc4, 0xdb, 0xe5, 0xa3, 0x0d, 0x05, 0xd1, 0xcd, 0xa2,
+  0xb5, 0x74, 0x00, 0x7b, 0x80, 0xc0, 0x5f, 0x78, 0x10, 0xb7, 0x2c, 0xf0, 0x2e, 0x4f, 0xd0, 0x3b,
+  0xc9, 0xbb, 0xa3, 0xfe, 0xb8, 0xce, 0x14, 0xb2, 0x4e, 0x6d, 0x79, 0xf3, 0xd7, 0xbf, 0xfe, 0xed,
+  0x49, 0x83, 0x11, 0x5f, 0x41, 0x21, 0x8c, 0xe3, 0x61, 0x05, 0x85, 0x7d, 0x68, 0x9e, 0x49, 0xe1,
+  0xff, 0xfe, 0xe3, 0x5f, 0xfe, 0x71, 0x4e, 0x12, 0x10, 0x4f, 0x59, 0x14, 0xf4, 0x55, 0x81, 0xa7,
+  0x98, 0x44, 0x9d, 0x41, 0xe0, 0xeb, 0x39, 0xb1, 0xab, 0x3c, 0x69, 0xc5, 0x18, 0xde, 0xc9, 0x24,
+  0xe8, 0xcf, 0x96, 0xd3, 0xbb, 0x1b, 0x13, 0xd9, 0x3d, 0x1f, 0xc6, 0x49, 0x36, 0x93, 0xc8, 0xee,
+  0x8d, 0x89, 0x3c, 0x1b, 0xb1, 0xdd, 0x97, 0x07, 0x49, 0x0c, 0x6b, 0x62, 0x26, 0xb5, 0x9d, 0x39,
+  0xa9, 0xf9, 0x12, 0x96, 0x89, 0xac, 0x22, 0x46, 0x2f, 0xae, 0x98, 0xfc, 0x7f, 0xfb, 0xe7, 0xff,
+  0xfd, 0xef, 0x7f, 0xb2, 0x28, 0x29, 0x55, 0xe7, 0x7f, 0x3a, 0x1c, 0xcd, 0x54, 0xad, 0x6f, 0x5c,
+  0x6b, 0x73, 0x14, 0x3e, 0x92, 0x31, 0x17, 0x2a, 0x83, 0x9d, 0xaf, 0x7a, 0xbb, 0xf6, 0x71, 0x4e,
+  0xe3, 0x64, 0x53, 0x5f, 0x9a, 0x65, 0x5d, 0xa6, 0x90, 0x34, 0xe6, 0xa5, 0xd2, 0xf1, 0xb2, 0x96,
+  0x23, 0x49, 0x67, 0x51, 0x43, 0xdc, 0x21, 0x43, 0x8c, 0x4b, 0x63, 0x0b, 0xf1, 0x60, 0x4d, 0x62,
+  0xd4, 0x8b, 0x7d, 0xf9, 0xf6, 0xf5, 0xde, 0x0e, 0xcc, 0x78, 0x1c, 0x61, 0x22, 0x95, 0xe5, 0xdf,
+  0xa9, 0x95, 0x4f, 0xa0, 0xb9, 0xf6, 0x34, 0xdf, 0xf0, 0x3a, 0xea, 0xe8, 0x1f, 0xf3, 0xd5, 0xd8,
+  0x67, 0xdc, 0x29, 0x7a, 0x5f, 0xd5, 0x3b, 0xd8, 0xd5, 0xc1, 0xc3, 0xee, 0xa2, 0x11, 0x03, 0xd3,
+  0x39, 0xcc, 0xc0, 0xa4, 0xdc, 0x70, 0xab, 0xc2, 0xd2, 0x7f, 0xe7, 0x4a, 0x01, 0x50, 0xed, 0x03,
+  0x1d, 0x5e, 0xe8, 0xab, 0x02, 0x77, 0x42, 0x00, 0x07, 0x78, 0x63, 0xe0, 0xa6, 0x12, 0xa0, 0x6b,
+  0x07, 0xd7, 0x11, 0x81, 0xba, 0xe5, 0x70, 0x27, 0x24, 0x00, 0xe3, 0xc2, 0x92, 0xa3, 0x1b, 0x8a,
+  0x20, 0x21, 0x2c, 0xd7, 0x91, 0x01, 0xf7, 0xb8, 0x23, 0x42, 0xa0, 0xad, 0xf5, 0x16, 0xac, 0x05,
+  0xee, 0xdc, 0xb7, 0x61, 0x2d, 0x90, 0x9f, 0xbb, 0x67, 0x2d, 0xd4, 0x2e, 0xa4, 0xe5, 0xa4, 0x4f,
+  0xb1, 0xfb, 0x41, 0x32, 0x70, 0x3b, 0xfc, 0xd2, 0xc0, 0x8a, 0x65, 0xc5, 0xfa, 0xf2, 0xd6, 0xb4,
+  0x6a, 0xb3, 0x6b, 0xca, 0x96, 0x37, 0xc7, 0xdb, 0x90, 0x2e, 0xb3, 0xea, 0xdf, 0x31, 0xe9, 0xee,
+  0x0d, 0xc8, 0x6b, 0xc9, 0x03, 0xda, 0x20, 0x1a, 0x8e, 0xb2, 0x19, 0x67, 0x78, 0xf4, 0x9e, 0x5c,
+  0x7d, 0xfc, 0x51, 0xe7, 0x63, 0x50, 0xe1, 0x60, 0x51, 0x9a, 0xa3, 0x1b, 0x3d, 0x18, 0xd5, 0x90,
+  0x82, 0x58, 0x8a, 0x39, 0x57, 0xd1, 0xe7, 0x5e, 0x2d, 0x87, 0xac, 0xab, 0x18, 0x52, 0xe1, 0x4e,
+  0x17, 0x44, 0xa6, 0x23, 0xb8, 0x20, 0x5c, 0xf0, 0x04, 0x13, 0x44, 0xfc, 0xd2, 0x21, 0x83, 0x7d,
+  0xcd, 0x09, 0xe9, 0x60, 0x0e, 0xdc, 0x3e, 0x03, 0xc3, 0xb6, 0x14, 0x63, 0xc3, 0xc9, 0xd6, 0x0f,
+  0xcd, 0x8f, 0x2a, 0x28, 0xc1, 0xc7, 0x6a, 0x8d, 0x28, 0xc7, 0xcb, 0x08, 0x69, 0x02, 0xdc, 0x85,
+  0xec, 0x52, 0x40, 0x42, 0x05, 0x23, 0x73, 0xb9, 0x34, 0x90, 0xd9, 0x71, 0x0c, 0x93, 0xee, 0x1c,
+  0xbc, 0x3a, 0x7c, 0xe3, 0xac, 0x2e, 0xa9, 0xc4, 0x40, 0x0b, 0xa2, 0x4c, 0x47, 0xe5, 0x10, 0xd7,
+  0x30, 0xb6, 0x77, 0x00, 0x24, 0x17, 0x48, 0x1b, 0xc4, 0x90, 0x40, 0x18, 0xb9, 0x31, 0xca, 0xfa,
+  0x6b, 0x8f, 0x1d, 0x31, 0x5e, 0x5d, 0xc2, 0xf3, 0xd8, 0x96, 0xe6, 0x15, 0xbc, 0xaa, 0x2b, 0x6d,
+  0x9e, 0xd6, 0x24, 0xc1, 0xdc, 0xfc, 0xd6, 0x46, 0x4f, 0x4f, 0x29, 0xf9, 0x94, 0x6e, 0xad, 0x3d,
+  0x5d, 0x05, 0x95, 0x77, 0x7e, 0x0b, 0x86, 0xf0, 0x94, 0x30, 0xcd, 0xb7, 0x58, 0xe9, 0x80, 0xd2,
+  0x5d, 0xea, 0x18, 0x31, 0x51, 0xe7, 0x40, 0xfa, 0x3f, 0x45, 0x3f, 0x45, 0x1d, 0xf1, 0xf5, 0x52,
+  0xe7, 0x25, 0x5d, 0xd3, 0xfc, 0xea, 0x92, 0x24, 0x4b, 0x4b, 0x56, 0xbd, 0x78, 0x26, 0xc1, 0x71,
+  0x4c, 0xa4, 0x6f, 0x6e, 0x6d, 0x2a, 0x18, 0x5f, 0xb5, 0x3f, 0xe7, 0xbb, 0xb0, 0x0a, 0xfa, 0x69,
+  0x2f, 0x1b, 0x79, 0x61, 0x19, 0xd6, 0xa3, 0xd6, 0x22, 0xe4, 0xb3, 0x51, 0xa2, 0x4a, 0x10, 0xbe,
+  0xba, 0x74, 0x79, 0x42, 0x7d, 0xd5, 0xf4, 0x22, 0x55, 0x37, 0xea, 0x1a, 0x54, 0xaf, 0x50, 0xab,
+  0x67, 0xf1, 0x73, 0x2c, 0x94, 0x70, 0xd7, 0x6b, 0x63, 0x91, 0xaa, 0xfe, 0x20, 0xc8, 0x54, 0x75,
+  0xa7, 0xce, 0xa7, 0xfc, 0xac, 0xd1, 0x3f, 0xc7, 0xa5, 0x93, 0x06, 0xbf, 0xe4, 0x83, 0x42, 0x4d,
+  0x3f, 0x84, 0x86, 0x31, 0xd7, 0x64, 0x75, 0x96, 0xae, 0x34, 0x62, 0xef, 0x94, 0x90, 0xa6, 0x59,
+  0xb1, 0xcf, 0x6c, 0xad, 0x58, 0x55, 0xb0, 0x2c, 0xe6, 0x86, 0x9e, 0x03, 0x6b, 0xca, 0x1a, 0x84,
+  0x40, 0x8e, 0xad, 0x0c, 0x8c, 0x5f, 0x00, 0x01, 0xa3, 0x05, 0xaf, 0xbe, 0x37, 0xe2, 0x8a, 0x4f,
+  0xe8, 0x0c, 0xc4, 0xc8, 0x93, 0x6f, 0x61, 0x19, 0x61, 0xea, 0x33, 0x92, 0xb1, 0xe9, 0xab, 0xde,
+  0x24, 0x12, 0x17, 0x20, 0xe7, 0xfd, 0xc6, 0x57, 0x0b, 0xd9, 0x01, 0xf2, 0x56, 0x7e, 0x43, 0xeb,
+  0xa5, 0xf3, 0xdb, 0x48, 0x1a, 0x90, 0x1c, 0x1a, 0x3f, 0xdd, 0xcb, 0xd2, 0x9b, 0x3b, 0xea, 0x1e,
+  0xde, 0x5d, 0xaf, 0x5a, 0x71, 0x10, 0x07, 0x24, 0x38, 0x66, 0xa2, 0x63, 0x84, 0x76, 0x68, 0x62,
+  0x3c, 0x2d, 0x59, 0x2d, 0x8b, 0x82, 0xf4, 0x0f, 0xf1, 0xaa, 0xbe, 0xd0, 0x39, 0x84, 0x1c, 0x58,
+  0xb7, 0x14, 0x80, 0xdf, 0xc4, 0x19, 0x2c, 0x41, 0x52, 0x72, 0x03, 0x98, 0x61, 0xdb, 0x36, 0x36,
+  0x69, 0xa8, 0xb7, 0xe0, 0x1e, 0x97, 0x80, 0xd0, 0x63, 0x2e, 0xc0, 0x3c, 0x4f, 0xa4, 0x2c, 0xc1,
+  0xe0, 0x85, 0xc0, 0x02, 0xcc, 0x3e, 0x6e, 0x40, 0x54, 0xb1, 0xa9, 0xaf, 0x80, 0x2b, 0xc8, 0x90,
+  0x5f, 0xe8, 0x11, 0x52, 0xe1, 0x06, 0x4e, 0x78, 0xd4, 0xf0, 0x9c, 0x69, 0x9d, 0x4b, 0xc4, 0x4a,
+  0x28, 0x98, 0x2e, 0xe9, 0xd4, 0x67, 0x5e, 0x7a, 0x2a, 0xbd, 0x51, 0x65, 0xa5, 0x67, 0xdc, 0xb9,
+  0xfb, 0xd4, 0x90, 0xd4, 0x6f, 0x0e, 0x9b, 0xdc, 0xae, 0x4c, 0x25, 0x57, 0xab, 0x99, 0xc9, 0xc3,
+  0x4f, 0x7e, 0x65, 0x08, 0x5d, 0x8b, 0x37, 0x33, 0x73, 0xd6, 0x0c, 0xd7, 0x0d, 0xe3, 0xae, 0xfa,
+  0xda, 0xc2, 0x36, 0xfc, 0x74, 0x3f, 0xe8, 0x8e, 0x1f, 0x57, 0xb1, 0xc8, 0x07, 0xb6, 0x64, 0x90,
+  0xd5, 0x44, 0x9a, 0x5d, 0xe4, 0xe5, 0xc8, 0xa3, 0x04, 0xd3, 0x8a, 0x6f, 0x5f, 0xef, 0x2b, 0x0f,
+  0xe9, 0x55, 0xf7, 0x67, 0xd9, 0xcb, 0xe0, 0xd9, 0x45, 0xd4, 0x56, 0x12, 0x35, 0x9a, 0x55, 0x3a,
+  0xe7, 0x39, 0x94, 0x1f, 0x89, 0x4e, 0xea, 0xc7, 0xb0, 0x21, 0x03, 0x20, 0xa0, 0x55, 0x0d, 0x58,
+  0x04, 0xa4, 0x1c, 0x93, 0x8e, 0xb2, 0xb6, 0xe4, 0x4e, 0xcd, 0x2c, 0x12, 0xc3, 0x9e, 0x1a, 0xa3,
+  0xd9, 0x7a, 0x43, 0xfe, 0x78, 0x0e, 0x55, 0x03, 0xc2, 0x23, 0xf2, 0x9c, 0xc8, 0xd3, 0xf8, 0xc4,
+  0xe2, 0x19, 0xc8, 0x96, 0xed, 0x52, 0x87, 0xa7, 0x1c, 0xd6, 0x84, 0xad, 0xc8, 0xbf, 0x83, 0xd5,
+  0x2f, 0x27, 0xbd, 0x52, 0xfa, 0x30, 0xc6, 0x4b, 0xa5, 0x89, 0xaa, 0x40, 0x82, 0x9c, 0x3e, 0x2e,
+  0x85, 0x12, 0x43, 0x86, 0xeb, 0x98, 0x8e, 0x18, 0x17, 0xe4, 0xbd, 0xc6, 0xcb, 0xe0, 0x5d, 0xb6,
+  0x60, 0x0c, 0x9d, 0x42, 0xeb, 0x9f, 0x7b, 0xf1, 0xf0, 0x42, 0xeb, 0xa1, 0x8d, 0x6f, 0x83, 0x8f,
+  0x45, 0x26, 0x4a, 0x38, 0x92, 0x60, 0x30, 0xe0, 0xef, 0xdf, 0x19, 0xe0, 0x3a, 0x36, 0xba, 0x5a,
+  0x97, 0x15, 0xc4, 0x54, 0x81, 0x70, 0x3f, 0x81, 0x22, 0x15, 0x41, 0x0a, 0xe8, 0x3f, 0x8d, 0x82,
+  0x84, 0x2d, 0xbd, 0x91, 0x4b, 0xf9, 0xf2, 0xeb, 0x62, 0x51, 0x8c, 0x16, 0xc4, 0x16, 0x8f, 0xb7,
+  0x7a, 0x25, 0x5a, 0x72, 0x1d, 0xaf, 0x30, 0x6f, 0xd5, 0x80, 0x7a, 0x5c, 0x73, 0x84, 0x3d, 0xb9,
+  0x1b, 0x6a, 0x78, 0xf8, 0x9d, 0xa3, 0x6f, 0xbd, 0x41, 0xe0, 0x06, 0xa2, 0x14, 0xaa, 0x56, 0xf8,
+  0x18, 0x05, 0xbe, 0x2c, 0x2a, 0x92, 0x83, 0xb0, 0x42, 0xdd, 0x87, 0x37, 0x30, 0xa8, 0x44, 0x34,
+  0x14, 0xe0, 0xea, 0xcf, 0x9e, 0x63, 0x7d, 0xa7, 0x22, 0xc7, 0x70, 0xa5, 0xea, 0xd8, 0xe0, 0x53,
+  0x94, 0xe7, 0x16, 0xa2, 0x58, 0x4d, 0xa5, 0x81, 0x1f, 0xb8, 0x99, 0x61, 0x8b, 0xaf, 0x33, 0xb1,
+  0xfa, 0xe8, 0x8a, 0x3f, 0x9a, 0x73, 0x37, 0xe6, 0x14, 0x8f, 0xc9, 0xad, 0x39, 0xb5, 0x25, 0x46,
+  0x39, 0xe8, 0x6b, 0x66, 0xd8, 0xb4, 0xd4, 0x4a, 0xe7, 0x62, 0xe6, 0xc4, 0x09, 0xbf, 0x89, 0xa1,
+  0xf1, 0x1a, 0xc7, 0x83, 0x3c, 0xf5, 0x0f, 0x1f, 0x6b, 0xf5, 0x81, 0x37, 0x74, 0xf1, 0xc8, 0x08,
+  0xc3, 0x57, 0xfc, 0x97, 0xd3, 0xe6, 0xe6, 0x86, 0xc0, 0xe8, 0x08, 0x37, 0x72, 0x52, 0x02, 0x83,
+  0x50, 0x9f, 0x8c, 0x6d, 0x8a, 0xa6, 0xd8, 0xca, 0x9b, 0x21, 0x8a, 0xc5, 0x82, 0x62, 0xa5, 0x68,
+  0xa6, 0x2c, 0xcb, 0x7c, 0x24, 0xae, 0xaa, 0xff, 0xd2, 0x16, 0x26, 0x74, 0x60, 0xf7, 0x38, 0x3b,
+  0x0e, 0x40, 0xe0, 0x9a, 0xbb, 0xad, 0x9f, 0xa2, 0xa7, 0x1a, 0x1a, 0xcd, 0x79, 0xde, 0x95, 0xbf,
+  0x9f, 0x01, 0x82, 0x86, 0xd9, 0x5f, 0x02, 0x6a, 0x55, 0x9d, 0x0d, 0xed, 0xea, 0x75, 0x62, 0x26,
+  0xcb, 0x0c, 0xee, 0xb3, 0x2f, 0x8a, 0x9b, 0x2d, 0x07, 0xdc, 0x5e, 0x6f, 0x7b, 0x39, 0x84, 0xfa,
+  0x93, 0xa3, 0x77, 0x60, 0x3d, 0xe0, 0xd1, 0xda, 0x2d, 0x1d, 0x47, 0x90, 0xbc, 0x3c, 0xdf, 0xbf,
+  0x8d, 0x54, 0x18, 0xb0, 0xc5, 0xb7, 0x42, 0x34, 0xe2, 0x3b, 0x92, 0x14, 0xd3, 0xec, 0xbc, 0x66,
+  0x57, 0x49, 0x7d, 0xee, 0xe6, 0x76, 0x44, 0xc7, 0xee, 0xd7, 0x16, 0xe1, 0xa4, 0x4f, 0x59, 0xc2,
+  0xbf, 0xd7, 0xd2, 0x2b, 0x32, 0x25, 0x8c, 0xe5, 0x8e, 0x68, 0xd7, 0x0b, 0x14, 0x12, 0x96, 0xcd,
+  0xef, 0xe1, 0x60, 0xb0, 0x8c, 0x77, 0xef, 0x36, 0x25, 0x46, 0xf2, 0x42, 0xf4, 0x78, 0xe7, 0x55,
+  0x53, 0x01, 0xc7, 0x24, 0x86, 0x67, 0x45, 0xea, 0x5a, 0x02, 0x4c, 0x24, 0xdd, 0x13, 0xb9, 0x2b,
+  0xd2, 0xdb, 0xc1, 0x4f, 0xcd, 0xde, 0xf8, 0x10, 0x48, 0x0b, 0x8b, 0x3e, 0x5c, 0xeb, 0x5c, 0x43,
+  0x1a, 0xd4, 0xe1, 0xae, 0xc8, 0x82, 0xce, 0x4d, 0x6f, 0x4b, 0x14, 0xf8, 0x63, 0x4e, 0x49, 0xe0,
+  0x01, 0xaf, 0xf9, 0x62, 0xe1, 0x1d, 0xf1, 0x60, 0x6e, 0x7e, 0x36, 0x6a, 0x6d, 0x6f, 0x73, 0x1d,
+  0x92, 0xaa, 0x73, 0x9f, 0x3b, 0x22, 0x89, 0xaa, 0xb2, 0xa8, 0x5b, 0x92, 0x07, 0x04, 0x34, 0x96,
+  0x1b, 0x87, 0x5f, 0x13, 0xbe, 0xa2, 0xbc, 0x49, 0xf7, 0xdc, 0xa3, 0x0f, 0x21, 0x2f, 0x5a, 0xde,
+  0xa4, 0x08, 0x15, 0x0b, 0x10, 0x0a, 0x35, 0x4c, 0x41, 0xae, 0x00, 0x4f, 0xba, 0xc9, 0x26, 0xfe,
+  0x01, 0xb1, 0x2d, 0x39, 0xd7, 0xac, 0x12, 0xa9, 0x0a, 0x6d, 0x96, 0x37, 0xf1, 0xc9, 0x14, 0x68,
+  0x88, 0x9b, 0xe0, 0xb5, 0xdd, 0xeb, 0xe5, 0x4d, 0x7c, 0x32, 0x78, 0xa7, 0x95, 0x5d, 0x75, 0x9e,
+  0xa4, 0x80, 0x2c, 0x3a, 0xda, 0x54, 0xf9, 0x2b, 0xaa, 0x01, 0x1f, 0x9b, 0xa1, 0xbb, 0x69, 0xad,
+  0xf5, 0xa4, 0xa1, 0x40, 0x70, 0xd8, 0x9d, 0xa9, 0x55, 0x5a, 0x58, 0x79, 0x82, 0x5f, 0xc9, 0xd6,
+  0x9f, 0xa0, 0x33, 0x07, 0x56, 0xe9, 0x8e, 0x0a, 0xcc, 0xc0, 0x1b, 0xd7, 0xb9, 0xf5, 0x00, 0xe2,
+  0xb5, 0x95, 0x15, 0x86, 0xa6, 0x89, 0x60, 0xe2, 0x0c, 0xc8, 0xbb, 0x54, 0x3b, 0x2f, 0xf7, 0x7a,
+  0x92, 0x0e, 0xbd, 0x88, 0x6f, 0xaf, 0x6d, 0x2c, 0xc3, 0xde, 0x6c, 0x30, 0x6e, 0x09, 0x47, 0x5d,
+  0x24, 0x54, 0x17, 0xfb, 0xda, 0x62, 0xf2, 0x2a, 0x21, 0x5d, 0xf6, 0x73, 0xc6, 0xcb, 0x9b, 0x4b,
+  0xa5, 0xae, 0xbf, 0xfe, 0xf5, 0x6f, 0x82, 0x5e, 0xfe, 0xfa, 0x0f, 0xff, 0x29, 0x9c, 0x71, 0xb9,
+  0x8c, 0xa6, 0x36, 0x5e, 0x82, 0xa1, 0x03, 0x65, 0x3d, 0x70, 0xab, 0xfc, 0xcc, 0x66, 0xc8, 0x0f,
+  0x52, 0x9c, 0x80, 0x56, 0x10, 0x85, 0x41, 0x24, 0xd7, 0xfa, 0xa1, 0x3c, 0x6f, 0x1f, 0x79, 0xc3,
+  0xd6, 0x83, 0xe1, 0x79, 0x7b, 0x00, 0x51, 0x7a, 0x10, 0xb5, 0x9a, 0x10, 0x2f, 0x3c, 0x1e, 0x9e,
+  0x8b, 0x66, 0x7b, 0xf9, 0xda, 0xa5, 0x45, 0x85, 0xdd, 0x5c, 0x39, 0x26, 0xb0, 0x64, 0xef, 0x8d,
+  0x57, 0x85, 0x76, 0x53, 0x6a, 0xcb, 0xfa, 0x27, 0x2b, 0x35, 0x0e, 0x0e, 0xb8, 0xa2, 0xca, 0x5c,
+  0x35, 0xfa, 0xcd, 0xb7, 0xc3, 0x85, 0x8b, 0x9b, 0xae, 0xe6, 0x00, 0x9e, 0xd6, 0xcb, 0x5c, 0x54,
+  0x2f, 0xba, 0x35, 0x71, 0xaf, 0x8a, 0x3b, 0xbc, 0x50, 0xb5, 0x68, 0x39, 0x54, 0xc9, 0x2b, 0xb4,
+  0x19, 0x84, 0x55, 0xc0, 0xad, 0x76, 0x01, 0x94, 0x99, 0x52, 0x5d, 0xfe, 0x44, 0xd7, 0x49, 0x72,
+  0xc5, 0xac, 0xd9, 0x95, 0x86, 0xb4, 0xdc, 0xed, 0xd9, 0xd6, 0xfa, 0xc6, 0xd7, 0xb8, 0x61, 0x3e,
+  0xd9, 0x06, 0xb6, 0x84, 0xda, 0xaf, 0x14, 0x7e, 0xba, 0x81, 0xaf, 0xb1, 0x38, 0x6c, 0x34, 0x6e,
+  0xdf, 0x56, 0xb4, 0x6d, 0x12, 0x9f, 0xc1, 0x64, 0x54, 0x58, 0xc6, 0xc5, 0x0a, 0xc3, 0x4c, 0x20,
+  0x61, 0xd5, 0x85, 0x4d, 0xd9, 0x5b, 0xec, 0xe2, 0xda, 0x9b, 0xed, 0x2b, 0x10, 0xe0, 0x2f, 0x50,
+  0x32, 0x1b, 0x24, 0x8a, 0xfe, 0x64, 0xcd, 0xec, 0x40, 0x31, 0x66, 0xf6, 0x14, 0xdd, 0x70, 0x1b,
+  0x15, 0xb3, 0x7b, 0xaf, 0x05, 0x0b, 0x1e, 0xaf, 0x8b, 0x44, 0xfd, 0xe0, 0x68, 0x04, 0xee, 0xdf,
+  0x9c, 0x35, 0xb3, 0x86, 0x0f, 0x6d, 0x8c, 0x55, 0x83, 0x6d, 0x87, 0xb1, 0x49, 0xfa, 0xfb, 0x5e,
+  0x17, 0xef, 0xa2, 0x0b, 0x05, 0x60, 0x16, 0x28, 0x5a, 0xe3, 0x72, 0x5b, 0x31, 0xdb, 0x31, 0xd1,
+  0x03, 0x56, 0xee, 0xdb, 0x88, 0xb1, 0x3a, 0xed, 0x29, 0xb5, 0xb9, 0x41, 0xb2, 0xa6, 0xfa, 0x55,
+  0x55, 0xe7, 0xc2, 0x5b, 0x1e, 0x72, 0x55, 0x79, 0xae, 0xa6, 0xc7, 0x10, 0x95, 0x45, 0xba, 0xd0,
+  0x7f, 0x56, 0x81, 0xaf, 0x35, 0xe2, 0xbc, 0xfb, 0xf5, 0x96, 0x09, 0x29, 0xc3, 0xa1, 0xcc, 0x2a,
+  0xcb, 0x39, 0xcb, 0x1c, 0xa2, 0x5f, 0x56, 0x09, 0x60, 0x44, 0x46, 0x47, 0x8c, 0x5c, 0x99, 0x09,
+  0x78, 0x17, 0x35, 0x78, 0xc4, 0x14, 0x87, 0x27, 0x57, 0x30, 0x84, 0x05, 0xc6, 0xff, 0xfe, 0xaf,
+  0x13, 0xd5, 0x9f, 0xb7, 0x5d, 0xf6, 0x09, 0xaa, 0xab, 0x35, 0x70, 0xae, 0xc2, 0xcf, 0xd2, 0x12,
+  0x5b, 0xb0, 0xf2, 0xd3, 0xa2, 0x3a, 0xab, 0xf6, 0xd3, 0x92, 0x16, 0x8b, 0xe1, 0x65, 0x65, 0xa5,
+  0x12, 0x41, 0x68, 0x84, 0xf8, 0xc9, 0x14, 0xb5, 0x1a, 0xf1, 0x68, 0x22, 0xef, 0x77, 0x7b, 0x85,
+  0x4b, 0x68, 0x9c, 0x28, 0xc6, 0xdb, 0x62, 0xec, 0xd5, 0x29, 0x1b, 0x8b, 0xe3, 0x79, 0x12, 0x37,
+  0x3b, 0x1c, 0x34, 0xda, 0xc3, 0xc0, 0xd4, 0x8d, 0xc5, 0xff, 0xef, 0x9b, 0xc0, 0x29, 0x2d, 0xa7,
+  0x9c, 0xaf, 0x55, 0x9d, 0xbd, 0x37, 0xc7, 0x11, 0x68, 0xdd, 0xf2, 0xbc, 0x7f, 0x24, 0xcf, 0xed,
+  0x57, 0xfa, 0x00, 0x09, 0xb0, 0x4d, 0x99, 0x26, 0xcc, 0x5e, 0x71, 0x72, 0x54, 0x2f, 0xbe, 0x2d,
+  0xb1, 0x2f, 0xf1, 0x98, 0xa0, 0x1b, 0x7a, 0xd1, 0x09, 0xbe, 0xee, 0xe1, 0x75, 0xd2, 0xb0, 0xde,
+  0x99, 0xa4, 0xcd, 0xcb, 0x94, 0x2d, 0x7f, 0x91, 0xf2, 0x95, 0xa9, 0x51, 0x1b, 0xfc, 0xf3, 0x9d,
+  0x17, 0xa0, 0xf2, 0xa4, 0x32, 0x9b, 0x5b, 0x75, 0x56, 0xb4, 0x10, 0x6e, 0x9c, 0x47, 0x45, 0x91,
+  0x83, 0x51, 0xfd, 0x5d, 0x95, 0xca, 0xa8, 0x93, 0x65, 0xfa, 0xf0, 0xf0, 0xb8, 0x66, 0xef, 0x75,
+  0x20, 0xcd, 0xcb, 0x25, 0x67, 0x05, 0xeb, 0xb6, 0x56, 0xbc, 0xc1, 0xb0, 0xed, 0xac, 0x82, 0x69,
+  0xa1, 0xa7, 0x30, 0xa3, 0x87, 0x4d, 0x7a, 0x38, 0xe2, 0x87, 0x65, 0x7a, 0xf8, 0x34, 0x8a, 0xe9,
+  0x71, 0xd9, 0x59, 0xc6, 0xc7, 0x2f, 0x9b, 0xf7, 0xbf, 0x6d, 0x3b, 0x58, 0x2a, 0xa5, 0x2e, 0x21,
+  0xa9, 0x0f, 0x2e, 0x11, 0x2d, 0xac, 0x1a, 0x09, 0x3d, 0x88, 0x90, 0x1a, 0x1f, 0x56, 0x9e, 0x6c,
+  0x2e, 0x3b, 0x1f, 0x1b, 0x47, 0xab, 0x82, 0xce, 0x12, 0x80, 0xf8, 0x87, 0xc1, 0x47, 0xf3, 0xd9,
+  0x8d, 0xe9, 0xff, 0x21, 0x2b, 0xfa, 0xcf, 0xa5, 0xd4, 0xc5, 0xdb, 0x54, 0x8a, 0x13, 0x79, 0xd1,
+  0x8d, 0xbd, 0xc4, 0xc7, 0xfa, 0x8e, 0x24, 0xeb, 0x8d, 0xb0, 0x60, 0x62, 0x67, 0x83, 0xbf, 0xfb,
+  0xb0, 0x2a, 0xee, 0x35, 0xd6, 0x1b, 0xf7, 0x37, 0xf0, 0x2b, 0x5d, 0xe9, 0xaa, 0x78, 0xdd, 0xf8,
+  0xae, 0xb1, 0xdd, 0xf8, 0x61, 0x83, 0x1c, 0x51, 0x78, 0xf6, 0xf0, 0xf2, 0x7f, 0xba, 0x81, 0x5e,
+  0x2e, 0x5a, 0x58, 0x14, 0xd2, 0xff, 0x03, 0x7c, 0x77, 0x3f, 0x10, 0x34, 0x6c, 0x00, 0x00
+};
+
+static const uint8_t WEBUI_STYLE_CSS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x5a, 0x4b, 0x6f, 0xeb, 0xb8,
+  0x15, 0xde, 0xf7, 0x57, 0x18, 0x08, 0x2e, 0x62, 0x17, 0x96, 0xa1, 0x87, 0x25, 0x79, 0xe4, 0xcd,
+  0x00, 0xb3, 0x28, 0xba, 0x99, 0xcd, 0xb4, 0x45, 0xbb, 0xa4, 0x24, 0xca, 0x56, 0x23, 0x89, 0x1e,
+  0x8a, 0x4a, 0xe2, 0x31, 0xfc, 0xdf, 0x7b, 0x48, 0xea, 0x41, 0x8a, 0xb2, 0xad, 0xe4, 0x66, 0x2e,
+  0xd0, 0x18, 0x71, 0x6c, 0x89, 0x3a, 0x3c, 0xcf, 0xef, 0x3c, 0x98, 0xbf, 0x5e, 0x4a, 0x44, 0x0f,
+  0x79, 0x15, 0xd9, 0xfb, 0x13, 0x4a, 0xd3, 0xbc, 0x3a, 0xc0, 0xa7, 0x98, 0xbc, 0x5b, 0x75, 0xfe,
+  0x07, 0xff, 0x12, 0x13, 0x9a, 0x62, 0x6a, 0xc1, 0x95, 0x6b, 0x4c, 0xd2, 0xf3, 0x25, 0x23, 0x15,
+  0xb3, 0x32, 0x54, 0xe6, 0xc5, 0x39, 0x7a, 0xfe, 0x0d, 0x1f, 0x08, 0x5e, 0xfc, 0xf3, 0xef, 0xcf,
+  0xeb, 0x7f, 0xa0, 0x23, 0x29, 0xd1, 0xfa, 0x6f, 0xb8, 0xc2, 0xaf, 0x68, 0xfd, 0x2f, 0x4c, 0x53,
+  0x54, 0xa1, 0x75, 0x8d, 0xaa, 0xda, 0xaa, 0x31, 0xcd, 0xb3, 0x7d, 0x8c, 0x92, 0x97, 0x03, 0x25,
+  0x4d, 0x95, 0x46, 0x45, 0x5e, 0x61, 0x44, 0xad, 0x03, 0x45, 0x69, 0x8e, 0x2b, 0xb6, 0x74, 0x3c,
+  0x3f, 0xc5, 0x87, 0xf5, 0x93, 0x8d, 0xf8, 0x6b, 0x61, 0x7f, 0x5b, 0x3f, 0x39, 0xc8, 0x41, 0x2e,
+  0x5e, 0xf8, 0xe2, 0x73, 0xe0, 0x3a, 0x1e, 0x5e, 0x38, 0xb6, 0xfd, 0x6d, 0xb5, 0x4f, 0x48, 0x41,
+  0x68, 0xf4, 0x94, 0x89, 0x9f, 0x7d, 0x99, 0x57, 0xd6, 0x11, 0xe7, 0x87, 0x23, 0x8b, 0xe0, 0xf6,
+  0xeb, 0x71, 0x4f, 0x5e, 0x31, 0xcd, 0x0a, 0xf2, 0x66, 0xbd, 0x47, 0xc7, 0x3c, 0x4d, 0x71, 0x75,
+  0xdd, 0x94, 0x08, 0x16, 0x25, 0xc0, 0x35, 0xfc, 0xc5, 0x14, 0xa4, 0x7d, 0xb7, 0xde, 0xf2, 0x94,
+  0x1d, 0x23, 0xc7, 0xb5, 0xed, 0xd3, 0xfb, 0xbe, 0x13, 0x7f, 0x81, 0x1a, 0x46, 0x7a, 0x1d, 0xb8,
+  0xfc, 0x56, 0x9a, 0xd7, 0xa7, 0x02, 0x9d, 0xa3, 0x03, 0xcd, 0xd3, 0x3d, 0x7f, 0xb3, 0x18, 0x2e,
+  0xe1, 0x0a, 0xc3, 0x40, 0xb0, 0x68, 0xca, 0xaa, 0x8e, 0x28, 0x3e, 0x61, 0xc4, 0x96, 0xfc, 0x59,
+  0x2b, 0xcb, 0xd9, 0x1a, 0x38, 0x82, 0x1d, 0x96, 0x1e, 0x27, 0xbd, 0x76, 0x32, 0xba, 0x5a, 0xed,
+  0x0f, 0xe8, 0x24, 0xc9, 0xa1, 0x22, 0x3f, 0x54, 0x56, 0x0e, 0x34, 0xea, 0xa8, 0x66, 0x88, 0xb2,
+  0xeb, 0x86, 0xf3, 0x45, 0x49, 0x01, 0x3a, 0x4a, 0x58, 0x4e, 0xaa, 0x8b, 0xa2, 0x25, 0x7a, 0x88,
+  0xd1, 0xd2, 0xf5, 0xfd, 0x75, 0xf7, 0x6b, 0x6f, 0x9c, 0x95, 0x50, 0x63, 0x4a, 0xc9, 0x09, 0x36,
+  0x2b, 0x18, 0xa6, 0x51, 0x5c, 0x34, 0x74, 0xe9, 0x00, 0x75, 0xb8, 0x25, 0x2d, 0xc5, 0xb5, 0xda,
+  0xd4, 0x91, 0xe3, 0xc3, 0x8e, 0xf2, 0x52, 0xe4, 0x9c, 0xde, 0x17, 0x35, 0x29, 0xf2, 0x74, 0x31,
+  0x41, 0xd4, 0x5d, 0x0d, 0x42, 0xcb, 0x67, 0xc0, 0xf6, 0x47, 0x94, 0x92, 0x37, 0xd0, 0xc9, 0x0e,
+  0x9e, 0xf4, 0x5c, 0x78, 0x13, 0x0f, 0xda, 0x6b, 0xf1, 0xda, 0x78, 0xab, 0x3d, 0xa3, 0x60, 0xda,
+  0x9c, 0xf3, 0x1c, 0x89, 0x8f, 0x19, 0xa1, 0xe5, 0x02, 0xee, 0xd4, 0x0b, 0x8c, 0x6a, 0xbc, 0x1e,
+  0x88, 0x0c, 0x17, 0x0d, 0x69, 0xa3, 0x23, 0x37, 0xd7, 0xa5, 0x7f, 0x5e, 0x52, 0xe2, 0xea, 0xfd,
+  0xcf, 0xd2, 0xf2, 0xa5, 0x48, 0x0a, 0x2f, 0x0e, 0xe7, 0x63, 0xbb, 0x1b, 0x33, 0xb3, 0x5d, 0x5d,
+  0x37, 0x2d, 0x41, 0x8b, 0xe5, 0xac, 0xc0, 0xd2, 0x45, 0xc1, 0x7d, 0x71, 0xe4, 0x6c, 0x7c, 0x8a,
+  0xcb, 0xbd, 0xb8, 0xf0, 0x26, 0xfd, 0x24, 0xb0, 0xed, 0xd6, 0xe4, 0xe0, 0xd3, 0x8c, 0x91, 0x52,
+  0xda, 0xa6, 0xf5, 0xab, 0x6d, 0x8a, 0x02, 0xf0, 0x2b, 0x86, 0xdf, 0x99, 0x25, 0xcc, 0x15, 0x25,
+  0xe0, 0xa1, 0x98, 0xca, 0x2b, 0x3d, 0x2b, 0x82, 0x93, 0x31, 0x23, 0x3e, 0x28, 0x92, 0xb4, 0x3a,
+  0xa1, 0x18, 0xc4, 0xc8, 0x5f, 0xf1, 0x88, 0xb5, 0x28, 0x42, 0x19, 0x50, 0xbb, 0x70, 0x45, 0x00,
+  0xdd, 0xe8, 0xf9, 0x79, 0x78, 0x04, 0xc5, 0x60, 0xa2, 0x86, 0xe1, 0x7d, 0xcb, 0x96, 0x05, 0x92,
+  0xee, 0x0b, 0x9c, 0xb1, 0x08, 0xa2, 0x60, 0x3f, 0xa1, 0xa4, 0x7f, 0x83, 0x92, 0x78, 0x48, 0x48,
+  0x6f, 0xf6, 0xb9, 0x14, 0x6d, 0x2c, 0xb8, 0xdc, 0x8c, 0xb7, 0xe3, 0xed, 0x27, 0x9b, 0x87, 0x9b,
+  0xa0, 0x73, 0x42, 0x14, 0xae, 0xac, 0x5b, 0xb9, 0xd5, 0x6b, 0x5c, 0xab, 0x0c, 0xb1, 0xa6, 0xb6,
+  0xb8, 0xe3, 0x5f, 0x3e, 0x1f, 0x0a, 0xee, 0x28, 0x14, 0x84, 0x63, 0xb6, 0x16, 0x60, 0x44, 0x7e,
+  0xef, 0xf7, 0xe2, 0xc1, 0x61, 0x04, 0x81, 0xe2, 0x76, 0x9d, 0xa7, 0x2a, 0xde, 0xdd, 0x3b, 0x3c,
+  0x57, 0x80, 0x69, 0xb8, 0xe9, 0x10, 0x08, 0xc3, 0xb5, 0x13, 0x04, 0x6d, 0x04, 0x78, 0x83, 0xac,
+  0x05, 0x8a, 0x71, 0xa1, 0x38, 0x90, 0xbd, 0xf9, 0x89, 0x3b, 0x10, 0x39, 0xa1, 0x24, 0x67, 0x67,
+  0xf8, 0xba, 0x1b, 0x39, 0x8f, 0xca, 0xfc, 0x2b, 0x2a, 0x1a, 0xdd, 0xfb, 0xb6, 0x63, 0xef, 0x8b,
+  0x49, 0x91, 0xea, 0xbe, 0xc6, 0x3d, 0x84, 0xbe, 0x12, 0xeb, 0x80, 0x4a, 0x0c, 0xd2, 0x7d, 0x40,
+  0xd1, 0x9e, 0x50, 0xaa, 0xd0, 0xe9, 0x4e, 0xa8, 0xb4, 0x03, 0x36, 0x0d, 0xd7, 0xb8, 0x77, 0xeb,
+  0xd0, 0x26, 0x75, 0x77, 0x43, 0xc7, 0xdb, 0x7b, 0x38, 0xe2, 0x3e, 0x50, 0x62, 0x2b, 0x83, 0x15,
+  0xb3, 0xea, 0x62, 0x7a, 0xa5, 0xf8, 0xdc, 0x52, 0xaa, 0x48, 0x85, 0xa7, 0xec, 0x77, 0x2f, 0x4b,
+  0x6c, 0x65, 0x96, 0x70, 0x11, 0x7f, 0xc9, 0x14, 0xe1, 0xa0, 0x71, 0x46, 0x50, 0xb4, 0xcf, 0x95,
+  0x92, 0x34, 0xb4, 0x86, 0xbb, 0x27, 0x92, 0xcb, 0x28, 0x1e, 0x50, 0x0b, 0x15, 0x05, 0x40, 0x93,
+  0x2b, 0xa1, 0x49, 0x05, 0x9a, 0xbc, 0xaa, 0x31, 0x5b, 0xdc, 0x88, 0x71, 0x70, 0xc1, 0xce, 0x40,
+  0x59, 0x81, 0x75, 0x48, 0x6f, 0x1d, 0xee, 0xbf, 0x4d, 0xcd, 0xf2, 0xec, 0x6c, 0x75, 0x31, 0x2e,
+  0x2f, 0x6b, 0xca, 0x69, 0x81, 0x6f, 0x86, 0xb0, 0x6d, 0x5c, 0x3e, 0x79, 0x68, 0x87, 0xf0, 0x6e,
+  0xb5, 0x9f, 0xc6, 0x4a, 0xd7, 0xc0, 0x4a, 0xce, 0x78, 0x8f, 0x94, 0x9a, 0x9d, 0xb6, 0xba, 0x9d,
+  0x22, 0x94, 0x70, 0x9c, 0x9a, 0x06, 0x61, 0x7b, 0x35, 0x5b, 0x31, 0xbe, 0x4e, 0x76, 0x23, 0xa5,
+  0x9e, 0x23, 0x62, 0x96, 0x05, 0x71, 0x10, 0xaf, 0x9f, 0x70, 0xb8, 0x4d, 0xbc, 0x64, 0x92, 0xcc,
+  0x7c, 0x7d, 0x65, 0xd9, 0x2e, 0xdc, 0x85, 0x1d, 0xd1, 0x55, 0x17, 0x5c, 0x1d, 0xc8, 0xd6, 0x1f,
+  0x08, 0x2f, 0x77, 0x08, 0x2f, 0xc7, 0x9e, 0x82, 0xac, 0x8e, 0xa8, 0xd5, 0xd2, 0x9c, 0x85, 0x5b,
+  0xb6, 0x81, 0x5b, 0xbb, 0x49, 0xd8, 0xd2, 0xca, 0xac, 0x5f, 0x48, 0x43, 0x73, 0x4c, 0x17, 0xbf,
+  0xe2, 0xb7, 0xe7, 0x75, 0x49, 0x2a, 0x02, 0x18, 0x9d, 0x60, 0x85, 0x03, 0x13, 0xb6, 0x76, 0x3a,
+  0x6c, 0x85, 0xca, 0x62, 0x13, 0xa6, 0xdc, 0x39, 0x30, 0x55, 0xe0, 0xd4, 0x6a, 0x13, 0xf8, 0xa0,
+  0x46, 0x11, 0x04, 0xfc, 0x0d, 0x94, 0x40, 0xdb, 0xac, 0x2e, 0xf5, 0xd8, 0x97, 0x3d, 0x3c, 0xed,
+  0x03, 0x21, 0x2b, 0x6e, 0x00, 0x30, 0x3f, 0x64, 0x01, 0x5f, 0xb7, 0x40, 0x4f, 0xa8, 0x47, 0x17,
+  0x5e, 0x12, 0x76, 0xe8, 0xb2, 0xf5, 0xef, 0xa2, 0xcb, 0x1c, 0x30, 0x68, 0xeb, 0x14, 0x53, 0x13,
+  0x7a, 0xf2, 0xe7, 0xa9, 0xc4, 0x28, 0x89, 0xc2, 0xd5, 0x0d, 0x90, 0x1c, 0x17, 0x5b, 0x8a, 0x14,
+  0x46, 0xfd, 0x53, 0x27, 0xa8, 0xc0, 0x4b, 0x67, 0x63, 0xfb, 0x3d, 0x0a, 0x4b, 0x23, 0x4c, 0x50,
+  0xf2, 0x55, 0x4a, 0x1b, 0x8a, 0x53, 0xd5, 0xfd, 0xc0, 0xff, 0xb7, 0xa1, 0x1f, 0xaa, 0x2b, 0x0e,
+  0x14, 0x63, 0xad, 0xbe, 0x7c, 0x72, 0x71, 0xea, 0x87, 0x9e, 0xba, 0x26, 0xe6, 0x8e, 0xa1, 0x2e,
+  0xf1, 0xc2, 0xad, 0x9b, 0x21, 0x75, 0xc9, 0xdb, 0x11, 0xc0, 0x4e, 0xdf, 0xca, 0xc9, 0xdc, 0x2c,
+  0xe8, 0xbc, 0xc5, 0xf3, 0x34, 0x8a, 0x24, 0xcb, 0xf4, 0x3d, 0x33, 0xcf, 0xdf, 0xba, 0xd7, 0x0d,
+  0xaa, 0xf2, 0x12, 0x09, 0x6f, 0xfc, 0xb8, 0x5b, 0x3c, 0x0c, 0x4c, 0x85, 0x38, 0xb8, 0x4a, 0x1f,
+  0x7a, 0xdc, 0x30, 0xae, 0xfd, 0xd0, 0x4b, 0xbe, 0x26, 0x05, 0x69, 0x81, 0x34, 0xd3, 0xef, 0x66,
+  0x96, 0x2a, 0x9a, 0x78, 0x7f, 0x46, 0x2a, 0x01, 0xd4, 0x84, 0xdd, 0x85, 0xf3, 0x0d, 0x5d, 0x93,
+  0x28, 0x26, 0xb8, 0x7e, 0x17, 0x76, 0x7f, 0x5f, 0xc2, 0x4e, 0x67, 0xb9, 0xb8, 0x20, 0xc9, 0xcb,
+  0xa8, 0x3c, 0xe2, 0x0a, 0x55, 0xf5, 0xe1, 0x43, 0xf5, 0x3d, 0x2e, 0x7f, 0x04, 0xad, 0x89, 0x88,
+  0xde, 0x19, 0x50, 0xb9, 0x9d, 0x28, 0x5c, 0x8c, 0x66, 0x86, 0x34, 0x8c, 0xab, 0x40, 0x9a, 0x77,
+  0xa4, 0x7a, 0x60, 0x23, 0x7e, 0xc9, 0x01, 0x6a, 0x4f, 0xe0, 0x49, 0x20, 0x75, 0x22, 0x97, 0x75,
+  0x4c, 0x44, 0x51, 0xb7, 0xa0, 0x15, 0x90, 0x1d, 0x9b, 0x32, 0xbe, 0xdc, 0x78, 0x6a, 0xdf, 0x55,
+  0x5b, 0x4a, 0xe1, 0x6d, 0xc2, 0x3b, 0x2f, 0xde, 0x3f, 0x61, 0x9d, 0x11, 0xe3, 0x5a, 0x72, 0xe7,
+  0x8e, 0x1c, 0x98, 0x95, 0x89, 0x22, 0x45, 0x49, 0xfe, 0x80, 0xfd, 0xab, 0x03, 0x6e, 0x25, 0xf8,
+  0xa1, 0x9c, 0xaa, 0xc1, 0x35, 0x9f, 0xeb, 0x2e, 0x2d, 0x15, 0x04, 0xb1, 0x88, 0x72, 0x1e, 0x1f,
+  0x64, 0xa4, 0x79, 0x29, 0xb2, 0xe6, 0xb2, 0x7c, 0x09, 0xc8, 0xbc, 0x77, 0x93, 0x06, 0xd1, 0xdb,
+  0x0f, 0x93, 0x86, 0x73, 0xc4, 0xab, 0xeb, 0x7e, 0xa7, 0x31, 0xe2, 0x38, 0xfe, 0x8f, 0x45, 0x1c,
+  0x11, 0x61, 0x5f, 0x09, 0x38, 0x6a, 0x71, 0xc2, 0xdb, 0x51, 0x45, 0xd2, 0xaf, 0x06, 0x1f, 0x47,
+  0x80, 0x4f, 0x49, 0x52, 0xfc, 0x09, 0x8b, 0x79, 0xe3, 0x6a, 0x41, 0xd2, 0x51, 0xed, 0xc1, 0xd1,
+  0xcb, 0xf9, 0x3f, 0xc8, 0x00, 0xee, 0x0c, 0x83, 0x0c, 0x1a, 0x6c, 0x00, 0x96, 0x68, 0xd2, 0x17,
+  0x2e, 0x4a, 0xdf, 0x3a, 0xe8, 0xa0, 0xb3, 0x94, 0x51, 0x54, 0x68, 0xb4, 0x83, 0xfb, 0x59, 0xa1,
+  0x23, 0xb6, 0x69, 0x7b, 0x86, 0x4f, 0xd8, 0x5d, 0x63, 0xa0, 0x0b, 0x64, 0xa3, 0x73, 0x11, 0x86,
+  0x9a, 0x6e, 0x5d, 0x6a, 0xfc, 0x7b, 0x83, 0x01, 0x81, 0xad, 0x22, 0xaf, 0xd9, 0x45, 0x89, 0x4a,
+  0xd7, 0x9f, 0x88, 0xca, 0xa9, 0x49, 0xcf, 0x9d, 0x2a, 0x7d, 0xa2, 0x21, 0x55, 0x0b, 0x77, 0x65,
+  0x77, 0x31, 0xa7, 0xd0, 0x8a, 0xe0, 0x71, 0xdb, 0x27, 0xf0, 0xc7, 0x8a, 0x31, 0x7b, 0x83, 0xba,
+  0x6b, 0xaa, 0x4f, 0xd4, 0x5a, 0x82, 0x36, 0xbf, 0x8a, 0xf4, 0xfa, 0x20, 0xc5, 0x29, 0xc5, 0xa1,
+  0xea, 0xb3, 0x8f, 0x43, 0xd9, 0x5d, 0xdd, 0x74, 0xbc, 0x91, 0x64, 0x66, 0x5c, 0xdf, 0x18, 0x46,
+  0xde, 0x77, 0x27, 0xcd, 0x5e, 0x15, 0x74, 0x75, 0x97, 0x1b, 0xa5, 0x40, 0x17, 0x36, 0xa0, 0xc7,
+  0xc8, 0xe9, 0x6c, 0x46, 0xdb, 0xb1, 0xae, 0xa6, 0x77, 0x94, 0xe8, 0x6d, 0x9c, 0x50, 0x3d, 0x0f,
+  0x79, 0x51, 0xf8, 0x81, 0x6f, 0x5a, 0x75, 0x09, 0x92, 0xf5, 0x21, 0xcf, 0x13, 0x8e, 0xe3, 0xde,
+  0x8d, 0xf8, 0xa0, 0x2b, 0x51, 0xba, 0xce, 0x49, 0x8c, 0x0c, 0xe7, 0x0e, 0x0e, 0x46, 0x12, 0x49,
+  0x1e, 0xc6, 0xdd, 0xe0, 0x4d, 0x14, 0x11, 0x15, 0x38, 0xfc, 0x0d, 0x62, 0x2f, 0xb0, 0x3b, 0x14,
+  0x11, 0x25, 0xf6, 0x40, 0x68, 0x3e, 0xc8, 0x7a, 0x18, 0xfb, 0x3b, 0xaf, 0x23, 0x7b, 0x1f, 0x64,
+  0x85, 0xaa, 0xa0, 0x64, 0xfe, 0x44, 0x87, 0x6e, 0xb2, 0xc9, 0x09, 0x7d, 0xa4, 0x47, 0x0f, 0xe3,
+  0x30, 0xee, 0x7b, 0xf4, 0x87, 0x6c, 0xa6, 0xb8, 0xc0, 0x0c, 0xcf, 0xa3, 0xcc, 0xbb, 0x1e, 0x60,
+  0x74, 0xb7, 0x75, 0x9c, 0xdd, 0x04, 0xa3, 0x92, 0xd4, 0x47, 0x58, 0xf5, 0xc3, 0x20, 0xec, 0x08,
+  0x3f, 0x66, 0x15, 0xbc, 0xee, 0x33, 0xa8, 0x68, 0xf0, 0x09, 0x74, 0xe6, 0x33, 0xe9, 0xa7, 0xb1,
+  0xa0, 0x26, 0xa9, 0xde, 0x67, 0x92, 0x3b, 0x14, 0x47, 0x4e, 0x4b, 0x8e, 0x2c, 0xbf, 0x67, 0xd4,
+  0xaa, 0x43, 0xeb, 0x9d, 0xe3, 0x06, 0xa3, 0x81, 0xe9, 0x99, 0xc8, 0xab, 0x8c, 0x98, 0xc3, 0xd6,
+  0x11, 0x61, 0x63, 0x3a, 0xaf, 0x10, 0x30, 0xe6, 0x11, 0x1f, 0x2a, 0xec, 0x76, 0xa3, 0xe6, 0xd1,
+  0xee, 0x30, 0xa4, 0x25, 0x7b, 0x51, 0x21, 0xfa, 0x87, 0x17, 0x72, 0x5f, 0xdf, 0x3a, 0x9a, 0x30,
+  0xa7, 0x89, 0xfb, 0xe7, 0xb4, 0x92, 0x39, 0xb5, 0x4a, 0x68, 0x9c, 0x40, 0x8d, 0x66, 0xca, 0x9e,
+  0x2a, 0xa4, 0xbf, 0x2b, 0x3f, 0x2b, 0x9b, 0x7d, 0x61, 0x86, 0x1e, 0xfc, 0x84, 0x77, 0xa0, 0x9f,
+  0x48, 0xd0, 0xe3, 0x14, 0x23, 0x6b, 0xb3, 0xbc, 0x9b, 0x89, 0x99, 0xb9, 0x31, 0x18, 0xb7, 0xc9,
+  0xe2, 0xa4, 0x53, 0x76, 0x71, 0xbb, 0x4e, 0xd2, 0x51, 0x6a, 0x95, 0xc9, 0xd3, 0x9c, 0x24, 0x6a,
+  0x1e, 0x76, 0xdd, 0x40, 0x58, 0xb0, 0xb3, 0x55, 0xe2, 0xba, 0x46, 0x07, 0x7c, 0x31, 0x97, 0x6b,
+  0x07, 0xa0, 0x77, 0xa6, 0x4f, 0xad, 0x40, 0xec, 0x5c, 0xe0, 0x28, 0x67, 0x40, 0x22, 0x19, 0xce,
+  0xba, 0xea, 0x26, 0xee, 0x0e, 0x34, 0x95, 0xf8, 0x72, 0x15, 0x7b, 0x0d, 0x17, 0x5a, 0x4d, 0x89,
+  0x00, 0xbc, 0x5b, 0xbc, 0x00, 0xf9, 0x9e, 0xec, 0xc4, 0x41, 0x9f, 0xf3, 0xf8, 0xa0, 0x4f, 0x44,
+  0xb0, 0x1e, 0x70, 0x86, 0xfc, 0xa3, 0x0a, 0x53, 0x99, 0x08, 0x24, 0x10, 0x22, 0x45, 0x8c, 0xe8,
+  0x7a, 0xec, 0xd2, 0x13, 0x6b, 0xda, 0x86, 0x7b, 0xa7, 0xd5, 0x2e, 0x37, 0xd6, 0xf2, 0x4a, 0x3e,
+  0x79, 0x99, 0x43, 0x55, 0xae, 0xbc, 0x89, 0xd9, 0xee, 0xca, 0x1c, 0x97, 0xcc, 0xd9, 0x9e, 0x4f,
+  0x08, 0xe6, 0x6d, 0x2f, 0x66, 0x09, 0xe3, 0xed, 0x35, 0x33, 0xf9, 0xdf, 0xc1, 0x83, 0xc4, 0x9f,
+  0xf9, 0x9c, 0xdc, 0xa8, 0x52, 0x35, 0x7e, 0xc2, 0xd5, 0xf5, 0xe7, 0x12, 0xa7, 0x39, 0x5a, 0x2c,
+  0x87, 0xf3, 0xb1, 0x30, 0x00, 0xc3, 0xac, 0x2e, 0xe3, 0xff, 0x0c, 0x98, 0x4e, 0x1b, 0x90, 0x2d,
+  0xf4, 0x54, 0xd8, 0x9d, 0x61, 0x9a, 0x87, 0xf7, 0x6a, 0xe8, 0x8c, 0x8f, 0xf5, 0x94, 0x7f, 0x3b,
+  0x90, 0x01, 0x6c, 0x9e, 0x95, 0x89, 0x09, 0xb6, 0x3a, 0xcd, 0x56, 0xdc, 0x3b, 0x30, 0xe7, 0xe8,
+  0x33, 0x46, 0xe7, 0xe3, 0xf1, 0xc7, 0x4d, 0x09, 0xaf, 0xd7, 0x9f, 0x5f, 0xf0, 0x39, 0xa3, 0xc0,
+  0x53, 0xbd, 0x38, 0x35, 0x45, 0x8d, 0x2f, 0xf6, 0xb7, 0x8b, 0xd6, 0x97, 0xc9, 0xd7, 0xa4, 0x86,
+  0xc3, 0xa9, 0xb5, 0x22, 0x67, 0x1a, 0xcb, 0x57, 0x57, 0x3e, 0xe1, 0x9b, 0x45, 0x79, 0x75, 0x85,
+  0x44, 0xcf, 0x59, 0xb1, 0xfa, 0x81, 0xe7, 0xa5, 0xff, 0x14, 0x89, 0x3b, 0x0b, 0xa8, 0xc2, 0xa1,
+  0x86, 0xc8, 0x2b, 0x51, 0x38, 0x15, 0x04, 0x71, 0xf5, 0x5f, 0x86, 0x53, 0x8f, 0x60, 0xdf, 0x26,
+  0x4e, 0x0b, 0xbf, 0x42, 0x74, 0xd7, 0xed, 0xb0, 0xaf, 0x5d, 0x38, 0xeb, 0x30, 0x9e, 0xe3, 0x12,
+  0x1f, 0x8c, 0xf5, 0x07, 0xf1, 0x37, 0x46, 0x69, 0x6d, 0x7e, 0xb0, 0x84, 0xd8, 0x5c, 0x1e, 0x4b,
+  0x1d, 0x34, 0x0c, 0x0d, 0xbd, 0x72, 0xc2, 0xae, 0x42, 0xdf, 0xb0, 0x60, 0x68, 0x8a, 0xc7, 0xb3,
+  0xb9, 0x41, 0xf8, 0x1a, 0x82, 0x63, 0xe1, 0xd4, 0x0b, 0x99, 0x9f, 0x07, 0x15, 0x28, 0x46, 0xe4,
+  0x4b, 0xb8, 0x0d, 0x87, 0xd4, 0x4c, 0x09, 0x94, 0x7c, 0x78, 0xc9, 0xcf, 0xfe, 0x5b, 0x2b, 0x18,
+  0xf7, 0xa0, 0x09, 0x11, 0x77, 0xaf, 0x7f, 0xf9, 0x1f, 0x77, 0xb5, 0x3f, 0x0a, 0x16, 0x24, 0x00,
+  0x00
+};
+
+static const WebAsset WEBUI_ASSETS[] = {
+  {"/", "text/html", WEBUI_INDEX_HTML, sizeof(WEBUI_INDEX_HTML), "\"a6c672f6b912719f\"", false},
+  {"/app.js", "application/javascript", WEBUI_APP_JS, sizeof(WEBUI_APP_JS), "\"13068a851d8c8987\"", true},
+  {"/style.css", "text/css", WEBUI_STYLE_CSS, sizeof(WEBUI_STYLE_CSS), "\"a0e34eacb34c8924\"", true}
+};
+
+#define WEBUI_ASSET_COUNT       3
+
+#endif // K2SO_WEBASSETS_H
@@ -0,0 +1,589 @@
+/*
+================================================================================
+// K-2SO Controller Web Control Queue Implementation
+// Network task side: capture request -> slot, pause it, post a command.
+// Main loop side: run the handler, answer through the paused request (a weak
+// pointer, so a client that hung up is simply skipped), free the slot.
+================================================================================
+*/
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include "webcontrol.h"
+#include "metrics.h"        // For the request latency histogram
+#include "config.h"
+#include "globals.h"
+
+//========================================
+// REQUEST SLOTS AND QUEUE
+//========================================
+
+struct WebRequestSlot {
+  AsyncWebServerRequestPtr request;     // Paused request; empty once the client is gone
+  WebRouteHandler handler;
+  const char* method;
+  bool authenticated;
+  bool responded;
+  unsigned long queuedAt;
+  unsigned long queuedMicros;           // For the latency histogram
+
+  char uri[WEB_MAX_URI_LENGTH];
+  uint8_t argCount;
+  uint16_t argName[WEB_MAX_ARGS];       // Offsets into pool
+  uint16_t argValue[WEB_MAX_ARGS];
+  uint16_t poolUsed;
+  char pool[WEB_ARG_POOL_SIZE];
+  char* body;                           // POST body (heap), nullptr if none
+  size_t bodyLength;
+  WebBodySink* sink;                    // Streamed body (onWebStream), nullptr if none
+  char ifNoneMatch[WEB_MAX_ETAG_LENGTH];
+
+  uint8_t headerCount;
+  const char* headerName[WEB_MAX_RESPONSE_HEADERS];
+  String headerValue[WEB_MAX_RESPONSE_HEADERS];
+};
+
+static WebRequestSlot slots[WEB_MAX_PENDING_REQUESTS];
+static QueueHandle_t freeSlots = nullptr;       // Indices of unused slots
+static QueueHandle_t controlQueue = nullptr;
+static WebRequestSlot* currentSlot = nullptr;   // Set while a handler runs
+static WebControlStats stats;
+
+WebRequest webRequest;
+
+// Maxima are raised from the network task and the main loop alike
+static void raiseStatMax(std::atomic<uint32_t>& value, uint32_t candidate) {
+  uint32_t current = value.load(std::memory_order_relaxed);
+  while (candidate > current &&
+         !value.compare_exchange_weak(current, candidate, std::memory_order_relaxed)) {
+  }
+}
+
+static void releaseSlot(uint8_t index) {
+  WebRequestSlot& slot = slots[index];
+  slot.request.reset();
+  free(slot.body);
+  slot.body = nullptr;
+  slot.bodyLength = 0;
+  delete slot.sink;
+  slot.sink = nullptr;
+  for (uint8_t i = 0; i < slot.headerCount; i++) {
+    slot.headerValue[i] = String();
+  }
+  slot.headerCount = 0;
+  xQueueSend(freeSlots, &index, 0);
+}
+
+bool postControlCommand(const ControlCommand& command) {
+  if (xQueueSend(controlQueue, &command, 0) != pdTRUE) {
+    stats.rejectedBusy.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  raiseStatMax(stats.maxQueueDepth, uxQueueMessagesWaiting(controlQueue));
+  return true;
+}
+
+//========================================
+// NETWORK TASK SIDE
+//========================================
+
+static bool storeArg(WebRequestSlot& slot, const String& name, const String& value) {
+  size_t needed = name.length() + value.length() + 2;
+  if (slot.argCount >= WEB_MAX_ARGS || slot.poolUsed + needed > WEB_ARG_POOL_SIZE) {
+    return false;
+  }
+  slot.argName[slot.argCount] = slot.poolUsed;
+  memcpy(&slot.pool[slot.poolUsed], name.c_str(), name.length() + 1);
+  slot.poolUsed += name.length() + 1;
+  slot.argValue[slot.argCount] = slot.poolUsed;
+  memcpy(&slot.pool[slot.poolUsed], value.c_str(), value.length() + 1);
+  slot.poolUsed += value.length() + 1;
+  slot.argCount++;
+  return true;
+}
+
+// Body chunks arrive before the request callback; collected in _tempObject,
+// which the library frees if the request dies before being queued. As with
+// streamed bodies, nothing is allocated for a client without credentials.
+static void collectRequestBody(AsyncWebServerRequest* request, uint8_t* data, size_t length,
+                               size_t index, size_t total) {
+  if (total > WEB_MAX_BODY_SIZE) {
+    return;
+  }
+  if (index == 0) {
+    if (strlen(WEB_AUTH_USER) > 0 && !request->authenticate(WEB_AUTH_USER, WEB_AUTH_PASS)) {
+      return;
+    }
+    request->_tempObject = malloc(total + 1);
+  }
+  char* body = (char*)request->_tempObject;
+  if (body == nullptr || index + length > total) {
+    return;
+  }
+  memcpy(body + index, data, length);
+  body[index + length] = '\0';
+}
+
+// Streamed bodies: the sink is kept here from the first chunk until the
+// request callback moves it into a slot (network task only)
+struct PendingStream {
+  AsyncWebServerRequest* request;
+  WebBodySink* sink;
+};
+
+static PendingStream pendingStreams[WEB_MAX_BODY_STREAMS];
+
+static WebBodySink* takePendingStream(AsyncWebServerRequest* request) {
+  for (PendingStream& pending : pendingStreams) {
+    if (pending.request == request) {
+      WebBodySink* sink = pending.sink;
+      pending.request = nullptr;
+      pending.sink = nullptr;
+      return sink;
+    }
+  }
+  return nullptr;
+}
+
+// Headers are complete before the first chunk, so unauthenticated uploads
+// never reach a sink. No sink (too large, too many streams, factory said
+// no) leaves the handler with webRequest.bodySink() == nullptr.
+static void streamRequestBody(WebBodySinkFactory factory, AsyncWebServerRequest* request,
+                              uint8_t* data, size_t length, size_t index, size_t total) {
+  if (index == 0) {
+    if (total > WEB_MAX_STREAM_SIZE ||
+        (strlen(WEB_AUTH_USER) > 0 && !request->authenticate(WEB_AUTH_USER, WEB_AUTH_PASS))) {
+      return;
+    }
+    for (PendingStream& pending : pendingStreams) {
+      if (pending.request == nullptr) {
+        pending.sink = factory(total);
+        if (pending.sink != nullptr) {
+          pending.request = request;
+          request->onDisconnect([request]() { delete takePendingStream(request); });
+        }
+        break;
+      }
+    }
+  }
+
+  for (PendingStream& pending : pendingStreams) {
+    if (pending.request == request) {
+      pending.sink->write(data, length);
+      return;
+    }
+  }
+}
+
+// Runs on the main loop
+static void runWebRequest(const ControlCommand& command) {
+  WebRequestSlot& slot = slots[command.slot];
+  unsigned long waited = millis() - slot.queuedAt;
+  raiseStatMax(stats.maxWaitMs, waited);
+
+  currentSlot = &slot;
+  slot.handler();
+  if (!slot.responded) {
+    webRequest.send(500, "text/plain", "No response");
+  }
+  currentSlot = nullptr;
+
+  metricObserve(METRIC_HTTP_LATENCY, micros() - slot.queuedMicros);
+  stats.requests.fetch_add(1, std::memory_order_relaxed);
+  releaseSlot(command.slot);
+}
+
+static void queueWebRequest(AsyncWebServerRequest* request, WebRouteHandler handler,
+                            size_t maxBody = WEB_MAX_BODY_SIZE, WebBodySink* sink = nullptr) {
+  if (request->contentLength() > maxBody) {
+    delete sink;
+    stats.rejectedSize.fetch_add(1, std::memory_order_relaxed);
+    request->send(413, "text/plain", "Request body too large");
+    return;
+  }
+
+  uint8_t index;
+  if (xQueueReceive(freeSlots, &index, 0) != pdTRUE) {
+    delete sink;
+    stats.rejectedBusy.fetch_add(1, std::memory_order_relaxed);
+    request->send(503, "text/plain", "Busy - try again");
+    return;
+  }
+
+  WebRequestSlot& slot = slots[index];
+  slot.handler = handler;
+  slot.method = request->methodToString();
+  slot.authenticated = (strlen(WEB_AUTH_USER) == 0) ||
+                       request->authenticate(WEB_AUTH_USER, WEB_AUTH_PASS);
+  slot.responded = false;
+  slot.queuedAt = millis();
+  slot.queuedMicros = micros();
+  strncpy(slot.uri, request->url().c_str(), sizeof(slot.uri) - 1);
+  slot.uri[sizeof(slot.uri) - 1] = '\0';
+  slot.ifNoneMatch[0] = '\0';
+  if (request->hasHeader("If-None-Match")) {
+    strlcpy(slot.ifNoneMatch, request->header("If-None-Match").c_str(), sizeof(slot.ifNoneMatch));
+  }
+
+  slot.argCount = 0;
+  slot.poolUsed = 0;
+  for (size_t i = 0; i < request->params(); i++) {
+    const AsyncWebParameter* param = request->getParam(i);
+    if (param->isFile()) {
+      continue;
+    }
+    if (!storeArg(slot, param->name(), param->value())) {
+      delete sink;
+      xQueueSend(freeSlots, &index, 0);
+      stats.rejectedSize.fetch_add(1, std::memory_order_relaxed);
+      request->send(400, "text/plain", "Too many parameters");
+      return;
+    }
+  }
+
+  slot.body = (char*)request->_tempObject;  // Slot owns the body from here on
+  slot.bodyLength = slot.body ? request->contentLength() : 0;
+  request->_tempObject = nullptr;
+  slot.sink = sink;
+
+  slot.request = request->pause();
+  ControlCommand command = {};
+  command.run = runWebRequest;
+  command.slot = index;
+
+  if (!postControlCommand(command)) {
+    request->send(503, "text/plain", "Busy - try again");
+    releaseSlot(index);
+  }
+}
+
+void onWeb(const char* uri, WebRequestMethodComposite method, WebRouteHandler handler) {
+  server.on(uri, method,
+            [handler](AsyncWebServerRequest* request) { queueWebRequest(request, handler); },
+            nullptr, collectRequestBody);
+}
+
+void onWeb(const char* uri, WebRouteHandler handler) {
+  onWeb(uri, HTTP_ANY, handler);
+}
+
+void onWebStream(const char* uri, WebBodySinkFactory factory, WebRouteHandler handler) {
+  server.on(uri, HTTP_POST,
+            [handler](AsyncWebServerRequest* request) {
+              queueWebRequest(request, handler, WEB_MAX_STREAM_SIZE, takePendingStream(request));
+            },
+            nullptr,
+            [factory](AsyncWebServerRequest* request, uint8_t* data, size_t length, size_t index, size_t total) {
+              streamRequestBody(factory, request, data, length, index, total);
+            });
+}
+
+void onWebNotFound(WebRouteHandler handler) {
+  server.onNotFound([handler](AsyncWebServerRequest* request) { queueWebRequest(request, handler); });
+}
+
+//========================================
+// MAIN LOOP SIDE
+//========================================
+
+void initializeWebControl() {
+  if (controlQueue != nullptr) {
+    return;
+  }
+  controlQueue = xQueueCreate(WEB_CONTROL_QUEUE_LENGTH, sizeof(ControlCommand));
+  freeSlots = xQueueCreate(WEB_MAX_PENDING_REQUESTS, sizeof(uint8_t));
+  for (uint8_t i = 0; i < WEB_MAX_PENDING_REQUESTS; i++) {
+    xQueueSend(freeSlots, &i, 0);
+  }
+}
+
+void processWebCommands() {
+  if (controlQueue == nullptr) {
+    return;
+  }
+  ControlCommand command;
+  for (uint8_t i = 0; i < WEB_COMMANDS_PER_LOOP; i++) {
+    if (xQueueReceive(controlQueue, &command, 0) != pdTRUE) {
+      return;
+    }
+    command.run(command);
+    stats.commands.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+//========================================
+// HANDLER VIEW OF THE CURRENT REQUEST
+//========================================
+
+bool WebRequest::hasArg(const char* name) const {
+  if (currentSlot == nullptr) {
+    return false;
+  }
+  if (strcmp(name, "plain") == 0) {
+    return currentSlot->body != nullptr;
+  }
+  for (uint8_t i = 0; i < currentSlot->argCount; i++) {
+    if (strcmp(&currentSlot->pool[currentSlot->argName[i]], name) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+String WebRequest::arg(const char* name) const {
+  if (currentSlot == nullptr) {
+    return String();
+  }
+  if (strcmp(name, "plain") == 0) {
+    return currentSlot->body ? String(currentSlot->body) : String();
+  }
+  for (uint8_t i = 0; i < currentSlot->argCount; i++) {
+    if (strcmp(&currentSlot->pool[currentSlot->argName[i]], name) == 0) {
+      return String(&currentSlot->pool[currentSlot->argValue[i]]);
+    }
+  }
+  return String();
+}
+
+const uint8_t* WebRequest::body(size_t& length) const {
+  if (currentSlot == nullptr || currentSlot->body == nullptr) {
+    length = 0;
+    return nullptr;
+  }
+  length = currentSlot->bodyLength;
+  return (const uint8_t*)currentSlot->body;
+}
+
+WebBodySink* WebRequest::bodySink() const {
+  return currentSlot ? currentSlot->sink : nullptr;
+}
+
+String WebRequest::arg(int index) const {
+  if (currentSlot == nullptr || index < 0 || index >= currentSlot->argCount) {
+    return String();
+  }
+  return String(&currentSlot->pool[currentSlot->argValue[index]]);
+}
+
+String WebRequest::argName(int index) const {
+  if (currentSlot == nullptr || index < 0 || index >= currentSlot->argCount) {
+    return String();
+  }
+  return String(&currentSlot->pool[currentSlot->argName[index]]);
+}
+
+int WebRequest::args() const {
+  return currentSlot ? currentSlot->argCount : 0;
+}
+
+String WebRequest::uri() const {
+  return currentSlot ? String(currentSlot->uri) : String();
+}
+
+const char* WebRequest::methodName() const {
+  return currentSlot ? currentSlot->method : "";
+}
+
+bool WebRequest::authenticated() const {
+  return currentSlot != nullptr && currentSlot->authenticated;
+}
+
+void WebRequest::sendHeader(const char* name, const String& value) {
+  if (currentSlot == nullptr || currentSlot->headerCount >= WEB_MAX_RESPONSE_HEADERS) {
+    return;
+  }
+  currentSlot->headerName[currentSlot->headerCount] = name;
+  currentSlot->headerValue[currentSlot->headerCount] = value;
+  currentSlot->headerCount++;
+}
+
+// Cache-Control: no-cache makes the browser revalidate every poll, which
+// costs a 304 without a body once the handler knows nothing changed
+bool WebRequest::notModified(const char* etag) {
+  sendHeader("ETag", etag);
+  sendHeader("Cache-Control", "no-cache");
+  if (currentSlot == nullptr || currentSlot->ifNoneMatch[0] == '\0' ||
+      strstr(currentSlot->ifNoneMatch, etag) == nullptr) {
+    return false;
+  }
+  send(304);
+  return true;
+}
+
+// The paused request to answer, or nothing if already answered / client gone
+static std::shared_ptr<AsyncWebServerRequest> claimResponse() {
+  if (currentSlot == nullptr || currentSlot->responded) {
+    return nullptr;
+  }
+  currentSlot->responded = true;
+
+  auto request = currentSlot->request.lock();
+  if (!request) {
+    stats.abandoned.fetch_add(1, std::memory_order_relaxed);
+  }
+  return request;
+}
+
+static void finishResponse(AsyncWebServerRequest* request, AsyncWebServerResponse* response) {
+  for (uint8_t i = 0; i < currentSlot->headerCount; i++) {
+    response->addHeader(currentSlot->headerName[i], currentSlot->headerValue[i]);
+  }
+  request->send(response);
+}
+
+void WebRequest::send(int code, const String& contentType, const String& content) {
+  auto request = claimResponse();
+  if (request) {
+    finishResponse(request.get(), request->beginResponse(code, contentType, content));
+  }
+}
+
+// The library would read 'content' in place while sending, so it gets a copy
+void WebRequest::send(int code, const char* contentType, const uint8_t* content, size_t length) {
+  auto request = claimResponse();
+  if (!request) {
+    return;
+  }
+  std::shared_ptr<uint8_t> copy((uint8_t*)malloc(length), free);
+  if (!copy) {
+    request->send(500, "text/plain", "Out of memory");
+    return;
+  }
+  memcpy(copy.get(), content, length);
+  AsyncWebServerResponse* response = request->beginResponse(contentType, length,
+      [copy, length](uint8_t* buffer, size_t maxLength, size_t index) -> size_t {
+        size_t chunk = min(maxLength, length - index);
+        memcpy(buffer, copy.get() + index, chunk);
+        return chunk;
+      });
+  response->setCode(code);
+  finishResponse(request.get(), response);
+}
+
+void WebRequest::sendChunked(const char* contentType, WebChunkSource* source) {
+  std::shared_ptr<WebChunkSource> owned(source);  // Lives as long as the response
+  auto request = claimResponse();
+  if (!request) {
+    return;
+  }
+  AsyncWebServerResponse* response = request->beginChunkedResponse(contentType,
+      [owned](uint8_t* buffer, size_t maxLength, size_t index) -> size_t {
+        return owned->read(buffer, maxLength);
+      });
+  finishResponse(request.get(), response);
+}
+
+void WebRequest::sendFile(File file, const char* contentType) {
+  auto request = claimResponse();
+  if (!request) {
+    return;
+  }
+  String path = file.path();
+  finishResponse(request.get(), request->beginResponse(file, path, contentType));
+}
+
+void WebRequest::requestAuthentication() {
+  sendHeader("WWW-Authenticate", "Basic realm=\"Login Required\"");
+  send(401, "text/plain", "Authentication required");
+}
+
+//========================================
+// STREAMED JSON LISTS
+//========================================
+
+JsonListSource::JsonListSource(const char* message, const char* listKey)
+  : message(message), listKey(listKey), error(nullptr), stage(LIST_HEADER), count(0),
+    pendingLength(0), pendingPos(0) {
+  pending[0] = '\0';
+}
+
+size_t JsonListSource::read(uint8_t* buffer, size_t maxLength) {
+  size_t written = 0;
+  while (written < maxLength) {
+    if (pendingPos >= pendingLength && !fillPending()) {
+      break;
+    }
+    size_t chunk = min(maxLength - written, pendingLength - pendingPos);
+    memcpy(buffer + written, pending + pendingPos, chunk);
+    written += chunk;
+    pendingPos += chunk;
+  }
+  return written;
+}
+
+bool JsonListSource::fillPending() {
+  switch (stage) {
+    case LIST_HEADER:
+      snprintf(pending, sizeof(pending), "{\"ok\":true,\"message\":\"%s\",\"%s\":[", message, listKey);
+      stage = LIST_ITEMS;
+      break;
+
+    case LIST_ITEMS: {
+      size_t offset = (count > 0) ? 1 : 0;  // Separator before all but the first item
+      pending[0] = ',';
+      if (nextItem(pending + offset, sizeof(pending) - offset)) {
+        count++;
+        break;
+      }
+      if (error != nullptr) {
+        snprintf(pending, sizeof(pending), "],\"count\":%u,\"error\":\"%s\"}", count, error);
+      } else {
+        snprintf(pending, sizeof(pending), "],\"count\":%u}", count);
+      }
+      stage = LIST_FOOTER;
+      break;
+    }
+
+    case LIST_FOOTER:
+      stage = LIST_DONE;
+      return false;
+
+    default:
+      return false;
+  }
+  pendingLength = strlen(pending);
+  pendingPos = 0;
+  return true;
+}
+
+void JsonListSource::failList(const char* reason) {
+  error = reason;
+}
+
+void JsonListSource::appendJsonString(char* out, size_t size, const char* text) {
+  size_t used = strlen(out);
+  if (used + 2 >= size) {
+    return;
+  }
+  out[used++] = '"';
+  for (const char* p = text; *p != '\0' && used + 3 < size; p++) {
+    if ((uint8_t)*p < 0x20) {
+      continue;  // Control characters never belong in names
+    }
+    if (*p == '"' || *p == '\\') {
+      out[used++] = '\\';
+    }
+    out[used++] = *p;
+  }
+  out[used++] = '"';
+  out[used] = '\0';
+}
+
+const WebControlStats& getWebControlStats() {
+  return stats;
+}
+
+void printWebControlStats() {
+  Serial.println(F("\n=== WEB CONTROL QUEUE ==="));
+  Serial.printf("Commands run: %lu (HTTP requests: %lu)\n",
+                (unsigned long)stats.commands.load(), (unsigned long)stats.requests.load());
+  Serial.printf("Queue: %u/%d now, %u max; free request slots: %u/%d\n",
+                controlQueue ? (unsigned)uxQueueMessagesWaiting(controlQueue) : 0,
+                WEB_CONTROL_QUEUE_LENGTH, (unsigned)stats.maxQueueDepth.load(),
+                freeSlots ? (unsigned)uxQueueMessagesWaiting(freeSlots) : 0,
+                WEB_MAX_PENDING_REQUESTS);
+  Serial.printf("Longest wait for the main loop: %lu ms\n", (unsigned long)stats.maxWaitMs.load());
+  Serial.printf("Rejected: busy %lu, size %lu; client gone before reply: %lu\n",
+                (unsigned long)stats.rejectedBusy.load(), (unsigned long)stats.rejectedSize.load(),
+                (unsigned long)stats.abandoned.load());
+}
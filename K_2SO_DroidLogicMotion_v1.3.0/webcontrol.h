@@ -0,0 +1,159 @@
+/*
+================================================================================
+// K-2SO Controller Web Control Queue Header
+// The HTTP server (ESPAsyncWebServer) runs in the network task. Routes only
+// capture the request - URI, arguments, body, auth result - into a request
+// slot and post a command into the control queue; the main loop drains the
+// queue and runs the handler, so nothing outside the loop touches servos,
+// config or the sequence manager. WebSocket commands use the same queue.
+//
+// Handlers keep the familiar WebServer style through 'webRequest':
+//   webRequest.hasArg("name") / webRequest.arg("name") / webRequest.send(...)
+================================================================================
+*/
+
+#ifndef K2SO_WEBCONTROL_H
+#define K2SO_WEBCONTROL_H
+
+#include <Arduino.h>
+#include <atomic>
+#include <FS.h>
+#include <ESPAsyncWebServer.h>
+
+//========================================
+// WEB CONTROL CONFIGURATION
+//========================================
+
+#define WEB_MAX_PENDING_REQUESTS    6       // Request slots waiting for the main loop
+#define WEB_CONTROL_QUEUE_LENGTH    16      // HTTP + WebSocket commands
+#define WEB_COMMANDS_PER_LOOP       4       // Drain budget per loop pass (motion first)
+#define WEB_MAX_ARGS                8
+#define WEB_ARG_POOL_SIZE           384     // Names + values of one request, NUL separated
+#define WEB_MAX_URI_LENGTH          48
+#define WEB_MAX_BODY_SIZE           32768   // POST body limit (buffered routes)
+#define WEB_MAX_STREAM_SIZE         262144  // POST body limit of onWebStream routes (never held in RAM)
+#define WEB_MAX_BODY_STREAMS        2       // Streamed bodies still arriving at the same time
+#define WEB_MAX_RESPONSE_HEADERS    4
+#define WEB_MAX_ETAG_LENGTH         48      // If-None-Match kept with a request
+#define WEB_MAX_COMMAND_TEXT        64      // WebSocket command line
+#define WEB_LIST_ITEM_BUFFER        192     // One streamed JSON list entry
+#define WEB_BATCH_MAX_COMMANDS      16      // POST /batch array length
+#define WEB_BATCH_JSON_SIZE         3072    // ArduinoJson pool for one batch
+
+//========================================
+// DATA STRUCTURES
+//========================================
+
+typedef void (*WebRouteHandler)();
+
+struct ControlCommand;
+typedef void (*ControlRunner)(const ControlCommand& command);
+
+// One entry of the control queue; copied by value
+struct ControlCommand {
+  ControlRunner run;                    // Executed on the main loop
+  uint8_t slot;                         // HTTP: request slot index
+  uint32_t client;                      // WebSocket: client id
+  char text[WEB_MAX_COMMAND_TEXT];      // WebSocket: command line
+};
+
+// Written from the network task and the main loop, hence atomic
+struct WebControlStats {
+  std::atomic<uint32_t> commands;       // Queue entries run (HTTP + WebSocket)
+  std::atomic<uint32_t> requests;       // ...of which HTTP requests
+  std::atomic<uint32_t> rejectedBusy;   // 503 - no free slot or queue full
+  std::atomic<uint32_t> rejectedSize;   // Too many args / body too large
+  std::atomic<uint32_t> abandoned;      // Client gone before the reply
+  std::atomic<uint32_t> maxQueueDepth;
+  std::atomic<uint32_t> maxWaitMs;      // Queued -> handler start
+};
+
+// Body of a chunked response, pulled piece by piece while it is sent. Runs
+// in the network task, so it may only read what stays valid meanwhile
+// (its own file/directory handles, fixed tables).
+class WebChunkSource {
+public:
+  virtual ~WebChunkSource() {}
+  virtual size_t read(uint8_t* buffer, size_t maxLength) = 0;  // 0 = finished
+};
+
+// {"ok":true,"message":"...","<listKey>":[item,item,...],"count":N}
+// produced one item at a time through a small fixed buffer. A list that
+// cannot be finished ends with ...,"count":N,"error":"..."} instead.
+class JsonListSource : public WebChunkSource {
+public:
+  JsonListSource(const char* message, const char* listKey);
+  size_t read(uint8_t* buffer, size_t maxLength) override;
+
+protected:
+  virtual bool nextItem(char* out, size_t size) = 0;    // One JSON value; false at the end
+  void failList(const char* reason);                    // Call from nextItem, then return false
+  static void appendJsonString(char* out, size_t size, const char* text);  // Quoted + escaped
+
+private:
+  enum ListStage : uint8_t { LIST_HEADER, LIST_ITEMS, LIST_FOOTER, LIST_DONE };
+
+  bool fillPending();
+
+  const char* message;
+  const char* listKey;
+  const char* error;
+  ListStage stage;
+  uint16_t count;
+  char pending[WEB_LIST_ITEM_BUFFER];
+  size_t pendingLength;
+  size_t pendingPos;
+};
+
+// Receiver of a streamed POST body (onWebStream). Chunks are handed over in
+// order in the network task while the body arrives; the route handler takes
+// the sink from webRequest.bodySink() on the main loop to finish the job.
+// The sink is deleted with the request (or when the client hangs up first).
+class WebBodySink {
+public:
+  virtual ~WebBodySink() {}
+  virtual void write(const uint8_t* data, size_t length) = 0;
+};
+
+typedef WebBodySink* (*WebBodySinkFactory)(size_t totalLength);  // Network task
+
+// Current request as seen by a handler running from the control queue
+class WebRequest {
+public:
+  bool hasArg(const char* name) const;
+  String arg(const char* name) const;   // "plain" is the POST body
+  const uint8_t* body(size_t& length) const;  // Raw POST body (binary safe), nullptr if none
+  WebBodySink* bodySink() const;        // onWebStream routes: the body's sink, nullptr if none
+  String arg(int index) const;
+  String argName(int index) const;
+  int args() const;
+  String uri() const;
+  const char* methodName() const;
+  bool authenticated() const;
+
+  void sendHeader(const char* name, const String& value);
+  bool notModified(const char* etag);   // Tags the response; true = client has it, 304 sent
+  void send(int code, const String& contentType = String(), const String& content = String());
+  void send(int code, const char* contentType, const uint8_t* content, size_t length);  // Binary body
+  void sendChunked(const char* contentType, WebChunkSource* source);  // Takes ownership
+  void sendFile(File file, const char* contentType);                 // Streams an open file
+  void requestAuthentication();
+};
+
+extern WebRequest webRequest;
+
+//========================================
+// FUNCTION DECLARATIONS
+//========================================
+
+void initializeWebControl();                            // Create queue and request slots
+void onWeb(const char* uri, WebRouteHandler handler);   // Route run from the control queue
+void onWeb(const char* uri, WebRequestMethodComposite method, WebRouteHandler handler);
+void onWebStream(const char* uri, WebBodySinkFactory factory, WebRouteHandler handler);  // POST, body fed to a sink
+void onWebNotFound(WebRouteHandler handler);
+bool postControlCommand(const ControlCommand& command); // Network task -> main loop
+void processWebCommands();                              // Drain the queue (call in loop)
+const WebControlStats& getWebControlStats();
+void printWebControlStats();
+
+#endif // K2SO_WEBCONTROL_H
@@ -0,0 +1,332 @@
+/*
+================================================================================
+// K-2SO Controller Web Events Implementation
+// AsyncEventSource on the main web server. Events are recorded on the main
+// loop into a numbered ring and broadcast in rate-limited batches; the
+// network task only reads the ring to replay missed events on reconnect.
+================================================================================
+*/
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <ArduinoJson.h>
+#include <stdarg.h>
+#include "webevents.h"
+#include "config.h"
+#include "sequences.h"    // For sequenceManager
+#include "handlers.h"     // For getModeName
+#include "globals.h"
+
+static AsyncEventSource eventSource(WEB_EVENTS_PATH);
+static bool webEventsStarted = false;
+static WebEventStats stats;
+
+//========================================
+// EVENT RING
+//========================================
+
+// Written by the main loop, read by the network task during replay
+static WebEvent ring[WEB_EVENTS_RING_SIZE];
+static portMUX_TYPE ringLock = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t nextEventId = 1;
+static uint32_t flushedId = 0;            // Newest id broadcast (or skipped, no clients)
+static volatile bool snapshotRequested = false;
+
+static const char* const EVENT_NAMES[] = { "playback", "playlist", "audio", "ir", "mode" };
+
+static uint32_t oldestRingId() {
+  return nextEventId > WEB_EVENTS_RING_SIZE ? nextEventId - WEB_EVENTS_RING_SIZE : 1;
+}
+
+// Copies event 'id' out of the ring; false if it was overwritten meanwhile
+static bool readRingEvent(uint32_t id, WebEvent& event) {
+  portENTER_CRITICAL(&ringLock);
+  event = ring[id & (WEB_EVENTS_RING_SIZE - 1)];
+  portEXIT_CRITICAL(&ringLock);
+  return event.id == id;
+}
+
+void postWebEvent(WebEventType type, const char* format, ...) {
+  if (!webEventsStarted) {
+    return;
+  }
+
+  WebEvent event;
+  event.type = type;
+  va_list args;
+  va_start(args, format);
+  vsnprintf(event.data, sizeof(event.data), format, args);
+  va_end(args);
+
+  portENTER_CRITICAL(&ringLock);
+  event.id = nextEventId++;
+  WebEvent& slot = ring[event.id & (WEB_EVENTS_RING_SIZE - 1)];
+  if (slot.id > flushedId) {
+    stats.lost.fetch_add(1, std::memory_order_relaxed);  // Clients were too slow for a whole ring of events
+  }
+  slot = event;
+  portEXIT_CRITICAL(&ringLock);
+  stats.posted.fetch_add(1, std::memory_order_relaxed);
+}
+
+//========================================
+// STATE CHANGE DETECTION
+//========================================
+
+// Sequence names are limited to [A-Za-z0-9_-], so they go into the JSON as is
+
+struct WatchedState {
+  PersonalityMode mode;
+  bool playing;
+  bool paused;
+  char sequence[MAX_SEQUENCE_NAME_LENGTH];
+  bool playlistActive;
+  uint8_t playlistIndex;
+  uint8_t playlistCount;
+};
+
+static WatchedState watched;
+static uint16_t lastProgressFrame = 0xFFFF;
+
+static void captureWatchedState(WatchedState& state) {
+  memset(&state, 0, sizeof(state));
+  state.mode = currentMode;
+  state.playing = sequenceManager.isPlaying();
+  state.paused = sequenceManager.isPaused();
+  if (state.playing) {
+    strncpy(state.sequence, sequenceManager.getCurrentSequenceName(), sizeof(state.sequence) - 1);
+  }
+  state.playlistActive = sequenceManager.playlistIsActive();
+  state.playlistIndex = sequenceManager.playlistGetCurrentIndex();
+  state.playlistCount = sequenceManager.playlistGetCount();
+}
+
+static void detectChanges() {
+  WatchedState state;
+  captureWatchedState(state);
+
+  if (state.mode != watched.mode) {
+    postWebEvent(WEB_EVENT_MODE, "{\"mode\":\"%s\"}", getModeName(state.mode).c_str());
+  }
+
+  bool sequenceChanged = strcmp(state.sequence, watched.sequence) != 0;
+  if (watched.playing && (!state.playing || sequenceChanged)) {
+    postWebEvent(WEB_EVENT_PLAYBACK, "{\"state\":\"stopped\",\"sequence\":\"%s\"}", watched.sequence);
+  }
+  if (state.playing && (!watched.playing || sequenceChanged)) {
+    postWebEvent(WEB_EVENT_PLAYBACK, "{\"state\":\"started\",\"sequence\":\"%s\"}", state.sequence);
+  } else if (state.playing && state.paused != watched.paused) {
+    postWebEvent(WEB_EVENT_PLAYBACK, "{\"state\":\"%s\",\"sequence\":\"%s\"}",
+                 state.paused ? "paused" : "resumed", state.sequence);
+  }
+
+  if (state.playlistActive != watched.playlistActive ||
+      state.playlistIndex != watched.playlistIndex ||
+      state.playlistCount != watched.playlistCount) {
+    postWebEvent(WEB_EVENT_PLAYLIST, "{\"active\":%s,\"index\":%u,\"count\":%u,\"sequence\":\"%s\"}",
+                 state.playlistActive ? "true" : "false", state.playlistIndex, state.playlistCount,
+                 sequenceManager.playlistGetCurrentName());
+  }
+
+  watched = state;
+}
+
+//========================================
+// BATCHED BROADCAST
+//========================================
+
+static void sendSnapshot() {
+  StaticJsonDocument<384> doc;
+  doc["mode"] = getModeName(currentMode);
+  doc["awake"] = isAwake;
+  doc["playing"] = watched.playing;
+  doc["paused"] = watched.paused;
+  doc["sequence"] = watched.sequence;
+  doc["frame"] = watched.playing ? sequenceManager.getCurrentFrame() : 0;
+  doc["frames"] = watched.playing ? sequenceManager.getTotalFrames() : 0;
+  JsonObject playlist = doc.createNestedObject("playlist");
+  playlist["active"] = watched.playlistActive;
+  playlist["index"] = watched.playlistIndex;
+  playlist["count"] = watched.playlistCount;
+  doc["volume"] = currentVolume;
+  doc["audioReady"] = isAudioReady;
+  doc["lastId"] = flushedId;
+
+  char buffer[384];
+  serializeJson(doc, buffer, sizeof(buffer));
+  eventSource.send(buffer, "state");
+}
+
+// Only the newest frame is sent; everything played in between is coalesced
+static bool sendProgress() {
+  if (!watched.playing) {
+    lastProgressFrame = 0xFFFF;
+    return false;
+  }
+  uint16_t frame = sequenceManager.getCurrentFrame();
+  if (frame == lastProgressFrame) {
+    return false;
+  }
+  if (lastProgressFrame != 0xFFFF && frame > lastProgressFrame + 1) {
+    stats.coalesced.fetch_add(frame - lastProgressFrame - 1, std::memory_order_relaxed);
+  }
+  lastProgressFrame = frame;
+
+  char buffer[WEB_EVENT_DATA_SIZE];
+  snprintf(buffer, sizeof(buffer), "{\"sequence\":\"%s\",\"frame\":%u,\"frames\":%u,\"percent\":%u}",
+           watched.sequence, frame, sequenceManager.getTotalFrames(),
+           (unsigned int)(sequenceManager.getPlaybackProgress() * 100.0f));
+  eventSource.send(buffer, "progress");
+  stats.progress.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+static void flushEvents() {
+  if (eventSource.count() == 0) {
+    // Nobody listening - events stay in the ring for reconnecting clients
+    flushedId = nextEventId - 1;
+    lastProgressFrame = 0xFFFF;
+    snapshotRequested = false;
+    return;
+  }
+  if (eventSource.avgPacketsWaiting() > WEB_EVENTS_MAX_QUEUED) {
+    stats.deferred.fetch_add(1, std::memory_order_relaxed);  // Let the clients drain first; the ring keeps the events
+    return;
+  }
+
+  bool sentAny = false;
+  if (snapshotRequested) {
+    snapshotRequested = false;
+    sendSnapshot();
+    sentAny = true;
+  }
+
+  if (flushedId + 1 < oldestRingId()) {
+    flushedId = oldestRingId() - 1;  // Overwritten ones are counted as lost
+  }
+  uint8_t budget = WEB_EVENTS_MAX_PER_FLUSH;
+  WebEvent event;
+  while (budget > 0 && flushedId + 1 < nextEventId) {
+    uint32_t id = flushedId + 1;
+    if (readRingEvent(id, event)) {
+      eventSource.send(event.data, EVENT_NAMES[event.type], event.id);
+      stats.sent.fetch_add(1, std::memory_order_relaxed);
+      budget--;
+      sentAny = true;
+    }
+    flushedId = id;
+  }
+
+  if (sendProgress()) {
+    sentAny = true;
+  }
+  if (sentAny) {
+    stats.batches.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+//========================================
+// CLIENT CONNECTIONS (network task)
+//========================================
+
+static bool checkAuth(AsyncWebServerRequest* request) {
+  if (request->url() != WEB_EVENTS_PATH) {
+    return true;  // Not ours - let the other handlers decide
+  }
+  if (strlen(WEB_AUTH_USER) == 0 || request->authenticate(WEB_AUTH_USER, WEB_AUTH_PASS)) {
+    return true;
+  }
+  stats.rejected.fetch_add(1, std::memory_order_relaxed);
+  return false;
+}
+
+// Resends what a reconnecting browser missed; newer events follow with the
+// next regular batch
+static void replayEvents(AsyncEventSourceClient* client, uint32_t lastId) {
+  portENTER_CRITICAL(&ringLock);
+  uint32_t oldest = oldestRingId();
+  uint32_t newest = flushedId;
+  portEXIT_CRITICAL(&ringLock);
+
+  if (lastId == newest) {
+    return;  // Up to date
+  }
+  if (lastId + 1 < oldest || lastId > newest) {
+    // Events were lost, or the id is from before a restart
+    client->send("{}", "resync", 0, WEB_EVENTS_RETRY_MS);
+    stats.resyncs.fetch_add(1, std::memory_order_relaxed);
+    snapshotRequested = true;
+    return;
+  }
+
+  WebEvent event;
+  for (uint32_t id = lastId + 1; id <= newest; id++) {
+    if (readRingEvent(id, event)) {
+      client->send(event.data, EVENT_NAMES[event.type], event.id);
+      stats.replayed.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+}
+
+static void onEventClient(AsyncEventSourceClient* client) {
+  stats.connects.fetch_add(1, std::memory_order_relaxed);
+  uint32_t lastId = client->lastId();
+  if (lastId == 0) {
+    client->send("{}", "hello", 0, WEB_EVENTS_RETRY_MS);  // Sets the reconnect delay
+    snapshotRequested = true;
+  } else {
+    replayEvents(client, lastId);
+  }
+}
+
+//========================================
+// LIFECYCLE
+//========================================
+
+void initializeWebEvents() {
+  if (webEventsStarted) {
+    return;  // Handler stays attached across server.end()/begin()
+  }
+  eventSource.onConnect(onEventClient);
+  eventSource.setFilter(checkAuth);
+  server.addHandler(&eventSource);
+
+  captureWatchedState(watched);
+  webEventsStarted = true;
+  Serial.println(F("✓ Event stream on " WEB_EVENTS_PATH));
+}
+
+void updateWebEvents() {
+  if (!webEventsStarted) {
+    return;
+  }
+  detectChanges();
+
+  static unsigned long lastFlush = 0;
+  unsigned long now = millis();
+  if (now - lastFlush >= WEB_EVENTS_FLUSH_INTERVAL_MS) {
+    lastFlush = now;
+    flushEvents();
+  }
+}
+
+uint8_t getWebEventClientCount() {
+  return webEventsStarted ? eventSource.count() : 0;
+}
+
+void printWebEventStats() {
+  Serial.println(F("\n=== WEB EVENTS (SSE) ==="));
+  Serial.printf("Path: %s, clients: %u, last event id: %lu\n", WEB_EVENTS_PATH,
+                getWebEventClientCount(), (unsigned long)(nextEventId - 1));
+  Serial.printf("Connects: %lu, rejected: %lu, replayed: %lu, resyncs: %lu\n",
+                (unsigned long)stats.connects.load(), (unsigned long)stats.rejected.load(),
+                (unsigned long)stats.replayed.load(), (unsigned long)stats.resyncs.load());
+  Serial.printf("Events: %lu posted, %lu sent, %lu lost (ring %d)\n",
+                (unsigned long)stats.posted.load(), (unsigned long)stats.sent.load(),
+                (unsigned long)stats.lost.load(), WEB_EVENTS_RING_SIZE);
+  Serial.printf("Batches: %lu (every %d ms), deferred: %lu\n",
+                (unsigned long)stats.batches.load(), WEB_EVENTS_FLUSH_INTERVAL_MS,
+                (unsigned long)stats.deferred.load());
+  Serial.printf("Progress: %lu samples, %lu frames coalesced\n",
+                (unsigned long)stats.progress.load(), (unsigned long)stats.coalesced.load());
+}
@@ -0,0 +1,87 @@
+/*
+================================================================================
+// K-2SO Controller Web Events Header
+// Read-only Server-Sent Events stream for dashboards and kiosk displays:
+//
+//   GET /events  (Basic auth)   ->  text/event-stream
+//
+// Events (name: JSON data):
+//   state     Full snapshot - first message after connecting, no id
+//   progress  {"sequence","frame","frames","percent"} - latest sample only, no id
+//   playback  {"state":"started|paused|resumed|stopped","sequence"}
+//   playlist  {"active","index","count","sequence"}
+//   audio     {"state":"playing","folder","track"} / {"state":"finished","track"}
+//   ir        {"button","code"}
+//   mode      {"mode"}
+//   resync    Last-Event-ID too old, events were lost - reload state
+//
+// Discrete events are numbered and kept in a small ring, so a browser that
+// reconnects with Last-Event-ID gets what it missed. Everything is sent in
+// batches every WEB_EVENTS_FLUSH_INTERVAL_MS; progress only ever sends the
+// newest frame, so a client never sees more than one batch per interval
+// however fast the sequence runs.
+================================================================================
+*/
+
+#ifndef K2SO_WEBEVENTS_H
+#define K2SO_WEBEVENTS_H
+
+#include <Arduino.h>
+#include <atomic>
+
+//========================================
+// WEB EVENTS CONFIGURATION
+//========================================
+
+#define WEB_EVENTS_PATH                 "/events"
+#define WEB_EVENTS_RING_SIZE            32      // Must be a power of 2
+#define WEB_EVENT_DATA_SIZE             96      // JSON data of one event
+#define WEB_EVENTS_FLUSH_INTERVAL_MS    200     // Batch rate (max 5 batches/s per client)
+#define WEB_EVENTS_MAX_PER_FLUSH        8       // Discrete events per batch, rest waits
+#define WEB_EVENTS_MAX_QUEUED           8       // Client send backlog that defers a batch
+#define WEB_EVENTS_RETRY_MS             2000    // Browser reconnect delay
+
+//========================================
+// DATA STRUCTURES
+//========================================
+
+enum WebEventType : uint8_t {
+  WEB_EVENT_PLAYBACK,
+  WEB_EVENT_PLAYLIST,
+  WEB_EVENT_AUDIO,
+  WEB_EVENT_IR,
+  WEB_EVENT_MODE
+};
+
+struct WebEvent {
+  uint32_t id;                          // 1, 2, 3... (0 = empty slot)
+  WebEventType type;
+  char data[WEB_EVENT_DATA_SIZE];
+};
+
+// Counted in the network task (connects, replays) and the main loop
+struct WebEventStats {
+  std::atomic<uint32_t> connects;
+  std::atomic<uint32_t> rejected;       // Failed authentication
+  std::atomic<uint32_t> posted;         // Discrete events added to the ring
+  std::atomic<uint32_t> batches;
+  std::atomic<uint32_t> sent;           // Discrete events broadcast
+  std::atomic<uint32_t> progress;       // Progress samples broadcast
+  std::atomic<uint32_t> coalesced;      // Frames folded into a later progress sample
+  std::atomic<uint32_t> deferred;       // Batches postponed, clients still busy
+  std::atomic<uint32_t> lost;           // Overwritten in the ring before being sent
+  std::atomic<uint32_t> replayed;       // Resent on reconnect (Last-Event-ID)
+  std::atomic<uint32_t> resyncs;        // Reconnects that were too far behind
+};
+
+//========================================
+// FUNCTION DECLARATIONS
+//========================================
+
+void initializeWebEvents();             // Attach the event source to the web server
+void updateWebEvents();                 // State change detection + batching (call in loop)
+void postWebEvent(WebEventType type, const char* format, ...);  // JSON data, main loop only
+uint8_t getWebEventClientCount();
+void printWebEventStats();
+
+#endif // K2SO_WEBEVENTS_H
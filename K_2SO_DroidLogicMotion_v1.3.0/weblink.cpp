@@ -0,0 +1,338 @@
+/*
+================================================================================
+// K-2SO Controller Web Link Implementation
+// AsyncWebSocket on the main web server. Client commands reuse the CLI
+// tokenizer and run from the control queue; pushes are diffed against the
+// last broadcast state so idle droids send nothing.
+================================================================================
+*/
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <ArduinoJson.h>
+#include <Adafruit_NeoPixel.h>
+#include "weblink.h"
+#include "config.h"
+#include "serialcli.h"    // For cliTokenize
+#include "animations.h"   // For setEyeColor, setEyeBrightness
+#include "sequences.h"    // For sequenceManager
+#include "handlers.h"     // For setRemoteServoTargets, setVolume, getModeName
+#include "webcontrol.h"   // For postControlCommand
+#include "globals.h"
+
+static AsyncWebSocket webSocket(WEBLINK_PATH);
+static bool webLinkStarted = false;
+static char webLinkToken[17] = "";
+static WebLinkStats stats;
+
+//========================================
+// PUSHED STATE
+//========================================
+
+struct WebLinkState {
+  PersonalityMode mode;
+  bool awake;
+  uint8_t brightness;
+  uint8_t volume;
+  bool audioReady;
+  bool playing;
+  bool paused;
+  uint16_t frame;
+  uint16_t frames;
+  char sequence[MAX_SEQUENCE_NAME_LENGTH];
+  bool playlistActive;
+  uint8_t playlistCount;
+  uint8_t playlistIndex;
+  bool recording;
+};
+
+static WebLinkState lastPushed;
+static unsigned long lastPushCheck = 0;
+static unsigned long lastStatsPush = 0;
+static unsigned long lastCleanup = 0;
+
+static void captureState(WebLinkState& state) {
+  memset(&state, 0, sizeof(state));
+  state.mode = currentMode;
+  state.awake = isAwake;
+  state.brightness = currentBrightness;
+  state.volume = currentVolume;
+  state.audioReady = isAudioReady;
+  state.playing = sequenceManager.isPlaying();
+  state.paused = sequenceManager.isPaused();
+  if (state.playing) {
+    state.frame = sequenceManager.getCurrentFrame();
+    state.frames = sequenceManager.getTotalFrames();
+    strncpy(state.sequence, sequenceManager.getCurrentSequenceName(), sizeof(state.sequence) - 1);
+  }
+  state.playlistActive = sequenceManager.playlistIsActive();
+  state.playlistCount = sequenceManager.playlistGetCount();
+  state.playlistIndex = sequenceManager.playlistGetCurrentIndex();
+  state.recording = sequenceManager.isRecording();
+}
+
+// Adds every field that differs from 'previous' (all fields when previous is
+// nullptr). Returns true if anything was added.
+static bool buildDelta(JsonDocument& doc, const WebLinkState& state, const WebLinkState* previous) {
+  bool all = (previous == nullptr);
+
+  if (all || state.mode != previous->mode) doc["mode"] = getModeName(state.mode);
+  if (all || state.awake != previous->awake) doc["awake"] = state.awake;
+  if (all || state.brightness != previous->brightness) doc["brightness"] = state.brightness;
+  if (all || state.volume != previous->volume) doc["volume"] = state.volume;
+  if (all || state.audioReady != previous->audioReady) doc["audioReady"] = state.audioReady;
+  if (all || state.playing != previous->playing) doc["playing"] = state.playing;
+  if (all || state.paused != previous->paused) doc["paused"] = state.paused;
+  if (all || state.frame != previous->frame) doc["frame"] = state.frame;
+  if (all || state.frames != previous->frames) doc["frames"] = state.frames;
+  if (all || strcmp(state.sequence, previous->sequence) != 0) doc["sequence"] = state.sequence;
+  if (all || state.playlistActive != previous->playlistActive ||
+      state.playlistCount != previous->playlistCount ||
+      state.playlistIndex != previous->playlistIndex) {
+    JsonObject playlist = doc.createNestedObject("playlist");
+    playlist["active"] = state.playlistActive;
+    playlist["count"] = state.playlistCount;
+    playlist["index"] = state.playlistIndex;
+  }
+  if (all || state.recording != previous->recording) doc["recording"] = state.recording;
+
+  return doc.size() > 0;
+}
+
+static void addSystemStats(JsonDocument& doc) {
+  doc["uptime"] = (millis() - uptimeStart) / 1000;
+  doc["freeMemory"] = ESP.getFreeHeap();
+}
+
+//========================================
+// CLIENT COMMANDS
+//========================================
+
+static bool parseByte(const char* token, int maxValue, int& value) {
+  return safeParseInt(token, value, 0, maxValue);
+}
+
+// 'S' only fills the latest-wins servo slots, which any task may do, so it
+// is handled in the network task instead of taking a queue entry per sample
+static bool handleServoLine(char* line) {
+  char* argv[6];
+  uint8_t argc = cliTokenize(line, argv, 6);
+  int eyePanPos, eyeTiltPos, headPanPos, headTiltPos;
+  if (argc != 5 || strcmp(argv[0], "S") != 0 ||
+      !parseByte(argv[1], 180, eyePanPos) || !parseByte(argv[2], 180, eyeTiltPos) ||
+      !parseByte(argv[3], 180, headPanPos) || !parseByte(argv[4], 180, headTiltPos)) {
+    return false;
+  }
+  setRemoteServoTargets(eyePanPos, eyeTiltPos, headPanPos, headTiltPos);
+  return true;
+}
+
+static bool handleClientCommand(char* line) {
+  char* argv[6];
+  uint8_t argc = cliTokenize(line, argv, 6);
+  if (argc == 0 || argv[0][1] != '\0') {
+    return false;
+  }
+
+  switch (argv[0][0]) {
+    case 'E': {
+      int r, g, b;
+      if (argc != 4 || !parseByte(argv[1], 255, r) || !parseByte(argv[2], 255, g) ||
+          !parseByte(argv[3], 255, b)) {
+        return false;
+      }
+      uint32_t color = Adafruit_NeoPixel::Color(r, g, b);
+      setEyeColor(color, color);
+      currentPixelMode = SOLID_COLOR;
+      lastActivityTime = millis();
+      return true;
+    }
+
+    case 'B': {
+      int brightness;
+      if (argc != 2 || !parseByte(argv[1], 255, brightness)) {
+        return false;
+      }
+      setEyeBrightness(brightness);
+      return true;
+    }
+
+    case 'V': {
+      int volume;
+      if (argc != 2 || !parseByte(argv[1], 30, volume)) {
+        return false;
+      }
+      setVolume(volume);
+      return true;
+    }
+  }
+  return false;
+}
+
+//========================================
+// SOCKET EVENTS
+//========================================
+
+// Control queue runners - main loop
+
+static void runClientCommand(const ControlCommand& command) {
+  char line[WEB_MAX_COMMAND_TEXT];
+  memcpy(line, command.text, sizeof(line));
+  if (handleClientCommand(line)) {
+    stats.commands.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    stats.badCommands.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+static void sendSnapshot(const ControlCommand& command) {
+  StaticJsonDocument<512> doc;
+  WebLinkState state;
+  captureState(state);
+  buildDelta(doc, state, nullptr);
+  addSystemStats(doc);
+
+  char buffer[512];
+  size_t length = serializeJson(doc, buffer, sizeof(buffer));
+  webSocket.text(command.client, buffer, length);
+}
+
+// Network task: only the token check and the hand-over to the queue
+static bool checkToken(AsyncWebServerRequest* request) {
+  if (request->url() != WEBLINK_PATH) {
+    return true;  // Not ours - let the other handlers decide
+  }
+  if (request->hasParam("token") && request->getParam("token")->value() == webLinkToken) {
+    return true;
+  }
+  stats.rejected.fetch_add(1, std::memory_order_relaxed);
+  return false;
+}
+
+static void onWebSocketEvent(AsyncWebSocket* socket, AsyncWebSocketClient* client,
+                             AwsEventType type, void* arg, uint8_t* data, size_t length) {
+  ControlCommand command = {};
+  command.client = client->id();
+
+  switch (type) {
+    case WS_EVT_CONNECT:
+      stats.connects.fetch_add(1, std::memory_order_relaxed);
+      Serial.printf("WebSocket client %lu connected\n", (unsigned long)client->id());
+      command.run = sendSnapshot;
+      break;
+
+    case WS_EVT_DISCONNECT:
+      Serial.printf("WebSocket client %lu disconnected\n", (unsigned long)client->id());
+      return;
+
+    case WS_EVT_DATA: {
+      // Commands are tiny; anything fragmented or oversized is invalid
+      AwsFrameInfo* info = (AwsFrameInfo*)arg;
+      if (info->opcode != WS_TEXT || !info->final || info->index != 0 || info->len != length ||
+          length == 0 || length >= WEB_MAX_COMMAND_TEXT) {
+        stats.badCommands.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+      memcpy(command.text, data, length);
+      command.text[length] = '\0';
+      if (command.text[0] == 'S') {
+        if (handleServoLine(command.text)) {
+          stats.commands.fetch_add(1, std::memory_order_relaxed);
+        } else {
+          stats.badCommands.fetch_add(1, std::memory_order_relaxed);
+        }
+        return;
+      }
+      command.run = runClientCommand;
+      break;
+    }
+
+    default:
+      return;
+  }
+
+  if (!postControlCommand(command)) {
+    stats.dropped.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+//========================================
+// LIFECYCLE
+//========================================
+
+void initializeWebLink() {
+  if (webLinkStarted) {
+    return;  // Handler stays attached across server.end()/begin()
+  }
+  snprintf(webLinkToken, sizeof(webLinkToken), "%08lx%08lx",
+           (unsigned long)esp_random(), (unsigned long)esp_random());
+
+  webSocket.onEvent(onWebSocketEvent);
+  webSocket.setFilter(checkToken);
+  server.addHandler(&webSocket);
+  webLinkStarted = true;
+
+  captureState(lastPushed);
+  Serial.println(F("✓ WebSocket link on " WEBLINK_PATH));
+}
+
+void updateWebLink() {
+  if (!webLinkStarted) {
+    return;
+  }
+
+  unsigned long now = millis();
+  if (now - lastCleanup >= WEBLINK_CLEANUP_INTERVAL_MS) {
+    lastCleanup = now;
+    webSocket.cleanupClients(WEBLINK_MAX_CLIENTS);
+  }
+
+  if (now - lastPushCheck < WEBLINK_PUSH_INTERVAL_MS) {
+    return;
+  }
+  lastPushCheck = now;
+
+  WebLinkState state;
+  captureState(state);
+
+  if (webSocket.count() == 0) {
+    lastPushed = state;  // Nothing to tell; new clients get a snapshot anyway
+    return;
+  }
+
+  StaticJsonDocument<512> doc;
+  bool changed = buildDelta(doc, state, &lastPushed);
+  if (now - lastStatsPush >= WEBLINK_STATS_INTERVAL_MS) {
+    lastStatsPush = now;
+    addSystemStats(doc);
+    changed = true;
+  }
+  if (!changed) {
+    return;
+  }
+
+  char buffer[512];
+  size_t length = serializeJson(doc, buffer, sizeof(buffer));
+  webSocket.textAll(buffer, length);
+  lastPushed = state;
+  stats.pushes.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint8_t getWebLinkClientCount() {
+  return webLinkStarted ? webSocket.count() : 0;
+}
+
+const char* getWebLinkToken() {
+  return webLinkToken;
+}
+
+void printWebLinkStats() {
+  Serial.println(F("\n=== WEB LINK (WebSocket) ==="));
+  Serial.printf("Path: %s, clients: %u/%d\n", WEBLINK_PATH, getWebLinkClientCount(), WEBLINK_MAX_CLIENTS);
+  Serial.printf("Connects: %lu, rejected: %lu\n",
+                (unsigned long)stats.connects.load(), (unsigned long)stats.rejected.load());
+  Serial.printf("Commands: %lu, invalid: %lu, dropped (queue full): %lu\n",
+                (unsigned long)stats.commands.load(), (unsigned long)stats.badCommands.load(),
+                (unsigned long)stats.dropped.load());
+  Serial.printf("State pushes: %lu\n", (unsigned long)stats.pushes.load());
+}
@@ -0,0 +1,65 @@
+/*
+================================================================================
+// K-2SO Controller Web Link Header
+// Persistent WebSocket channel for the web UI. The browser streams compact
+// control commands; the droid pushes state deltas only when something changed.
+//
+// Connect: GET /ws/info (Basic auth) -> {"path":"/ws","token":"..."}, then
+//          ws://<host>/ws?token=<token>  (same port as the web UI)
+//
+// Browser -> droid (text, space separated):
+//   S <eyePan> <eyeTilt> <headPan> <headTilt>   Servo positions (0-180)
+//   E <r> <g> <b>                               Solid eye color
+//   B <0-255>                                   Eye brightness
+//   V <0-30>                                    Volume
+//
+// Droid -> browser: JSON object holding only the fields that changed
+// (full snapshot right after connecting)
+//
+// Socket events arrive in the network task; commands and snapshots are
+// posted to the web control queue and run on the main loop. 'S' goes straight
+// into the latest-wins servo target slots (applied at the next servo tick).
+================================================================================
+*/
+
+#ifndef K2SO_WEBLINK_H
+#define K2SO_WEBLINK_H
+
+#include <Arduino.h>
+#include <atomic>
+
+//========================================
+// WEB LINK CONFIGURATION
+//========================================
+
+#define WEBLINK_PATH                "/ws"
+#define WEBLINK_MAX_CLIENTS         4
+#define WEBLINK_PUSH_INTERVAL_MS    100     // State diff / push rate limit
+#define WEBLINK_STATS_INTERVAL_MS   5000    // Uptime / heap refresh (always changing)
+#define WEBLINK_CLEANUP_INTERVAL_MS 1000    // Drop closed / surplus clients
+
+//========================================
+// DATA STRUCTURES
+//========================================
+
+// Counted in the network task ('S' lines, connects) and the main loop
+struct WebLinkStats {
+  std::atomic<uint32_t> connects;
+  std::atomic<uint32_t> rejected;       // Bad or missing token
+  std::atomic<uint32_t> commands;       // Valid client commands applied
+  std::atomic<uint32_t> badCommands;
+  std::atomic<uint32_t> dropped;        // Control queue full
+  std::atomic<uint32_t> pushes;         // Delta messages broadcast
+};
+
+//========================================
+// FUNCTION DECLARATIONS
+//========================================
+
+void initializeWebLink();               // Attach the WebSocket handler to the web server
+void updateWebLink();                   // State diff push + client cleanup (call in loop)
+uint8_t getWebLinkClientCount();
+const char* getWebLinkToken();          // Session token handed out by /ws/info
+void printWebLinkStats();
+
+#endif // K2SO_WEBLINK_H
@@ -1,7 +1,8 @@
 /*
 ================================================================================
 // K-2SO Controller Web Interface Implementation - FIXED VERSION
-// Complete HTML/CSS/JavaScript interface for droid control
+// Web UI helpers. The page itself lives in webui/ (index.html, style.css,
+// app.js) and is compiled into webassets.h by tools/build_webui.py.
 ================================================================================
 */
 
@@ -11,1804 +12,6 @@
 #include "globals.h"
 #include "handlers.h"
 
-//========================================
-// MAIN PAGE GENERATION
-//========================================
-
-String getIndexPage() {
-  String html = "";
-  // Pre-allocate memory to prevent fragmentation during string concatenation
-  // Estimated page size: ~18KB, reserve 20KB to be safe
-  html.reserve(20000);
-
-  // Build complete HTML page
-  html += getPageHeader();
-  html += "<body>\n";
-  html += "  <div class='main-container'>\n";
-  html += "    " + getStatusSection() + "\n";
-  html += "    " + getServoControlSection() + "\n";
-  html += "    " + getLEDControlSection() + "\n";
-  html += "    " + getDetailLEDControlSection() + "\n";
-  html += "    " + getAudioControlSection() + "\n";
-  html += "    " + getModeControlSection() + "\n";
-  html += "    " + getSequenceControlSection() + "\n";
-  html += "  </div>\n";
-  html += getPageJavaScript();
-  html += "</body>\n";
-  html += "</html>\n";
-
-  return html;
-}
-
-//========================================
-// PAGE STRUCTURE SECTIONS
-//========================================
-
-String getPageHeader() {
-  String header = R"rawliteral(
-<!DOCTYPE html>
-<html lang="en">
-<head>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <title>K-2SO Controller</title>
-    <meta name="description" content="Professional K-2SO Droid Controller Interface">
-    <meta name="author" content="Advanced Droid Systems">
-    <style>
-)rawliteral";
-  
-  header += getPageCSS();
-  header += R"rawliteral(
-    </style>
-</head>
-)rawliteral";
-  
-  return header;
-}
-
-String getPageCSS() {
-  return R"rawliteral(
-    /* K-2SO Controller Styles */
-    * {
-        margin: 0;
-        padding: 0;
-        box-sizing: border-box;
-    }
-    
-    body {
-        font-family: 'Segoe UI', Tahoma, Geneva, Verdana, sans-serif;
-        background: linear-gradient(135deg, #0a0a0a 0%, #1a1a2e 50%, #16213e 100%);
-        color: #ffffff;
-        min-height: 100vh;
-        overflow-x: hidden;
-    }
-    
-    .main-container {
-        max-width: 1200px;
-        margin: 0 auto;
-        padding: 20px;
-        display: grid;
-        grid-template-columns: repeat(auto-fit, minmax(300px, 1fr));
-        gap: 20px;
-        align-items: start;
-    }
-    
-    /* Card-based sections */
-    .control-section {
-        background: rgba(255, 255, 255, 0.1);
-        backdrop-filter: blur(10px);
-        border-radius: 15px;
-        border: 1px solid rgba(255, 255, 255, 0.2);
-        padding: 25px;
-        box-shadow: 0 8px 32px rgba(0, 0, 0, 0.3);
-        transition: transform 0.3s ease, box-shadow 0.3s ease;
-    }
-    
-    .control-section:hover {
-        transform: translateY(-5px);
-        box-shadow: 0 12px 48px rgba(0, 0, 0, 0.4);
-    }
-    
-    .section-title {
-        font-size: 1.5rem;
-        font-weight: 600;
-        margin-bottom: 20px;
-        color: #4da6ff;
-        text-align: center;
-        text-shadow: 0 2px 4px rgba(0, 0, 0, 0.5);
-        position: relative;
-    }
-    
-    .section-title::after {
-        content: '';
-        position: absolute;
-        bottom: -8px;
-        left: 50%;
-        transform: translateX(-50%);
-        width: 50px;
-        height: 2px;
-        background: linear-gradient(90deg, transparent, #4da6ff, transparent);
-    }
-    
-    /* Status Section */
-    .status-grid {
-        display: grid;
-        grid-template-columns: repeat(auto-fit, minmax(200px, 1fr));
-        gap: 15px;
-        margin-top: 15px;
-    }
-    
-    .status-item {
-        background: rgba(0, 0, 0, 0.3);
-        padding: 15px;
-        border-radius: 10px;
-        text-align: center;
-        border: 1px solid rgba(77, 166, 255, 0.3);
-    }
-    
-    .status-label {
-        font-size: 0.9rem;
-        opacity: 0.8;
-        margin-bottom: 5px;
-    }
-    
-    .status-value {
-        font-size: 1.4rem;
-        font-weight: bold;
-        color: #4da6ff;
-    }
-    
-    /* Servo Control Gamepad */
-    .servo-gamepad {
-        display: grid;
-        grid-template-columns: repeat(3, 1fr);
-        gap: 8px;
-        max-width: 200px;
-        margin: 20px auto;
-        padding: 15px;
-        background: rgba(0, 0, 0, 0.4);
-        border-radius: 15px;
-        border: 2px solid rgba(77, 166, 255, 0.3);
-    }
-    
-    .gamepad-btn {
-        width: 50px;
-        height: 50px;
-        border: none;
-        border-radius: 10px;
-        background: linear-gradient(145deg, #2a2a2a, #1a1a1a);
-        color: #ffffff;
-        font-size: 18px;
-        cursor: pointer;
-        transition: all 0.2s ease;
-        box-shadow: inset 0 2px 4px rgba(0, 0, 0, 0.3);
-        display: flex;
-        align-items: center;
-        justify-content: center;
-    }
-    
-    .gamepad-btn:hover {
-        background: linear-gradient(145deg, #4da6ff, #3a8ae8);
-        transform: translateY(-2px);
-        box-shadow: 0 4px 8px rgba(77, 166, 255, 0.4);
-    }
-    
-    .gamepad-btn:active {
-        transform: translateY(0);
-        box-shadow: inset 0 2px 4px rgba(0, 0, 0, 0.5);
-    }
-    
-    /* Center button special styling */
-    .gamepad-btn.center {
-        background: linear-gradient(145deg, #ff6b6b, #e74c3c);
-    }
-    
-    .gamepad-btn.center:hover {
-        background: linear-gradient(145deg, #ff8787, #ff6b6b);
-    }
-    
-    /* Servo Position Display */
-    .servo-positions {
-        display: grid;
-        grid-template-columns: repeat(2, 1fr);
-        gap: 10px;
-        margin-top: 15px;
-    }
-    
-    .position-display {
-        background: rgba(0, 0, 0, 0.3);
-        padding: 10px;
-        border-radius: 8px;
-        text-align: center;
-        font-family: 'Courier New', monospace;
-    }
-    
-    .position-label {
-        font-size: 0.8rem;
-        opacity: 0.7;
-    }
-    
-    .position-value {
-        font-size: 1.2rem;
-        font-weight: bold;
-        color: #4da6ff;
-    }
-    
-    /* LED Controls */
-    .led-controls {
-        display: flex;
-        flex-direction: column;
-        gap: 20px;
-    }
-    
-    .color-buttons {
-        display: grid;
-        grid-template-columns: repeat(5, 1fr);
-        gap: 10px;
-    }
-    
-    .color-btn {
-        width: 100%;
-        height: 45px;
-        border: none;
-        border-radius: 8px;
-        cursor: pointer;
-        transition: all 0.3s ease;
-        font-weight: bold;
-        text-shadow: 0 1px 2px rgba(0, 0, 0, 0.7);
-        border: 2px solid rgba(255, 255, 255, 0.2);
-    }
-    
-    .color-btn:hover {
-        transform: scale(1.05);
-        border-color: rgba(255, 255, 255, 0.5);
-    }
-    
-    .color-btn.red { background: #ff4757; }
-    .color-btn.green { background: #2ed573; }
-    .color-btn.blue { background: #3742fa; }
-    .color-btn.white { background: #f1f2f6; color: #333; }
-    .color-btn.off { background: #2f3542; }
-    
-    .animation-buttons {
-        display: grid;
-        grid-template-columns: repeat(2, 1fr);
-        gap: 10px;
-        margin-top: 15px;
-    }
-    
-    .animation-btn {
-        padding: 12px 20px;
-        border: none;
-        border-radius: 8px;
-        background: linear-gradient(145deg, #2a2a2a, #1a1a1a);
-        color: #ffffff;
-        font-weight: bold;
-        cursor: pointer;
-        transition: all 0.3s ease;
-        border: 1px solid rgba(77, 166, 255, 0.3);
-    }
-    
-    .animation-btn:hover {
-        background: linear-gradient(145deg, #4da6ff, #3a8ae8);
-        transform: translateY(-2px);
-    }
-    
-    /* Sliders */
-    .slider-container {
-        margin: 15px 0;
-    }
-    
-    .slider-label {
-        display: block;
-        margin-bottom: 8px;
-        font-weight: 500;
-        color: #4da6ff;
-    }
-    
-    .slider {
-        width: 100%;
-        height: 8px;
-        border-radius: 4px;
-        background: rgba(255, 255, 255, 0.2);
-        outline: none;
-        cursor: pointer;
-        -webkit-appearance: none;
-    }
-    
-    .slider::-webkit-slider-thumb {
-        -webkit-appearance: none;
-        width: 20px;
-        height: 20px;
-        border-radius: 50%;
-        background: linear-gradient(145deg, #4da6ff, #3a8ae8);
-        cursor: pointer;
-        box-shadow: 0 2px 6px rgba(0, 0, 0, 0.3);
-    }
-    
-    .slider::-moz-range-thumb {
-        width: 20px;
-        height: 20px;
-        border-radius: 50%;
-        background: linear-gradient(145deg, #4da6ff, #3a8ae8);
-        cursor: pointer;
-        border: none;
-        box-shadow: 0 2px 6px rgba(0, 0, 0, 0.3);
-    }
-    
-    .slider-value {
-        float: right;
-        font-weight: bold;
-        color: #4da6ff;
-        font-family: 'Courier New', monospace;
-    }
-    
-    /* Audio Controls */
-    .sound-buttons {
-        display: grid;
-        grid-template-columns: repeat(2, 1fr);
-        gap: 10px;
-        max-height: 300px;
-        overflow-y: auto;
-    }
-    
-    .sound-btn {
-        padding: 12px 15px;
-        border: none;
-        border-radius: 8px;
-        background: linear-gradient(145deg, #2a2a2a, #1a1a1a);
-        color: #ffffff;
-        font-weight: 500;
-        cursor: pointer;
-        transition: all 0.3s ease;
-        border: 1px solid rgba(77, 166, 255, 0.3);
-        text-align: left;
-    }
-    
-    .sound-btn:hover {
-        background: linear-gradient(145deg, #4da6ff, #3a8ae8);
-        transform: translateY(-1px);
-    }
-    
-    /* Mode Selector */
-    .mode-buttons {
-        display: grid;
-        grid-template-columns: repeat(3, 1fr);
-        gap: 10px;
-    }
-    
-    .mode-btn {
-        padding: 15px 10px;
-        border: none;
-        border-radius: 8px;
-        background: linear-gradient(145deg, #2a2a2a, #1a1a1a);
-        color: #ffffff;
-        font-weight: bold;
-        cursor: pointer;
-        transition: all 0.3s ease;
-        border: 2px solid rgba(77, 166, 255, 0.3);
-        text-transform: uppercase;
-        font-size: 0.9rem;
-    }
-    
-    .mode-btn:hover {
-        border-color: rgba(77, 166, 255, 0.6);
-        transform: translateY(-2px);
-    }
-    
-    .mode-btn.active {
-        background: linear-gradient(145deg, #4da6ff, #3a8ae8);
-        border-color: #4da6ff;
-        box-shadow: 0 4px 15px rgba(77, 166, 255, 0.4);
-    }
-    
-    /* Sequence Control Section */
-    .sequence-list {
-        max-height: 250px;
-        overflow-y: auto;
-        margin-bottom: 20px;
-        background: rgba(0, 0, 0, 0.3);
-        border-radius: 10px;
-        padding: 10px;
-    }
-
-    .sequence-item {
-        display: flex;
-        justify-content: space-between;
-        align-items: center;
-        padding: 10px;
-        margin: 5px 0;
-        background: rgba(255, 255, 255, 0.05);
-        border-radius: 8px;
-        border: 1px solid rgba(77, 166, 255, 0.2);
-        transition: all 0.3s ease;
-    }
-
-    .sequence-item:hover {
-        background: rgba(255, 255, 255, 0.1);
-        border-color: rgba(77, 166, 255, 0.4);
-    }
-
-    .sequence-name {
-        font-weight: 500;
-        color: #ffffff;
-        flex: 1;
-        margin-right: 10px;
-    }
-
-    .sequence-actions {
-        display: flex;
-        gap: 5px;
-    }
-
-    .btn-small {
-        padding: 6px 12px;
-        border: none;
-        border-radius: 6px;
-        font-size: 0.85rem;
-        cursor: pointer;
-        transition: all 0.2s ease;
-        font-weight: 500;
-    }
-
-    .btn-play {
-        background: linear-gradient(145deg, #2ed573, #26b360);
-        color: white;
-    }
-
-    .btn-play:hover {
-        background: linear-gradient(145deg, #3ee583, #2ed573);
-        transform: translateY(-1px);
-    }
-
-    .btn-stop {
-        background: linear-gradient(145deg, #ff6b6b, #e74c3c);
-        color: white;
-    }
-
-    .btn-stop:hover {
-        background: linear-gradient(145deg, #ff7b7b, #ff6b6b);
-        transform: translateY(-1px);
-    }
-
-    .btn-delete {
-        background: linear-gradient(145deg, #ff4757, #e84118);
-        color: white;
-    }
-
-    .btn-delete:hover {
-        background: linear-gradient(145deg, #ff5767, #ff4757);
-        transform: translateY(-1px);
-    }
-
-    .btn-add {
-        background: linear-gradient(145deg, #4da6ff, #3a8ae8);
-        color: white;
-    }
-
-    .btn-add:hover {
-        background: linear-gradient(145deg, #5db6ff, #4da6ff);
-        transform: translateY(-1px);
-    }
-
-    .playlist-status {
-        background: rgba(0, 0, 0, 0.3);
-        padding: 15px;
-        border-radius: 10px;
-        margin-bottom: 15px;
-        border: 1px solid rgba(77, 166, 255, 0.3);
-    }
-
-    .playlist-info {
-        font-size: 0.9rem;
-        margin-bottom: 10px;
-        color: #4da6ff;
-    }
-
-    .playlist-controls {
-        display: grid;
-        grid-template-columns: repeat(2, 1fr);
-        gap: 8px;
-        margin-top: 10px;
-    }
-
-    .btn-control {
-        padding: 10px 15px;
-        border: none;
-        border-radius: 8px;
-        background: linear-gradient(145deg, #2a2a2a, #1a1a1a);
-        color: #ffffff;
-        font-weight: bold;
-        cursor: pointer;
-        transition: all 0.3s ease;
-        border: 1px solid rgba(77, 166, 255, 0.3);
-        font-size: 0.85rem;
-    }
-
-    .btn-control:hover {
-        background: linear-gradient(145deg, #4da6ff, #3a8ae8);
-        transform: translateY(-2px);
-    }
-
-    .ir-mapping-list {
-        max-height: 200px;
-        overflow-y: auto;
-        background: rgba(0, 0, 0, 0.3);
-        border-radius: 10px;
-        padding: 10px;
-    }
-
-    .ir-mapping-item {
-        display: flex;
-        justify-content: space-between;
-        align-items: center;
-        padding: 8px;
-        margin: 4px 0;
-        background: rgba(255, 255, 255, 0.05);
-        border-radius: 6px;
-        font-size: 0.9rem;
-    }
-
-    .ir-button-name {
-        font-weight: 600;
-        color: #4da6ff;
-        min-width: 80px;
-    }
-
-    .ir-sequence-name {
-        flex: 1;
-        text-align: center;
-        color: #ffffff;
-    }
-
-    .empty-message {
-        text-align: center;
-        padding: 20px;
-        color: rgba(255, 255, 255, 0.5);
-        font-style: italic;
-    }
-
-    .section-subsection {
-        margin-top: 20px;
-        padding-top: 20px;
-        border-top: 1px solid rgba(77, 166, 255, 0.2);
-    }
-
-    .subsection-title {
-        font-size: 1.1rem;
-        font-weight: 600;
-        margin-bottom: 15px;
-        color: #ffffff;
-        text-align: center;
-    }
-
-    /* Scrollbar styling */
-    .sequence-list::-webkit-scrollbar,
-    .ir-mapping-list::-webkit-scrollbar {
-        width: 8px;
-    }
-
-    .sequence-list::-webkit-scrollbar-track,
-    .ir-mapping-list::-webkit-scrollbar-track {
-        background: rgba(0, 0, 0, 0.2);
-        border-radius: 4px;
-    }
-
-    .sequence-list::-webkit-scrollbar-thumb,
-    .ir-mapping-list::-webkit-scrollbar-thumb {
-        background: rgba(77, 166, 255, 0.5);
-        border-radius: 4px;
-    }
-
-    .sequence-list::-webkit-scrollbar-thumb:hover,
-    .ir-mapping-list::-webkit-scrollbar-thumb:hover {
-        background: rgba(77, 166, 255, 0.7);
-    }
-
-    /* Mobile Responsive */
-    @media (max-width: 768px) {
-        .main-container {
-            grid-template-columns: 1fr;
-            padding: 15px;
-            gap: 15px;
-        }
-        
-        .control-section {
-            padding: 20px;
-        }
-        
-        .servo-gamepad {
-            max-width: 180px;
-        }
-        
-        .gamepad-btn {
-            width: 45px;
-            height: 45px;
-            font-size: 16px;
-        }
-        
-        .color-buttons {
-            grid-template-columns: repeat(5, 1fr);
-        }
-        
-        .sound-buttons {
-            grid-template-columns: 1fr;
-        }
-    }
-    
-    /* Animations */
-    @keyframes pulse {
-        0% { box-shadow: 0 0 0 0 rgba(77, 166, 255, 0.7); }
-        70% { box-shadow: 0 0 0 10px rgba(77, 166, 255, 0); }
-        100% { box-shadow: 0 0 0 0 rgba(77, 166, 255, 0); }
-    }
-    
-    .pulse-animation {
-        animation: pulse 2s infinite;
-    }
-    
-    /* Loading states */
-    .loading {
-        opacity: 0.6;
-        pointer-events: none;
-    }
-    
-    .loading::after {
-        content: '';
-        position: absolute;
-        top: 50%;
-        left: 50%;
-        width: 20px;
-        height: 20px;
-        margin: -10px 0 0 -10px;
-        border: 2px solid transparent;
-        border-top: 2px solid #4da6ff;
-        border-radius: 50%;
-        animation: spin 1s linear infinite;
-    }
-    
-    @keyframes spin {
-        0% { transform: rotate(0deg); }
-        100% { transform: rotate(360deg); }
-    }
-)rawliteral";
-}
-
-//========================================
-// CONTROL SECTIONS
-//========================================
-
-String getStatusSection() {
-  return R"rawliteral(
-    <div class="control-section">
-        <h2 class="section-title">System Status</h2>
-        <div class="status-grid">
-            <div class="status-item">
-                <div class="status-label">Mode</div>
-                <div class="status-value" id="currentMode">SCANNING</div>
-            </div>
-            <div class="status-item">
-                <div class="status-label">Status</div>
-                <div class="status-value" id="systemStatus">AWAKE</div>
-            </div>
-            <div class="status-item">
-                <div class="status-label">Uptime</div>
-                <div class="status-value" id="systemUptime">00:00:00</div>
-            </div>
-            <div class="status-item">
-                <div class="status-label">Free RAM</div>
-                <div class="status-value" id="freeMemory">0 KB</div>
-            </div>
-        </div>
-    </div>
-)rawliteral";
-}
-
-String getServoControlSection() {
-  return R"rawliteral(
-    <div class="control-section">
-        <h2 class="section-title">Servo Control</h2>
-        <div class="servo-gamepad">
-            <button class="gamepad-btn" onclick="setServos(0, 180, 0, 180)">↖</button>
-            <button class="gamepad-btn" onclick="setServos(90, 180, 90, 180)">↑</button>
-            <button class="gamepad-btn" onclick="setServos(180, 180, 180, 180)">↗</button>
-            <button class="gamepad-btn" onclick="setServos(0, 90, 0, 90)">←</button>
-            <button class="gamepad-btn center" onclick="centerAllServos()">●</button>
-            <button class="gamepad-btn" onclick="setServos(180, 90, 180, 90)">→</button>
-            <button class="gamepad-btn" onclick="setServos(0, 0, 0, 0)">↙</button>
-            <button class="gamepad-btn" onclick="setServos(90, 0, 90, 0)">↓</button>
-            <button class="gamepad-btn" onclick="setServos(180, 0, 180, 0)">↘</button>
-        </div>
-        <div class="servo-positions">
-            <div class="position-display">
-                <div class="position-label">Eye Pan</div>
-                <div class="position-value" id="eyePanPos">90°</div>
-            </div>
-            <div class="position-display">
-                <div class="position-label">Eye Tilt</div>
-                <div class="position-value" id="eyeTiltPos">90°</div>
-            </div>
-            <div class="position-display">
-                <div class="position-label">Head Pan</div>
-                <div class="position-value" id="headPanPos">90°</div>
-            </div>
-            <div class="position-display">
-                <div class="position-label">Head Tilt</div>
-                <div class="position-value" id="headTiltPos">90°</div>
-            </div>
-        </div>
-    </div>
-)rawliteral";
-}
-
-String getLEDControlSection() {
-  return R"rawliteral(
-    <div class="control-section">
-        <h2 class="section-title">Eye Control</h2>
-        <div class="led-controls">
-            <div class="color-buttons">
-                <button class="color-btn red" onclick="setColor('red')">RED</button>
-                <button class="color-btn green" onclick="setColor('green')">GREEN</button>
-                <button class="color-btn blue" onclick="setColor('blue')">BLUE</button>
-                <button class="color-btn white" onclick="setColor('white')">WHITE</button>
-                <button class="color-btn off" onclick="setColor('off')">OFF</button>
-            </div>
-            <div class="animation-buttons">
-                <button class="animation-btn" onclick="setAnimation('flicker')">FLICKER</button>
-                <button class="animation-btn" onclick="setAnimation('pulse')">PULSE</button>
-            </div>
-            <div class="slider-container">
-                <label class="slider-label">Brightness <span class="slider-value" id="brightnessValue">150</span></label>
-                <input type="range" class="slider" id="brightnessSlider" min="0" max="255" value="150" oninput="setBrightness(this.value)">
-            </div>
-        </div>
-    </div>
-)rawliteral";
-}
-
-String getAudioControlSection() {
-  return R"rawliteral(
-    <div class="control-section">
-        <h2 class="section-title">Audio Control</h2>
-        <div class="slider-container">
-            <label class="slider-label">Volume <span class="slider-value" id="volumeValue">15</span></label>
-            <input type="range" class="slider" id="volumeSlider" min="0" max="30" value="15" oninput="setVolume(this.value)">
-        </div>
-        <div class="sound-buttons">
-            <button class="sound-btn" onclick="playSound(1)">🔊 I Am K-2SO</button>
-            <button class="sound-btn" onclick="playSound(2)">🔊 Behavior</button>
-            <button class="sound-btn" onclick="playSound(3)">🔊 Fresh One</button>
-            <button class="sound-btn" onclick="playSound(4)">🔊 Clear of Hostiles</button>
-            <button class="sound-btn" onclick="playSound(5)">🔊 Quiet</button>
-            <button class="sound-btn" onclick="playSound(6)">🔊 Random Voice</button>
-            <button class="sound-btn" onclick="playSound(7)">🔊 Alert Sound</button>
-            <button class="sound-btn" onclick="playSound(8)">🔊 Boot Sound</button>
-        </div>
-    </div>
-)rawliteral";
-}
-
-String getModeControlSection() {
-  return R"rawliteral(
-    <div class="control-section">
-        <h2 class="section-title">Behavior Mode</h2>
-        <div class="mode-buttons">
-            <button class="mode-btn active" id="scanningMode" onclick="setMode('scanning')">SCANNING</button>
-            <button class="mode-btn" id="alertMode" onclick="setMode('alert')">ALERT</button>
-            <button class="mode-btn" id="idleMode" onclick="setMode('idle')">IDLE</button>
-        </div>
-    </div>
-)rawliteral";
-}
-
-String getDetailLEDControlSection() {
-  return R"rawliteral(
-    <div class="control-section">
-        <h2 class="section-title">Detail LED Control</h2>
-        <div class="led-controls">
-            <div class="slider-container">
-                <label class="slider-label">LED Count <span class="slider-value" id="detailCountValue">5</span></label>
-                <input type="range" class="slider" id="detailCountSlider" min="1" max="8" value="5" oninput="setDetailCount(this.value)">
-            </div>
-            <div class="slider-container">
-                <label class="slider-label">Brightness <span class="slider-value" id="detailBrightnessValue">150</span></label>
-                <input type="range" class="slider" id="detailBrightnessSlider" min="0" max="255" value="150" oninput="setDetailBrightness(this.value)">
-            </div>
-            <div class="animation-buttons">
-                <button class="animation-btn" onclick="setDetailPattern('blink')">BLINK</button>
-                <button class="animation-btn" onclick="setDetailPattern('fade')">FADE</button>
-                <button class="animation-btn" onclick="setDetailPattern('chase')">CHASE</button>
-                <button class="animation-btn" onclick="setDetailPattern('pulse')">PULSE</button>
-                <button class="animation-btn" onclick="setDetailPattern('random')">RANDOM</button>
-                <button class="animation-btn" onclick="setDetailEnabled('off')">OFF</button>
-            </div>
-        </div>
-    </div>
-)rawliteral";
-}
-
-String getSequenceControlSection() {
-  return R"rawliteral(
-    <div class="control-section" style="grid-column: 1 / -1;">
-        <h2 class="section-title">Sequence Management</h2>
-
-        <!-- Sequence List -->
-        <div class="subsection-title">Sequences</div>
-        <div class="sequence-list" id="sequenceList">
-            <div class="empty-message">Loading sequences...</div>
-        </div>
-        <div class="playlist-controls" style="margin-bottom: 20px;">
-            <button class="btn-control" onclick="sequenceImport()">Import JSON</button>
-            <button class="btn-control" onclick="sequenceVerifyAll()">Verify All</button>
-            <button class="btn-control" onclick="showSequenceStats()">Stats</button>
-            <button class="btn-control" onclick="loadSequenceList()">Refresh</button>
-        </div>
-
-        <!-- Playback Controls -->
-        <div class="section-subsection">
-            <div class="subsection-title">Playback</div>
-            <div class="playlist-controls">
-                <button class="btn-control" onclick="sequencePause()">⏸️ Pause</button>
-                <button class="btn-control" onclick="sequenceResume()">▶ Resume</button>
-                <button class="btn-control" onclick="sequenceStop()">⏹️ Stop</button>
-            </div>
-        </div>
-
-        <!-- Playlist Management -->
-        <div class="section-subsection">
-            <div class="subsection-title">Playlist</div>
-            <div class="playlist-status">
-                <div class="playlist-info" id="playlistInfo">
-                    No sequences in playlist
-                </div>
-                <div class="playlist-controls">
-                    <button class="btn-control" onclick="playlistSavePrompt()">Save</button>
-                    <button class="btn-control" onclick="playlistLoadPrompt()">Load</button>
-                    <button class="btn-control" onclick="playlistPlay()">▶ Play</button>
-                    <button class="btn-control" onclick="playlistLoop()">🔁 Loop</button>
-                    <button class="btn-control" onclick="playlistClear()">🗑️ Clear</button>
-                </div>
-            </div>
-        </div>
-
-        <!-- IR Mapping -->
-        <div class="section-subsection">
-            <div class="subsection-title">IR Button Mappings</div>
-            <div class="ir-mapping-list" id="irMappingList">
-                <div class="empty-message">Loading IR mappings...</div>
-            </div>
-        </div>
-    </div>
-)rawliteral";
-}
-
-//========================================
-// JAVASCRIPT SECTION
-//========================================
-
-String getPageJavaScript() {
-  return R"rawliteral(
-<script>
-    // Global variables
-    let statusUpdateInterval;
-    let isConnected = true;
-    
-    // Initialize page when loaded
-    document.addEventListener('DOMContentLoaded', function() {
-        console.log('K-2SO Controller initialized');
-        startStatusUpdates();
-        centerAllServos();
-        loadSequenceList();
-        loadPlaylistStatus();
-        loadIRMappings();
-
-        // Auto-refresh sequence data every 5 seconds
-        setInterval(loadSequenceList, 5000);
-        setInterval(loadPlaylistStatus, 5000);
-    });
-    
-    // Status update functions
-    function startStatusUpdates() {
-        updateStatus();
-        statusUpdateInterval = setInterval(updateStatus, 2000);
-    }
-    
-    function stopStatusUpdates() {
-        if (statusUpdateInterval) {
-            clearInterval(statusUpdateInterval);
-        }
-    }
-    
-    async function updateStatus() {
-        try {
-            const response = await fetch('/status');
-            if (!response.ok) throw new Error('Network response was not ok');
-            
-            const data = await response.json();
-            
-            // Update status display
-            document.getElementById('currentMode').textContent = data.mode;
-            document.getElementById('systemStatus').textContent = data.awake ? 'AWAKE' : 'SLEEPING';
-            document.getElementById('systemUptime').textContent = formatUptime(data.uptime);
-            document.getElementById('freeMemory').textContent = formatMemory(data.freeMemory);
-            
-            // Update active mode button
-            updateModeButtons(data.mode.toLowerCase());
-            
-            // Update connection status
-            setConnectionStatus(true);
-            
-        } catch (error) {
-            console.error('Status update failed:', error);
-            setConnectionStatus(false);
-        }
-    }
-    
-    // Servo control functions
-    async function setServos(eyePan, eyeTilt, headPan, headTilt) {
-        try {
-            showLoading('servo');
-            const response = await fetch(`/setServos?eyePan=${eyePan}&eyeTilt=${eyeTilt}&headPan=${headPan}&headTilt=${headTilt}`);
-            
-            if (response.ok) {
-                updateServoPositions(eyePan, eyeTilt, headPan, headTilt);
-                showFeedback('Servos moved', 'success');
-            } else {
-                throw new Error('Servo command failed');
-            }
-        } catch (error) {
-            showFeedback('Servo error: ' + error.message, 'error');
-        } finally {
-            hideLoading('servo');
-        }
-    }
-    
-    function centerAllServos() {
-        setServos(90, 90, 90, 90);
-    }
-    
-    function updateServoPositions(eyePan, eyeTilt, headPan, headTilt) {
-        document.getElementById('eyePanPos').textContent = eyePan + '°';
-        document.getElementById('eyeTiltPos').textContent = eyeTilt + '°';
-        document.getElementById('headPanPos').textContent = headPan + '°';
-        document.getElementById('headTiltPos').textContent = headTilt + '°';
-    }
-    
-    // LED control functions
-    async function setColor(color) {
-        try {
-            showLoading('led');
-            const response = await fetch('/' + color);
-            
-            if (response.ok) {
-                showFeedback('Eye color changed', 'success');
-            } else {
-                throw new Error('Color command failed');
-            }
-        } catch (error) {
-            showFeedback('LED error: ' + error.message, 'error');
-        } finally {
-            hideLoading('led');
-        }
-    }
-    
-    async function setAnimation(animation) {
-        try {
-            showLoading('led');
-            const response = await fetch('/' + animation);
-            
-            if (response.ok) {
-                showFeedback('Animation started', 'success');
-            } else {
-                throw new Error('Animation command failed');
-            }
-        } catch (error) {
-            showFeedback('Animation error: ' + error.message, 'error');
-        } finally {
-            hideLoading('led');
-        }
-    }
-    
-    async function setBrightness(value) {
-        document.getElementById('brightnessValue').textContent = value;
-        
-        try {
-            const response = await fetch(`/brightness?value=${value}`);
-            if (!response.ok) throw new Error('Brightness command failed');
-        } catch (error) {
-            showFeedback('Brightness error: ' + error.message, 'error');
-        }
-    }
-    
-    // Audio control functions
-    async function setVolume(value) {
-        document.getElementById('volumeValue').textContent = value;
-        
-        try {
-            const response = await fetch(`/volume?value=${value}`);
-            if (!response.ok) throw new Error('Volume command failed');
-        } catch (error) {
-            showFeedback('Volume error: ' + error.message, 'error');
-        }
-    }
-    
-    async function playSound(fileNumber) {
-        try {
-            showLoading('audio');
-            const response = await fetch(`/playSound?file=${fileNumber}`);
-            
-            if (response.ok) {
-                showFeedback('Playing sound', 'success');
-            } else {
-                throw new Error('Sound playback failed');
-            }
-        } catch (error) {
-            showFeedback('Audio error: ' + error.message, 'error');
-        } finally {
-            hideLoading('audio');
-        }
-    }
-    
-    // Mode control functions
-    async function setMode(mode) {
-        try {
-            showLoading('mode');
-            const response = await fetch(`/mode?mode=${mode}`);
-            
-            if (response.ok) {
-                updateModeButtons(mode);
-                showFeedback('Mode changed to ' + mode.toUpperCase(), 'success');
-            } else {
-                throw new Error('Mode change failed');
-            }
-        } catch (error) {
-            showFeedback('Mode error: ' + error.message, 'error');
-        } finally {
-            hideLoading('mode');
-        }
-    }
-    
-    function updateModeButtons(activeMode) {
-        // Remove active class from all buttons
-        document.querySelectorAll('.mode-btn').forEach(btn => {
-            btn.classList.remove('active');
-        });
-        
-        // Add active class to selected button
-        const activeButton = document.getElementById(activeMode + 'Mode');
-        if (activeButton) {
-            activeButton.classList.add('active');
-        }
-    }
-    
-    // Utility functions
-    function formatUptime(seconds) {
-        const hours = Math.floor(seconds / 3600);
-        const minutes = Math.floor((seconds % 3600) / 60);
-        const secs = seconds % 60;
-        return `${hours.toString().padStart(2, '0')}:${minutes.toString().padStart(2, '0')}:${secs.toString().padStart(2, '0')}`;
-    }
-    
-    function formatMemory(bytes) {
-        if (bytes < 1024) return bytes + ' B';
-        if (bytes < 1048576) return Math.round(bytes / 1024) + ' KB';
-        return Math.round(bytes / 1048576) + ' MB';
-    }
-    
-    function setConnectionStatus(connected) {
-        if (connected !== isConnected) {
-            isConnected = connected;
-            const statusElements = document.querySelectorAll('.status-value');
-            statusElements.forEach(el => {
-                el.style.color = connected ? '#4da6ff' : '#ff4757';
-            });
-            
-            if (!connected) {
-                showFeedback('Connection lost - attempting to reconnect...', 'error');
-            } else {
-                showFeedback('Connected to K-2SO', 'success');
-            }
-        }
-    }
-    
-    function showLoading(section) {
-        // Visual feedback for loading state
-        const elements = document.querySelectorAll('.control-section');
-        elements.forEach(el => {
-            if (el.textContent.toLowerCase().includes(section)) {
-                el.classList.add('loading');
-            }
-        });
-    }
-    
-    function hideLoading(section) {
-        const elements = document.querySelectorAll('.control-section');
-        elements.forEach(el => {
-            el.classList.remove('loading');
-        });
-    }
-    
-    function showFeedback(message, type) {
-        // Create temporary feedback element
-        const feedback = document.createElement('div');
-        feedback.textContent = message;
-        feedback.style.cssText = `
-            position: fixed;
-            top: 20px;
-            right: 20px;
-            padding: 15px 25px;
-            border-radius: 8px;
-            color: white;
-            font-weight: bold;
-            z-index: 1000;
-            animation: slideInRight 0.3s ease;
-            background: ${type === 'success' ? '#2ed573' : '#ff4757'};
-            box-shadow: 0 4px 12px rgba(0,0,0,0.3);
-        `;
-        
-        document.body.appendChild(feedback);
-        
-        setTimeout(() => {
-            feedback.style.animation = 'slideOutRight 0.3s ease';
-            setTimeout(() => document.body.removeChild(feedback), 300);
-        }, 3000);
-    }
-    
-    // Add CSS animations for feedback
-    const style = document.createElement('style');
-    style.textContent = `
-        @keyframes slideInRight {
-            from { transform: translateX(100%); }
-            to { transform: translateX(0); }
-        }
-        @keyframes slideOutRight {
-            from { transform: translateX(0); }
-            to { transform: translateX(100%); }
-        }
-    `;
-    document.head.appendChild(style);
-    
-    // Keyboard shortcuts
-    document.addEventListener('keydown', function(event) {
-        // Only process if not in an input field
-        if (event.target.tagName === 'INPUT') return;
-        
-        switch(event.key) {
-            case 'c':
-            case 'C':
-                centerAllServos();
-                break;
-            case '1':
-                setMode('scanning');
-                break;
-            case '2':
-                setMode('alert');
-                break;
-            case '3':
-                setMode('idle');
-                break;
-            case 'r':
-            case 'R':
-                setColor('red');
-                break;
-            case 'g':
-            case 'G':
-                setColor('green');
-                break;
-            case 'b':
-            case 'B':
-                setColor('blue');
-                break;
-            case 'w':
-            case 'W':
-                setColor('white');
-                break;
-            case 'ArrowUp':
-                event.preventDefault();
-                setServos(90, 180, 90, 180);
-                break;
-            case 'ArrowDown':
-                event.preventDefault();
-                setServos(90, 0, 90, 0);
-                break;
-            case 'ArrowLeft':
-                event.preventDefault();
-                setServos(0, 90, 0, 90);
-                break;
-            case 'ArrowRight':
-                event.preventDefault();
-                setServos(180, 90, 180, 90);
-                break;
-        }
-    });
-    
-    // Touch/mobile support
-    let touchStartX, touchStartY;
-    
-    document.addEventListener('touchstart', function(e) {
-        touchStartX = e.touches[0].clientX;
-        touchStartY = e.touches[0].clientY;
-    });
-    
-    document.addEventListener('touchend', function(e) {
-        if (!touchStartX || !touchStartY) return;
-        
-        const touchEndX = e.changedTouches[0].clientX;
-        const touchEndY = e.changedTouches[0].clientY;
-        
-        const diffX = touchStartX - touchEndX;
-        const diffY = touchStartY - touchEndY;
-        
-        const minSwipeDistance = 50;
-        
-        if (Math.abs(diffX) > Math.abs(diffY)) {
-            // Horizontal swipe
-            if (Math.abs(diffX) > minSwipeDistance) {
-                if (diffX > 0) {
-                    // Swipe left
-                    setServos(0, 90, 0, 90);
-                } else {
-                    // Swipe right
-                    setServos(180, 90, 180, 90);
-                }
-            }
-        } else {
-            // Vertical swipe
-            if (Math.abs(diffY) > minSwipeDistance) {
-                if (diffY > 0) {
-                    // Swipe up
-                    setServos(90, 180, 90, 180);
-                } else {
-                    // Swipe down
-                    setServos(90, 0, 90, 0);
-                }
-            }
-        }
-        
-        touchStartX = null;
-        touchStartY = null;
-    });
-    
-    // Detail LED control functions
-    async function setDetailCount(value) {
-        document.getElementById('detailCountValue').textContent = value;
-        try {
-            const response = await fetch(`/detailCount?value=${value}`);
-            if (!response.ok) throw new Error('Detail count command failed');
-        } catch (error) {
-            showFeedback('Detail LED error: ' + error.message, 'error');
-        }
-    }
-
-    async function setDetailBrightness(value) {
-        document.getElementById('detailBrightnessValue').textContent = value;
-        try {
-            const response = await fetch(`/detailBrightness?value=${value}`);
-            if (!response.ok) throw new Error('Detail brightness command failed');
-        } catch (error) {
-            showFeedback('Detail LED error: ' + error.message, 'error');
-        }
-    }
-
-    async function setDetailPattern(pattern) {
-        try {
-            showLoading('detail');
-            const response = await fetch(`/detailPattern?pattern=${pattern}`);
-            if (response.ok) {
-                showFeedback('Detail LED pattern: ' + pattern.toUpperCase(), 'success');
-            } else {
-                throw new Error('Pattern command failed');
-            }
-        } catch (error) {
-            showFeedback('Detail LED error: ' + error.message, 'error');
-        } finally {
-            hideLoading('detail');
-        }
-    }
-
-    async function setDetailEnabled(state) {
-        try {
-            const response = await fetch(`/detailEnabled?state=${state}`);
-            if (response.ok) {
-                showFeedback('Detail LEDs: ' + state.toUpperCase(), 'success');
-            } else {
-                throw new Error('Detail enabled command failed');
-            }
-        } catch (error) {
-            showFeedback('Detail LED error: ' + error.message, 'error');
-        }
-    }
-
-    // ========================================
-    // SEQUENCE MANAGEMENT FUNCTIONS
-    // ========================================
-
-    async function readApiResponse(response) {
-        const contentType = response.headers.get('content-type') || '';
-        let payload = null;
-        let text = '';
-
-        if (contentType.includes('application/json')) {
-            try {
-                payload = await response.json();
-            } catch (error) {
-                payload = null;
-            }
-        } else {
-            text = await response.text();
-        }
-
-        if (!response.ok) {
-            throw new Error((payload && payload.message) || text || 'Request failed');
-        }
-
-        if (payload && payload.ok === false) {
-            throw new Error(payload.message || 'Request failed');
-        }
-
-        return payload || { ok: true, message: text };
-    }
-
-    function refreshSequenceViews() {
-        setTimeout(() => {
-            loadSequenceList();
-            loadPlaylistStatus();
-            loadIRMappings();
-        }, 400);
-    }
-
-    // Load and display sequence list
-    async function loadSequenceList() {
-        try {
-            const data = await readApiResponse(await fetch('/seq/list'));
-            const listDiv = document.getElementById('sequenceList');
-
-            if (!data.sequences || data.sequences.length === 0) {
-                listDiv.innerHTML = '<div class="empty-message">No sequences available</div>';
-                return;
-            }
-
-            let html = '';
-            data.sequences.forEach(seq => {
-                html += `
-                    <div class="sequence-item">
-                        <div class="sequence-name">${escapeHtml(seq.name)}</div>
-                        <div class="sequence-actions">
-                            <button class="btn-small btn-play" onclick="sequencePlay('${escapeHtml(seq.name)}')">▶</button>
-                            <button class="btn-small btn-loop" onclick="sequenceLoop('${escapeHtml(seq.name)}')">🔁</button>
-                            <button class="btn-small btn-add" onclick="playlistAdd('${escapeHtml(seq.name)}')">+</button>
-                            <button class="btn-small btn-control" onclick="sequenceVerify('${escapeHtml(seq.name)}')">V</button>
-                            <button class="btn-small btn-control" onclick="sequenceExport('${escapeHtml(seq.name)}')">E</button>
-                            <button class="btn-small btn-control" onclick="sequenceDuplicatePrompt('${escapeHtml(seq.name)}')">C</button>
-                            <button class="btn-small btn-delete" onclick="sequenceDelete('${escapeHtml(seq.name)}')">🗑️</button>
-                        </div>
-                    </div>
-                `;
-            });
-
-            if (data.count >= data.maxDisplayed) {
-                html += '<div class="empty-message" style="color:#ff9f43;">Showing first ' + data.maxDisplayed + ' sequences only</div>';
-            }
-
-            listDiv.innerHTML = html;
-
-        } catch (error) {
-            console.error('Error loading sequences:', error);
-            document.getElementById('sequenceList').innerHTML =
-                '<div class="empty-message">Error loading sequences</div>';
-        }
-    }
-
-    // Play a sequence
-    async function sequencePlay(name) {
-        try {
-            const data = await readApiResponse(await fetch(`/seq/play?name=${encodeURIComponent(name)}`));
-            showFeedback(data.message || `Playing: ${name}`, 'success');
-            refreshSequenceViews();
-        } catch (error) {
-            showFeedback('Error: ' + error.message, 'error');
-        }
-    }
-
-    // Stop sequence/playlist playback
-    async function sequenceStop() {
-        try {
-            const data = await readApiResponse(await fetch('/seq/stop'));
-            showFeedback(data.message || 'Playback stopped', 'success');
-            refreshSequenceViews();
-        } catch (error) {
-            showFeedback('Error: ' + error.message, 'error');
-        }
-    }
-
-    // Pause playback
-    async function sequencePause() {
-        try {
-            const data = await readApiResponse(await fetch('/seq/pause'));
-            showFeedback(data.message || 'Playback paused', 'success');
-            refreshSequenceViews();
-        } catch (error) {
-            showFeedback('Error: ' + error.message, 'error');
-        }
-    }
-
-    // Resume playback
-    async function sequenceResume() {
-        try {
-            const data = await readApiResponse(await fetch('/seq/resume'));
-            showFeedback(data.message || 'Playback resumed', 'success');
-            refreshSequenceViews();
-        } catch (error) {
-            showFeedback('Error: ' + error.message, 'error');
-        }
-    }
-
-    // Loop a single sequence
-    async function sequenceLoop(name) {
-        try {
-            const data = await readApiResponse(await fetch(`/seq/loop?name=${encodeURIComponent(name)}`));
-            showFeedback(data.message || `Looping: ${name}`, 'success');
-            refreshSequenceViews();
-        } catch (error) {
-            showFeedback('Error: ' + error.message, 'error');
-        }
-    }
-
-    // Delete a sequence
-    async function sequenceDelete(name) {
-        if (!confirm(`Delete sequence "${name}"?`)) return;
-
-        try {
-            const data = await readApiResponse(await fetch(`/seq/delete?name=${encodeURIComponent(name)}`));
-            showFeedback(data.message || `Deleted: ${name}`, 'success');
-            refreshSequenceViews();
-        } catch (error) {
-            showFeedback('Error: ' + error.message, 'error');
-        }
-    }
-
-    async function sequenceImport() {
-        const input = document.createElement('input');
-        input.type = 'file';
-        input.accept = '.json,.seq,application/json,text/plain';
-        input.onchange = async event => {
-            const file = event.target.files && event.target.files[0];
-            if (!file) return;
-
-            try {
-                const payload = await file.text();
-                const data = await readApiResponse(await fetch('/seq/import', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'text/plain;charset=utf-8' },
-                    body: payload
-                }));
-                showFeedback(data.message || 'Sequence imported', 'success');
-                refreshSequenceViews();
-            } catch (error) {
-                showFeedback('Error: ' + error.message, 'error');
-            }
-        };
-        input.click();
-    }
-
-    async function sequenceVerify(name) {
-        try {
-            const data = await readApiResponse(await fetch(`/seq/verify?name=${encodeURIComponent(name)}`));
-            alert(
-                `Sequence verified\n\n` +
-                `Name: ${data.name}\n` +
-                `Declared frames: ${data.declaredFrames}\n` +
-                `Actual frames: ${data.actualFrames}\n` +
-                `Duration: ${((data.durationMs || 0) / 1000).toFixed(2)} s\n` +
-                `Version: ${data.version}\n` +
-                `File size: ${data.fileSize} bytes`
-            );
-            showFeedback(data.message || `Verified: ${name}`, 'success');
-        } catch (error) {
-            showFeedback('Error: ' + error.message, 'error');
-        }
-    }
-
-    async function sequenceVerifyAll() {
-        try {
-            const data = await readApiResponse(await fetch('/seq/verify-all'));
-            alert(
-                `Verify All\n\n` +
-                `OK: ${data.okCount}\n` +
-                `Failed: ${data.failCount}\n\n` +
-                `${data.report || ''}`
-            );
-            showFeedback(data.message || 'All sequences verified', 'success');
-        } catch (error) {
-            showFeedback('Error: ' + error.message, 'error');
-        }
-    }
-
-    async function showSequenceStats() {
-        try {
-            const data = await readApiResponse(await fetch('/seq/stats'));
-            alert(
-                `Sequence Storage Stats\n\n` +
-                `Sequences: ${data.sequenceCount}\n` +
-                `Saved playlists: ${data.playlistCount}\n` +
-                `Total bytes: ${data.totalBytes}\n` +
-                `Used bytes: ${data.usedBytes}\n` +
-                `Free bytes: ${data.freeBytes}\n` +
-                `Largest sequence: ${data.largestSequenceName || 'n/a'}\n` +
-                `Largest sequence bytes: ${data.largestSequenceBytes}`
-            );
-        } catch (error) {
-            showFeedback('Error: ' + error.message, 'error');
-        }
-    }
-
-    async function sequenceExport(name) {
-        try {
-            const response = await fetch(`/seq/export?name=${encodeURIComponent(name)}`);
-            if (!response.ok) {
-                await readApiResponse(response);
-                return;
-            }
-
-            const jsonText = await response.text();
-            const blob = new Blob([jsonText], { type: 'application/json' });
-            const url = URL.createObjectURL(blob);
-            const link = document.createElement('a');
-            link.href = url;
-            link.download = `${name}.json`;
-            document.body.appendChild(link);
-            link.click();
-            link.remove();
-            URL.revokeObjectURL(url);
-            showFeedback(`Exported sequence: ${name}`, 'success');
-        } catch (error) {
-            showFeedback('Error: ' + error.message, 'error');
-        }
-    }
-
-    async function sequenceDuplicatePrompt(sourceName) {
-        const targetName = prompt(`Duplicate "${sourceName}" as:`, `${sourceName}_copy`);
-        if (targetName === null) return;
-
-        const trimmed = targetName.trim();
-        if (!trimmed) {
-            showFeedback('Error: target name is required', 'error');
-            return;
-        }
-
-        try {
-            const data = await readApiResponse(await fetch(`/seq/duplicate?source=${encodeURIComponent(sourceName)}&target=${encodeURIComponent(trimmed)}`));
-            showFeedback(data.message || 'Sequence duplicated', 'success');
-            refreshSequenceViews();
-        } catch (error) {
-            showFeedback('Error: ' + error.message, 'error');
-        }
-    }
-
-    async function playlistSavePrompt() {
-        const playlistName = prompt('Save current playlist as:', 'show_a');
-        if (playlistName === null) return;
-
-        const trimmed = playlistName.trim();
-        if (!trimmed) return;
-
-        try {
-            const data = await readApiResponse(await fetch(`/seq/playlist/save?name=${encodeURIComponent(trimmed)}`));
-            showFeedback(data.message || 'Playlist saved', 'success');
-            refreshSequenceViews();
-        } catch (error) {
-            showFeedback('Error: ' + error.message, 'error');
-        }
-    }
-
-    async function playlistLoadPrompt() {
-        try {
-            const listData = await readApiResponse(await fetch('/seq/playlist/list'));
-            const available = (listData.playlists || []).map(item => item.name);
-            const suggested = available.length > 0 ? available[0] : 'show_a';
-            const message = available.length > 0
-                ? `Load which playlist?\nAvailable: ${available.join(', ')}`
-                : 'Load which playlist?';
-            const playlistName = prompt(message, suggested);
-            if (playlistName === null) return;
-
-            const trimmed = playlistName.trim();
-            if (!trimmed) return;
-
-            const data = await readApiResponse(await fetch(`/seq/playlist/load?name=${encodeURIComponent(trimmed)}`));
-            showFeedback(data.message || 'Playlist loaded', 'success');
-            refreshSequenceViews();
-        } catch (error) {
-            showFeedback('Error: ' + error.message, 'error');
-        }
-    }
-
-    // Add sequence to playlist
-    async function playlistAdd(name) {
-        try {
-            const data = await readApiResponse(await fetch(`/seq/playlist/add?name=${encodeURIComponent(name)}`));
-            showFeedback(data.message || `Added to playlist: ${name}`, 'success');
-            refreshSequenceViews();
-        } catch (error) {
-            showFeedback('Error: ' + error.message, 'error');
-        }
-    }
-
-    async function playlistRemove(index) {
-        try {
-            const data = await readApiResponse(await fetch(`/seq/playlist/remove?index=${index}`));
-            showFeedback(data.message || 'Playlist item removed', 'success');
-            refreshSequenceViews();
-        } catch (error) {
-            showFeedback('Error: ' + error.message, 'error');
-        }
-    }
-
-    async function playlistMove(fromIndex, toIndex) {
-        try {
-            const data = await readApiResponse(await fetch(`/seq/playlist/move?from=${fromIndex}&to=${toIndex}`));
-            showFeedback(data.message || 'Playlist reordered', 'success');
-            refreshSequenceViews();
-        } catch (error) {
-            showFeedback('Error: ' + error.message, 'error');
-        }
-    }
-
-    // Clear playlist
-    async function playlistClear() {
-        try {
-            const data = await readApiResponse(await fetch('/seq/playlist/clear'));
-            showFeedback(data.message || 'Playlist cleared', 'success');
-            refreshSequenceViews();
-        } catch (error) {
-            showFeedback('Error: ' + error.message, 'error');
-        }
-    }
-
-    // Play playlist
-    async function playlistPlay() {
-        try {
-            const data = await readApiResponse(await fetch('/seq/playlist/play'));
-            showFeedback(data.message || 'Playing playlist', 'success');
-            refreshSequenceViews();
-        } catch (error) {
-            showFeedback('Error: ' + error.message, 'error');
-        }
-    }
-
-    // Play playlist with loop
-    async function playlistLoop() {
-        try {
-            const data = await readApiResponse(await fetch('/seq/playlist/loop'));
-            showFeedback(data.message || 'Looping playlist', 'success');
-            refreshSequenceViews();
-        } catch (error) {
-            showFeedback('Error: ' + error.message, 'error');
-        }
-    }
-
-    // Load playlist status
-    async function loadPlaylistStatus() {
-        try {
-            const data = await readApiResponse(await fetch('/seq/playlist/get'));
-            const infoDiv = document.getElementById('playlistInfo');
-
-            if (!data.sequences || data.sequences.length === 0) {
-                infoDiv.innerHTML =
-                    'No sequences in playlist<br><br>' +
-                    '<button class="btn-small btn-control" onclick="playlistSavePrompt()">Save</button> ' +
-                    '<button class="btn-small btn-control" onclick="playlistLoadPrompt()">Load</button>';
-                return;
-            }
-
-            let html = `<strong>${data.count} sequence(s):</strong><br>`;
-            data.sequences.forEach((seq, index) => {
-                const isCurrent = (data.active && index === data.currentIndex);
-                html += `<span style="${isCurrent ? 'color: #2ed573; font-weight: bold;' : ''}">
-                    ${isCurrent ? '▶ ' : '• '}${escapeHtml(seq)}
-                </span><br>`;
-                html += `
-                    <span style="display:inline-flex;gap:4px;margin:0 0 8px 0;">
-                        <button class="btn-small btn-control" onclick="playlistMove(${index + 1}, ${index})" ${index === 0 ? 'disabled' : ''}>Up</button>
-                        <button class="btn-small btn-control" onclick="playlistMove(${index + 1}, ${index + 2})" ${index === data.sequences.length - 1 ? 'disabled' : ''}>Down</button>
-                        <button class="btn-small btn-delete" onclick="playlistRemove(${index + 1})">Remove</button>
-                    </span><br>
-                `;
-            });
-
-            if (data.active) {
-                html += `<br><span style="color: #4da6ff;">Status: Playing</span>`;
-            }
-
-            html += '<br><button class="btn-small btn-control" onclick="playlistSavePrompt()">Save</button> ';
-            html += '<button class="btn-small btn-control" onclick="playlistLoadPrompt()">Load</button>';
-
-            infoDiv.innerHTML = html;
-
-        } catch (error) {
-            console.error('Error loading playlist:', error);
-        }
-    }
-
-    // Load IR mappings
-    async function loadIRMappings() {
-        try {
-            const data = await readApiResponse(await fetch('/seq/map/list'));
-            const listDiv = document.getElementById('irMappingList');
-
-            if (!data.mappings || data.mappings.length === 0) {
-                listDiv.innerHTML = '<div class="empty-message">No IR buttons configured</div>';
-                return;
-            }
-
-            let html = '';
-            data.mappings.forEach(mapping => {
-                const mappedLabel = mapping.sequence && mapping.sequence.length > 0 ? mapping.sequence : 'Unmapped';
-                html += `
-                    <div class="ir-mapping-item">
-                        <div class="ir-button-name">${escapeHtml(mapping.button)}</div>
-                        <div class="ir-sequence-name">${escapeHtml(mappedLabel)}</div>
-                        <button class="btn-small btn-control" onclick="irMapSetPrompt('${escapeHtml(mapping.button)}', '${escapeHtml(mapping.sequence || '')}')">Map</button>
-                        <button class="btn-small btn-delete" onclick="irMapClear('${escapeHtml(mapping.button)}')">✕</button>
-                    </div>
-                `;
-            });
-
-            listDiv.innerHTML = html;
-
-        } catch (error) {
-            console.error('Error loading IR mappings:', error);
-            document.getElementById('irMappingList').innerHTML =
-                '<div class="empty-message">Error loading IR mappings</div>';
-        }
-    }
-
-    // Clear IR mapping
-    async function irMapClear(buttonName) {
-        if (!confirm(`Clear mapping for button "${buttonName}"?`)) return;
-
-        try {
-            const data = await readApiResponse(await fetch(`/seq/map/clear?button=${encodeURIComponent(buttonName)}`));
-            showFeedback(data.message || `Cleared mapping for: ${buttonName}`, 'success');
-            refreshSequenceViews();
-        } catch (error) {
-            showFeedback('Error: ' + error.message, 'error');
-        }
-    }
-
-    async function irMapSetPrompt(buttonName, currentSequence = '') {
-        const nextSequence = prompt(`Map button "${buttonName}" to which sequence? Leave blank to cancel.`, currentSequence || '');
-        if (nextSequence === null) return;
-
-        const trimmed = nextSequence.trim();
-        if (!trimmed) return;
-
-        try {
-            const data = await readApiResponse(await fetch(`/seq/map/set?button=${encodeURIComponent(buttonName)}&sequence=${encodeURIComponent(trimmed)}`));
-            showFeedback(data.message || `Mapped ${buttonName}`, 'success');
-            refreshSequenceViews();
-        } catch (error) {
-            showFeedback('Error: ' + error.message, 'error');
-        }
-    }
-
-    // HTML escape utility
-    function escapeHtml(text) {
-        const map = {
-            '&': '&amp;',
-            '<': '&lt;',
-            '>': '&gt;',
-            '"': '&quot;',
-            "'": '&#039;'
-        };
-        return String(text).replace(/[&<>"']/g, m => map[m]);
-    }
-
-    console.log('K-2SO Controller ready. Use keyboard shortcuts: C=center, 1/2/3=modes, R/G/B/W=colors, arrows=movement');
-</script>
-)rawliteral";
-}
-
 //========================================
 // UTILITY FUNCTIONS
 //========================================
@@ -53,25 +53,24 @@ enum WebPageSection {
 };
 
 //========================================
-// FUNCTION DECLARATIONS
+// STATIC ASSETS
 //========================================
 
-// Main page generation
-String getIndexPage();                                 // Get complete HTML page
-
-// Page section generators
-String getPageHeader();                                // Get HTML head section
-String getPageCSS();                                   // Get CSS styles
-String getPageJavaScript();                            // Get JavaScript code
-
-// Control section generators
-String getServoControlSection();                       // Get servo gamepad HTML
-String getLEDControlSection();                         // Get LED control HTML
-String getDetailLEDControlSection();                   // Get Detail LED control HTML
-String getAudioControlSection();                       // Get audio control HTML
-String getModeControlSection();                        // Get mode selection HTML
-String getStatusSection();                             // Get status display HTML
-String getSequenceControlSection();                    // Get sequence management HTML
+// One pre-built file of the web UI, gzip-compressed in flash. The table
+// itself (WEBUI_ASSETS) is generated into webassets.h by tools/build_webui.py
+// from the sources in webui/.
+struct WebAsset {
+  const char* path;             // Request path, "/" for index.html
+  const char* contentType;
+  const uint8_t* data;          // gzip body (PROGMEM)
+  size_t length;
+  const char* etag;             // Quoted content hash
+  bool immutable;               // Requested via hashed URL, cache for a year
+};
+
+//========================================
+// FUNCTION DECLARATIONS
+//========================================
 
 // Dynamic content generators
 String getCurrentStatusJSON();                         // Get status as JSON
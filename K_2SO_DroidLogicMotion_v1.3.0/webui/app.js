@@ -0,0 +1,1066 @@
+// Global variables
+let statusUpdateInterval;
+let listUpdateInterval;
+let isConnected = true;
+let webLink = null;             // WebSocket to the droid (null while disconnected)
+let lastRecording = false;
+
+// Initialize page when loaded
+document.addEventListener('DOMContentLoaded', function() {
+    console.log('K-2SO Controller initialized');
+    startStatusUpdates();
+    centerAllServos();
+    loadSequenceList();
+    loadPlaylistStatus();
+    loadIRMappings();
+
+    // Polling is the fallback; once the WebSocket is up the droid pushes changes
+    startListUpdates(5000);
+    connectWebLink();
+    connectEventStream();
+    startGamepadStreaming();
+});
+
+// Status update functions
+function startStatusUpdates() {
+    updateStatus();
+    statusUpdateInterval = setInterval(updateStatus, 2000);
+}
+
+function stopStatusUpdates() {
+    if (statusUpdateInterval) {
+        clearInterval(statusUpdateInterval);
+        statusUpdateInterval = null;
+    }
+}
+
+function startListUpdates(interval) {
+    if (listUpdateInterval) {
+        clearInterval(listUpdateInterval);
+    }
+    listUpdateInterval = setInterval(() => {
+        loadSequenceList();
+        loadPlaylistStatus();
+    }, interval);
+}
+
+// WebSocket link - see weblink.h for the protocol
+async function connectWebLink() {
+    if (!('WebSocket' in window)) return;
+
+    let info;
+    try {
+        info = await readApiResponse(await fetch('/ws/info'));
+    } catch (error) {
+        setTimeout(connectWebLink, 10000);
+        return;
+    }
+
+    const socket = new WebSocket(`ws://${location.host}${info.path}?token=${info.token}`);
+
+    socket.onopen = () => {
+        webLink = socket;
+        stopStatusUpdates();
+        startListUpdates(30000);    // Only catches edits made from the serial CLI
+        setConnectionStatus(true);
+        console.log('WebSocket link connected');
+    };
+
+    socket.onmessage = (event) => {
+        applyWebLinkState(JSON.parse(event.data));
+    };
+
+    socket.onclose = () => {
+        if (webLink === socket) {
+            webLink = null;
+            startStatusUpdates();
+            startListUpdates(5000);
+        }
+        setTimeout(connectWebLink, 3000);
+    };
+}
+
+function sendWebLink(command) {
+    if (!webLink || webLink.readyState !== WebSocket.OPEN) return false;
+    webLink.send(command);
+    return true;
+}
+
+function applyWebLinkState(state) {
+    if ('mode' in state) {
+        document.getElementById('currentMode').textContent = state.mode;
+        updateModeButtons(state.mode.toLowerCase());
+    }
+    if ('awake' in state) {
+        document.getElementById('systemStatus').textContent = state.awake ? 'AWAKE' : 'SLEEPING';
+    }
+    if ('uptime' in state) {
+        document.getElementById('systemUptime').textContent = formatUptime(state.uptime);
+    }
+    if ('freeMemory' in state) {
+        document.getElementById('freeMemory').textContent = formatMemory(state.freeMemory);
+    }
+    if ('brightness' in state) {
+        document.getElementById('brightnessSlider').value = state.brightness;
+        document.getElementById('brightnessValue').textContent = state.brightness;
+    }
+    if ('volume' in state) {
+        document.getElementById('volumeSlider').value = state.volume;
+        document.getElementById('volumeValue').textContent = state.volume;
+    }
+    if ('playlist' in state || 'sequence' in state) {
+        loadPlaylistStatus();
+    }
+    if ('recording' in state) {
+        if (lastRecording && !state.recording) {
+            loadSequenceList();     // A new recording was just saved
+        }
+        lastRecording = state.recording;
+    }
+}
+
+// Event stream (/events, see webevents.h) - read-only playback progress.
+// EventSource reconnects by itself and resumes with Last-Event-ID.
+function connectEventStream() {
+    if (!('EventSource' in window)) return;
+
+    const events = new EventSource('/events');
+    const status = document.getElementById('playbackStatus');
+
+    const showProgress = (p) => {
+        status.textContent = `\u25B6 ${p.sequence} - frame ${p.frame}/${p.frames} (${p.percent}%)`;
+    };
+
+    events.addEventListener('state', (event) => {
+        const state = JSON.parse(event.data);
+        if (!state.playing) {
+            status.textContent = 'Idle';
+        } else if (state.paused) {
+            status.textContent = `\u23F8 ${state.sequence} (paused)`;
+        } else {
+            showProgress({ sequence: state.sequence, frame: state.frame, frames: state.frames,
+                           percent: state.frames ? Math.floor(state.frame * 100 / state.frames) : 0 });
+        }
+    });
+    events.addEventListener('progress', (event) => {
+        showProgress(JSON.parse(event.data));
+    });
+    events.addEventListener('playback', (event) => {
+        const playback = JSON.parse(event.data);
+        if (playback.state === 'stopped') {
+            status.textContent = 'Idle';
+        } else if (playback.state === 'paused') {
+            status.textContent = `\u23F8 ${playback.sequence} (paused)`;
+        }
+    });
+}
+
+// Hardware gamepad (Gamepad API): left stick drives the eyes, right stick
+// the head. Streams over the WebSocket only, at most 25 updates per second.
+function startGamepadStreaming() {
+    if (!navigator.getGamepads) return;
+
+    let lastSent = '';
+    setInterval(() => {
+        const pad = Array.from(navigator.getGamepads()).find(p => p);
+        if (!pad || !webLink) return;
+
+        const axis = (index) => Math.round(90 + (pad.axes[index] || 0) * 90);
+        const positions = [axis(0), 180 - axis(1), axis(2), 180 - axis(3)];
+        const command = 'S ' + positions.join(' ');
+        if (command !== lastSent && sendWebLink(command)) {
+            lastSent = command;
+            updateServoPositions(...positions);
+        }
+    }, 40);
+}
+
+async function updateStatus() {
+    try {
+        const response = await fetch('/status');
+        if (!response.ok) throw new Error('Network response was not ok');
+        
+        const data = await response.json();
+        
+        // Update status display
+        document.getElementById('currentMode').textContent = data.mode;
+        document.getElementById('systemStatus').textContent = data.awake ? 'AWAKE' : 'SLEEPING';
+        document.getElementById('systemUptime').textContent = formatUptime(data.uptime);
+        document.getElementById('freeMemory').textContent = formatMemory(data.freeMemory);
+        
+        // Update active mode button
+        updateModeButtons(data.mode.toLowerCase());
+        
+        // Update connection status
+        setConnectionStatus(true);
+        
+    } catch (error) {
+        console.error('Status update failed:', error);
+        setConnectionStatus(false);
+    }
+}
+
+// Servo control functions
+async function setServos(eyePan, eyeTilt, headPan, headTilt) {
+    if (sendWebLink(`S ${eyePan} ${eyeTilt} ${headPan} ${headTilt}`)) {
+        updateServoPositions(eyePan, eyeTilt, headPan, headTilt);
+        return;
+    }
+
+    try {
+        showLoading('servo');
+        const response = await fetch(`/setServos?eyePan=${eyePan}&eyeTilt=${eyeTilt}&headPan=${headPan}&headTilt=${headTilt}`);
+        
+        if (response.ok) {
+            updateServoPositions(eyePan, eyeTilt, headPan, headTilt);
+            showFeedback('Servos moved', 'success');
+        } else {
+            throw new Error('Servo command failed');
+        }
+    } catch (error) {
+        showFeedback('Servo error: ' + error.message, 'error');
+    } finally {
+        hideLoading('servo');
+    }
+}
+
+function centerAllServos() {
+    setServos(90, 90, 90, 90);
+}
+
+function updateServoPositions(eyePan, eyeTilt, headPan, headTilt) {
+    document.getElementById('eyePanPos').textContent = eyePan + '°';
+    document.getElementById('eyeTiltPos').textContent = eyeTilt + '°';
+    document.getElementById('headPanPos').textContent = headPan + '°';
+    document.getElementById('headTiltPos').textContent = headTilt + '°';
+}
+
+// LED control functions
+async function setColor(color) {
+    try {
+        showLoading('led');
+        const response = await fetch('/' + color);
+        
+        if (response.ok) {
+            showFeedback('Eye color changed', 'success');
+        } else {
+            throw new Error('Color command failed');
+        }
+    } catch (error) {
+        showFeedback('LED error: ' + error.message, 'error');
+    } finally {
+        hideLoading('led');
+    }
+}
+
+async function setAnimation(animation) {
+    try {
+        showLoading('led');
+        const response = await fetch('/' + animation);
+        
+        if (response.ok) {
+            showFeedback('Animation started', 'success');
+        } else {
+            throw new Error('Animation command failed');
+        }
+    } catch (error) {
+        showFeedback('Animation error: ' + error.message, 'error');
+    } finally {
+        hideLoading('led');
+    }
+}
+
+async function setBrightness(value) {
+    document.getElementById('brightnessValue').textContent = value;
+    if (sendWebLink(`B ${value}`)) return;
+    
+    try {
+        const response = await fetch(`/brightness?value=${value}`);
+        if (!response.ok) throw new Error('Brightness command failed');
+    } catch (error) {
+        showFeedback('Brightness error: ' + error.message, 'error');
+    }
+}
+
+// Audio control functions
+async function setVolume(value) {
+    document.getElementById('volumeValue').textContent = value;
+    if (sendWebLink(`V ${value}`)) return;
+    
+    try {
+        const response = await fetch(`/volume?value=${value}`);
+        if (!response.ok) throw new Error('Volume command failed');
+    } catch (error) {
+        showFeedback('Volume error: ' + error.message, 'error');
+    }
+}
+
+async function playSound(fileNumber) {
+    try {
+        showLoading('audio');
+        const response = await fetch(`/playSound?file=${fileNumber}`);
+        
+        if (response.ok) {
+            showFeedback('Playing sound', 'success');
+        } else {
+            throw new Error('Sound playback failed');
+        }
+    } catch (error) {
+        showFeedback('Audio error: ' + error.message, 'error');
+    } finally {
+        hideLoading('audio');
+    }
+}
+
+// Mode control functions
+async function setMode(mode) {
+    try {
+        showLoading('mode');
+        const response = await fetch(`/mode?mode=${mode}`);
+        
+        if (response.ok) {
+            updateModeButtons(mode);
+            showFeedback('Mode changed to ' + mode.toUpperCase(), 'success');
+        } else {
+            throw new Error('Mode change failed');
+        }
+    } catch (error) {
+        showFeedback('Mode error: ' + error.message, 'error');
+    } finally {
+        hideLoading('mode');
+    }
+}
+
+function updateModeButtons(activeMode) {
+    // Remove active class from all buttons
+    document.querySelectorAll('.mode-btn').forEach(btn => {
+        btn.classList.remove('active');
+    });
+    
+    // Add active class to selected button
+    const activeButton = document.getElementById(activeMode + 'Mode');
+    if (activeButton) {
+        activeButton.classList.add('active');
+    }
+}
+
+// Utility functions
+function formatUptime(seconds) {
+    const hours = Math.floor(seconds / 3600);
+    const minutes = Math.floor((seconds % 3600) / 60);
+    const secs = seconds % 60;
+    return `${hours.toString().padStart(2, '0')}:${minutes.toString().padStart(2, '0')}:${secs.toString().padStart(2, '0')}`;
+}
+
+function formatMemory(bytes) {
+    if (bytes < 1024) return bytes + ' B';
+    if (bytes < 1048576) return Math.round(bytes / 1024) + ' KB';
+    return Math.round(bytes / 1048576) + ' MB';
+}
+
+function setConnectionStatus(connected) {
+    if (connected !== isConnected) {
+        isConnected = connected;
+        const statusElements = document.querySelectorAll('.status-value');
+        statusElements.forEach(el => {
+            el.style.color = connected ? '#4da6ff' : '#ff4757';
+        });
+        
+        if (!connected) {
+            showFeedback('Connection lost - attempting to reconnect...', 'error');
+        } else {
+            showFeedback('Connected to K-2SO', 'success');
+        }
+    }
+}
+
+function showLoading(section) {
+    // Visual feedback for loading state
+    const elements = document.querySelectorAll('.control-section');
+    elements.forEach(el => {
+        if (el.textContent.toLowerCase().includes(section)) {
+            el.classList.add('loading');
+        }
+    });
+}
+
+function hideLoading(section) {
+    const elements = document.querySelectorAll('.control-section');
+    elements.forEach(el => {
+        el.classList.remove('loading');
+    });
+}
+
+function showFeedback(message, type) {
+    // Create temporary feedback element
+    const feedback = document.createElement('div');
+    feedback.textContent = message;
+    feedback.style.cssText = `
+        position: fixed;
+        top: 20px;
+        right: 20px;
+        padding: 15px 25px;
+        border-radius: 8px;
+        color: white;
+        font-weight: bold;
+        z-index: 1000;
+        animation: slideInRight 0.3s ease;
+        background: ${type === 'success' ? '#2ed573' : '#ff4757'};
+        box-shadow: 0 4px 12px rgba(0,0,0,0.3);
+    `;
+    
+    document.body.appendChild(feedback);
+    
+    setTimeout(() => {
+        feedback.style.animation = 'slideOutRight 0.3s ease';
+        setTimeout(() => document.body.removeChild(feedback), 300);
+    }, 3000);
+}
+
+// Add CSS animations for feedback
+const style = document.createElement('style');
+style.textContent = `
+    @keyframes slideInRight {
+        from { transform: translateX(100%); }
+        to { transform: translateX(0); }
+    }
+    @keyframes slideOutRight {
+        from { transform: translateX(0); }
+        to { transform: translateX(100%); }
+    }
+`;
+document.head.appendChild(style);
+
+// Keyboard shortcuts
+document.addEventListener('keydown', function(event) {
+    // Only process if not in an input field
+    if (event.target.tagName === 'INPUT') return;
+    
+    switch(event.key) {
+        case 'c':
+        case 'C':
+            centerAllServos();
+            break;
+        case '1':
+            setMode('scanning');
+            break;
+        case '2':
+            setMode('alert');
+            break;
+        case '3':
+            setMode('idle');
+            break;
+        case 'r':
+        case 'R':
+            setColor('red');
+            break;
+        case 'g':
+        case 'G':
+            setColor('green');
+            break;
+        case 'b':
+        case 'B':
+            setColor('blue');
+            break;
+        case 'w':
+        case 'W':
+            setColor('white');
+            break;
+        case 'ArrowUp':
+            event.preventDefault();
+            setServos(90, 180, 90, 180);
+            break;
+        case 'ArrowDown':
+            event.preventDefault();
+            setServos(90, 0, 90, 0);
+            break;
+        case 'ArrowLeft':
+            event.preventDefault();
+            setServos(0, 90, 0, 90);
+            break;
+        case 'ArrowRight':
+            event.preventDefault();
+            setServos(180, 90, 180, 90);
+            break;
+    }
+});
+
+// Touch/mobile support
+let touchStartX, touchStartY;
+
+document.addEventListener('touchstart', function(e) {
+    touchStartX = e.touches[0].clientX;
+    touchStartY = e.touches[0].clientY;
+});
+
+document.addEventListener('touchend', function(e) {
+    if (!touchStartX || !touchStartY) return;
+    
+    const touchEndX = e.changedTouches[0].clientX;
+    const touchEndY = e.changedTouches[0].clientY;
+    
+    const diffX = touchStartX - touchEndX;
+    const diffY = touchStartY - touchEndY;
+    
+    const minSwipeDistance = 50;
+    
+    if (Math.abs(diffX) > Math.abs(diffY)) {
+        // Horizontal swipe
+        if (Math.abs(diffX) > minSwipeDistance) {
+            if (diffX > 0) {
+                // Swipe left
+                setServos(0, 90, 0, 90);
+            } else {
+                // Swipe right
+                setServos(180, 90, 180, 90);
+            }
+        }
+    } else {
+        // Vertical swipe
+        if (Math.abs(diffY) > minSwipeDistance) {
+            if (diffY > 0) {
+                // Swipe up
+                setServos(90, 180, 90, 180);
+            } else {
+                // Swipe down
+                setServos(90, 0, 90, 0);
+            }
+        }
+    }
+    
+    touchStartX = null;
+    touchStartY = null;
+});
+
+// Detail LED control functions
+async function setDetailCount(value) {
+    document.getElementById('detailCountValue').textContent = value;
+    try {
+        const response = await fetch(`/detailCount?value=${value}`);
+        if (!response.ok) throw new Error('Detail count command failed');
+    } catch (error) {
+        showFeedback('Detail LED error: ' + error.message, 'error');
+    }
+}
+
+async function setDetailBrightness(value) {
+    document.getElementById('detailBrightnessValue').textContent = value;
+    try {
+        const response = await fetch(`/detailBrightness?value=${value}`);
+        if (!response.ok) throw new Error('Detail brightness command failed');
+    } catch (error) {
+        showFeedback('Detail LED error: ' + error.message, 'error');
+    }
+}
+
+async function setDetailPattern(pattern) {
+    try {
+        showLoading('detail');
+        const response = await fetch(`/detailPattern?pattern=${pattern}`);
+        if (response.ok) {
+            showFeedback('Detail LED pattern: ' + pattern.toUpperCase(), 'success');
+        } else {
+            throw new Error('Pattern command failed');
+        }
+    } catch (error) {
+        showFeedback('Detail LED error: ' + error.message, 'error');
+    } finally {
+        hideLoading('detail');
+    }
+}
+
+async function setDetailEnabled(state) {
+    try {
+        const response = await fetch(`/detailEnabled?state=${state}`);
+        if (response.ok) {
+            showFeedback('Detail LEDs: ' + state.toUpperCase(), 'success');
+        } else {
+            throw new Error('Detail enabled command failed');
+        }
+    } catch (error) {
+        showFeedback('Detail LED error: ' + error.message, 'error');
+    }
+}
+
+// ========================================
+// SEQUENCE MANAGEMENT FUNCTIONS
+// ========================================
+
+async function readApiResponse(response) {
+    const contentType = response.headers.get('content-type') || '';
+    let payload = null;
+    let text = '';
+
+    if (contentType.includes('application/json')) {
+        try {
+            payload = await response.json();
+        } catch (error) {
+            payload = null;
+        }
+    } else {
+        text = await response.text();
+    }
+
+    if (!response.ok) {
+        throw new Error((payload && payload.message) || text || 'Request failed');
+    }
+
+    if (payload && payload.ok === false) {
+        throw new Error(payload.message || 'Request failed');
+    }
+
+    return payload || { ok: true, message: text };
+}
+
+function refreshSequenceViews() {
+    setTimeout(() => {
+        loadSequenceList();
+        loadPlaylistStatus();
+        loadIRMappings();
+    }, 400);
+}
+
+// Load and display sequence list
+async function loadSequenceList() {
+    try {
+        const data = await readApiResponse(await fetch('/seq/list'));
+        const listDiv = document.getElementById('sequenceList');
+
+        if (!data.sequences || data.sequences.length === 0) {
+            listDiv.innerHTML = '<div class="empty-message">No sequences available</div>';
+            return;
+        }
+
+        let html = '';
+        data.sequences.forEach(seq => {
+            html += `
+                <div class="sequence-item">
+                    <div class="sequence-name">${escapeHtml(seq.name)}</div>
+                    <div class="sequence-actions">
+                        <button class="btn-small btn-play" onclick="sequencePlay('${escapeHtml(seq.name)}')">▶</button>
+                        <button class="btn-small btn-loop" onclick="sequenceLoop('${escapeHtml(seq.name)}')">🔁</button>
+                        <button class="btn-small btn-add" onclick="playlistAdd('${escapeHtml(seq.name)}')">+</button>
+                        <button class="btn-small btn-control" onclick="sequenceVerify('${escapeHtml(seq.name)}')">V</button>
+                        <button class="btn-small btn-control" onclick="sequenceExport('${escapeHtml(seq.name)}')">E</button>
+                        <button class="btn-small btn-control" onclick="sequenceDuplicatePrompt('${escapeHtml(seq.name)}')">C</button>
+                        <button class="btn-small btn-delete" onclick="sequenceDelete('${escapeHtml(seq.name)}')">🗑️</button>
+                    </div>
+                </div>
+            `;
+        });
+
+        listDiv.innerHTML = html;
+
+    } catch (error) {
+        console.error('Error loading sequences:', error);
+        document.getElementById('sequenceList').innerHTML =
+            '<div class="empty-message">Error loading sequences</div>';
+    }
+}
+
+// Play a sequence
+async function sequencePlay(name) {
+    try {
+        const data = await readApiResponse(await fetch(`/seq/play?name=${encodeURIComponent(name)}`));
+        showFeedback(data.message || `Playing: ${name}`, 'success');
+        refreshSequenceViews();
+    } catch (error) {
+        showFeedback('Error: ' + error.message, 'error');
+    }
+}
+
+// Stop sequence/playlist playback
+async function sequenceStop() {
+    try {
+        const data = await readApiResponse(await fetch('/seq/stop'));
+        showFeedback(data.message || 'Playback stopped', 'success');
+        refreshSequenceViews();
+    } catch (error) {
+        showFeedback('Error: ' + error.message, 'error');
+    }
+}
+
+// Pause playback
+async function sequencePause() {
+    try {
+        const data = await readApiResponse(await fetch('/seq/pause'));
+        showFeedback(data.message || 'Playback paused', 'success');
+        refreshSequenceViews();
+    } catch (error) {
+        showFeedback('Error: ' + error.message, 'error');
+    }
+}
+
+// Resume playback
+async function sequenceResume() {
+    try {
+        const data = await readApiResponse(await fetch('/seq/resume'));
+        showFeedback(data.message || 'Playback resumed', 'success');
+        refreshSequenceViews();
+    } catch (error) {
+        showFeedback('Error: ' + error.message, 'error');
+    }
+}
+
+// Loop a single sequence
+async function sequenceLoop(name) {
+    try {
+        const data = await readApiResponse(await fetch(`/seq/loop?name=${encodeURIComponent(name)}`));
+        showFeedback(data.message || `Looping: ${name}`, 'success');
+        refreshSequenceViews();
+    } catch (error) {
+        showFeedback('Error: ' + error.message, 'error');
+    }
+}
+
+// Delete a sequence
+async function sequenceDelete(name) {
+    if (!confirm(`Delete sequence "${name}"?`)) return;
+
+    try {
+        const data = await readApiResponse(await fetch(`/seq/delete?name=${encodeURIComponent(name)}`));
+        showFeedback(data.message || `Deleted: ${name}`, 'success');
+        refreshSequenceViews();
+    } catch (error) {
+        showFeedback('Error: ' + error.message, 'error');
+    }
+}
+
+async function sequenceImport() {
+    const input = document.createElement('input');
+    input.type = 'file';
+    input.accept = '.json,.seq,application/json,text/plain';
+    input.onchange = async event => {
+        const file = event.target.files && event.target.files[0];
+        if (!file) return;
+
+        try {
+            const payload = await file.text();
+            const data = await readApiResponse(await fetch('/seq/import', {
+                method: 'POST',
+                headers: { 'Content-Type': 'text/plain;charset=utf-8' },
+                body: payload
+            }));
+            showFeedback(data.message || 'Sequence imported', 'success');
+            refreshSequenceViews();
+        } catch (error) {
+            showFeedback('Error: ' + error.message, 'error');
+        }
+    };
+    input.click();
+}
+
+async function sequenceVerify(name) {
+    try {
+        const data = await readApiResponse(await fetch(`/seq/verify?name=${encodeURIComponent(name)}`));
+        alert(
+            `Sequence verified\n\n` +
+            `Name: ${data.name}\n` +
+            `Declared frames: ${data.declaredFrames}\n` +
+            `Actual frames: ${data.actualFrames}\n` +
+            `Duration: ${((data.durationMs || 0) / 1000).toFixed(2)} s\n` +
+            `Version: ${data.version}\n` +
+            `File size: ${data.fileSize} bytes`
+        );
+        showFeedback(data.message || `Verified: ${name}`, 'success');
+    } catch (error) {
+        showFeedback('Error: ' + error.message, 'error');
+    }
+}
+
+async function sequenceVerifyAll() {
+    try {
+        const data = await readApiResponse(await fetch('/seq/verify-all'));
+        alert(
+            `Verify All\n\n` +
+            `OK: ${data.okCount}\n` +
+            `Failed: ${data.failCount}\n\n` +
+            `${data.report || ''}`
+        );
+        showFeedback(data.message || 'All sequences verified', 'success');
+    } catch (error) {
+        showFeedback('Error: ' + error.message, 'error');
+    }
+}
+
+async function showSequenceStats() {
+    try {
+        const data = await readApiResponse(await fetch('/seq/stats'));
+        alert(
+            `Sequence Storage Stats\n\n` +
+            `Sequences: ${data.sequenceCount}\n` +
+            `Saved playlists: ${data.playlistCount}\n` +
+            `Total bytes: ${data.totalBytes}\n` +
+            `Used bytes: ${data.usedBytes}\n` +
+            `Free bytes: ${data.freeBytes}\n` +
+            `Largest sequence: ${data.largestSequenceName || 'n/a'}\n` +
+            `Largest sequence bytes: ${data.largestSequenceBytes}`
+        );
+    } catch (error) {
+        showFeedback('Error: ' + error.message, 'error');
+    }
+}
+
+async function sequenceExport(name) {
+    try {
+        const response = await fetch(`/seq/export?name=${encodeURIComponent(name)}`);
+        if (!response.ok) {
+            await readApiResponse(response);
+            return;
+        }
+
+        const jsonText = await response.text();
+        const blob = new Blob([jsonText], { type: 'application/json' });
+        const url = URL.createObjectURL(blob);
+        const link = document.createElement('a');
+        link.href = url;
+        link.download = `${name}.json`;
+        document.body.appendChild(link);
+        link.click();
+        link.remove();
+        URL.revokeObjectURL(url);
+        showFeedback(`Exported sequence: ${name}`, 'success');
+    } catch (error) {
+        showFeedback('Error: ' + error.message, 'error');
+    }
+}
+
+async function sequenceDuplicatePrompt(sourceName) {
+    const targetName = prompt(`Duplicate "${sourceName}" as:`, `${sourceName}_copy`);
+    if (targetName === null) return;
+
+    const trimmed = targetName.trim();
+    if (!trimmed) {
+        showFeedback('Error: target name is required', 'error');
+        return;
+    }
+
+    try {
+        const data = await readApiResponse(await fetch(`/seq/duplicate?source=${encodeURIComponent(sourceName)}&target=${encodeURIComponent(trimmed)}`));
+        showFeedback(data.message || 'Sequence duplicated', 'success');
+        refreshSequenceViews();
+    } catch (error) {
+        showFeedback('Error: ' + error.message, 'error');
+    }
+}
+
+async function playlistSavePrompt() {
+    const playlistName = prompt('Save current playlist as:', 'show_a');
+    if (playlistName === null) return;
+
+    const trimmed = playlistName.trim();
+    if (!trimmed) return;
+
+    try {
+        const data = await readApiResponse(await fetch(`/seq/playlist/save?name=${encodeURIComponent(trimmed)}`));
+        showFeedback(data.message || 'Playlist saved', 'success');
+        refreshSequenceViews();
+    } catch (error) {
+        showFeedback('Error: ' + error.message, 'error');
+    }
+}
+
+async function playlistLoadPrompt() {
+    try {
+        const listData = await readApiResponse(await fetch('/seq/playlist/list'));
+        const available = (listData.playlists || []).map(item => item.name);
+        const suggested = available.length > 0 ? available[0] : 'show_a';
+        const message = available.length > 0
+            ? `Load which playlist?\nAvailable: ${available.join(', ')}`
+            : 'Load which playlist?';
+        const playlistName = prompt(message, suggested);
+        if (playlistName === null) return;
+
+        const trimmed = playlistName.trim();
+        if (!trimmed) return;
+
+        const data = await readApiResponse(await fetch(`/seq/playlist/load?name=${encodeURIComponent(trimmed)}`));
+        showFeedback(data.message || 'Playlist loaded', 'success');
+        refreshSequenceViews();
+    } catch (error) {
+        showFeedback('Error: ' + error.message, 'error');
+    }
+}
+
+// Add sequence to playlist
+async function playlistAdd(name) {
+    try {
+        const data = await readApiResponse(await fetch(`/seq/playlist/add?name=${encodeURIComponent(name)}`));
+        showFeedback(data.message || `Added to playlist: ${name}`, 'success');
+        refreshSequenceViews();
+    } catch (error) {
+        showFeedback('Error: ' + error.message, 'error');
+    }
+}
+
+async function playlistRemove(index) {
+    try {
+        const data = await readApiResponse(await fetch(`/seq/playlist/remove?index=${index}`));
+        showFeedback(data.message || 'Playlist item removed', 'success');
+        refreshSequenceViews();
+    } catch (error) {
+        showFeedback('Error: ' + error.message, 'error');
+    }
+}
+
+async function playlistMove(fromIndex, toIndex) {
+    try {
+        const data = await readApiResponse(await fetch(`/seq/playlist/move?from=${fromIndex}&to=${toIndex}`));
+        showFeedback(data.message || 'Playlist reordered', 'success');
+        refreshSequenceViews();
+    } catch (error) {
+        showFeedback('Error: ' + error.message, 'error');
+    }
+}
+
+// Clear playlist
+async function playlistClear() {
+    try {
+        const data = await readApiResponse(await fetch('/seq/playlist/clear'));
+        showFeedback(data.message || 'Playlist cleared', 'success');
+        refreshSequenceViews();
+    } catch (error) {
+        showFeedback('Error: ' + error.message, 'error');
+    }
+}
+
+// Play playlist
+async function playlistPlay() {
+    try {
+        const data = await readApiResponse(await fetch('/seq/playlist/play'));
+        showFeedback(data.message || 'Playing playlist', 'success');
+        refreshSequenceViews();
+    } catch (error) {
+        showFeedback('Error: ' + error.message, 'error');
+    }
+}
+
+// Play playlist with loop
+async function playlistLoop() {
+    try {
+        const data = await readApiResponse(await fetch('/seq/playlist/loop'));
+        showFeedback(data.message || 'Looping playlist', 'success');
+        refreshSequenceViews();
+    } catch (error) {
+        showFeedback('Error: ' + error.message, 'error');
+    }
+}
+
+// Load playlist status
+async function loadPlaylistStatus() {
+    try {
+        const data = await readApiResponse(await fetch('/seq/playlist/get'));
+        const infoDiv = document.getElementById('playlistInfo');
+
+        if (!data.sequences || data.sequences.length === 0) {
+            infoDiv.innerHTML =
+                'No sequences in playlist<br><br>' +
+                '<button class="btn-small btn-control" onclick="playlistSavePrompt()">Save</button> ' +
+                '<button class="btn-small btn-control" onclick="playlistLoadPrompt()">Load</button>';
+            return;
+        }
+
+        let html = `<strong>${data.count} sequence(s):</strong><br>`;
+        data.sequences.forEach((seq, index) => {
+            const isCurrent = (data.active && index === data.currentIndex);
+            html += `<span style="${isCurrent ? 'color: #2ed573; font-weight: bold;' : ''}">
+                ${isCurrent ? '▶ ' : '• '}${escapeHtml(seq)}
+            </span><br>`;
+            html += `
+                <span style="display:inline-flex;gap:4px;margin:0 0 8px 0;">
+                    <button class="btn-small btn-control" onclick="playlistMove(${index + 1}, ${index})" ${index === 0 ? 'disabled' : ''}>Up</button>
+                    <button class="btn-small btn-control" onclick="playlistMove(${index + 1}, ${index + 2})" ${index === data.sequences.length - 1 ? 'disabled' : ''}>Down</button>
+                    <button class="btn-small btn-delete" onclick="playlistRemove(${index + 1})">Remove</button>
+                </span><br>
+            `;
+        });
+
+        if (data.active) {
+            html += `<br><span style="color: #4da6ff;">Status: Playing</span>`;
+        }
+
+        html += '<br><button class="btn-small btn-control" onclick="playlistSavePrompt()">Save</button> ';
+        html += '<button class="btn-small btn-control" onclick="playlistLoadPrompt()">Load</button>';
+
+        infoDiv.innerHTML = html;
+
+    } catch (error) {
+        console.error('Error loading playlist:', error);
+    }
+}
+
+// Load IR mappings
+async function loadIRMappings() {
+    try {
+        const data = await readApiResponse(await fetch('/seq/map/list'));
+        const listDiv = document.getElementById('irMappingList');
+
+        if (!data.mappings || data.mappings.length === 0) {
+            listDiv.innerHTML = '<div class="empty-message">No IR buttons configured</div>';
+            return;
+        }
+
+        let html = '';
+        data.mappings.forEach(mapping => {
+            const mappedLabel = mapping.sequence && mapping.sequence.length > 0 ? mapping.sequence : 'Unmapped';
+            html += `
+                <div class="ir-mapping-item">
+                    <div class="ir-button-name">${escapeHtml(mapping.button)}</div>
+                    <div class="ir-sequence-name">${escapeHtml(mappedLabel)}</div>
+                    <button class="btn-small btn-control" onclick="irMapSetPrompt('${escapeHtml(mapping.button)}', '${escapeHtml(mapping.sequence || '')}')">Map</button>
+                    <button class="btn-small btn-delete" onclick="irMapClear('${escapeHtml(mapping.button)}')">✕</button>
+                </div>
+            `;
+        });
+
+        listDiv.innerHTML = html;
+
+    } catch (error) {
+        console.error('Error loading IR mappings:', error);
+        document.getElementById('irMappingList').innerHTML =
+            '<div class="empty-message">Error loading IR mappings</div>';
+    }
+}
+
+// Clear IR mapping
+async function irMapClear(buttonName) {
+    if (!confirm(`Clear mapping for button "${buttonName}"?`)) return;
+
+    try {
+        const data = await readApiResponse(await fetch(`/seq/map/clear?button=${encodeURIComponent(buttonName)}`));
+        showFeedback(data.message || `Cleared mapping for: ${buttonName}`, 'success');
+        refreshSequenceViews();
+    } catch (error) {
+        showFeedback('Error: ' + error.message, 'error');
+    }
+}
+
+async function irMapSetPrompt(buttonName, currentSequence = '') {
+    const nextSequence = prompt(`Map button "${buttonName}" to which sequence? Leave blank to cancel.`, currentSequence || '');
+    if (nextSequence === null) return;
+
+    const trimmed = nextSequence.trim();
+    if (!trimmed) return;
+
+    try {
+        const data = await readApiResponse(await fetch(`/seq/map/set?button=${encodeURIComponent(buttonName)}&sequence=${encodeURIComponent(trimmed)}`));
+        showFeedback(data.message || `Mapped ${buttonName}`, 'success');
+        refreshSequenceViews();
+    } catch (error) {
+        showFeedback('Error: ' + error.message, 'error');
+    }
+}
+
+// HTML escape utility
+function escapeHtml(text) {
+    const map = {
+        '&': '&amp;',
+        '<': '&lt;',
+        '>': '&gt;',
+        '"': '&quot;',
+        "'": '&#039;'
+    };
+    return String(text).replace(/[&<>"']/g, m => map[m]);
+}
+
+console.log('K-2SO Controller ready. Use keyboard shortcuts: C=center, 1/2/3=modes, R/G/B/W=colors, arrows=movement');